@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** Benchmark helpers
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+namespace bench {
+
+    /**
+     * @brief Prevent the optimizer from discarding a computed value.
+     *
+     * On GCC/Clang this is also a compiler barrier: passing a pointer makes
+     * the pointed data opaque, so reading it cannot be hoisted out of the
+     * timed region.
+     *
+     * @param value Value to keep alive.
+     */
+    template <typename T>
+    inline void do_not_optimize(T const &value)
+    {
+#if defined(__GNUC__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static_cast<void>(*static_cast<volatile T const *>(&value));
+#endif
+    }
+
+    /**
+     * @brief Run a callable several times and return the median duration.
+     * @param runs Number of timed runs (after one warm-up run).
+     * @param fn Callable to measure.
+     * @return Median run time in microseconds.
+     */
+    template <typename Fn>
+    double median_us(std::size_t runs, Fn &&fn)
+    {
+        std::vector<double> samples;
+        samples.reserve(runs);
+        fn();
+        for (std::size_t i = 0; i < runs; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto stop = std::chrono::steady_clock::now();
+            samples.push_back(std::chrono::duration<double, std::micro>(stop - start).count());
+        }
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+
+    /**
+     * @brief Print one result row: label, input size and timings.
+     */
+    inline void report(const char *label, std::size_t n, double baseline_us, double candidate_us)
+    {
+        std::printf("%-28s n=%-8zu baseline=%10.2f us  candidate=%10.2f us  speedup=x%.2f\n",
+            label, n, baseline_us, candidate_us, candidate_us > 0.0 ? baseline_us / candidate_us : 0.0);
+    }
+
+} // namespace bench
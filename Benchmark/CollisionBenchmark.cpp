@@ -0,0 +1,264 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** Server collision checks: all pairs vs uniform grid broadphase
+*/
+
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "BenchUtils.hpp"
+#include "SpatialGrid.hpp"
+#include "registry.hpp"
+
+namespace {
+    constexpr std::size_t RUNS = 21;
+    constexpr std::size_t TICKS = 120;
+    constexpr float DT = 0.016f;
+    constexpr float SCREEN_W = 1920.f;
+    constexpr float SCREEN_H = 1080.f;
+    constexpr float PLAYER_SIZE = 30.f;
+    constexpr float PROJ_WIDTH = 10.f;
+    constexpr float PROJ_HEIGHT = 5.f;
+
+    constexpr std::uint32_t LAYER_ENEMY = 1u << 0;
+
+    struct Position { float x, y; };
+    struct CollisionBox { float width, height; };
+    struct Health { int current; };
+
+    struct Shot { float x, y, vx, vy; };
+
+    /**
+     * @brief One recorded tick, laid out like ServerGame's state: enemy positions
+     *        to replay into the registry, projectiles and players in hash maps.
+     */
+    struct Frame {
+        std::vector<Position> enemies;
+        std::unordered_map<uint32_t, Shot> shots;
+        std::unordered_map<uint32_t, std::pair<float, float>> players;
+    };
+
+    /**
+     * @brief Record a dense wave: enemies drifting in formation from the right
+     *        while every player fires a minigun (12 shots/s).
+     */
+    std::vector<Frame> record_wave(std::size_t enemyCount, std::size_t playerCount)
+    {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> jitter(-1.f, 1.f);
+        std::vector<Position> enemies;
+        std::vector<Position> enemyVel;
+        std::vector<Shot> shots;
+
+        for (std::size_t i = 0; i < enemyCount; ++i) {
+            float x = SCREEN_W * 0.55f + static_cast<float>(i % 10) * 80.f;
+            float y = 60.f + static_cast<float>((i / 10) % 14) * 70.f + jitter(rng) * 10.f;
+            enemies.push_back({x, y});
+            enemyVel.push_back({-60.f, jitter(rng) * 40.f});
+        }
+
+        std::vector<Frame> frames;
+        float shotTimer = 0.f;
+        for (std::size_t t = 0; t < TICKS; ++t) {
+            shotTimer += DT;
+            while (shotTimer >= 1.f / 12.f) {
+                shotTimer -= 1.f / 12.f;
+                for (std::size_t p = 0; p < playerCount; ++p) {
+                    float y = SCREEN_H * static_cast<float>(p + 1) / static_cast<float>(playerCount + 1);
+                    shots.push_back({220.f, y + jitter(rng) * 8.f, 900.f, 0.f});
+                }
+            }
+            for (std::size_t i = 0; i < enemies.size(); ++i) {
+                enemies[i].x += enemyVel[i].x * DT;
+                enemies[i].y += enemyVel[i].y * DT;
+            }
+            for (auto &s : shots)
+                s.x += s.vx * DT;
+            std::erase_if(shots, [](Shot const &s) { return s.x > SCREEN_W + 50.f; });
+
+            Frame frame;
+            frame.enemies = enemies;
+            uint32_t id = 1;
+            for (auto const &s : shots)
+                frame.shots.emplace(id++, s);
+            for (std::size_t p = 0; p < playerCount; ++p) {
+                float y = SCREEN_H * static_cast<float>(p + 1) / static_cast<float>(playerCount + 1);
+                frame.players.emplace(static_cast<uint32_t>(p + 1), std::make_pair(200.f + static_cast<float>(t) * 8.f, y));
+            }
+            frames.push_back(std::move(frame));
+        }
+        return frames;
+    }
+
+    /**
+     * @brief Server-side world: enemy entities whose positions are replayed each tick.
+     */
+    struct World {
+        ecs::registry reg;
+        std::vector<ecs::entity_t> enemies;
+        physics::uniform_grid grid{-128.f, -128.f, SCREEN_W + 256.f, SCREEN_H + 256.f, 64.f};
+        std::vector<ecs::entity_t> gridEntities;
+
+        explicit World(std::size_t enemyCount)
+        {
+            reg.register_component<Position>();
+            reg.register_component<CollisionBox>();
+            reg.register_component<Health>();
+            for (std::size_t i = 0; i < enemyCount; ++i) {
+                auto e = reg.spawn_entity();
+                reg.add_component<Position>(e, {0.f, 0.f});
+                reg.add_component<CollisionBox>(e, {30.f, 30.f});
+                reg.add_component<Health>(e, {1000});
+                enemies.push_back(e);
+            }
+        }
+
+        void load(Frame const &f)
+        {
+            auto &positions = reg.get_components<Position>();
+            for (std::size_t i = 0; i < enemies.size(); ++i)
+                *positions[static_cast<std::size_t>(enemies[i])] = f.enemies[i];
+        }
+    };
+
+    template <typename Component>
+    Component *component_ptr(ecs::sparse_array<Component> &arr, ecs::entity_t entity)
+    {
+        auto idx = static_cast<std::size_t>(entity);
+        if (idx >= arr.size() || !arr[idx])
+            return nullptr;
+        return &*arr[idx];
+    }
+
+    physics::aabb box_of(Position const &pos, CollisionBox const &box)
+    {
+        return physics::aabb::from_center(pos.x, pos.y, box.width, box.height);
+    }
+
+    /**
+     * @brief Projectile -> enemy and player -> enemy checks as ServerGame ran
+     *        them before the broadphase: every pair, component lookups per pair.
+     */
+    std::size_t all_pairs(World &w, Frame const &f)
+    {
+        auto &positions = w.reg.get_components<Position>();
+        auto &boxes = w.reg.get_components<CollisionBox>();
+        auto &healths = w.reg.get_components<Health>();
+        std::size_t hits = 0;
+
+        for (auto const &[id, s] : f.shots) {
+            auto shot = physics::aabb::from_center(s.x, s.y, PROJ_WIDTH, PROJ_HEIGHT);
+            for (auto enemy : w.enemies) {
+                auto pos = component_ptr(positions, enemy);
+                auto hp = component_ptr(healths, enemy);
+                auto box = component_ptr(boxes, enemy);
+                if (pos && hp && box && shot.overlaps(box_of(*pos, *box))) {
+                    ++hits;
+                    break;
+                }
+            }
+        }
+        for (auto const &[pid, p] : f.players) {
+            auto player = physics::aabb::from_center(p.first, p.second, PLAYER_SIZE, PLAYER_SIZE);
+            for (auto enemy : w.enemies) {
+                auto pos = component_ptr(positions, enemy);
+                auto box = component_ptr(boxes, enemy);
+                if (pos && box && player.overlaps(box_of(*pos, *box))) {
+                    ++hits;
+                    break;
+                }
+            }
+        }
+        return hits;
+    }
+
+    /**
+     * @brief The same checks through a grid rebuilt once for the tick, as rebuild_broadphase() does.
+     */
+    std::size_t broadphase(World &w, Frame const &f)
+    {
+        auto &positions = w.reg.get_components<Position>();
+        auto &boxes = w.reg.get_components<CollisionBox>();
+        auto &healths = w.reg.get_components<Health>();
+
+        w.grid.clear();
+        w.gridEntities.clear();
+        for (auto enemy : w.enemies) {
+            auto pos = component_ptr(positions, enemy);
+            auto box = component_ptr(boxes, enemy);
+            if (!pos || !box)
+                continue;
+            w.grid.insert(static_cast<uint32_t>(w.gridEntities.size()), box_of(*pos, *box), LAYER_ENEMY);
+            w.gridEntities.push_back(enemy);
+        }
+        w.grid.build();
+
+        std::size_t hits = 0;
+        for (auto const &[id, s] : f.shots) {
+            bool hit = false;
+            w.grid.query(physics::aabb::from_center(s.x, s.y, PROJ_WIDTH, PROJ_HEIGHT), LAYER_ENEMY,
+                [&](uint32_t k, physics::aabb const &) { hit = hit || component_ptr(healths, w.gridEntities[k]); });
+            hits += hit ? 1 : 0;
+        }
+        for (auto const &[pid, p] : f.players) {
+            bool hit = false;
+            w.grid.query(physics::aabb::from_center(p.first, p.second, PLAYER_SIZE, PLAYER_SIZE), LAYER_ENEMY,
+                [&](uint32_t, physics::aabb const &) { hit = true; });
+            hits += hit ? 1 : 0;
+        }
+        return hits;
+    }
+
+    template <typename Check>
+    double replay(World &w, std::vector<Frame> const &frames, Check check)
+    {
+        return bench::median_us(RUNS, [&]() {
+            std::size_t hits = 0;
+            for (auto const &f : frames) {
+                w.load(f);
+                hits += check(w, f);
+            }
+            bench::do_not_optimize(hits);
+        });
+    }
+
+    void run(std::size_t enemies, std::size_t players)
+    {
+        auto frames = record_wave(enemies, players);
+        World world(enemies);
+
+        std::size_t expected = 0;
+        std::size_t got = 0;
+        for (auto const &f : frames) {
+            world.load(f);
+            expected += all_pairs(world, f);
+            got += broadphase(world, f);
+        }
+        if (expected != got)
+            std::printf("MISMATCH: all pairs found %zu hits, broadphase %zu\n", expected, got);
+
+        double load = replay(world, frames, [](World &, Frame const &) { return std::size_t{0}; });
+        double naive = replay(world, frames, all_pairs);
+        double grid = replay(world, frames, broadphase);
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "%zu enemies, %zu players", enemies, players);
+        bench::report(label, TICKS, (naive - load) / TICKS, (grid - load) / TICKS);
+        std::printf("  (%zu hits over the wave, %zu shots in flight in the last tick)\n",
+            expected, frames.back().shots.size());
+    }
+}
+
+int main()
+{
+    std::printf("collision time per tick over a %zu-tick wave: baseline = all pairs, candidate = uniform grid"
+        " (median of %zu replays)\n", TICKS, RUNS);
+    run(70, 4);
+    run(200, 4);
+    run(500, 4);
+    return 0;
+}
@@ -0,0 +1,137 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** Projectile update: unordered_map vs SoA projectile pool
+*/
+
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "BenchUtils.hpp"
+#include "ProjectilePool.hpp"
+
+namespace {
+    constexpr std::size_t RUNS = 31;
+    constexpr std::size_t TICKS = 60;
+    constexpr float DT = 0.016f;
+    constexpr physics::aabb BOUNDS{-50.f, -50.f, 1970.f, 1130.f};
+
+    /**
+     * @brief Per-projectile state as ServerGame stored it before the pool.
+     */
+    struct ProjectileState {
+        float x, y, z, vx, vy, vz;
+        uint32_t ownerId;
+        float damage, width, height;
+    };
+
+    /**
+     * @brief Spawn positions and velocities, replayed identically by both versions.
+     */
+    std::vector<physics::projectile> make_spawns(std::size_t count)
+    {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> x(-40.f, 1960.f);
+        std::uniform_real_distribution<float> y(-40.f, 1120.f);
+        std::uniform_real_distribution<float> v(-900.f, 900.f);
+        std::vector<physics::projectile> spawns;
+        spawns.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            spawns.push_back({x(rng), y(rng), v(rng), v(rng) * 0.2f, 1, 1.f, 10.f, 5.f});
+        return spawns;
+    }
+
+    /**
+     * @brief Old update: walk the map, collect out-of-bounds ids, erase them one by one.
+     *        Culled projectiles are respawned to keep the live count steady.
+     */
+    std::size_t tick_map(std::unordered_map<uint32_t, ProjectileState> &projectiles, uint32_t &nextId,
+                         std::vector<physics::projectile> const &spawns, std::size_t &cursor)
+    {
+        std::vector<uint32_t> toRemove;
+        for (auto &kv : projectiles) {
+            ProjectileState &state = kv.second;
+            state.x += state.vx * DT;
+            state.y += state.vy * DT;
+            state.z += state.vz * DT;
+            if (state.x < BOUNDS.left || state.x > BOUNDS.right || state.y < BOUNDS.top || state.y > BOUNDS.bottom)
+                toRemove.push_back(kv.first);
+        }
+        for (uint32_t id : toRemove)
+            projectiles.erase(id);
+        for (std::size_t i = 0; i < toRemove.size(); ++i) {
+            auto const &p = spawns[cursor++ % spawns.size()];
+            projectiles[nextId++] = ProjectileState{p.x, p.y, 0.f, p.vx, p.vy, 0.f, p.owner, p.damage, p.width, p.height};
+        }
+        return toRemove.size();
+    }
+
+    std::size_t tick_pool(physics::projectile_pool &pool, std::vector<physics::projectile> const &spawns,
+                          std::size_t &cursor)
+    {
+        pool.integrate(DT);
+        std::size_t removed = pool.cull(BOUNDS, [](physics::projectile_pool::handle) {});
+        for (std::size_t i = 0; i < removed; ++i)
+            pool.spawn(spawns[cursor++ % spawns.size()]);
+        return removed;
+    }
+
+    void run(std::size_t live)
+    {
+        auto spawns = make_spawns(live * 8);
+
+        std::unordered_map<uint32_t, ProjectileState> map;
+        uint32_t nextId = 1;
+        physics::projectile_pool pool;
+        for (std::size_t i = 0; i < live; ++i) {
+            auto const &p = spawns[i];
+            map[nextId++] = ProjectileState{p.x, p.y, 0.f, p.vx, p.vy, 0.f, p.owner, p.damage, p.width, p.height};
+            pool.spawn(p);
+        }
+        std::size_t mapCursor = live;
+        std::size_t poolCursor = live;
+
+        double mapUs = bench::median_us(RUNS, [&]() {
+            std::size_t removed = 0;
+            for (std::size_t t = 0; t < TICKS; ++t)
+                removed += tick_map(map, nextId, spawns, mapCursor);
+            bench::do_not_optimize(removed);
+        });
+        double poolUs = bench::median_us(RUNS, [&]() {
+            std::size_t removed = 0;
+            for (std::size_t t = 0; t < TICKS; ++t)
+                removed += tick_pool(pool, spawns, poolCursor);
+            bench::do_not_optimize(removed);
+        });
+        bench::report("update + cull + respawn", live, mapUs / TICKS, poolUs / TICKS);
+
+        double scalarUs = bench::median_us(RUNS, [&]() {
+            for (std::size_t t = 0; t < TICKS; ++t) {
+                pool.integrate_scalar(DT);
+                bench::do_not_optimize(pool.xs().data());
+            }
+        });
+#ifdef PHYSICS_PROJECTILE_SSE
+        double sseUs = bench::median_us(RUNS, [&]() {
+            for (std::size_t t = 0; t < TICKS; ++t) {
+                pool.integrate_sse(DT);
+                bench::do_not_optimize(pool.xs().data());
+            }
+        });
+        bench::report("integrate: auto vs SSE2", live, scalarUs / TICKS, sseUs / TICKS);
+#else
+        std::printf("integrate only               n=%-8zu %10.2f us (SSE2 path disabled)\n", live, scalarUs / TICKS);
+#endif
+    }
+}
+
+int main()
+{
+    std::printf("time per tick: baseline = unordered_map<uint32_t, ProjectileState>, candidate = projectile_pool"
+        " (median of %zu runs of %zu ticks)\n", RUNS, TICKS);
+    for (std::size_t live : {1000u, 10000u, 50000u})
+        run(live);
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** Full registry sync: JSON text vs binary snapshot
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "BenchUtils.hpp"
+#include "entity_storage.hpp"
+#include "registry_snapshot.hpp"
+#include "serializer.hpp"
+
+namespace {
+    constexpr std::size_t RUNS = 21;
+
+    /**
+     * @brief Registers the components ServerGame registers, in the same order.
+     */
+    void register_server_components(ecs::registry &reg)
+    {
+        reg.register_component<component::position>();
+        reg.register_component<component::previous_position>();
+        reg.register_component<component::velocity>();
+        reg.register_component<component::rotation>();
+        reg.register_component<component::scale>();
+        reg.register_component<component::dynamic_position>();
+        reg.register_component<component::drawable>();
+        reg.register_component<component::sprite>();
+        reg.register_component<component::model3D>();
+        reg.register_component<component::audio>();
+        reg.register_component<component::text>();
+        reg.register_component<component::font>();
+        reg.register_component<component::clickable>();
+        reg.register_component<component::hoverable>();
+        reg.register_component<component::controllable>();
+        reg.register_component<component::health>();
+        reg.register_component<component::damage>();
+        reg.register_component<component::collision_box>();
+        reg.register_component<component::hitbox_link>();
+        reg.register_component<component::type>();
+        reg.register_component<component::client_id>();
+        reg.register_component<component::pattern_element>();
+    }
+
+    /**
+     * @brief The previous path: FullRegistry JSON built by serialize_entity(), dumped as text.
+     */
+    std::string encode_json(ecs::registry &reg)
+    {
+        nlohmann::json root;
+        root["type"] = "FullRegistry";
+        root["entities"] = nlohmann::json::array();
+        for (auto entity : reg.alive_entities()) {
+            auto j = game::serializer::serialize_entity(reg, entity);
+            if (!j.empty())
+                root["entities"].push_back(j);
+        }
+        return root.dump();
+    }
+
+    void run(const char *name)
+    {
+        std::string path = std::string(ASSETS_PATH "/Config_assets/Levels/") + name + ".json";
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            std::printf("%-8s cannot open %s\n", name, path.c_str());
+            return;
+        }
+        nlohmann::json level;
+        file >> level;
+
+        ecs::registry server;
+        register_server_components(server);
+        game::storage::store_level_entities(server, level);
+
+        std::string text = encode_json(server);
+        std::vector<uint8_t> binary = game::serializer::encode_snapshot(server);
+        std::printf("%-8s entities=%-4zu json=%7zu B  binary=%7zu B  (x%.2f smaller)\n",
+            name, server.alive_entities().size(), text.size(), binary.size(),
+            static_cast<double>(text.size()) / static_cast<double>(binary.size()));
+
+        double jsonEncodeUs = bench::median_us(RUNS, [&] {
+            bench::do_not_optimize(encode_json(server).size());
+        });
+        double binaryEncodeUs = bench::median_us(RUNS, [&] {
+            bench::do_not_optimize(game::serializer::encode_snapshot(server).size());
+        });
+        bench::report("  encode json vs binary", server.alive_entities().size(), jsonEncodeUs, binaryEncodeUs);
+
+        double jsonDecodeUs = bench::median_us(RUNS, [&] {
+            ecs::registry client;
+            register_server_components(client);
+            game::serializer::deserialize_entities(client, nlohmann::json::parse(text));
+            bench::do_not_optimize(client.alive_entities().size());
+        });
+        double binaryDecodeUs = bench::median_us(RUNS, [&] {
+            ecs::registry client;
+            register_server_components(client);
+            auto snapshot = game::serializer::decode_snapshot(binary.data(), binary.size());
+            if (snapshot)
+                game::serializer::restore_snapshot(client, *snapshot);
+            bench::do_not_optimize(client.alive_entities().size());
+        });
+        bench::report("  decode json vs binary", server.alive_entities().size(), jsonDecodeUs, binaryDecodeUs);
+    }
+}
+
+int main()
+{
+    std::printf("Full registry sent on level load, built from the level files\n");
+    run("level_01");
+    run("level_02");
+    run("level_03");
+    return 0;
+}
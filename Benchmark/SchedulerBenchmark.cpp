@@ -0,0 +1,116 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** Sequential vs parallel run_systems micro-benchmark
+*/
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "BenchUtils.hpp"
+#include "registry.hpp"
+
+namespace {
+    struct Position { float x, y, z; };
+    struct Velocity { float vx, vy, vz; };
+    struct Health { float current, regen; };
+    struct Animation { float time, frame; };
+    struct Emitter { float timer, rate; };
+
+    constexpr std::size_t RUNS = 31;
+    constexpr float DT = 0.016f;
+
+    /**
+     * @brief Per-component work heavy enough to resemble a real system.
+     */
+    float churn(float value)
+    {
+        for (int i = 0; i < 16; ++i)
+            value = std::sqrt(value * value + 1.f) - 0.5f;
+        return value;
+    }
+
+    /**
+     * @brief Register a frame made of four systems on disjoint data, the
+     *        shape of the client's movement / health / render-prep systems.
+     */
+    void populate(ecs::registry &reg, std::size_t n, std::size_t workers)
+    {
+        reg.set_system_workers(workers);
+        reg.register_component<Position>();
+        reg.register_component<Velocity>();
+        reg.register_component<Health>();
+        reg.register_component<Animation>();
+        reg.register_component<Emitter>();
+        for (std::size_t i = 0; i < n; ++i) {
+            auto e = reg.spawn_entity();
+            float f = static_cast<float>(i);
+            reg.add_component<Position>(e, {f, f, 0.f});
+            reg.add_component<Velocity>(e, {1.f, 2.f, 0.f});
+            reg.add_component<Health>(e, {100.f, 0.1f});
+            reg.add_component<Animation>(e, {0.f, 0.f});
+            reg.add_component<Emitter>(e, {0.f, 2.f});
+        }
+
+        reg.add_system(ecs::reads<Velocity>{}, ecs::writes<Position>{},
+            [](ecs::registry &, ecs::sparse_array<Velocity> const &vel, ecs::sparse_array<Position> &pos) {
+                for (std::size_t i = 0; i < pos.size(); ++i)
+                    if (pos[i] && vel[i])
+                        pos[i]->x = churn(pos[i]->x + vel[i]->vx * DT);
+            });
+        reg.add_system(ecs::reads<>{}, ecs::writes<Health>{},
+            [](ecs::registry &, ecs::sparse_array<Health> &hp) {
+                for (auto &h : hp)
+                    if (h)
+                        h->current = churn(h->current + h->regen * DT);
+            });
+        reg.add_system(ecs::reads<>{}, ecs::writes<Animation>{},
+            [](ecs::registry &, ecs::sparse_array<Animation> &anim) {
+                for (auto &a : anim)
+                    if (a)
+                        a->frame = churn(a->time += DT);
+            });
+        reg.add_system(ecs::reads<>{}, ecs::writes<Emitter>{},
+            [](ecs::registry &, ecs::sparse_array<Emitter> &emit) {
+                for (auto &e : emit)
+                    if (e)
+                        e->timer = churn(e->timer + e->rate * DT);
+            });
+    }
+
+    void run(std::size_t n, std::size_t workers)
+    {
+        ecs::registry sequential;
+        ecs::registry parallel;
+        populate(sequential, n, 0);
+        populate(parallel, n, workers);
+
+        double seq = bench::median_us(RUNS, [&]() { sequential.run_systems(); });
+        double par = bench::median_us(RUNS, [&]() { parallel.run_systems(); });
+        bench::report("4 independent systems", n, seq, par);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int hw = std::thread::hardware_concurrency();
+    std::vector<std::size_t> counts;
+    for (int i = 1; i < argc; ++i)
+        counts.push_back(static_cast<std::size_t>(std::strtoul(argv[i], nullptr, 10)));
+    if (counts.empty())
+        counts.push_back(hw > 1 ? hw - 1 : 1);
+
+    std::printf("baseline = run_systems on 1 thread, candidate = run_systems with N workers"
+        " (%u hardware threads, median of %zu runs)\n", hw, RUNS);
+    if (hw < 2)
+        std::printf("single hardware thread: the pool cannot overlap systems, this only measures its overhead\n");
+    for (std::size_t workers : counts) {
+        std::printf("N = %zu\n", workers);
+        for (std::size_t n : {1000u, 10000u, 100000u})
+            run(n, workers);
+    }
+    return 0;
+}
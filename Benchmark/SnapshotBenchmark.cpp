@@ -0,0 +1,162 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** Snapshot bandwidth: raw floats vs delta against the acked tick
+*/
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "BenchUtils.hpp"
+#include "Snapshot.hpp"
+
+namespace {
+    constexpr std::size_t RUNS = 31;
+    constexpr std::size_t TICKS = 600;
+    constexpr uint32_t ACK_LAG = 4;
+    constexpr float DT = 0.016f;
+
+    /**
+     * @brief Entity counts of a level file, plus what is usually alive besides.
+     */
+    struct Scene {
+        const char *name;
+        std::size_t enemies;
+        std::size_t obstacles;
+        std::size_t elements;
+        std::size_t players = 4;
+        std::size_t projectiles = 30;
+        std::size_t enemyProjectiles = 20;
+    };
+
+    /**
+     * @brief Moves every entity roughly like the server does: enemies and
+     *        obstacles scroll at -50 units/s, half of the enemies on a sine,
+     *        players move on some ticks, projectiles fly straight.
+     */
+    class World {
+        public:
+            explicit World(Scene const &scene) : _rng(3)
+            {
+                std::uniform_real_distribution<float> x(0.f, 4000.f);
+                std::uniform_real_distribution<float> y(0.f, 1080.f);
+                auto add = [&](snapshot::EntityKind kind, std::size_t count, float vx, uint32_t firstId) {
+                    for (std::size_t i = 0; i < count; ++i)
+                        _states.push_back({kind, firstId + static_cast<uint32_t>(i), x(_rng), y(_rng), 0.f, vx, 0.f, 0.f});
+                };
+                add(snapshot::EntityKind::Player, scene.players, 0.f, 1);
+                add(snapshot::EntityKind::Enemy, scene.enemies, -50.f, 100);
+                add(snapshot::EntityKind::Obstacle, scene.obstacles, -50.f, 1000);
+                add(snapshot::EntityKind::Element, scene.elements, -50.f, 2000);
+                add(snapshot::EntityKind::Projectile, scene.projectiles, 600.f, 1u << 20);
+                add(snapshot::EntityKind::EnemyProjectile, scene.enemyProjectiles, -300.f, 1u << 20);
+            }
+
+            void step(uint32_t tick)
+            {
+                std::bernoulli_distribution moves(0.5);
+                for (std::size_t i = 0; i < _states.size(); ++i) {
+                    auto &s = _states[i];
+                    if (s.kind == snapshot::EntityKind::Player) {
+                        if (moves(_rng))
+                            s.x += 200.f * DT;
+                        continue;
+                    }
+                    s.x += s.vx * DT;
+                    if (s.kind == snapshot::EntityKind::Enemy && i % 2 == 0)
+                        s.y += std::sin(static_cast<float>(tick) * 0.05f) * 2.f;
+                }
+            }
+
+            snapshot::WorldState quantized() const
+            {
+                snapshot::WorldState world;
+                world.reserve(_states.size());
+                for (auto const &s : _states)
+                    world.push_back(snapshot::quantize(s));
+                snapshot::sortWorld(world);
+                return world;
+            }
+
+            /**
+             * @brief Bytes of the previous format: 12-byte chunk header, raw floats per record.
+             */
+            std::size_t raw_bytes() const
+            {
+                std::size_t total = 0;
+                std::size_t chunk = 0;
+                for (auto const &s : _states) {
+                    std::size_t record = 17;
+                    if (s.kind == snapshot::EntityKind::Enemy || s.kind == snapshot::EntityKind::Element)
+                        record += 8;
+                    else if (s.kind == snapshot::EntityKind::Obstacle)
+                        record += 12;
+                    if (chunk == 0 || chunk + record > snapshot::MAX_DATAGRAM_SIZE) {
+                        total += chunk;
+                        chunk = 12;
+                    }
+                    chunk += record;
+                }
+                return total + chunk;
+            }
+
+        private:
+            std::mt19937 _rng;
+            std::vector<snapshot::EntityState> _states;
+    };
+
+    void run(Scene const &scene)
+    {
+        World world(scene);
+        snapshot::SnapshotWriter writer;
+        snapshot::SnapshotHistory history;
+        std::size_t raw = 0;
+        std::size_t full = 0;
+        std::size_t delta = 0;
+        std::size_t datagrams = 0;
+
+        for (uint32_t tick = 1; tick <= TICKS; ++tick) {
+            world.step(tick);
+            snapshot::WorldState current = world.quantized();
+            raw += world.raw_bytes();
+            for (auto const &chunk : writer.encode(tick, current, 0, nullptr))
+                full += chunk.size();
+            uint32_t baselineTick = tick > ACK_LAG ? tick - ACK_LAG : 0;
+            auto const *baseline = baselineTick ? history.find(baselineTick) : nullptr;
+            for (auto const &chunk : writer.encode(tick, current, baselineTick, baseline)) {
+                delta += chunk.size();
+                ++datagrams;
+            }
+            history.store(tick, current);
+        }
+
+        std::printf("%-8s entities=%-4zu raw=%6zu B/tick  quantized full=%6zu B/tick  delta=%6zu B/tick"
+                    "  (x%.2f vs raw, %.2f datagrams/tick)\n",
+            scene.name, scene.players + scene.enemies + scene.obstacles + scene.elements + scene.projectiles
+                + scene.enemyProjectiles,
+            raw / TICKS, full / TICKS, delta / TICKS, static_cast<double>(raw) / static_cast<double>(delta),
+            static_cast<double>(datagrams) / TICKS);
+
+        snapshot::WorldState previous = world.quantized();
+        world.step(TICKS + 1);
+        snapshot::WorldState current = world.quantized();
+        double fullUs = bench::median_us(RUNS, [&] {
+            bench::do_not_optimize(writer.encode(TICKS + 1, current, 0, nullptr).size());
+        });
+        double deltaUs = bench::median_us(RUNS, [&] {
+            bench::do_not_optimize(writer.encode(TICKS + 1, current, TICKS, &previous).size());
+        });
+        bench::report("  encode full vs delta", current.size(), fullUs, deltaUs);
+    }
+}
+
+int main()
+{
+    std::printf("Snapshot bytes per tick and per client, baseline acked %u ticks late\n", ACK_LAG);
+    run({"level_01", 70, 27, 3});
+    run({"level_02", 229, 54, 4});
+    run({"level_03", 259, 111, 11});
+    return 0;
+}
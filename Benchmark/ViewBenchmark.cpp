@@ -0,0 +1,105 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** registry::view vs zipper micro-benchmark
+*/
+
+#include <cstdio>
+#include "BenchUtils.hpp"
+#include "registry.hpp"
+#include "zipper.hpp"
+
+namespace {
+    struct Position { float x, y, z; };
+    struct Velocity { float vx, vy, vz; };
+    struct CollisionBox { float width, height, depth; };
+    struct DenseBox { float width, height, depth; };
+
+    constexpr std::size_t RUNS = 51;
+}
+
+template <>
+struct ecs::storage_policy<DenseBox> {
+    using type = ecs::dense_storage;
+};
+
+namespace {
+    /**
+     * @brief Fill a registry: every entity has a position, half have a
+     *        velocity and one in twenty has a collision box.
+     */
+    void populate(ecs::registry &reg, std::size_t n)
+    {
+        reg.register_component<Position>();
+        reg.register_component<Velocity>();
+        reg.register_component<CollisionBox>();
+        reg.register_component<DenseBox>();
+        for (std::size_t i = 0; i < n; ++i) {
+            auto e = reg.spawn_entity();
+            float f = static_cast<float>(i);
+            reg.add_component<Position>(e, {f, f, 0.f});
+            if (i % 2 == 0)
+                reg.add_component<Velocity>(e, {1.f, 2.f, 0.f});
+            if (i % 20 == 0) {
+                reg.add_component<CollisionBox>(e, {32.f, 32.f, 1.f});
+                reg.add_component<DenseBox>(e, {32.f, 32.f, 1.f});
+            }
+        }
+    }
+
+    void run(std::size_t n)
+    {
+        ecs::registry reg;
+        populate(reg, n);
+        auto &pos = reg.get_components<Position>();
+        auto &vel = reg.get_components<Velocity>();
+        auto &box = reg.get_components<CollisionBox>();
+
+        double zip2 = bench::median_us(RUNS, [&]() {
+            float sum = 0.f;
+            ecs::containers::zipper zip(pos, vel);
+            for (auto [p, v] : zip)
+                sum += p->x + v->vx;
+            bench::do_not_optimize(sum);
+        });
+        double view2 = bench::median_us(RUNS, [&]() {
+            float sum = 0.f;
+            for (auto [p, v] : reg.view<Position, Velocity>())
+                sum += p.x + v.vx;
+            bench::do_not_optimize(sum);
+        });
+        bench::report("position+velocity", n, zip2, view2);
+
+        double zip3 = bench::median_us(RUNS, [&]() {
+            float sum = 0.f;
+            ecs::containers::zipper zip(pos, vel, box);
+            for (auto [p, v, b] : zip)
+                sum += p->x + v->vx + b->width;
+            bench::do_not_optimize(sum);
+        });
+        double view3 = bench::median_us(RUNS, [&]() {
+            float sum = 0.f;
+            for (auto [p, v, b] : reg.view<Position, Velocity, CollisionBox>())
+                sum += p.x + v.vx + b.width;
+            bench::do_not_optimize(sum);
+        });
+        bench::report("pos+vel+collision_box", n, zip3, view3);
+
+        double dense3 = bench::median_us(RUNS, [&]() {
+            float sum = 0.f;
+            for (auto [p, v, b] : reg.view<Position, Velocity, DenseBox>())
+                sum += p.x + v.vx + b.width;
+            bench::do_not_optimize(sum);
+        });
+        bench::report("pos+vel+box (dense box)", n, zip3, dense3);
+    }
+}
+
+int main()
+{
+    std::printf("baseline = ecs::containers::zipper, candidate = registry::view (median of %zu runs)\n", RUNS);
+    for (std::size_t n : {1000u, 10000u, 100000u})
+        run(n);
+    return 0;
+}
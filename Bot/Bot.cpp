@@ -0,0 +1,324 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Headless simulated client
+*/
+
+#include "Bot.hpp"
+#include "protocol.hpp"
+#include "PlayerMovement.hpp"
+#include "FixedTimestep.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace bot {
+
+    Bot::Bot(std::size_t index, const asio::ip::udp::endpoint &server, std::size_t botCount,
+             RoomPlan &plan, Stats &stats, const Script &script, Clock::time_point connectAt)
+        : _index(index), _botCount(botCount), _server(server), _plan(plan), _stats(stats),
+          _script(script), _nextSend(connectAt) {}
+
+    void Bot::update(Clock::time_point now) {
+        if (state() == State::Left)
+            return;
+        std::size_t received;
+        while ((received = _socket.receive_batch(_batch.data(), _batch.size())) > 0) {
+            for (std::size_t i = 0; i < received; ++i) {
+                if (_batch[i].endpoint == _server)
+                    handle(_batch[i].data.data(), _batch[i].data.size(), now);
+            }
+            if (received < _batch.size())
+                break;
+        }
+        if (state() == State::Playing)
+            play(now);
+        else if (now >= _nextSend)
+            sendLobbyRequest(now);
+    }
+
+    void Bot::leave() {
+        State current = state();
+        if (current == State::Joining || current == State::Confirming || current == State::Playing) {
+            ClientLeaveRoomMessage msg{};
+            msg.type = MessageType::ClientLeaveRoom;
+            msg.clientId = _clientId;
+            msg.roomId = _roomId;
+            _socket.sendTo(&msg, sizeof(msg), _server);
+        }
+        setState(State::Left);
+    }
+
+    void Bot::handle(const uint8_t *data, std::size_t size, Clock::time_point now) {
+        if (size < sizeof(MessageType))
+            return;
+        switch (static_cast<MessageType>(data[0])) {
+            case MessageType::ServerAssignId:
+                handleAssignId(data, size, now);
+                break;
+            case MessageType::ServerSendRooms:
+                handleRooms(data, size, now);
+                break;
+            case MessageType::ServerRoomAssignId:
+                handleRoomAssign(data, size, now);
+                break;
+            case MessageType::ServerSetRoomReady:
+                if (state() == State::Confirming)
+                    _nextSend = now;
+                break;
+            case MessageType::GameStart:
+                handleGameStart(data, size, now);
+                break;
+            case MessageType::Snapshot:
+                handleSnapshot(data, size, now);
+                break;
+            case MessageType::PlayerInputAck:
+                handleInputAck(data, size, now);
+                break;
+            case MessageType::Reliable:
+                handleReliable(data, size, now);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void Bot::handleAssignId(const uint8_t *data, std::size_t size, Clock::time_point now) {
+        if (size < sizeof(ServerAssignIdMessage) || state() != State::Connecting)
+            return;
+        const auto *msg = reinterpret_cast<const ServerAssignIdMessage *>(data);
+        _clientId = ntohl(msg->clientId);
+        _reliable = reliable::Connection(_clientId);
+        setState(State::FetchingRooms);
+        _nextSend = now;
+    }
+
+    void Bot::handleRooms(const uint8_t *data, std::size_t size, Clock::time_point now) {
+        if (size < sizeof(ServerSendRoomsMessage) || state() != State::FetchingRooms)
+            return;
+        const auto *msg = reinterpret_cast<const ServerSendRoomsMessage *>(data);
+        auto rooms = parseRooms(std::string_view(msg->jsonData, strnlen(msg->jsonData, sizeof(msg->jsonData))));
+        if (!rooms) {
+            LOG_WARN("[Bot " << _index << "] Malformed room list, the server may have more rooms than fit in it");
+            return;
+        }
+        _plan.offer(*rooms, _botCount);
+        auto room = _plan.roomFor(_index);
+        if (!room) {
+            setState(State::Lobby);
+            return;
+        }
+        _roomId = *room;
+        setState(State::Joining);
+        _nextSend = now;
+    }
+
+    void Bot::handleRoomAssign(const uint8_t *data, std::size_t size, Clock::time_point now) {
+        if (size < sizeof(ServerRoomAssignIdMessage) || state() != State::Joining)
+            return;
+        const auto *msg = reinterpret_cast<const ServerRoomAssignIdMessage *>(data);
+        if (msg->roomId != _roomId)
+            return;
+        setState(State::Confirming);
+        _nextSend = now;
+    }
+
+    void Bot::handleGameStart(const uint8_t *data, std::size_t size, Clock::time_point now) {
+        // The server broadcasts GameStart again whenever a player of a started room confirms.
+        if (size < sizeof(GameStartMessage) || state() != State::Confirming)
+            return;
+        const auto *msg = reinterpret_cast<const GameStartMessage *>(data);
+        uint32_t tickRate = ntohl(msg->tickRate);
+        if (!timing::isSupportedTickRate(tickRate))
+            tickRate = timing::DEFAULT_TICK_RATE;
+        _stats.announcedTickRate.store(tickRate, std::memory_order_relaxed);
+        _tickDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(1'000'000'000 / tickRate));
+
+        _snapshots.reset();
+        _sequence = 0;
+        _ackedSequence = 0;
+        _lastSnapshotTick = 0;
+        _delayFloor = NO_TRANSIT;
+        _windowFloor = NO_TRANSIT;
+        _gameStart = now;
+        _windowEnd = now + DELAY_WINDOW;
+        _nextCommand = now;
+        // Spread the shots of the swarm over the interval instead of firing them together.
+        _nextShot = now + _script.shootInterval * static_cast<long>(_index % 8) / 8;
+
+        SceneStateMessage scene{};
+        scene.type = MessageType::SceneState;
+        scene.clientId = htonl(_clientId);
+        scene.scene = htonl(static_cast<uint32_t>(SceneState::GAME));
+        _socket.sendTo(&scene, sizeof(scene), _server);
+        setState(State::Playing);
+    }
+
+    void Bot::handleSnapshot(const uint8_t *data, std::size_t size, Clock::time_point now) {
+        using Result = snapshot::SnapshotReceiver::Result;
+
+        if (state() != State::Playing)
+            return;
+        _snapshotRecords.clear();
+        if (_snapshots.receive(data, size, _snapshotRecords) != Result::Completed)
+            return;
+
+        uint32_t tick = _snapshots.completedTick();
+        SnapshotAckMessage ack{};
+        ack.type = MessageType::SnapshotAck;
+        ack.clientId = htonl(_clientId);
+        ack.tick = htonl(tick);
+        _socket.sendTo(&ack, sizeof(ack), _server);
+
+        _stats.snapshotsReceived.add(1);
+        if (_lastSnapshotTick != 0 && tick > _lastSnapshotTick) {
+            _stats.ticksAdvanced.add(tick - _lastSnapshotTick);
+            _stats.snapshotsLost.add(tick - _lastSnapshotTick - 1);
+            _stats.ticksSpan.add(metrics::elapsedNs(_lastSnapshotAt, now));
+        }
+        _lastSnapshotTick = tick;
+        _lastSnapshotAt = now;
+        recordSnapshotDelay(tick, now);
+    }
+
+    void Bot::recordSnapshotDelay(uint32_t tick, Clock::time_point now) {
+        // The server clock is unknown, so transit is arrival time minus the tick's
+        // time on a local epoch. The fastest transit of the last two windows is
+        // taken as zero delay; the window lets the floor follow ticks the server
+        // skipped, which shift every later transit.
+        int64_t transit = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            now - _gameStart - _tickDuration * static_cast<int64_t>(tick)).count();
+        if (now >= _windowEnd) {
+            _delayFloor = _windowFloor;
+            _windowFloor = NO_TRANSIT;
+            _windowEnd = now + DELAY_WINDOW;
+        }
+        _windowFloor = std::min(_windowFloor, transit);
+        int64_t floor = std::min(_delayFloor, _windowFloor);
+        _stats.snapshotDelay.record(static_cast<uint64_t>(transit - floor));
+    }
+
+    void Bot::handleInputAck(const uint8_t *data, std::size_t size, Clock::time_point now) {
+        if (size < sizeof(PlayerInputAckMessage) || state() != State::Playing)
+            return;
+        const auto *msg = reinterpret_cast<const PlayerInputAckMessage *>(data);
+        uint32_t sequence = ntohl(msg->sequence);
+        if (sequence <= _ackedSequence || sequence > _sequence)
+            return;
+        if (_sequence - sequence < COMMAND_HISTORY)
+            _stats.inputRoundTrip.record(metrics::elapsedNs(_commands[sequence % COMMAND_HISTORY].sentAt, now));
+        _ackedSequence = sequence;
+    }
+
+    void Bot::handleReliable(const uint8_t *data, std::size_t size, Clock::time_point now) {
+        if (!_reliable.on_packet(now, data, size))
+            return;
+        reliable::Channel channel;
+        while (_reliable.receive(channel, _reliableMessage))
+            ;
+    }
+
+    void Bot::sendLobbyRequest(Clock::time_point now) {
+        switch (state()) {
+            case State::Idle:
+                setState(State::Connecting);
+                [[fallthrough]];
+            case State::Connecting: {
+                ClientHelloMessage msg{};
+                msg.type = MessageType::ClientHello;
+                msg.clientId = htonl(0);
+                std::string name = "bot" + std::to_string(_index);
+                std::strncpy(msg.clientName, name.c_str(), sizeof(msg.clientName) - 1);
+                _socket.sendTo(&msg, sizeof(msg), _server);
+                _nextSend = now + HELLO_TIMEOUT;
+                return;
+            }
+            case State::FetchingRooms: {
+                ClientFetchRoomsMessage msg{};
+                msg.type = MessageType::ClientFetchRooms;
+                msg.clientId = _clientId;
+                _socket.sendTo(&msg, sizeof(msg), _server);
+                break;
+            }
+            case State::Joining: {
+                ClientRoomIdAskMessage msg{};
+                msg.type = MessageType::ClientRoomIdAsk;
+                msg.clientId = _clientId;
+                msg.roomId = _roomId;
+                _socket.sendTo(&msg, sizeof(msg), _server);
+                break;
+            }
+            case State::Confirming: {
+                // Ignored by the server until the room is ready, so it is safe to repeat.
+                ClientConfirmStartMessage msg{};
+                msg.type = MessageType::ClientConfirmStart;
+                msg.clientId = _clientId;
+                msg.roomId = _roomId;
+                _socket.sendTo(&msg, sizeof(msg), _server);
+                break;
+            }
+            default:
+                return;
+        }
+        _nextSend = now + RESEND_INTERVAL;
+    }
+
+    void Bot::play(Clock::time_point now) {
+        // After a stall, send the commands that are due once instead of in a burst.
+        if (now - _nextCommand > _tickDuration * static_cast<int>(INPUT_REDUNDANCY))
+            _nextCommand = now;
+        while (now >= _nextCommand) {
+            sendCommand(now);
+            _nextCommand += _tickDuration;
+        }
+        if (now - _nextShot > _script.shootInterval)
+            _nextShot = now;
+        while (now >= _nextShot) {
+            sendShoot();
+            _nextShot += _script.shootInterval;
+        }
+        _reliable.flush(now, [this](const uint8_t *data, std::size_t size) {
+            _socket.sendTo(data, size, _server);
+        });
+    }
+
+    void Bot::sendCommand(Clock::time_point now) {
+        ++_sequence;
+        _commands[_sequence % COMMAND_HISTORY] = {scriptedButtons(_sequence), now};
+
+        ClientInputMessage msg{};
+        msg.type = MessageType::ClientInput;
+        msg.clientId = htonl(_clientId);
+        msg.sequence = htonl(_sequence);
+        msg.count = static_cast<uint8_t>(std::min<uint32_t>(INPUT_REDUNDANCY, _sequence - _ackedSequence));
+        for (uint8_t i = 0; i < msg.count; ++i)
+            msg.buttons[i] = _commands[(_sequence - i) % COMMAND_HISTORY].buttons;
+        _socket.sendTo(&msg, sizeof(msg), _server);
+        _stats.commandsSent.add(1);
+    }
+
+    void Bot::sendShoot() {
+        ClientShootMessage msg{};
+        msg.type = MessageType::ClientShoot;
+        msg.clientId = htonl(_clientId);
+        _socket.sendTo(&msg, sizeof(msg), _server);
+        _stats.shotsSent.add(1);
+    }
+
+    uint8_t Bot::scriptedButtons(uint32_t sequence) const {
+        // Four diagonals in turn, each bot starting on a different one, so the
+        // players sweep the screen and keep colliding with its edges.
+        static constexpr uint8_t PATTERN[] = {
+            movement::Up | movement::Right,
+            movement::Down | movement::Right,
+            movement::Down | movement::Left,
+            movement::Up | movement::Left,
+        };
+        auto period = std::max<int64_t>(1, _script.strafePeriod / _tickDuration);
+        auto step = (static_cast<int64_t>(sequence) * 4 / period + static_cast<int64_t>(_index)) % 4;
+        return PATTERN[step];
+    }
+
+} // namespace bot
@@ -0,0 +1,168 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Headless simulated client
+*/
+
+#pragma once
+
+#include "UDP_socket.hpp"
+#include "ReliableChannel.hpp"
+#include "Snapshot.hpp"
+#include "TickProfiler.hpp"
+#include "RoomPlan.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace bot {
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @struct Stats
+     * @brief Measurements shared by every bot of a swarm, read and reset by its report.
+     *
+     * Bots record from their driver threads; nothing here takes a lock.
+     */
+    struct Stats {
+        metrics::Histogram snapshotDelay;   ///< Arrival of a snapshot after the fastest one of its bot, in ns.
+        metrics::Histogram inputRoundTrip;  ///< From sending a command to the ack that applied it, in ns.
+        metrics::Counter snapshotsReceived; ///< Snapshots completed.
+        metrics::Counter snapshotsLost;     ///< Snapshot ticks skipped between two completed snapshots.
+        metrics::Counter ticksAdvanced;     ///< Sum over bots of how far their last snapshot tick moved.
+        metrics::Counter ticksSpan;         ///< Time those moves took, in ns; the ratio is the server tick rate.
+        metrics::Counter commandsSent;
+        metrics::Counter shotsSent;
+        std::atomic<uint32_t> announcedTickRate{0}; ///< Tick rate of the last GameStartMessage.
+    };
+
+    /**
+     * @struct Script
+     * @brief What every bot does once in game.
+     */
+    struct Script {
+        std::chrono::milliseconds shootInterval{250};  ///< Time between two ClientShootMessage.
+        std::chrono::milliseconds strafePeriod{2000};  ///< Time to go around the movement pattern once.
+    };
+
+    /**
+     * @class Bot
+     * @brief One simulated client: joins a room like GameClient does, then plays a script.
+     *
+     * A bot speaks the client protocol with its own socket and client ID,
+     * without Game, raylib or any registry. It goes through the lobby as
+     * the real client (ClientHello, ClientFetchRooms, ClientRoomIdAsk,
+     * ClientConfirmStart), resending each request until the server answers,
+     * then announces the game scene and sends one movement command per
+     * server tick plus a shot at a fixed interval. It decodes snapshots and
+     * acks them so the server keeps delta-encoding against real baselines,
+     * and drains the reliable channel without restoring anything.
+     *
+     * Bots are not thread-safe: one driver thread calls update() on a bot.
+     * state() and traffic() may be read from any thread.
+     */
+    class Bot {
+        public:
+            enum class State : uint8_t {
+                Idle,           ///< Not connected yet.
+                Connecting,     ///< ClientHello sent.
+                FetchingRooms,  ///< Waiting for the room list or for the room plan.
+                Joining,        ///< ClientRoomIdAsk sent.
+                Confirming,     ///< In a room, confirming until the game starts.
+                Playing,        ///< Received GameStart.
+                Lobby,          ///< Connected, but no room was planned for it.
+                Left,           ///< Left its room; does nothing anymore.
+            };
+
+            static constexpr std::chrono::milliseconds RESEND_INTERVAL{500};
+            /** A ClientHello is not idempotent, so it is only resent after a long silence. */
+            static constexpr std::chrono::milliseconds HELLO_TIMEOUT{3000};
+
+            Bot(std::size_t index, const asio::ip::udp::endpoint &server, std::size_t botCount,
+                RoomPlan &plan, Stats &stats, const Script &script, Clock::time_point connectAt);
+
+            Bot(const Bot &) = delete;
+            Bot &operator=(const Bot &) = delete;
+
+            /**
+             * @brief Handles every pending datagram, then sends what is due at now.
+             */
+            void update(Clock::time_point now);
+
+            /**
+             * @brief Leaves the room, if any, and stops sending.
+             */
+            void leave();
+
+            State state() const { return _state.load(std::memory_order_relaxed); }
+            UDP_socket::Traffic traffic() const { return _socket.getTraffic(); }
+
+        private:
+            static constexpr std::size_t BATCH_SIZE = 16;
+            static constexpr std::size_t COMMAND_HISTORY = 64;
+            static constexpr std::chrono::seconds DELAY_WINDOW{2};
+            static constexpr int64_t NO_TRANSIT = std::numeric_limits<int64_t>::max();
+
+            struct Command {
+                uint8_t buttons{0};
+                Clock::time_point sentAt{};
+            };
+
+            void handle(const uint8_t *data, std::size_t size, Clock::time_point now);
+            void handleAssignId(const uint8_t *data, std::size_t size, Clock::time_point now);
+            void handleRooms(const uint8_t *data, std::size_t size, Clock::time_point now);
+            void handleRoomAssign(const uint8_t *data, std::size_t size, Clock::time_point now);
+            void handleGameStart(const uint8_t *data, std::size_t size, Clock::time_point now);
+            void handleSnapshot(const uint8_t *data, std::size_t size, Clock::time_point now);
+            void handleInputAck(const uint8_t *data, std::size_t size, Clock::time_point now);
+            void handleReliable(const uint8_t *data, std::size_t size, Clock::time_point now);
+
+            void sendLobbyRequest(Clock::time_point now);
+            void play(Clock::time_point now);
+            void sendCommand(Clock::time_point now);
+            void sendShoot();
+            void recordSnapshotDelay(uint32_t tick, Clock::time_point now);
+            uint8_t scriptedButtons(uint32_t sequence) const;
+            void setState(State state) { _state.store(state, std::memory_order_relaxed); }
+
+            std::size_t _index;
+            std::size_t _botCount;
+            asio::ip::udp::endpoint _server;
+            RoomPlan &_plan;
+            Stats &_stats;
+            Script _script;
+            UDP_socket _socket;
+            std::array<UDP_socket::Datagram, BATCH_SIZE> _batch;
+
+            std::atomic<State> _state{State::Idle};
+            Clock::time_point _nextSend;
+            uint32_t _clientId{0};
+            uint32_t _roomId{0};
+
+            reliable::Connection _reliable;
+            std::vector<uint8_t> _reliableMessage;
+            snapshot::SnapshotReceiver _snapshots;
+            std::vector<snapshot::EntityState> _snapshotRecords;
+
+            Clock::duration _tickDuration{};
+            Clock::time_point _gameStart;
+            Clock::time_point _nextCommand;
+            Clock::time_point _nextShot;
+            uint32_t _sequence{0};
+            uint32_t _ackedSequence{0};
+            std::array<Command, COMMAND_HISTORY> _commands{};
+            uint32_t _lastSnapshotTick{0};
+            Clock::time_point _lastSnapshotAt;
+
+            int64_t _delayFloor{NO_TRANSIT};   ///< Fastest snapshot transit of the previous window.
+            int64_t _windowFloor{NO_TRANSIT};  ///< Fastest snapshot transit of the current window.
+            Clock::time_point _windowEnd;
+    };
+
+} // namespace bot
@@ -0,0 +1,67 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Room assignment of the load test bots
+*/
+
+#include "RoomPlan.hpp"
+#include "GameStatus.hpp"
+#include <algorithm>
+#include <nlohmann/json.hpp>
+
+namespace bot {
+
+    std::optional<std::vector<RoomInfo>> parseRooms(std::string_view json) {
+        nlohmann::json parsed = nlohmann::json::parse(json, nullptr, false);
+        if (parsed.is_discarded() || !parsed.contains("rooms") || !parsed["rooms"].is_array())
+            return std::nullopt;
+
+        std::vector<RoomInfo> rooms;
+        try {
+            for (const auto &room : parsed["rooms"]) {
+                RoomInfo info;
+                info.id = room.at("id").get<uint32_t>();
+                info.currentPlayers = room.at("currentPlayers").get<int>();
+                info.minPlayers = room.at("minPlayers").get<int>();
+                info.maxPlayers = room.at("maxPlayers").get<int>();
+                info.status = room.at("status").get<int>();
+                rooms.push_back(info);
+            }
+        } catch (const nlohmann::json::exception &) {
+            return std::nullopt;
+        }
+        return rooms;
+    }
+
+    void RoomPlan::offer(const std::vector<RoomInfo> &rooms, std::size_t botCount) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_ready.load(std::memory_order_relaxed))
+            return;
+
+        std::vector<RoomInfo> sorted = rooms;
+        std::sort(sorted.begin(), sorted.end(), [](const RoomInfo &a, const RoomInfo &b) { return a.id < b.id; });
+        for (const auto &room : sorted) {
+            if (room.status != static_cast<int>(GameStatus::WAITING_PLAYERS))
+                continue;
+            int needed = room.minPlayers - room.currentPlayers;
+            if (needed <= 0 || room.currentPlayers + needed > room.maxPlayers)
+                continue;
+            if (_seats.size() + static_cast<std::size_t>(needed) > botCount)
+                continue;
+            _seats.insert(_seats.end(), static_cast<std::size_t>(needed), room.id);
+        }
+        _ready.store(true, std::memory_order_release);
+    }
+
+    std::optional<uint32_t> RoomPlan::roomFor(std::size_t botIndex) const {
+        if (!isReady() || botIndex >= _seats.size())
+            return std::nullopt;
+        return _seats[botIndex];
+    }
+
+    std::size_t RoomPlan::seatCount() const {
+        return isReady() ? _seats.size() : 0;
+    }
+
+} // namespace bot
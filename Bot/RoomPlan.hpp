@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Room assignment of the load test bots
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace bot {
+
+    /**
+     * @struct RoomInfo
+     * @brief One entry of the room list sent by the server (ServerSendRoomsMessage).
+     */
+    struct RoomInfo {
+        uint32_t id{0};
+        int currentPlayers{0};
+        int minPlayers{0};
+        int maxPlayers{0};
+        int status{0};  ///< GameStatus value.
+    };
+
+    /**
+     * @brief Parses the JSON room list of a ServerSendRoomsMessage.
+     * @return The rooms, or nothing if the JSON is malformed or truncated.
+     */
+    std::optional<std::vector<RoomInfo>> parseRooms(std::string_view json);
+
+    /**
+     * @class RoomPlan
+     * @brief Decides which room each bot joins, from the first room list a bot receives.
+     *
+     * Every bot fetches the room list, but the seats are planned once so
+     * bots never race each other for the same room. Rooms are filled in id
+     * order with exactly the players they still need to start: a room only
+     * starts when every player in it confirmed, and a player joining a room
+     * that is already ready would race that start. Rooms that are not
+     * waiting for players, or that the remaining bots cannot fill, are
+     * skipped; bots left without a seat stay in the lobby.
+     *
+     * offer() may be called from any thread. Once isReady() returned true,
+     * roomFor() never changes.
+     */
+    class RoomPlan {
+        public:
+            /**
+             * @brief Plans the seats of botCount bots, unless a plan already exists.
+             */
+            void offer(const std::vector<RoomInfo> &rooms, std::size_t botCount);
+
+            bool isReady() const { return _ready.load(std::memory_order_acquire); }
+
+            /** @brief Room of a bot, nothing if it has no seat or no plan exists yet. */
+            std::optional<uint32_t> roomFor(std::size_t botIndex) const;
+
+            /** @brief Number of bots with a seat, 0 before the plan exists. */
+            std::size_t seatCount() const;
+
+        private:
+            std::mutex _mutex;
+            std::atomic<bool> _ready{false};
+            std::vector<uint32_t> _seats; ///< Room of bot i, written once before _ready.
+    };
+
+} // namespace bot
@@ -0,0 +1,159 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Load test swarm of headless clients
+*/
+
+#include "Swarm.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <sstream>
+
+namespace bot {
+
+    namespace {
+        constexpr std::size_t MAX_DRIVERS = 8;
+
+        double toMs(uint64_t nanoseconds) {
+            return static_cast<double>(nanoseconds) / 1e6;
+        }
+
+        double tickRate(uint64_t ticks, uint64_t nanoseconds) {
+            return nanoseconds == 0 ? 0.0 : static_cast<double>(ticks) * 1e9 / static_cast<double>(nanoseconds);
+        }
+
+        double percent(uint64_t part, uint64_t whole) {
+            return whole == 0 ? 0.0 : 100.0 * static_cast<double>(part) / static_cast<double>(whole);
+        }
+    }
+
+    Swarm::Swarm(const SwarmOptions &options) : _options(options) {
+        if (_options.threads == 0)
+            _options.threads = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, MAX_DRIVERS);
+        _options.threads = std::min(_options.threads, std::max<std::size_t>(_options.botCount, 1));
+
+        Clock::time_point start = Clock::now();
+        _bots.reserve(_options.botCount);
+        for (std::size_t i = 0; i < _options.botCount; ++i) {
+            _bots.push_back(std::make_unique<Bot>(i, _options.server, _options.botCount, _plan, _stats,
+                                                  _options.script, start + _options.connectInterval * static_cast<long>(i)));
+        }
+    }
+
+    void Swarm::run() {
+        LOG_INFO("Starting " << _bots.size() << " bots on " << _options.threads << " threads against "
+            << _options.server << " for " << _options.duration.count() << "s");
+
+        _running = true;
+        std::size_t perDriver = (_bots.size() + _options.threads - 1) / _options.threads;
+        for (std::size_t first = 0; first < _bots.size(); first += perDriver)
+            _drivers.emplace_back(&Swarm::drive, this, first, std::min(first + perDriver, _bots.size()));
+
+        Clock::time_point start = Clock::now();
+        Clock::time_point end = start + _options.duration;
+        Clock::time_point lastReport = start;
+        Clock::time_point nextReport = start + REPORT_INTERVAL;
+        while (Clock::now() < end) {
+            std::this_thread::sleep_until(std::min(nextReport, end));
+            Clock::time_point now = Clock::now();
+            report(now - lastReport);
+            lastReport = now;
+            nextReport += REPORT_INTERVAL;
+        }
+
+        _running = false;
+        for (auto &driver : _drivers)
+            driver.join();
+        _drivers.clear();
+        for (auto &bot : _bots)
+            bot->leave();
+        summarize(Clock::now() - start);
+    }
+
+    void Swarm::drive(std::size_t first, std::size_t last) {
+        while (_running.load(std::memory_order_relaxed)) {
+            Clock::time_point now = Clock::now();
+            for (std::size_t i = first; i < last; ++i)
+                _bots[i]->update(now);
+            std::this_thread::sleep_for(POLL_INTERVAL);
+        }
+    }
+
+    UDP_socket::Traffic Swarm::traffic() const {
+        UDP_socket::Traffic total;
+        for (const auto &bot : _bots) {
+            UDP_socket::Traffic traffic = bot->traffic();
+            total.packetsIn += traffic.packetsIn;
+            total.bytesIn += traffic.bytesIn;
+            total.packetsOut += traffic.packetsOut;
+            total.bytesOut += traffic.bytesOut;
+        }
+        return total;
+    }
+
+    void Swarm::report(std::chrono::duration<double> elapsed) {
+        std::array<std::size_t, static_cast<std::size_t>(Bot::State::Left) + 1> states{};
+        for (const auto &bot : _bots)
+            ++states[static_cast<std::size_t>(bot->state())];
+        std::size_t playing = states[static_cast<std::size_t>(Bot::State::Playing)];
+        std::size_t lobby = states[static_cast<std::size_t>(Bot::State::Lobby)];
+        std::size_t connecting = states[static_cast<std::size_t>(Bot::State::Idle)]
+            + states[static_cast<std::size_t>(Bot::State::Connecting)];
+        std::size_t joining = _bots.size() - playing - lobby - connecting;
+
+        uint64_t received = _stats.snapshotsReceived.collect();
+        uint64_t lost = _stats.snapshotsLost.collect();
+        uint64_t advanced = _stats.ticksAdvanced.collect();
+        uint64_t span = _stats.ticksSpan.collect();
+        uint64_t commands = _stats.commandsSent.collect();
+        uint64_t shots = _stats.shotsSent.collect();
+        metrics::Summary delay = _stats.snapshotDelay.collect();
+        metrics::Summary roundTrip = _stats.inputRoundTrip.collect();
+        UDP_socket::Traffic now = traffic();
+        double seconds = elapsed.count();
+
+        _totals.snapshotsReceived += received;
+        _totals.snapshotsLost += lost;
+        _totals.ticksAdvanced += advanced;
+        _totals.ticksSpan += span;
+        _totals.commandsSent += commands;
+        _totals.shotsSent += shots;
+        _totals.maxSnapshotDelay = std::max(_totals.maxSnapshotDelay, delay.max);
+        _totals.maxInputRoundTrip = std::max(_totals.maxInputRoundTrip, roundTrip.max);
+
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(1)
+             << "bots " << connecting << " connecting, " << joining << " joining, " << playing << " playing, "
+             << lobby << " in lobby | tick " << tickRate(advanced, span)
+             << "/s (announced " << _stats.announcedTickRate.load(std::memory_order_relaxed) << ")"
+             << std::setprecision(2)
+             << " | snapshot delay p50 " << toMs(delay.p50) << " p99 " << toMs(delay.p99) << " max " << toMs(delay.max) << " ms"
+             << " | input rtt p50 " << toMs(roundTrip.p50) << " p99 " << toMs(roundTrip.p99) << " ms"
+             << " | snapshot loss " << percent(lost, received + lost) << "%"
+             << std::setprecision(0)
+             << " | " << static_cast<double>(now.packetsOut - _lastTraffic.packetsOut) / seconds << " pkt/s out, "
+             << static_cast<double>(now.packetsIn - _lastTraffic.packetsIn) / seconds << " pkt/s in";
+        LOG_INFO(line.str());
+        _lastTraffic = now;
+    }
+
+    void Swarm::summarize(std::chrono::duration<double> elapsed) const {
+        UDP_socket::Traffic total = traffic();
+        std::ostringstream summary;
+        summary << std::fixed << std::setprecision(2)
+                << "Run of " << elapsed.count() << "s: " << _plan.seatCount() << "/" << _bots.size() << " bots had a room"
+                << ", mean tick rate " << tickRate(_totals.ticksAdvanced, _totals.ticksSpan) << "/s"
+                << ", " << _totals.snapshotsReceived << " snapshots, " << _totals.snapshotsLost << " lost ("
+                << percent(_totals.snapshotsLost, _totals.snapshotsReceived + _totals.snapshotsLost) << "%)"
+                << ", worst snapshot delay " << toMs(_totals.maxSnapshotDelay) << " ms"
+                << ", worst input rtt " << toMs(_totals.maxInputRoundTrip) << " ms"
+                << ", " << _totals.commandsSent << " commands and " << _totals.shotsSent << " shots sent"
+                << ", " << total.packetsOut << " datagrams out (" << total.bytesOut << " bytes)"
+                << ", " << total.packetsIn << " in (" << total.bytesIn << " bytes)";
+        LOG_INFO(summary.str());
+    }
+
+} // namespace bot
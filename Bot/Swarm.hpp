@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Load test swarm of headless clients
+*/
+
+#pragma once
+
+#include "Bot.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace bot {
+
+    /**
+     * @struct SwarmOptions
+     * @brief Command line of r-type_bot.
+     */
+    struct SwarmOptions {
+        asio::ip::udp::endpoint server;
+        std::size_t botCount{100};
+        std::chrono::seconds duration{60};
+        std::size_t threads{0};                        ///< 0 for one per hardware thread, at most 8.
+        std::chrono::milliseconds connectInterval{5};  ///< Delay between two bots connecting.
+        Script script;
+    };
+
+    /**
+     * @class Swarm
+     * @brief Runs many bots in one process and reports what they measure.
+     *
+     * Bots are split between a few driver threads which poll their sockets
+     * every millisecond. Bots connect one after the other, so the server is
+     * not flooded with ClientHello at once. Every second the swarm logs how
+     * many bots got how far, the server tick rate seen through the snapshot
+     * ticks, the snapshot delay and input round trip percentiles, and the
+     * share of snapshots lost; a summary of the whole run follows at the end.
+     */
+    class Swarm {
+        public:
+            static constexpr std::chrono::seconds REPORT_INTERVAL{1};
+            static constexpr std::chrono::milliseconds POLL_INTERVAL{1};
+
+            explicit Swarm(const SwarmOptions &options);
+
+            /**
+             * @brief Runs the bots for the configured duration, then makes them leave.
+             */
+            void run();
+
+        private:
+            struct Totals {
+                uint64_t snapshotsReceived{0};
+                uint64_t snapshotsLost{0};
+                uint64_t ticksAdvanced{0};
+                uint64_t ticksSpan{0};
+                uint64_t commandsSent{0};
+                uint64_t shotsSent{0};
+                uint64_t maxSnapshotDelay{0};
+                uint64_t maxInputRoundTrip{0};
+            };
+
+            void drive(std::size_t first, std::size_t last);
+            void report(std::chrono::duration<double> elapsed);
+            void summarize(std::chrono::duration<double> elapsed) const;
+            UDP_socket::Traffic traffic() const;
+
+            SwarmOptions _options;
+            RoomPlan _plan;
+            Stats _stats;
+            std::vector<std::unique_ptr<Bot>> _bots;
+            std::vector<std::thread> _drivers;
+            std::atomic<bool> _running{false};
+            UDP_socket::Traffic _lastTraffic;
+            Totals _totals;
+    };
+
+} // namespace bot
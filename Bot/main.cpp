@@ -0,0 +1,72 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** main
+*/
+
+#include "Swarm.hpp"
+#include "Logger.hpp"
+#include <string>
+
+namespace {
+	constexpr std::size_t MAX_BOTS = 2000;
+
+	bool is_number(std::string const &str) {
+		if (str.empty() || str.size() > 6)
+			return false;
+		for (char c : str) {
+			if (!std::isdigit(static_cast<unsigned char>(c)))
+				return false;
+		}
+		return true;
+	}
+
+	int usage(char const *name) {
+		std::cerr << "Usage: " << name
+			<< " <server_ip> <server_port> [bot_count] [duration_seconds] [shoot_interval_ms]" << std::endl;
+		return 1;
+	}
+}
+
+int main(int argc, char *argv[]) {
+	if (argc < 3)
+		return usage(argv[0]);
+
+	std::string serverIp = argv[1];
+	if (serverIp == "localhost")
+		serverIp = "127.0.0.1";
+	for (int i = 2; i < argc; ++i) {
+		if (!is_number(argv[i])) {
+			LOG_ERROR("Invalid argument '" << argv[i] << "': expected a positive number.");
+			return usage(argv[0]);
+		}
+	}
+
+	unsigned long port = std::stoul(argv[2]);
+	if (port == 0 || port > 65535) {
+		LOG_ERROR("The port number entered is invalid!");
+		return usage(argv[0]);
+	}
+	bot::SwarmOptions options;
+	try {
+		options.server = asio::ip::udp::endpoint(asio::ip::make_address(serverIp), static_cast<uint16_t>(port));
+	} catch (const std::exception &e) {
+		LOG_ERROR("Invalid server address: " << e.what());
+		return usage(argv[0]);
+	}
+	if (argc > 3)
+		options.botCount = std::stoul(argv[3]);
+	if (argc > 4)
+		options.duration = std::chrono::seconds(std::stoul(argv[4]));
+	if (argc > 5)
+		options.script.shootInterval = std::chrono::milliseconds(std::stoul(argv[5]));
+	if (options.botCount == 0 || options.botCount > MAX_BOTS || options.script.shootInterval.count() == 0) {
+		LOG_ERROR("The bot count must be between 1 and " << MAX_BOTS << " and the shoot interval above 0.");
+		return usage(argv[0]);
+	}
+
+	bot::Swarm swarm(options);
+	swarm.run();
+	return 0;
+}
@@ -37,7 +37,9 @@ void GameClient::handleElementSpawn(const std::vector<uint8_t> &buffer) {
     std::memcpy(&bh, &h, sizeof(float));
     
     std::lock_guard<std::mutex> g(stateMutex);
-    elements[elementId] = std::make_tuple(x, y, z, vx, vy, vz, bw, bh);
+    WorldState &world = editWorld();
+    bool spawned = world.elements.insert_or_assign(elementId, std::make_tuple(x, y, z, vx, vy, vz, bw, bh)).second;
+    world.emit(spawned ? WorldEvent::Type::Spawn : WorldEvent::Type::Update, snapshot::EntityKind::Element, elementId);
 }
 
 void GameClient::handleElementUpdate(const std::vector<uint8_t> &buffer) {
@@ -61,16 +63,19 @@ void GameClient::handleElementUpdate(const std::vector<uint8_t> &buffer) {
         std::memcpy(&vy, &vyb, sizeof(float));
     
         std::lock_guard<std::mutex> lock(stateMutex);
+        WorldState &world = editWorld();
         float vz = 0.f;
-        auto it = elements.find(elementId);
+        auto it = world.elements.find(elementId);
         float existingWidth = 0.0f;
         float existingHeight = 0.0f;
-        if (it != elements.end()) {
+        if (it != world.elements.end()) {
             vz = std::get<5>(it->second);
             existingWidth = std::get<6>(it->second);
             existingHeight = std::get<7>(it->second);
         }
-        elements[elementId] = std::make_tuple(x, y, z, vx, vy, vz, existingWidth, existingHeight);
+        bool spawned = it == world.elements.end();
+        world.elements[elementId] = std::make_tuple(x, y, z, vx, vy, vz, existingWidth, existingHeight);
+        world.emit(spawned ? WorldEvent::Type::Spawn : WorldEvent::Type::Update, snapshot::EntityKind::Element, elementId);
     }
 }
 
@@ -81,6 +86,8 @@ void GameClient::handleElementDespawn(const std::vector<uint8_t> &buffer) {
         uint32_t elementId = ntohl(msg->elementId);
         
         std::lock_guard<std::mutex> lock(stateMutex);
-        elements.erase(elementId);
+        WorldState &world = editWorld();
+        if (world.elements.erase(elementId))
+            world.emit(WorldEvent::Type::Despawn, snapshot::EntityKind::Element, elementId);
     }
 }
@@ -37,7 +37,9 @@ void GameClient::handleEnemySpawn(const std::vector<uint8_t> &buffer) {
     std::memcpy(&bh, &h, sizeof(float));
 
     std::lock_guard<std::mutex> g(stateMutex);
-    enemies[enemyId] = std::make_tuple(x, y, z, vx, vy, vz, bw, bh);
+    WorldState &world = editWorld();
+    bool spawned = world.enemies.insert_or_assign(enemyId, std::make_tuple(x, y, z, vx, vy, vz, bw, bh)).second;
+    world.emit(spawned ? WorldEvent::Type::Spawn : WorldEvent::Type::Update, snapshot::EntityKind::Enemy, enemyId);
 }
 
 void GameClient::handleEnemyUpdate(const std::vector<uint8_t>& data) {
@@ -61,16 +63,19 @@ void GameClient::handleEnemyUpdate(const std::vector<uint8_t>& data) {
         std::memcpy(&vy, &vyb, sizeof(float));
 
         std::lock_guard<std::mutex> lock(stateMutex);
+        WorldState &world = editWorld();
         float vz = 0.f;
-        auto it = enemies.find(enemyId);
+        auto it = world.enemies.find(enemyId);
         float existingWidth = 0.0f;
         float existingHeight = 0.0f;
-        if (it != enemies.end()) {
+        if (it != world.enemies.end()) {
             vz = std::get<5>(it->second);
             existingWidth = std::get<6>(it->second);
             existingHeight = std::get<7>(it->second);
         }
-        enemies[enemyId] = std::make_tuple(x, y, z, vx, vy, vz, existingWidth, existingHeight);
+        bool spawned = it == world.enemies.end();
+        world.enemies[enemyId] = std::make_tuple(x, y, z, vx, vy, vz, existingWidth, existingHeight);
+        world.emit(spawned ? WorldEvent::Type::Spawn : WorldEvent::Type::Update, snapshot::EntityKind::Enemy, enemyId);
     }
 }
 
@@ -82,7 +87,9 @@ void GameClient::handleEnemyDespawn(const std::vector<uint8_t> &data) {
 		uint32_t enemyId = ntohl(msg->enemyId);
 
 		std::lock_guard<std::mutex> lock(stateMutex);
-		enemies.erase(enemyId);
+		WorldState &world = editWorld();
+		if (world.enemies.erase(enemyId))
+			world.emit(WorldEvent::Type::Despawn, snapshot::EntityKind::Enemy, enemyId);
 	}
 }
 
@@ -95,5 +102,4 @@ void GameClient::handleBossDeath(const std::vector<uint8_t> &buffer) {
     uint32_t bossId = ntohl(msg.bossId);
     bossDefeated = true;
     _lastBoss = ntohl(msg._lastBoss);
-    fetchFullRegistryAsync();
 }
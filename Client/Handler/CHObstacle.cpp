@@ -39,7 +39,9 @@ void GameClient::handleObstacleSpawn(const std::vector<uint8_t> &buffer) {
     std::memcpy(&vz, &vzb, sizeof(float));
 
     std::lock_guard<std::mutex> g(stateMutex);
-    obstacles[id] = std::make_tuple(x, y, z, w, h, d, vx, vy, vz);
+    WorldState &world = editWorld();
+    bool spawned = world.obstacles.insert_or_assign(id, std::make_tuple(x, y, z, w, h, d, vx, vy, vz)).second;
+    world.emit(spawned ? WorldEvent::Type::Spawn : WorldEvent::Type::Update, snapshot::EntityKind::Obstacle, id);
 }
 
 void GameClient::handleObstacleUpdate(const std::vector<uint8_t> &buffer) {
@@ -67,13 +69,15 @@ void GameClient::handleObstacleUpdate(const std::vector<uint8_t> &buffer) {
     std::memcpy(&vz, &vzb, sizeof(float));
 
     std::lock_guard<std::mutex> g(stateMutex);
+    WorldState &world = editWorld();
 
-    auto it = obstacles.find(id);
-    if (it != obstacles.end()) {
+    auto it = world.obstacles.find(id);
+    if (it != world.obstacles.end()) {
         float existingWidth = std::get<3>(it->second);
         float existingHeight = std::get<4>(it->second);
         float existingDepth = std::get<5>(it->second);
-        obstacles[id] = std::make_tuple(x, y, z, existingWidth, existingHeight, existingDepth, vx, vy, vz);
+        world.obstacles[id] = std::make_tuple(x, y, z, existingWidth, existingHeight, existingDepth, vx, vy, vz);
+        world.emit(WorldEvent::Type::Update, snapshot::EntityKind::Obstacle, id);
     }
 }
 
@@ -82,5 +86,7 @@ void GameClient::handleObstacleDespawn(const std::vector<uint8_t> &buffer) {
 	const ObstacleDespawnMessage *msg = reinterpret_cast<const ObstacleDespawnMessage *>(buffer.data());
 	uint32_t id = ntohl(msg->obstacleId);
 	std::lock_guard<std::mutex> g(stateMutex);
-	obstacles.erase(id);
+	WorldState &world = editWorld();
+	if (world.obstacles.erase(id))
+		world.emit(WorldEvent::Type::Despawn, snapshot::EntityKind::Obstacle, id);
 }
\ No newline at end of file
@@ -27,7 +27,26 @@ void GameClient::handlePlayerUpdate(const std::vector<uint8_t> &buffer) {
 	std::memcpy(&z, &zb, sizeof(float));
 
 	std::lock_guard<std::mutex> g(stateMutex);
-	players[id] = {x, y, z};
+	WorldState &world = editWorld();
+	bool spawned = world.players.insert_or_assign(id, std::make_tuple(x, y, z)).second;
+	world.emit(spawned ? WorldEvent::Type::Spawn : WorldEvent::Type::Update, snapshot::EntityKind::Player, id);
+}
+
+void GameClient::handlePlayerInputAck(const std::vector<uint8_t> &buffer) {
+	if (buffer.size() < sizeof(PlayerInputAckMessage)) return;
+	const PlayerInputAckMessage *msg = reinterpret_cast<const PlayerInputAckMessage *>(buffer.data());
+	if (ntohl(msg->clientId) != clientId) return;
+
+	uint32_t xb = ntohl(msg->pos.xBits);
+	uint32_t yb = ntohl(msg->pos.yBits);
+	InputAck ack{ntohl(msg->sequence), 0.f, 0.f};
+	std::memcpy(&ack.x, &xb, sizeof(float));
+	std::memcpy(&ack.y, &yb, sizeof(float));
+
+	std::lock_guard<std::mutex> g(stateMutex);
+	WorldState &world = editWorld();
+	world.inputAck = ack;
+	++world.inputAckCount;
 }
 
 void GameClient::handlePlayerSkinUpdate(const std::vector<uint8_t> &buffer) {
@@ -38,11 +57,13 @@ void GameClient::handlePlayerSkinUpdate(const std::vector<uint8_t> &buffer) {
     std::string filename(msg->skinFilename);
 
     std::lock_guard<std::mutex> g(stateMutex);
+    WorldState &world = editWorld();
     if (!filename.empty()) {
-        playerSkins[id] = filename;
+        world.playerSkins[id] = filename;
     } else {
-        playerSkins.erase(id);
+        world.playerSkins.erase(id);
     }
+    world.emit(WorldEvent::Type::Update, snapshot::EntityKind::Player, id);
 }
 
 void GameClient::handlePlayerWeaponUpdate(const std::vector<uint8_t> &buffer) {
@@ -53,10 +74,11 @@ void GameClient::handlePlayerWeaponUpdate(const std::vector<uint8_t> &buffer) {
     std::string weaponId(msg->weaponId);
 
     std::lock_guard<std::mutex> g(stateMutex);
+    WorldState &world = editWorld();
     if (!weaponId.empty()) {
-        playerWeapons[id] = weaponId;
+        world.playerWeapons[id] = weaponId;
     } else {
-        playerWeapons.erase(id);
+        world.playerWeapons.erase(id);
     }
 }
 
@@ -69,8 +91,9 @@ void GameClient::handlePlayerHealth(const std::vector<uint8_t> &buffer) {
 	int16_t maxHealth = ntohs(msg->maxHealth);
 
 	std::lock_guard<std::mutex> g(stateMutex);
+	WorldState &world = editWorld();
 
-	playerHealth[playerId] = {currentHealth, maxHealth};
+	world.playerHealth[playerId] = {currentHealth, maxHealth};
 }
 
 void GameClient::handlePlayerDeath(const std::vector<uint8_t> &buffer) {
@@ -79,7 +102,9 @@ void GameClient::handlePlayerDeath(const std::vector<uint8_t> &buffer) {
 	uint32_t deadPlayerId = ntohl(msg->clientId);
 
 	std::lock_guard<std::mutex> g(stateMutex);
-	players.erase(deadPlayerId);
+	WorldState &world = editWorld();
+	if (world.players.erase(deadPlayerId))
+		world.emit(WorldEvent::Type::Despawn, snapshot::EntityKind::Player, deadPlayerId);
 
 	std::cout << "[Client] Player " << deadPlayerId << " died!" << std::endl;
 
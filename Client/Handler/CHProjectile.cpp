@@ -34,7 +34,8 @@ void GameClient::handleProjectileSpawn(const std::vector<uint8_t> &buffer) {
 	std::memcpy(&vz, &vzb, sizeof(float));
 
 	std::lock_guard<std::mutex> g(stateMutex);
-	projectiles[projId] = std::make_tuple(x, y, z, vx, vy, vz, ownerId);
+	WorldState &world = editWorld();
+	world.projectiles[projId] = std::make_tuple(x, y, z, vx, vy, vz, ownerId);
 }
 
 void GameClient::handleProjectileUpdate(const std::vector<uint8_t> &buffer) {
@@ -53,8 +54,9 @@ void GameClient::handleProjectileUpdate(const std::vector<uint8_t> &buffer) {
     std::memcpy(&z, &zb, sizeof(float));
 
     std::lock_guard<std::mutex> g(stateMutex);
-    auto it = projectiles.find(projId);
-    if (it != projectiles.end()) {
+    WorldState &world = editWorld();
+    auto it = world.projectiles.find(projId);
+    if (it != world.projectiles.end()) {
         std::get<0>(it->second) = x;
         std::get<1>(it->second) = y;
         std::get<2>(it->second) = z;
@@ -67,7 +69,8 @@ void GameClient::handleProjectileDespawn(const std::vector<uint8_t> &buffer) {
 	uint32_t projId = ntohl(msg->projectileId);
 
 	std::lock_guard<std::mutex> g(stateMutex);
-	projectiles.erase(projId);
+	WorldState &world = editWorld();
+	world.projectiles.erase(projId);
 }
 
 void GameClient::handleEnemyProjectileSpawn(const std::vector<uint8_t> &buffer) {
@@ -93,7 +96,8 @@ void GameClient::handleEnemyProjectileSpawn(const std::vector<uint8_t> &buffer)
 	std::memcpy(&vz, &vzb, sizeof(float));
 
 	std::lock_guard<std::mutex> g(stateMutex);
-	enemyProjectiles[projId] = std::make_tuple(x, y, z, vx, vy, vz, ownerId);
+	WorldState &world = editWorld();
+	world.enemyProjectiles[projId] = std::make_tuple(x, y, z, vx, vy, vz, ownerId);
 }
 
 void GameClient::handleEnemyProjectileUpdate(const std::vector<uint8_t> &buffer) {
@@ -112,8 +116,9 @@ void GameClient::handleEnemyProjectileUpdate(const std::vector<uint8_t> &buffer)
 	std::memcpy(&z, &zb, sizeof(float));
 
 	std::lock_guard<std::mutex> g(stateMutex);
-	auto it = enemyProjectiles.find(projId);
-	if (it != enemyProjectiles.end()) {
+	WorldState &world = editWorld();
+	auto it = world.enemyProjectiles.find(projId);
+	if (it != world.enemyProjectiles.end()) {
 		std::get<0>(it->second) = x;
 		std::get<1>(it->second) = y;
 		std::get<2>(it->second) = z;
@@ -127,5 +132,6 @@ void GameClient::handleEnemyProjectileDespawn(const std::vector<uint8_t> &buffer
 	uint32_t projId = ntohl(msg->projectileId);
 
 	std::lock_guard<std::mutex> g(stateMutex);
-	enemyProjectiles.erase(projId);
+	WorldState &world = editWorld();
+	world.enemyProjectiles.erase(projId);
 }
\ No newline at end of file
@@ -0,0 +1,40 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** client_handler
+*/
+
+#include "../client.hpp"
+#include "Logger.hpp"
+
+void GameClient::handleReliable(const std::vector<uint8_t> &buffer) {
+    if (!reliableLink.on_packet(reliable::Connection::Clock::now(), buffer.data(), buffer.size())) {
+        LOG_DEBUG("Dropping malformed reliable datagram");
+        return;
+    }
+
+    reliable::Channel channel;
+    while (reliableLink.receive(channel, reliableMessage)) {
+        if (channel == reliable::Channel::Registry) {
+            auto snapshot = game::serializer::decode_snapshot(reliableMessage.data(), reliableMessage.size());
+            if (!snapshot) {
+                LOG_ERROR("handleReliable(): invalid full registry snapshot");
+                continue;
+            }
+            storeFullRegistry(std::move(*snapshot), true);
+            continue;
+        }
+        if (reliableMessage.empty())
+            continue;
+        MessageType type = static_cast<MessageType>(reliableMessage[0]);
+        if (type != MessageType::Reliable)
+            handleMessage(type, reliableMessage);
+    }
+}
+
+void GameClient::flushReliable() {
+    reliableLink.flush(reliable::Connection::Clock::now(), [this](const uint8_t *data, std::size_t size) {
+        socket.sendTo(data, size, serverEndpoint);
+    });
+}
@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** client_handler
+*/
+
+#include "../client.hpp"
+#include "Logger.hpp"
+
+void GameClient::handleSnapshot(const std::vector<uint8_t> &buffer) {
+    using Result = snapshot::SnapshotReceiver::Result;
+
+    snapshotRecords.clear();
+    Result result = snapshotReceiver.receive(buffer.data(), buffer.size(), snapshotRecords);
+    if (result == Result::Malformed) {
+        LOG_DEBUG("Dropping malformed snapshot chunk");
+        return;
+    }
+    if (result != Result::Applied && result != Result::Completed)
+        return;
+
+    if (result == Result::Completed) {
+        SnapshotAckMessage ack{};
+        ack.type = MessageType::SnapshotAck;
+        ack.clientId = htonl(clientId);
+        ack.tick = htonl(snapshotReceiver.completedTick());
+        socket.sendTo(&ack, sizeof(ack), serverEndpoint);
+        interpolation.push(snapshotReceiver.completedTick(), *snapshotReceiver.completedWorld(),
+                           snapshot::InterpolationBuffer::now());
+    }
+
+    std::lock_guard<std::mutex> g(stateMutex);
+    WorldState &world = editWorld();
+    for (const auto &record : snapshotRecords) {
+        switch (record.kind) {
+            case snapshot::EntityKind::Player: {
+                bool spawned = world.players.insert_or_assign(record.id, std::make_tuple(record.x, record.y, record.z)).second;
+                world.emit(spawned ? WorldEvent::Type::Spawn : WorldEvent::Type::Update, record.kind, record.id);
+                break;
+            }
+            case snapshot::EntityKind::Enemy:
+            case snapshot::EntityKind::Element: {
+                auto &entities = record.kind == snapshot::EntityKind::Enemy ? world.enemies : world.elements;
+                float vz = 0.f;
+                float existingWidth = 0.0f;
+                float existingHeight = 0.0f;
+                auto it = entities.find(record.id);
+                bool spawned = it == entities.end();
+                if (!spawned) {
+                    vz = std::get<5>(it->second);
+                    existingWidth = std::get<6>(it->second);
+                    existingHeight = std::get<7>(it->second);
+                }
+                entities[record.id] = std::make_tuple(record.x, record.y, record.z, record.vx, record.vy, vz,
+                                                      existingWidth, existingHeight);
+                world.emit(spawned ? WorldEvent::Type::Spawn : WorldEvent::Type::Update, record.kind, record.id);
+                break;
+            }
+            case snapshot::EntityKind::Obstacle: {
+                auto it = world.obstacles.find(record.id);
+                if (it != world.obstacles.end()) {
+                    it->second = std::make_tuple(record.x, record.y, record.z, std::get<3>(it->second),
+                                                 std::get<4>(it->second), std::get<5>(it->second),
+                                                 record.vx, record.vy, record.vz);
+                    world.emit(WorldEvent::Type::Update, record.kind, record.id);
+                }
+                break;
+            }
+            case snapshot::EntityKind::Projectile:
+            case snapshot::EntityKind::EnemyProjectile: {
+                auto &shots = record.kind == snapshot::EntityKind::Projectile ? world.projectiles : world.enemyProjectiles;
+                auto it = shots.find(record.id);
+                if (it != shots.end()) {
+                    std::get<0>(it->second) = record.x;
+                    std::get<1>(it->second) = record.y;
+                    std::get<2>(it->second) = record.z;
+                }
+                break;
+            }
+        }
+    }
+}
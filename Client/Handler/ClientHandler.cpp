@@ -110,6 +110,15 @@ void GameClient::handleMessage(MessageType type, const std::vector<uint8_t> &buf
         case MessageType::ElementDespawn:
             handleElementDespawn(buffer);
             break;
+        case MessageType::Snapshot:
+            handleSnapshot(buffer);
+            break;
+        case MessageType::PlayerInputAck:
+            handlePlayerInputAck(buffer);
+            break;
+        case MessageType::Reliable:
+            handleReliable(buffer);
+            break;
         default:
             break;
     }
@@ -120,7 +129,7 @@ void GameClient::handleServerAssignId(const std::vector<uint8_t> &buffer) {
     const ServerAssignIdMessage *msg = reinterpret_cast<const ServerAssignIdMessage *>(buffer.data());
     clientId = ntohl(msg->clientId);
     std::cout << "[Client] Reçu clientId=" << clientId << std::endl;
-    initTcpConnection();
+    reliableLink = reliable::Connection(clientId);
     std::string pendingSkin;
     std::string pendingWeapon;
     {
@@ -175,6 +184,13 @@ void GameClient::handleGameStart(const std::vector<uint8_t> &buffer) {
 	if (buffer.size() < sizeof(GameStartMessage)) return;
 	const GameStartMessage *msg = reinterpret_cast<const GameStartMessage *>(buffer.data());
 	std::cout << "Le jeu commence ! Nombre de joueurs : " << ntohl(msg->clientCount) << std::endl;
+	snapshotReceiver.reset();
+	interpolation.setTickRate(ntohl(msg->tickRate));
+	{
+		std::lock_guard<std::mutex> g(stateMutex);
+		WorldState &world = editWorld();
+		world.inputAck.reset();
+	}
 	_game.setGameStatus(GameStatus::RUNNING);
 }
 
@@ -202,7 +218,8 @@ void GameClient::handleGlobalScore(const std::vector<uint8_t> &buffer) {
 	int32_t globalScore = ntohl(msg->totalScore);
 
 	std::lock_guard<std::mutex> g(stateMutex);
-	this->globalScore = globalScore;
+	WorldState &world = editWorld();
+	world.globalScore = globalScore;
 }
 
 void GameClient::handleIndividualScore(const std::vector<uint8_t> &buffer) {
@@ -213,7 +230,8 @@ void GameClient::handleIndividualScore(const std::vector<uint8_t> &buffer) {
 	uint32_t score = ntohl(msg->score);
 
 	std::lock_guard<std::mutex> g(stateMutex);
-	playerIndividualScores[playerId] = score;
+	WorldState &world = editWorld();
+	world.playerIndividualScores[playerId] = score;
 }
 
 void GameClient::handleChatMessage(const std::vector<uint8_t> &buffer) {
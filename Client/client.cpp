@@ -10,6 +10,7 @@
 #include "../Engine/Game.hpp"
 #include "../Engine/Utils/Include/serializer.hpp"
 #include <asio.hpp>
+#include <algorithm>
 #include <cstring>
 
 GameClient::GameClient(Game &game, const std::string &serverIp, uint16_t serverPort, const std::string &name)
@@ -99,17 +100,6 @@ void GameClient::sendClientLeaveRoom() {
     socket.sendTo(&msg, sizeof(msg), serverEndpoint);
 }
 
-void GameClient::initTcpConnection() {
-    if (clientId == 0) return;
-
-    uint16_t tcpPort = 5000 + clientId;
-    tcpClient = std::make_unique<TCP_socket>();
-
-    if (!tcpClient->connectToServer(serverIpStr, tcpPort)) {
-        return;
-    }
-}
-
 void GameClient::recvLoop() {
     while (running) {
         std::vector<uint8_t> buffer;
@@ -120,46 +110,47 @@ void GameClient::recvLoop() {
             }
             MessageType type = *reinterpret_cast<MessageType *>(buffer.data());
             handleMessage(type, buffer);
+            if (++unpublishedMessages >= MAX_UNPUBLISHED_MESSAGES)
+                publishWorld();
         } else {
+            publishWorld();
+            flushReliable();
             std::this_thread::sleep_for(std::chrono::milliseconds(1));
         }
     }
 }
 
-void GameClient::sendInputEvent(InputCode code, bool pressed) {
-    if (clientId == 0)
+void GameClient::sendInputCommands(uint32_t sequence, const uint8_t *buttons, std::size_t count) {
+    if (clientId == 0 || count == 0)
         return;
     ClientInputMessage m{};
     m.type = MessageType::ClientInput;
     m.clientId = htonl(clientId);
+    m.sequence = htonl(sequence);
+    m.count = static_cast<uint8_t>(std::min(count, INPUT_REDUNDANCY));
+    std::memcpy(m.buttons, buttons, m.count);
+    socket.sendTo(&m, sizeof(m), serverEndpoint);
+}
+
+void GameClient::sendInputEvent(InputCode code, bool pressed) {
+    if (clientId == 0)
+        return;
+    ClientInputEventMessage m{};
+    m.type = MessageType::ClientInputEvent;
+    m.clientId = htonl(clientId);
     m.inputCode = static_cast<uint8_t>(code);
     m.isPressed = pressed ? 1 : 0;
     socket.sendTo(&m, sizeof(m), serverEndpoint);
 }
 
-void GameClient::sendSceneState(SceneState scene, ecs::registry* registry) {
+void GameClient::sendSceneState(SceneState scene) {
     SceneStateMessage msg{};
     msg.type = MessageType::SceneState;
     msg.clientId = htonl(clientId);
     msg.scene = htonl(static_cast<uint32_t>(scene));
+    if (scene == SceneState::GAME)
+        hasPendingFullRegistry.store(false, std::memory_order_release);
     socket.sendTo(&msg, sizeof(msg), serverEndpoint);
-
-    if (scene == SceneState::GAME) {
-        if (!tcpClient) {
-            initTcpConnection();
-            if (!tcpClient) {
-                return;
-            }
-        }
-        nlohmann::json fullRegistry = tcpClient->receiveJson();
-        if (fullRegistry.is_null()) {
-            return;
-        }
-        storeFullRegistry(fullRegistry, true);
-        if (registry) {
-            game::serializer::deserialize_entities(*registry, fullRegistry);
-        }
-    }
 }
 
 void GameClient::sendShoot() {
@@ -216,7 +207,9 @@ void GameClient::sendSkinSelection(const std::string &skinFilename) {
         std::lock_guard<std::mutex> lock(stateMutex);
         pendingSkinSelection = skinFilename;
         if (clientId != 0) {
-            playerSkins[clientId] = skinFilename;
+            WorldState &world = editWorld();
+            world.playerSkins[clientId] = skinFilename;
+            world.emit(WorldEvent::Type::Update, snapshot::EntityKind::Player, clientId);
         }
     }
 
@@ -248,7 +241,7 @@ void GameClient::sendWeaponSelection(const std::string &weaponId) {
         std::lock_guard<std::mutex> lock(stateMutex);
         pendingWeaponSelection = weaponId;
         if (clientId != 0) {
-            playerWeapons[clientId] = weaponId;
+            editWorld().playerWeapons[clientId] = weaponId;
         }
     }
 
@@ -271,15 +264,47 @@ void GameClient::sendWeaponSelection(const std::string &weaponId) {
     }
 }
 
-void GameClient::storeFullRegistry(const nlohmann::json &registryJson, bool markPending) {
+const WorldState &GameClient::world() {
+    return worldBuffer.read();
+}
+
+WorldState &GameClient::editWorld() {
+    worldDirty = true;
+    return worldBuffer.back();
+}
+
+void GameClient::acknowledgeEvents(uint64_t next) {
+    eventsApplied.store(next, std::memory_order_release);
+}
+
+void GameClient::publishWorld() {
+    unpublishedMessages = 0;
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (!worldDirty)
+        return;
+    WorldState &world = worldBuffer.back();
+    uint64_t applied = eventsApplied.load(std::memory_order_acquire);
+    if (applied > world.firstEvent) {
+        std::size_t done = static_cast<std::size_t>(std::min<uint64_t>(applied - world.firstEvent, world.events.size()));
+        world.events.erase(world.events.begin(), world.events.begin() + done);
+        world.firstEvent += done;
+    }
+    if (world.events.size() > MAX_PENDING_EVENTS) {
+        world.firstEvent += world.events.size();
+        world.events.clear();
+    }
+    worldBuffer.publish();
+    worldDirty = false;
+}
+
+void GameClient::storeFullRegistry(game::serializer::RegistrySnapshot snapshot, bool markPending) {
     std::lock_guard<std::mutex> lock(registryMutex);
-    latestFullRegistry = registryJson;
-    if (markPending) {
+    latestFullRegistry = std::move(snapshot);
+    if (markPending)
         hasPendingFullRegistry.store(true, std::memory_order_release);
-    }
 }
 
-std::optional<nlohmann::json> GameClient::consumeFullRegistry() {
+std::optional<game::serializer::RegistrySnapshot> GameClient::consumeFullRegistry() {
     std::lock_guard<std::mutex> lock(registryMutex);
     if (!hasPendingFullRegistry.load(std::memory_order_acquire)) {
         return std::nullopt;
@@ -288,25 +313,6 @@ std::optional<nlohmann::json> GameClient::consumeFullRegistry() {
     return latestFullRegistry;
 }
 
-void GameClient::fetchFullRegistryAsync() {
-    if (!tcpClient || !tcpClient->isConnected()) {
-        return;
-    }
-
-    bool expected = false;
-    if (!fullRegistryFetchInFlight.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
-        return;
-    }
-
-    std::thread([this]() {
-        nlohmann::json fullRegistry = tcpClient->receiveJson();
-        if (!fullRegistry.is_null()) {
-            storeFullRegistry(fullRegistry, true);
-        }
-        fullRegistryFetchInFlight.store(false, std::memory_order_release);
-    }).detach();
-}
-
 const std::string &GameClient::getClientName() const {
     return clientName;
 }
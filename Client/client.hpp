@@ -8,10 +8,14 @@
 #pragma once
 
 #include "../Shared/protocol.hpp"
+#include "../Shared/Snapshot.hpp"
+#include "../Shared/Interpolation.hpp"
+#include "../Shared/TripleBuffer.hpp"
 #include "../Shared/Sockets/Include/UDP_socket.hpp"
-#include "../Shared/Sockets/Include/TCP_socket.hpp"
+#include "../Shared/Sockets/Include/ReliableChannel.hpp"
 #include "../Engine/Core/Include/registry.hpp"
 #include "serializer.hpp"
+#include "registry_snapshot.hpp"
 #include <asio.hpp>
 #include <cstring>
 #include <iostream>
@@ -31,11 +35,78 @@
 
 class Game;
 
+/**
+ * @struct WorldEvent
+ * @brief One change of a networked entity, in the order the network saw it.
+ *
+ * Events only name the entity: its state is read from the WorldState they
+ * were published with, so several updates of an entity between two frames
+ * cost one lookup each and always apply its newest state.
+ */
+struct WorldEvent {
+    enum class Type : uint8_t {
+        Spawn,   ///< The entity appeared.
+        Update,  ///< The entity's state changed.
+        Despawn  ///< The entity is gone.
+    };
+
+    Type type;
+    snapshot::EntityKind kind; ///< Player, Enemy, Obstacle or Element.
+    uint32_t id;               ///< Server id of the entity.
+};
+
+/**
+ * @struct WorldState
+ * @brief Everything the server told the client about the game in progress.
+ *
+ * The receive thread edits one copy and publishes it through a
+ * TripleBuffer; the game thread reads the latest published copy with
+ * GameClient::world(), without locking nor copying.
+ */
+struct WorldState {
+    /**
+     * @struct InputAck
+     * @brief Authoritative state of the local player, see PlayerInputAckMessage.
+     */
+    struct InputAck {
+        uint32_t sequence; ///< Last movement command the server applied.
+        float x;           ///< Position after that command.
+        float y;           ///< Position after that command.
+    };
+
+    std::unordered_map<uint32_t, std::tuple<float, float, float>> players; ///< Maps player IDs to their (x, y, z) positions.
+    std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, float, float, float>> obstacles; ///< Maps obstacle IDs to their position and size data.
+    std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, uint32_t>> projectiles; ///< Maps projectile IDs to their position, size, and owner data.
+    std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, float, float>> enemies; ///< Maps enemy IDs to their position and velocity data.
+    std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, float, float>> elements; ///< Maps element IDs to their position, velocity and size data.
+    std::unordered_map<uint32_t, std::pair<int16_t, int16_t>> playerHealth; ///< Maps player IDs to their (current health, max health).
+    std::unordered_map<uint32_t, uint32_t> playerIndividualScores; ///< Maps player IDs to their individual scores.
+    std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, uint32_t>> enemyProjectiles; ///< Maps enemy projectile IDs to their position, velocity, and owner data.
+    std::unordered_map<uint32_t, std::string> playerSkins; ///< Maps player IDs to their selected skin filenames.
+    std::unordered_map<uint32_t, std::string> playerWeapons; ///< Maps player IDs to their selected weapon identifiers.
+    int32_t globalScore = 0; ///< The shared team score for all players.
+    std::optional<InputAck> inputAck; ///< Newest ack of the local player's movement commands.
+    uint32_t inputAckCount = 0; ///< Acks received so far, to tell a new ack from one already applied.
+    uint64_t firstEvent = 0; ///< Sequence number of events[0].
+    std::vector<WorldEvent> events; ///< Entity changes not yet acknowledged by the game thread.
+
+    /**
+     * @brief Records a change of a networked entity.
+     */
+    void emit(WorldEvent::Type type, snapshot::EntityKind kind, uint32_t id) { events.push_back({type, kind, id}); }
+
+    /**
+     * @brief Sequence number of the next event to be emitted.
+     */
+    uint64_t endEvent() const { return firstEvent + events.size(); }
+};
+
 /**
  * @class GameClient
  * @brief Manages client-side networking for the R-Type multiplayer game.
  *
- * This class handles all communication between the game client and server using both UDP and TCP protocols.
+ * This class handles all communication between the game client and server over UDP, with a reliable
+ * ordered channel on top for the registry sync and critical gameplay events.
  * It manages game state synchronization, player input transmission, and scene transitions.
  * The client runs a dedicated background thread to receive and process server messages asynchronously.
  */
@@ -47,58 +118,78 @@ class GameClient {
         std::thread rxThread; ///< Background thread that continuously receives messages from the server.
         std::atomic<bool> running{false}; ///< Thread-safe flag controlling the client's running state.
         Game &_game; ///< Reference to the main game instance.
-        std::unique_ptr<TCP_socket> tcpClient; ///< TCP connection for reliable data transfer (e.g., registry sync).
+        reliable::Connection reliableLink; ///< Reliable channels with the server; only used by the receive thread.
+        std::vector<uint8_t> reliableMessage; ///< Scratch buffer for messages completed on the reliable channels.
         std::string serverPortStr; ///< Server port number stored as a string.
         std::string serverIpStr; ///< Server IP address stored as a string.
         bool connectionFailed = false; ///< Flag indicating if the initial connection attempt failed.
         std::string pendingSkinSelection; ///< Stores the skin selection waiting to be sent to the server.
         std::string pendingWeaponSelection; ///< Stores the weapon selection waiting to be sent to the server.
         std::mutex registryMutex; ///< Protects access to the full registry data.
-        nlohmann::json latestFullRegistry; ///< Cached copy of the complete game registry received from the server.
+        game::serializer::RegistrySnapshot latestFullRegistry; ///< Cached copy of the complete game registry received from the server.
         std::atomic<bool> hasPendingFullRegistry{false}; ///< Indicates if a new full registry is ready to be consumed.
-        std::atomic<bool> fullRegistryFetchInFlight{false}; ///< Prevents multiple simultaneous registry fetch requests.
 
         /**
          * @brief Stores a complete registry snapshot received from the server.
-         * @param registryJson JSON representation of the full game registry.
+         * @param snapshot Decoded full game registry.
          * @param markPending If true, marks the registry as pending for consumption by the game thread.
          */
 
-        void storeFullRegistry(const nlohmann::json &registryJson, bool markPending);
-
-        /**
-         * @brief Requests the full game registry from the server asynchronously.
-         */
-        void fetchFullRegistryAsync();
+        void storeFullRegistry(game::serializer::RegistrySnapshot snapshot, bool markPending);
         
         std::deque<std::pair<std::string, std::string>> _chatQueue; ///< Queue of chat messages waiting to be processed.
         std::mutex roomsMutex; ///< Protects access to the rooms list.
         std::condition_variable roomsCv; ///< Notifies waiting threads when rooms data is updated.
         bool roomsUpdated{false}; ///< Flag indicating if the rooms list has been refreshed.
         std::map<int, game::serializer::RoomData> rooms; ///< Map of available game rooms indexed by room ID.
+        snapshot::SnapshotReceiver snapshotReceiver; ///< Rebuilds delta snapshots; only used by the receive thread.
+        std::vector<snapshot::EntityState> snapshotRecords; ///< Scratch list reused to decode snapshot chunks.
+        TripleBuffer<WorldState> worldBuffer; ///< World edited by the network, read by the game thread.
+        bool worldDirty = false; ///< The back buffer changed since the last publish; guarded by stateMutex.
+        std::size_t unpublishedMessages = 0; ///< Messages handled since the last publish; receive thread only.
+        static constexpr std::size_t MAX_UNPUBLISHED_MESSAGES = 64; ///< Publish at least this often under a steady stream.
+        std::atomic<uint64_t> eventsApplied{0}; ///< Events the game thread is done with; written by acknowledgeEvents().
+        static constexpr std::size_t MAX_PENDING_EVENTS = 1 << 14; ///< Beyond this, events are dropped and the reader resyncs.
+
+        /**
+         * @brief The world copy the network edits. Caller must hold stateMutex.
+         */
+        WorldState &editWorld();
+
+        /**
+         * @brief Makes the edits so far visible to world(), if there are any.
+         *
+         * Events the game thread acknowledged are trimmed first. If it fell
+         * too far behind (e.g. no scene is consuming them), all pending events
+         * are dropped: firstEvent jumps past them and tells the reader to
+         * rebuild from the maps instead.
+         */
+        void publishWorld();
 
     public:
         uint32_t clientId{0}; ///< Unique identifier assigned to this client by the server.
         int roomId{-1}; ///< ID of the room the client is currently in (-1 if not in a room).
-        std::mutex stateMutex; ///< Protects access to shared game state data structures.
-
-        std::unordered_map<uint32_t, std::tuple<float, float, float>> players; ///< Maps player IDs to their (x, y, z) positions.
-        std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, float, float, float>> obstacles; ///< Maps obstacle IDs to their position and size data.
-        std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, uint32_t>> projectiles; ///< Maps projectile IDs to their position, size, and owner data.
-        std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, float, float>> enemies; ///< Maps enemy IDs to their position and velocity data.
-        std::unordered_map<uint32_t, std::pair<int16_t, int16_t>> playerHealth; ///< Maps player IDs to their (current health, max health).
-        std::unordered_map<uint32_t, uint32_t> playerIndividualScores; ///< Maps player IDs to their individual scores.
-        std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, uint32_t>> enemyProjectiles; ///< Maps enemy projectile IDs to their position, velocity, and owner data.
-        std::unordered_map<uint32_t, std::string> playerSkins; ///< Maps player IDs to their selected skin filenames.
-        std::unordered_map<uint32_t, std::string> playerWeapons; ///< Maps player IDs to their selected weapon identifiers.
-        int32_t globalScore = 0; ///< The shared team score for all players.
+        std::mutex stateMutex; ///< Serializes edits of the world and guards the chat queue.
+        snapshot::InterpolationBuffer interpolation; ///< Complete snapshots, smoothed for rendering without stateMutex.
+
+        using InputAck = WorldState::InputAck;
         std::atomic<bool> bossDefeated{false}; ///< Thread-safe flag indicating if the boss has been defeated.
         bool _lastBoss = false; ///< Flag indicating if the current boss is the final boss of the game.
 
         /**
-         * @brief Maps elements IDs to their (x,y,velX,velY).
+         * @brief Latest world published by the network thread.
+         *
+         * Game thread only. Neither locks nor copies; the reference stays
+         * valid until the next call.
          */
-        std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, float, float>> elements;
+        const WorldState &world();
+
+        /**
+         * @brief Game thread only: events before this sequence number were
+         *        applied and can be dropped from the next published worlds.
+         * @param next Sequence number of the first event not applied yet.
+         */
+        void acknowledgeEvents(uint64_t next);
 
         /**
          * @brief Waits for the rooms list to be updated by the server.
@@ -161,18 +252,21 @@ class GameClient {
         void sendClientLeaveRoom();
 
         /**
-         * @brief Establishes a TCP connection to the server for reliable data transfer.
+         * @brief Main loop that continuously receives and processes UDP messages from the server.
          */
-        void initTcpConnection();
+        void recvLoop();
 
         /**
-         * @brief Main loop that continuously receives and processes UDP messages from the server.
+         * @brief Sends the newest movement commands to the server.
+         * @param sequence Sequence number of buttons[0].
+         * @param buttons Button masks (movement::Button), newest first.
+         * @param count Number of commands, at most INPUT_REDUNDANCY are sent.
          */
-        void recvLoop();
+        void sendInputCommands(uint32_t sequence, const uint8_t *buttons, std::size_t count);
 
         /**
-         * @brief Sends player input events to the server.
-         * @param code The type of input (e.g., move up, shoot).
+         * @brief Sends a key press or release to the server (Smash Bros mode).
+         * @param code The type of input (e.g., move up, jump).
          * @param pressed true if the input is pressed, false if released.
          */
         void sendInputEvent(InputCode code, bool pressed);
@@ -185,9 +279,9 @@ class GameClient {
 
         /**
          * @brief Retrieves and clears the pending full registry if available.
-         * @return An optional containing the registry JSON if available, or empty if none pending.
+         * @return An optional containing the registry snapshot if available, or empty if none pending.
          */
-        std::optional<nlohmann::json> consumeFullRegistry();
+        std::optional<game::serializer::RegistrySnapshot> consumeFullRegistry();
 
         /**
          * @brief Notifies the server whether endless mode is enabled.
@@ -250,6 +344,31 @@ class GameClient {
          */
         void handlePlayerUpdate(const std::vector<uint8_t> &buffer);
 
+        /**
+         * @brief Processes one chunk of the per-tick world snapshot.
+         * @param buffer Raw message data.
+         *
+         * Chunks older than the newest complete tick are dropped, so a late
+         * datagram never moves entities back in time. Once every chunk of a
+         * tick arrived, the tick is acked so the server can use it as baseline.
+         */
+        void handleSnapshot(const std::vector<uint8_t> &buffer);
+
+        /**
+         * @brief Processes a datagram of the reliable channels.
+         * @param buffer Raw message data.
+         *
+         * Registry messages are stored as the pending full registry; event
+         * messages are dispatched like any other message, in the order the
+         * server sent them. The ack goes out with the next flushReliable().
+         */
+        void handleReliable(const std::vector<uint8_t> &buffer);
+
+        /**
+         * @brief Sends the acks and resends due on the reliable channels.
+         */
+        void flushReliable();
+
         /**
          * @brief Sends the selected player skin to the server.
          * @param skinFilename Filename of the skin asset.
@@ -268,6 +387,12 @@ class GameClient {
          */
         void handlePlayerSkinUpdate(const std::vector<uint8_t> &buffer);
 
+        /**
+         * @brief Stores the server's ack of the local player's movement commands.
+         * @param buffer Raw PlayerInputAckMessage.
+         */
+        void handlePlayerInputAck(const std::vector<uint8_t> &buffer);
+
         /**
          * @brief Processes a server message updating a player's weapon.
          * @param buffer Raw message data.
@@ -294,10 +419,11 @@ class GameClient {
 
         /**
          * @brief Sends the current scene state to the server.
+         *        Entering GAME drops any stale pending registry; the scene
+         *        applies the one the server answers with from consumeFullRegistry().
          * @param scene The current scene (e.g., MENU, GAME).
-         * @param registry Pointer to the ECS registry, used when transitioning to the game scene.
          */
-        void sendSceneState(SceneState scene, ecs::registry* registry);
+        void sendSceneState(SceneState scene);
 
         /**
          * @brief Sends a shoot command to the server.
@@ -10,6 +10,7 @@
 #include <raylib.h>
 
 #include "../../Include/entity.hpp"
+#include "../../Include/sparse_array.hpp"
 #include "DynamicPosition.hpp"
 #include <string>
 #include <cstdint>
@@ -316,4 +317,18 @@ namespace component {
         uint32_t id{0}; ///< Unique client identifier assigned by the server.
     };
 
-}
\ No newline at end of file
+}
+
+// =========================
+// STORAGE POLICIES
+// =========================
+
+/**
+ * Large components that only a handful of entities own are stored packed
+ * (see ecs::dense_storage) instead of one std::optional per entity.
+ */
+template <> struct ecs::storage_policy<component::sprite> { using type = ecs::dense_storage; };
+template <> struct ecs::storage_policy<component::model3D> { using type = ecs::dense_storage; };
+template <> struct ecs::storage_policy<component::audio> { using type = ecs::dense_storage; };
+template <> struct ecs::storage_policy<component::text> { using type = ecs::dense_storage; };
+template <> struct ecs::storage_policy<component::font> { using type = ecs::dense_storage; };
@@ -43,10 +43,10 @@ namespace game::entities {
     }
 
     void setup_enemy_ai_system(ecs::registry &reg) {
-        reg.add_system<component::velocity, component::type>(
+        reg.add_system(ecs::reads<component::type>{}, ecs::writes<component::velocity>{},
             [](ecs::registry &reg,
-            ecs::sparse_array<component::velocity> &vel,
-            ecs::sparse_array<component::type> &type) 
+            ecs::sparse_array<component::type> const &type,
+            ecs::sparse_array<component::velocity> &vel) 
             {
                 for (std::size_t i = 0; i < vel.size() && i < type.size(); ++i) {
                     if (vel[i] && type[i] && type[i]->value == component::entity_type::ENEMY) {
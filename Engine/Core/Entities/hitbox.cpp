@@ -34,13 +34,13 @@ ecs::entity_t create_hitbox_for(ecs::registry &reg, ecs::entity_t owner) {
 }
 
 void setup_hitbox_sync_system(ecs::registry &reg) {
-    reg.add_system<component::position, component::collision_box, component::hitbox_link>(
+    reg.add_system(ecs::reads<component::collision_box, component::hitbox_link>{}, ecs::writes<component::position>{},
         [](ecs::registry &reg,
-           ecs::sparse_array<component::position> &hitPos,
-           ecs::sparse_array<component::collision_box> &hitBox,
-           ecs::sparse_array<component::hitbox_link> &link)
+           ecs::sparse_array<component::collision_box> const &hitBox,
+           ecs::sparse_array<component::hitbox_link> const &link,
+           ecs::sparse_array<component::position> &hitPos)
     {
-        auto &positionsAll = reg.get_components<component::position>();
+        auto &positionsAll = hitPos;
         for (std::size_t i = 0; i < hitPos.size() && i < hitBox.size() && i < link.size(); ++i) {
             if (!hitPos[i] || !hitBox[i] || !link[i])
                 continue;
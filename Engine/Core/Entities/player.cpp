@@ -51,20 +51,20 @@ namespace game::entities
 
     void setup_player_control_system(ecs::registry &reg)
     {
-        reg.add_system<component::velocity, component::controllable>(
+        reg.add_system(ecs::reads<component::controllable>{}, ecs::writes<component::velocity>{},
             [](ecs::registry &reg,
-               ecs::sparse_array<component::velocity> &vel,
-               ecs::sparse_array<component::controllable> &ctrl) 
+               ecs::sparse_array<component::controllable> const &ctrl,
+               ecs::sparse_array<component::velocity> &vel) 
             { });
     }
 
     void setup_player_bounds_system(ecs::registry &reg, float screen_width,
         float screen_height, float screen_depth) {
-        reg.add_system<component::position, component::type>(
+        reg.add_system(ecs::reads<component::type>{}, ecs::writes<component::position>{},
             [screen_width, screen_height, screen_depth](
                 ecs::registry &reg,
-                ecs::sparse_array<component::position> &pos,
-                ecs::sparse_array<component::type> &type)
+                ecs::sparse_array<component::type> const &type,
+                ecs::sparse_array<component::position> &pos)
             {
                 for (std::size_t i = 0; i < pos.size() && i < type.size(); ++i) {
                     if (pos[i] && type[i] && type[i]->value == component::entity_type::PLAYER) {
@@ -0,0 +1,53 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** Dense component type identifiers
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace ecs {
+
+namespace detail {
+
+    /**
+     * @brief Hands out the next free component identifier.
+     * @return A process-wide unique identifier, starting from 0.
+     */
+    inline std::size_t next_component_id() noexcept
+    {
+        static std::atomic<std::size_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    template <class Component>
+    std::size_t component_id_of() noexcept
+    {
+        static std::size_t const id = next_component_id();
+        return id;
+    }
+
+} // namespace detail
+
+/**
+ * @brief Dense identifier of a component type.
+ *
+ * Identifiers are assigned on first use and never change for the lifetime of
+ * the process. They are small consecutive integers, so the registry can keep
+ * its pools in a flat array indexed by them instead of hashing a type_index.
+ *
+ * @tparam Component The component type (cv-qualifiers are ignored).
+ * @return The identifier of the component type.
+ */
+template <class Component>
+std::size_t component_id() noexcept
+{
+    return detail::component_id_of<std::remove_cv_t<Component>>();
+}
+
+} // namespace ecs
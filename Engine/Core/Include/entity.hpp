@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 
 namespace ecs {
@@ -19,14 +20,22 @@ namespace ecs {
  * This class encapsulates an entity ID and provides conversions
  * and comparisons for use in an Entity Component System (ECS).
  * It ensures type safety compared to using raw size_t values directly.
+ *
+ * The identifier is an index into component arrays, tagged with a generation
+ * counter. The registry bumps the generation of an index each time it is
+ * recycled, so a handle kept after kill_entity() no longer compares equal to,
+ * nor is considered alive as, the entity that reuses its index.
  */
 class entity_t {
     public:
+        using generation_type = std::uint32_t; ///< Recycling counter type.
+
         /**
          * @brief Construct an entity identifier from a numeric value.
          * @param id The numeric identifier to assign to the entity.
+         * @param generation Generation of the index (0 for a never recycled index).
          */
-        explicit entity_t(std::size_t id) noexcept;
+        explicit entity_t(std::size_t id, generation_type generation = 0) noexcept;
 
         /**
          * @brief Implicit conversion operator to retrieve the identifier.
@@ -40,11 +49,17 @@ class entity_t {
          */
         std::size_t value() const noexcept;
 
+        /**
+         * @brief Accessor for the generation of the entity's index.
+         * @return How many times the index had been recycled when the handle was created.
+         */
+        generation_type generation() const noexcept;
+
         /**
          * @brief Equality operator between two entities.
          * @param lhs Left-hand side entity.
          * @param rhs Right-hand side entity.
-         * @return True if both entities share the same identifier.
+         * @return True if both entities share the same identifier and generation.
          */
         friend bool operator==(const entity_t &lhs, const entity_t &rhs) noexcept;
 
@@ -52,12 +67,13 @@ class entity_t {
          * @brief Inequality operator between two entities.
          * @param lhs Left-hand side entity.
          * @param rhs Right-hand side entity.
-         * @return True if both entities have different identifiers.
+         * @return True if the identifiers or generations differ.
          */
         friend bool operator!=(const entity_t &lhs, const entity_t &rhs) noexcept;
 
     private:
         std::size_t _id; ///< Internal unique entity identifier.
+        generation_type _generation; ///< Generation of the identifier.
 };
 
 } // namespace ecs
@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** Keyed set of entities
+*/
+
+#pragma once
+
+#include "entity.hpp"
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace ecs {
+
+/**
+ * @class entity_index
+ * @brief Entities looked up by an external key (e.g. a network id), and kept
+ *        packed for iteration.
+ *
+ * Entities and their keys live in two parallel dense arrays, and a hash map
+ * gives the slot of each key. insert(), find() and erase() are O(1): erase()
+ * moves the last entity into the freed slot, so iteration order is not
+ * preserved.
+ *
+ * @tparam Key Hashable key type.
+ */
+template <typename Key>
+class entity_index {
+    public:
+        using size_type = std::size_t; ///< Size/index type.
+
+        /**
+         * @brief Add an entity under a key.
+         * @param key Key of the entity.
+         * @param entity Entity to store.
+         * @return False, leaving the index unchanged, if the key is already used.
+         */
+        bool insert(const Key &key, entity_t entity)
+        {
+            if (!_slots.emplace(key, _entities.size()).second)
+                return false;
+            _keys.push_back(key);
+            _entities.push_back(entity);
+            return true;
+        }
+
+        /**
+         * @brief Entity stored under a key.
+         * @param key Key to look up.
+         * @return The entity, or nullptr if the key is unknown.
+         */
+        const entity_t *find(const Key &key) const
+        {
+            auto it = _slots.find(key);
+            return it == _slots.end() ? nullptr : &_entities[it->second];
+        }
+
+        /**
+         * @brief Whether an entity is stored under a key.
+         */
+        bool contains(const Key &key) const { return _slots.find(key) != _slots.end(); }
+
+        /**
+         * @brief Remove the entity stored under a key.
+         * @param key Key of the entity.
+         * @return The removed entity, or std::nullopt if the key is unknown.
+         */
+        std::optional<entity_t> erase(const Key &key)
+        {
+            auto it = _slots.find(key);
+            if (it == _slots.end())
+                return std::nullopt;
+            size_type slot = it->second;
+            entity_t entity = _entities[slot];
+            _slots.erase(it);
+            if (slot + 1 != _entities.size()) {
+                _entities[slot] = _entities.back();
+                _keys[slot] = std::move(_keys.back());
+                _slots[_keys[slot]] = slot;
+            }
+            _entities.pop_back();
+            _keys.pop_back();
+            return entity;
+        }
+
+        /**
+         * @brief Remove every entity. Does not kill them.
+         */
+        void clear() noexcept
+        {
+            _slots.clear();
+            _keys.clear();
+            _entities.clear();
+        }
+
+        size_type size() const noexcept { return _entities.size(); }
+        bool empty() const noexcept { return _entities.empty(); }
+
+        /**
+         * @brief Stored entities, packed; keys()[i] is the key of entities()[i].
+         */
+        const std::vector<entity_t> &entities() const noexcept { return _entities; }
+
+        /**
+         * @brief Keys of the stored entities, in the order of entities().
+         */
+        const std::vector<Key> &keys() const noexcept { return _keys; }
+
+    private:
+        std::unordered_map<Key, size_type> _slots; ///< Key -> slot in the dense arrays.
+        std::vector<Key> _keys;                    ///< Key of each slot.
+        std::vector<entity_t> _entities;           ///< Entity of each slot.
+};
+
+} // namespace ecs
@@ -7,17 +7,18 @@
 
 #pragma once
 
-#include <unordered_map>
-#include <typeindex>
-#include <any>
 #include <stdexcept>
 #include <functional>
+#include <memory>
 #include <vector>
 #include <type_traits>
 #include <queue>
 
+#include "component_id.hpp"
 #include "sparse_array.hpp"
 #include "entity.hpp"
+#include "scheduler.hpp"
+#include "view.hpp"
 
 namespace ecs {
 
@@ -26,7 +27,7 @@ namespace ecs {
      * @brief Core ECS registry that manages entities, components, and systems.
      *
      * The registry is the central hub of the Entity Component System architecture.
-     * It stores all components in sparse arrays indexed by component type,
+     * It stores all components in sparse arrays indexed by component_id(),
      * manages entity lifecycle (creation and destruction), and executes systems
      * that process entities with specific component combinations.
      */
@@ -45,8 +46,8 @@ namespace ecs {
              * @brief Registers a component type and returns its sparse array.
              *
              * If the component type is already registered, returns the existing sparse array.
-             * Otherwise, creates a new sparse array for this component type and registers
-             * an eraser function for entity cleanup.
+             * Otherwise, creates a new sparse array for this component type, which is
+             * cleaned up by kill_entity.
              *
              * @tparam Component The component type to register.
              * @return Reference to the sparse array containing all components of this type.
@@ -54,22 +55,20 @@ namespace ecs {
             template <class Component>
             sparse_array<Component> &register_component()
             {
-                const std::type_index key = std::type_index(typeid(Component));
-                auto it = _components_arrays.find(key);
-                if (it == _components_arrays.end()) {
-                    it = _components_arrays.emplace(key, std::any{sparse_array<Component>{}}).first;
-                    // Register eraser for kill_entity
-                    _erasers.emplace_back([](registry &r, entity_t const &e) {
-                        std::size_t idx = static_cast<std::size_t>(e);
-                        r.get_components<Component>().erase(idx);
-                    });
-                }
-                return std::any_cast<sparse_array<Component> &>(it->second);
+                const std::size_t id = component_id<Component>();
+                if (id >= _pools.size())
+                    _pools.resize(id + 1);
+                if (!_pools[id])
+                    _pools[id] = std::make_unique<pool<Component>>();
+                return static_cast<pool<Component> &>(*_pools[id]).components;
             }
 
             /**
              * @brief Retrieves the sparse array for a component type.
              *
+             * The lookup is an index into a flat array. The returned reference stays
+             * valid until clear(), so hot loops can fetch it once and reuse it.
+             *
              * @tparam Component The component type to retrieve.
              * @return Reference to the sparse array containing all components of this type.
              * @throws std::runtime_error if the component type is not registered.
@@ -77,12 +76,7 @@ namespace ecs {
             template <class Component>
             sparse_array<Component> &get_components()
             {
-                const std::type_index key = std::type_index(typeid(Component));
-                auto it = _components_arrays.find(key);
-                if (it == _components_arrays.end()) {
-                    throw std::runtime_error("Component type not registered");
-                }
-                return std::any_cast<sparse_array<Component> &>(it->second);
+                return static_cast<pool<Component> &>(find_pool(component_id<Component>())).components;
             }
 
             /**
@@ -95,12 +89,50 @@ namespace ecs {
             template <class Component>
             sparse_array<Component> const &get_components() const
             {
-                const std::type_index key = std::type_index(typeid(Component));
-                auto it = _components_arrays.find(key);
-                if (it == _components_arrays.end()) {
-                    throw std::runtime_error("Component type not registered");
-                }
-                return std::any_cast<sparse_array<Component> const &>(it->second);
+                return static_cast<pool<Component> const &>(find_pool(component_id<Component>())).components;
+            }
+
+            /**
+             * @brief Checks whether a component type has been registered.
+             *
+             * @tparam Component The component type to look for.
+             * @return True if get_components<Component>() would succeed.
+             */
+            template <class Component>
+            bool has_components() const noexcept
+            {
+                const std::size_t id = component_id<Component>();
+                return id < _pools.size() && _pools[id];
+            }
+
+            // --- Views ---
+
+            /**
+             * @brief Builds a view over entities owning all the given components.
+             *
+             * Iteration is driven by the smallest pool and probes the others by index.
+             *
+             * @tparam Components Component types the entities must own.
+             * @return View yielding tuples of component references.
+             * @throws std::runtime_error if a component type is not registered.
+             */
+            template <class... Components>
+            containers::view<Components...> view()
+            {
+                return containers::view<Components...>(get_components<Components>()...);
+            }
+
+            /**
+             * @brief Same as view(), with the entity index as first tuple element.
+             *
+             * @tparam Components Component types the entities must own.
+             * @return View yielding (index, component references...) tuples.
+             * @throws std::runtime_error if a component type is not registered.
+             */
+            template <class... Components>
+            containers::indexed_view<Components...> indexed_view()
+            {
+                return containers::indexed_view<Components...>(get_components<Components>()...);
             }
 
             // --- Systems ---
@@ -110,6 +142,8 @@ namespace ecs {
              *
              * Systems are functions that process entities containing all specified component types.
              * The system receives references to the sparse arrays of the requested components.
+             * Such a system may use the whole registry (spawn, kill, add or remove components),
+             * so it always runs alone, after every system registered before it.
              *
              * @tparam Components Component types the system operates on.
              * @tparam Function The function type (callable).
@@ -119,18 +153,54 @@ namespace ecs {
             void add_system(Function &&f)
             {
                 using Fn = std::decay_t<Function>;
-                _systems.emplace_back([this, func = Fn(std::forward<Function>(f))](registry &r) {
+                _scheduler.add([func = Fn(std::forward<Function>(f))](registry &r) {
                     func(r, static_cast<sparse_array<Components> &>(r.get_components<Components>())...);
-                });
+                }, system_access{{}, {}, true});
+            }
+
+            /**
+             * @brief Registers a system with a declared access, allowing it to run in parallel.
+             *
+             * The system receives const references to the arrays it reads, then references to
+             * the arrays it writes. It must not touch any other component array nor change
+             * the set of entities or components; systems whose accesses do not conflict may
+             * run at the same time.
+             *
+             * @code
+             * reg.add_system(ecs::reads<velocity>{}, ecs::writes<position>{},
+             *     [](ecs::registry &, ecs::sparse_array<velocity> const &vel, ecs::sparse_array<position> &pos) { ... });
+             * @endcode
+             *
+             * @tparam Read Component types only read.
+             * @tparam Write Component types written.
+             * @tparam Function The function type (callable).
+             * @param f The system function to register.
+             */
+            template <class... Read, class... Write, typename Function>
+            void add_system(reads<Read...>, writes<Write...>, Function &&f)
+            {
+                using Fn = std::decay_t<Function>;
+                _scheduler.add([func = Fn(std::forward<Function>(f))](registry &r) {
+                    registry const &cr = r;
+                    func(r, cr.get_components<Read>()..., r.get_components<Write>()...);
+                }, system_access{{component_id<Read>()...}, {component_id<Write>()...}, false});
             }
 
             /**
-             * @brief Executes all registered systems in order.
+             * @brief Executes all registered systems.
              *
-             * Each system processes entities that have the components it requires.
+             * Systems run in registration order, except that consecutive systems with
+             * non-conflicting declared accesses run concurrently on the worker threads.
              */
             void run_systems();
 
+            /**
+             * @brief Sets how many worker threads help run_systems().
+             *
+             * @param count Worker thread count; 0 runs every system on the calling thread.
+             */
+            void set_system_workers(std::size_t count) { _scheduler.set_worker_count(count); }
+
             // --- Entities ---
 
             /**
@@ -144,19 +214,28 @@ namespace ecs {
              * @brief Converts an index to an entity identifier.
              *
              * @param idx The index to convert.
-             * @return The entity identifier corresponding to the index.
+             * @return The entity identifier corresponding to the index, tagged with its current generation.
              */
             entity_t entity_from_index(std::size_t idx) const;
 
             /**
              * @brief Destroys an entity and removes all its components.
              *
-             * The entity ID is recycled and can be reused for future entities.
+             * The entity ID is recycled and can be reused for future entities,
+             * under a new generation. Killing a dead or stale handle does nothing.
              *
              * @param e The entity to destroy.
              */
             void kill_entity(entity_t const &e);
 
+            /**
+             * @brief Checks in O(1) whether a handle still designates a living entity.
+             *
+             * @param e The entity to check.
+             * @return False if the entity was killed, even if its index has been reused since.
+             */
+            bool is_alive(entity_t const &e) const;
+
             /**
              * @brief Adds a component to an entity by moving it.
              *
@@ -204,34 +283,75 @@ namespace ecs {
             /**
              * @brief Retrieves all currently alive entities.
              *
-             * @return Vector of entity identifiers for all non-destroyed entities.
+             * The list is maintained on spawn/kill, so reading it allocates nothing.
+             * Order is not sorted by index: killing an entity moves the last one into its place.
+             *
+             * @return Dense list of entity identifiers for all non-destroyed entities.
              */
-            std::vector<entity_t> alive_entities() const;
+            std::vector<entity_t> const &alive_entities() const { return _alive; }
 
             /**
              * @brief Completely clears the registry and resets all state.
              *
-             * Removes all components, entities, systems, and erasers.
+             * Removes all components, entities and systems.
              * Resets entity ID generation to start from 0 again.
              * This is typically used when switching between game scenes or completely resetting the game world.
              */
             void clear()
             {
-                _components_arrays.clear();
-                _systems.clear();
-                _erasers.clear();
+                _pools.clear();
+                _scheduler.clear();
 
                 _next_entity_id = 0;
                 while (!_free_ids.empty())
                     _free_ids.pop();
+                _generations.clear();
+                _alive.clear();
+                _alive_slots.clear();
             }
 
         private:
-            std::unordered_map<std::type_index, std::any> _components_arrays; ///< Maps component types to their sparse arrays.
-            std::vector<std::function<void(registry &)>> _systems; ///< Registered system functions.
-            std::vector<std::function<void(registry &, entity_t const &)>> _erasers; ///< Component cleanup functions for entity destruction.
+            /**
+             * @struct pool_base
+             * @brief Type-erased owner of a component sparse array.
+             */
+            struct pool_base {
+                virtual ~pool_base() = default;
+
+                /**
+                 * @brief Removes the component of an entity, if any.
+                 * @param idx Index of the entity.
+                 */
+                virtual void erase(std::size_t idx) = 0;
+            };
+
+            /**
+             * @struct pool
+             * @brief Sparse array of one component type.
+             */
+            template <class Component>
+            struct pool final : pool_base {
+                sparse_array<Component> components; ///< Components of every entity.
+
+                void erase(std::size_t idx) override { components.erase(idx); }
+            };
+
+            pool_base &find_pool(std::size_t id) const
+            {
+                if (id >= _pools.size() || !_pools[id])
+                    throw std::runtime_error("Component type not registered");
+                return *_pools[id];
+            }
+
+            std::vector<std::unique_ptr<pool_base>> _pools; ///< Component pools indexed by component_id(), null if unregistered.
+            scheduler _scheduler; ///< Registered systems and the threads running them.
             std::queue<std::size_t> _free_ids; ///< Pool of recycled entity IDs available for reuse.
             std::size_t _next_entity_id{0}; ///< Counter for generating new entity IDs.
+            std::vector<entity_t::generation_type> _generations; ///< Current generation of each entity ID.
+            std::vector<entity_t> _alive; ///< Dense list of alive entities.
+            std::vector<std::size_t> _alive_slots; ///< Entity ID -> position in _alive, npos if dead.
+
+            static constexpr std::size_t npos = static_cast<std::size_t>(-1); ///< Marker for a dead entity ID.
         };
 
 } // namespace ecs
\ No newline at end of file
@@ -0,0 +1,139 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** System scheduler
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ecs {
+
+    class registry;
+
+    /**
+     * @struct reads
+     * @brief Tag listing the components a system only reads.
+     * @tparam Components Component types read by the system.
+     */
+    template <class... Components>
+    struct reads {};
+
+    /**
+     * @struct writes
+     * @brief Tag listing the components a system modifies.
+     * @tparam Components Component types written by the system.
+     */
+    template <class... Components>
+    struct writes {};
+
+    /**
+     * @struct system_access
+     * @brief Components a system touches, by component_id().
+     *
+     * An exclusive system may do anything with the registry (spawn, kill,
+     * add or remove components) and never runs alongside another system.
+     */
+    struct system_access {
+        std::vector<std::size_t> reads;  ///< Components read only.
+        std::vector<std::size_t> writes; ///< Components written.
+        bool exclusive{false};           ///< Whether the system needs the whole registry.
+
+        /**
+         * @brief Whether two systems must keep their registration order.
+         * @param other Access of the other system.
+         * @return True if either system is exclusive or one writes a component the other touches.
+         */
+        bool conflicts_with(system_access const &other) const;
+    };
+
+    /**
+     * @class scheduler
+     * @brief Runs registered systems, in parallel when their accesses allow it.
+     *
+     * Systems are grouped into stages: a system goes in the stage right after
+     * the last earlier system it conflicts with. Systems in the same stage
+     * touch disjoint data and run concurrently on a worker pool; stages run
+     * one after another. Conflicting systems therefore always run in
+     * registration order, which keeps results identical to a sequential run.
+     *
+     * Worker threads are only started the first time a stage holds more
+     * than one system.
+     */
+    class scheduler {
+        public:
+            using system_fn = std::function<void(registry &)>; ///< Type-erased system.
+
+            /**
+             * @brief Create a scheduler with one worker per extra hardware thread.
+             */
+            scheduler();
+
+            /**
+             * @brief Create a scheduler with a given number of worker threads.
+             * @param workers Threads helping the caller; 0 runs everything on the caller.
+             */
+            explicit scheduler(std::size_t workers);
+
+            ~scheduler();
+            scheduler(scheduler &&) noexcept;
+            scheduler &operator=(scheduler &&) noexcept;
+            scheduler(scheduler const &) = delete;
+            scheduler &operator=(scheduler const &) = delete;
+
+            /**
+             * @brief Append a system.
+             * @param fn The system to run.
+             * @param access Components the system touches.
+             */
+            void add(system_fn fn, system_access access);
+
+            /**
+             * @brief Run every system once, stage by stage.
+             * @param reg Registry handed to each system.
+             * @throws Rethrows the first exception raised by a system of the failing stage.
+             */
+            void run(registry &reg);
+
+            /**
+             * @brief Remove every system. Worker threads are kept.
+             */
+            void clear();
+
+            /**
+             * @brief Change the number of worker threads.
+             * @param workers Threads helping the caller; 0 runs everything on the caller.
+             */
+            void set_worker_count(std::size_t workers);
+
+            /**
+             * @brief Number of worker threads helping the caller.
+             * @return Worker count.
+             */
+            std::size_t worker_count() const noexcept { return _workers; }
+
+            /**
+             * @brief Stages of the current system list.
+             * @return For each stage, the indices of its systems in registration order.
+             */
+            std::vector<std::vector<std::size_t>> const &stages();
+
+        private:
+            class worker_pool;
+
+            void build();
+
+            std::vector<system_fn> _systems;                  ///< Systems in registration order.
+            std::vector<system_access> _accesses;             ///< Access of each system.
+            std::vector<std::vector<std::size_t>> _stages;    ///< Cached stages, rebuilt when dirty.
+            bool _dirty{false};                               ///< Whether _stages is out of date.
+            std::size_t _workers{0};                          ///< Requested worker count.
+            std::unique_ptr<worker_pool> _pool;               ///< Worker threads, created on demand.
+    };
+
+} // namespace ecs
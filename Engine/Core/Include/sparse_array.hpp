@@ -12,9 +12,64 @@
 #include <cstddef>
 #include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace ecs {
 
+/**
+ * @struct optional_storage
+ * @brief Storage policy tag: one std::optional slot per entity index (default).
+ *
+ * Best for small components present on most entities (position, velocity, type...).
+ */
+struct optional_storage {};
+
+/**
+ * @struct dense_storage
+ * @brief Storage policy tag: sparse set with packed components.
+ *
+ * Components are kept contiguous in a dense array, next to the list of owning
+ * entity indices, and a sparse index maps entity -> dense slot. Empty entities
+ * only cost one index, and iteration only visits live components.
+ * Best for large components attached to few entities (sprite, text, font...).
+ */
+struct dense_storage {};
+
+/**
+ * @struct storage_policy
+ * @brief Selects the storage policy used by sparse_array for a component type.
+ *
+ * Specialize it next to a component definition to opt into dense_storage:
+ * @code
+ * template <> struct ecs::storage_policy<component::sprite> { using type = ecs::dense_storage; };
+ * @endcode
+ *
+ * @tparam Component Component type.
+ */
+template <typename Component>
+struct storage_policy {
+    using type = optional_storage; ///< Selected storage tag.
+};
+
+template <typename Component, typename Storage = typename storage_policy<Component>::type>
+class sparse_array;
+
+/**
+ * @struct is_dense_pool
+ * @brief True for sparse arrays using dense_storage, whose begin()/end() walk the
+ *        live components in dense order instead of one slot per entity index.
+ *
+ * @tparam Container Container type.
+ */
+template <typename Container>
+struct is_dense_pool : std::false_type {};
+
+template <typename Component>
+struct is_dense_pool<sparse_array<Component, dense_storage>> : std::true_type {};
+
+template <typename Container>
+inline constexpr bool is_dense_pool_v = is_dense_pool<std::remove_const_t<Container>>::value;
+
 /**
  * @class sparse_array
  * @brief Sparse container for storing components by entity index.
@@ -25,10 +80,19 @@ namespace ecs {
  * This allows direct O(1) access to components while keeping memory proportional
  * to the number of active entities.
  *
+ * Next to the slots, the array keeps a packed list of the indices owning a
+ * component (owners()), so views can walk a sparsely populated pool without
+ * visiting every slot. insert_at, emplace_at and erase keep it exact; an index
+ * handed out through the mutable operator[] is listed in case the caller fills
+ * the slot, and prune_owners() drops it again if it stayed empty. Filling
+ * empty slots through begin()/end() iterators is not tracked.
+ *
  * @tparam Component Type of the component stored in the array.
  */
-template <typename Component>
+template <typename Component, typename Storage>
 class sparse_array {
+    static_assert(std::is_same_v<Storage, optional_storage>, "Unknown sparse_array storage policy");
+
     public:
         using value_type = std::optional<Component>;              ///< Optional component per entity.
         using reference_type = value_type &;                      ///< Mutable reference to a component slot.
@@ -39,6 +103,8 @@ class sparse_array {
         using iterator = typename container_t::iterator;          ///< Mutable iterator.
         using const_iterator = typename container_t::const_iterator; ///< Const iterator.
 
+        static constexpr size_type npos = static_cast<size_type>(-1); ///< Marker for "not listed".
+
     public:
         // === Construction / assignment ===
 
@@ -54,10 +120,20 @@ class sparse_array {
 
         /**
          * @brief Access component slot at given index (auto-resizes if necessary).
+         *
+         * The index is listed in owners() since the caller may fill the slot.
+         *
          * @param idx Entity index.
          * @return Mutable reference to the optional component.
          */
-        reference_type operator[](size_t idx) { ensure_size(idx + 1); return _data[idx]; }
+        reference_type operator[](size_t idx) {
+            ensure_size(idx + 1);
+            if (_owner_slots[idx] == npos) {
+                track(idx);
+                _unverified = true;
+            }
+            return _data[idx];
+        }
 
         /**
          * @brief Access component slot at given index (const).
@@ -67,6 +143,14 @@ class sparse_array {
          */
         const_reference_type operator[](size_t idx) const { return idx < _data.size() ? _data[idx] : _nullopt; }
 
+        /**
+         * @brief Unchecked access to a stored component.
+         * @param idx Entity index; contains(idx) must be true.
+         * @return Reference to the component.
+         */
+        Component &get(size_type idx) { return *_data[idx]; }
+        Component const &get(size_type idx) const { return *_data[idx]; }
+
         // === Iteration ===
 
         iterator begin() { return _data.begin(); }
@@ -85,6 +169,40 @@ class sparse_array {
          */
         size_type size() const { return _data.size(); }
 
+        /**
+         * @brief Check whether the entity at the given index owns a component.
+         * @param idx Entity index.
+         * @return True if a component is stored at this index.
+         */
+        bool contains(size_type idx) const { return idx < _data.size() && _data[idx].has_value(); }
+
+        /**
+         * @brief Indices that may own a component, in no particular order.
+         *
+         * Every owner is listed. Indices handed out through the mutable
+         * operator[] and left empty are listed too until prune_owners().
+         *
+         * @return Packed list of entity indices.
+         */
+        std::vector<size_type> const &owners() const { return _owners; }
+
+        /**
+         * @brief Drop the indices of owners() whose slot is empty.
+         *
+         * Free when no index was listed through operator[] since the last call.
+         *
+         * @return Number of components stored, i.e. the size of owners() afterwards.
+         */
+        size_type prune_owners() {
+            if (_unverified) {
+                for (size_type i = _owners.size(); i-- > 0;)
+                    if (!_data[_owners[i]].has_value())
+                        untrack(_owners[i]);
+                _unverified = false;
+            }
+            return _owners.size();
+        }
+
         // === Modifiers ===
 
         /**
@@ -96,6 +214,7 @@ class sparse_array {
         reference_type insert_at(size_type pos, Component const &c) {
             ensure_size(pos + 1);
             _data[pos] = c;
+            track(pos);
             return _data[pos];
         }
 
@@ -108,6 +227,7 @@ class sparse_array {
         reference_type insert_at(size_type pos, Component &&c) {
             ensure_size(pos + 1);
             _data[pos] = std::move(c);
+            track(pos);
             return _data[pos];
         }
 
@@ -123,6 +243,7 @@ class sparse_array {
             ensure_size(pos + 1);
             _data[pos].reset();
             _data[pos].emplace(Component{std::forward<Params>(params)...});
+            track(pos);
             return _data[pos];
         }
 
@@ -135,6 +256,7 @@ class sparse_array {
         void erase(size_type pos) {
             if (pos < _data.size()) {
                 _data[pos].reset();
+                untrack(pos);
             }
         }
 
@@ -160,12 +282,305 @@ class sparse_array {
          * @param n Minimum required size.
          */
         void ensure_size(size_type n) {
-            if (_data.size() < n) _data.resize(n);
+            if (_data.size() < n) {
+                _data.resize(n);
+                _owner_slots.resize(n, npos);
+            }
+        }
+
+        /**
+         * @brief List an index in owners() if it is not already.
+         * @param pos Entity index, below size().
+         */
+        void track(size_type pos) {
+            if (_owner_slots[pos] != npos)
+                return;
+            _owner_slots[pos] = _owners.size();
+            _owners.push_back(pos);
+        }
+
+        /**
+         * @brief Remove an index from owners() by swapping the last one into its place.
+         * @param pos Entity index, below size().
+         */
+        void untrack(size_type pos) {
+            size_type slot = _owner_slots[pos];
+            if (slot == npos)
+                return;
+            _owners[slot] = _owners.back();
+            _owner_slots[_owners[slot]] = slot;
+            _owners.pop_back();
+            _owner_slots[pos] = npos;
         }
 
     private:
         container_t _data{};                ///< Underlying storage of optional components.
+        std::vector<size_type> _owners{};   ///< Indices that may own a component.
+        std::vector<size_type> _owner_slots{}; ///< Entity index -> position in _owners, npos if not listed.
+        bool _unverified{false};            ///< Whether operator[] listed indices since the last prune_owners().
         static inline const value_type _nullopt{}; ///< Static empty optional for out-of-bounds access.
 };
 
+/**
+ * @class sparse_array<Component, dense_storage>
+ * @brief Sparse set storage for components selected with dense_storage.
+ *
+ * Keeps the same indexing API as the optional-based sparse_array
+ * (operator[], insert_at, emplace_at, erase, size), but slots are returned as
+ * lightweight proxies behaving like std::optional<Component>&. Removal is a
+ * swap-and-pop in the dense array, so pointers to components are not stable
+ * across erase; proxies are, since they re-resolve the entity index.
+ *
+ * Iterating with begin()/end() visits live components only, in dense order;
+ * entities() gives the owning entity index of each of them.
+ *
+ * @tparam Component Type of the component stored in the array.
+ */
+template <typename Component>
+class sparse_array<Component, dense_storage> {
+    template <bool Const>
+    class basic_slot;
+
+    public:
+        using value_type = Component;                             ///< Packed component type.
+        using reference_type = basic_slot<false>;                 ///< Mutable optional-like proxy to a slot.
+        using const_reference_type = basic_slot<true>;            ///< Const optional-like proxy to a slot.
+        using container_t = std::vector<Component>;               ///< Dense component storage.
+        using size_type = typename container_t::size_type;        ///< Size/index type.
+
+        using iterator = typename container_t::iterator;          ///< Mutable iterator over live components.
+        using const_iterator = typename container_t::const_iterator; ///< Const iterator over live components.
+
+        static constexpr size_type npos = static_cast<size_type>(-1); ///< Marker for "no dense slot".
+
+    public:
+        // === Construction / assignment ===
+
+        sparse_array() = default;
+        sparse_array(sparse_array const &) = default;
+        sparse_array(sparse_array &&) noexcept = default;
+        ~sparse_array() = default;
+
+        sparse_array &operator=(sparse_array const &) = default;
+        sparse_array &operator=(sparse_array &&) noexcept = default;
+
+        // === Access ===
+
+        /**
+         * @brief Access component slot at given index (auto-resizes the sparse index if necessary).
+         * @param idx Entity index.
+         * @return Proxy behaving like a mutable std::optional<Component>&.
+         */
+        reference_type operator[](size_t idx) { ensure_size(idx + 1); return reference_type{this, idx}; }
+
+        /**
+         * @brief Access component slot at given index (const).
+         * @param idx Entity index.
+         * @return Proxy behaving like a const std::optional<Component>&, empty if out of bounds.
+         */
+        const_reference_type operator[](size_t idx) const { return const_reference_type{this, idx}; }
+
+        /**
+         * @brief Unchecked access to a stored component.
+         * @param idx Entity index; contains(idx) must be true.
+         * @return Reference to the component.
+         */
+        Component &get(size_type idx) { return _dense[_sparse[idx]]; }
+        Component const &get(size_type idx) const { return _dense[_sparse[idx]]; }
+
+        // === Iteration ===
+
+        iterator begin() { return _dense.begin(); }
+        const_iterator begin() const { return _dense.begin(); }
+        const_iterator cbegin() const { return _dense.cbegin(); }
+
+        iterator end() { return _dense.end(); }
+        const_iterator end() const { return _dense.end(); }
+        const_iterator cend() const { return _dense.cend(); }
+
+        /**
+         * @brief Entity indices owning each live component, parallel to begin()/end().
+         * @return Dense list of entity indices.
+         */
+        std::vector<size_type> const &entities() const { return _entities; }
+
+        // === Capacity ===
+
+        /**
+         * @brief Get the size of the sparse index (highest entity index touched + 1).
+         * @return Current index size, same meaning as for the optional storage.
+         */
+        size_type size() const { return _sparse.size(); }
+
+        /**
+         * @brief Get the number of live components.
+         * @return Size of the dense array.
+         */
+        size_type dense_size() const { return _dense.size(); }
+
+        /**
+         * @brief Check whether the entity at the given index owns a component.
+         * @param idx Entity index.
+         * @return True if a component is stored at this index.
+         */
+        bool contains(size_type idx) const { return idx < _sparse.size() && _sparse[idx] != npos; }
+
+        // === Modifiers ===
+
+        /**
+         * @brief Insert or replace a component at the given index.
+         * @param pos Entity index.
+         * @param c Component instance to insert.
+         * @return Proxy to the inserted component slot.
+         */
+        reference_type insert_at(size_type pos, Component const &c) {
+            store(pos, c);
+            return reference_type{this, pos};
+        }
+
+        /**
+         * @brief Insert or replace a component at the given index (move version).
+         * @param pos Entity index.
+         * @param c Component instance to insert (moved).
+         * @return Proxy to the inserted component slot.
+         */
+        reference_type insert_at(size_type pos, Component &&c) {
+            store(pos, std::move(c));
+            return reference_type{this, pos};
+        }
+
+        /**
+         * @brief Construct a component in place at the given index.
+         * @tparam Params Constructor parameter types.
+         * @param pos Entity index.
+         * @param params Parameters to forward to the Component constructor.
+         * @return Proxy to the emplaced component slot.
+         */
+        template <class... Params>
+        reference_type emplace_at(size_type pos, Params &&...params) {
+            store(pos, Component{std::forward<Params>(params)...});
+            return reference_type{this, pos};
+        }
+
+        /**
+         * @brief Remove a component from the given index.
+         * @param pos Entity index.
+         *
+         * The last dense component is moved into the freed slot.
+         */
+        void erase(size_type pos) {
+            if (!contains(pos))
+                return;
+            size_type slot = _sparse[pos];
+            size_type last = _dense.size() - 1;
+            if (slot != last) {
+                _dense[slot] = std::move(_dense[last]);
+                _entities[slot] = _entities[last];
+                _sparse[_entities[slot]] = slot;
+            }
+            _dense.pop_back();
+            _entities.pop_back();
+            _sparse[pos] = npos;
+        }
+
+        // === Utilities ===
+
+        /**
+         * @brief Get the entity index owning a given component of this container.
+         * @param ref Reference to a component stored in this container.
+         * @return The entity index, or -1 if the component does not belong to this container.
+         */
+        size_type get_index(value_type const &ref) const {
+            auto ptr = std::addressof(ref);
+            auto base = _dense.data();
+            if (ptr >= base && ptr < base + _dense.size()) {
+                return _entities[static_cast<size_type>(ptr - base)];
+            }
+            return static_cast<size_type>(-1);
+        }
+
+    private:
+        /**
+         * @class basic_slot
+         * @brief Optional-like view of one entity slot, resolved through the sparse index on each access.
+         * @tparam Const Whether the slot gives read-only access.
+         */
+        template <bool Const>
+        class basic_slot {
+            using owner_t = std::conditional_t<Const, sparse_array const, sparse_array>;
+            using component_t = std::conditional_t<Const, Component const, Component>;
+
+            public:
+                basic_slot(owner_t *owner, size_type idx) : _owner(owner), _idx(idx) {}
+
+                bool has_value() const { return _owner->contains(_idx); }
+                explicit operator bool() const { return has_value(); }
+
+                component_t &operator*() const { return _owner->_dense[_owner->_sparse[_idx]]; }
+                component_t *operator->() const { return std::addressof(**this); }
+
+                /**
+                 * @brief Checked access, like std::optional::value().
+                 * @throws std::bad_optional_access if the slot is empty.
+                 */
+                component_t &value() const {
+                    if (!has_value())
+                        throw std::bad_optional_access();
+                    return **this;
+                }
+
+                template <bool C = Const, typename = std::enable_if_t<!C>>
+                basic_slot &operator=(Component const &c) { _owner->store(_idx, c); return *this; }
+
+                template <bool C = Const, typename = std::enable_if_t<!C>>
+                basic_slot &operator=(Component &&c) { _owner->store(_idx, std::move(c)); return *this; }
+
+                template <bool C = Const, typename = std::enable_if_t<!C>>
+                basic_slot &operator=(std::nullopt_t) { _owner->erase(_idx); return *this; }
+
+                template <bool C = Const, typename = std::enable_if_t<!C>>
+                void reset() { _owner->erase(_idx); }
+
+                template <class... Params, bool C = Const, typename = std::enable_if_t<!C>>
+                Component &emplace(Params &&...params) {
+                    _owner->store(_idx, Component{std::forward<Params>(params)...});
+                    return **this;
+                }
+
+            private:
+                owner_t *_owner; ///< Array the slot belongs to.
+                size_type _idx;  ///< Entity index of the slot.
+        };
+
+        /**
+         * @brief Insert or overwrite the component of an entity.
+         * @param pos Entity index.
+         * @param c Component to store.
+         */
+        template <typename C>
+        void store(size_type pos, C &&c) {
+            ensure_size(pos + 1);
+            if (_sparse[pos] != npos) {
+                _dense[_sparse[pos]] = std::forward<C>(c);
+                return;
+            }
+            _sparse[pos] = _dense.size();
+            _dense.push_back(std::forward<C>(c));
+            _entities.push_back(pos);
+        }
+
+        /**
+         * @brief Ensure the sparse index has at least `n` entries.
+         * @param n Minimum required size.
+         */
+        void ensure_size(size_type n) {
+            if (_sparse.size() < n) _sparse.resize(n, npos);
+        }
+
+    private:
+        container_t _dense{};              ///< Live components, packed.
+        std::vector<size_type> _entities{}; ///< Entity index of each dense component.
+        std::vector<size_type> _sparse{};   ///< Entity index -> dense slot, npos if empty.
+};
+
 } // namespace ecs
@@ -0,0 +1,201 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** Multi-component views
+*/
+
+#pragma once
+
+#include <tuple>
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include <utility>
+
+#include "sparse_array.hpp"
+
+namespace ecs::containers {
+
+    /**
+     * @class basic_view
+     * @brief Iterates entities owning every requested component, driven by the smallest pool.
+     *
+     * Unlike zipper, which walks all containers slot by slot, a view picks the
+     * pool with the fewest candidates when it is built, walks only that one and
+     * probes the others by entity index. Candidates are the packed entity list
+     * of a pool (entities() for dense storage, owners() for optional storage),
+     * or the shortest slot range when every pool is close to full. Cost is
+     * O(components in the smallest pool), not O(max entity id).
+     *
+     * Dereferencing yields a tuple of component references, so structured
+     * bindings write straight into the pools:
+     * @code
+     * for (auto [pos, vel] : reg.view<component::position, component::velocity>())
+     *     pos.x += vel.vx * dt;
+     * for (auto [idx, pos] : reg.indexed_view<component::position>())
+     *     ...;
+     * @endcode
+     *
+     * Adding or removing components of the viewed types while iterating
+     * invalidates the view.
+     *
+     * @tparam Indexed Whether the entity index is yielded first.
+     * @tparam Components Component types to iterate over.
+     */
+    template <bool Indexed, class... Components>
+    class basic_view {
+        using pools_t = std::tuple<sparse_array<Components> &...>;
+        using sequence_t = std::index_sequence_for<Components...>;
+
+        public:
+            /**
+             * @class iterator
+             * @brief Input iterator over matching entities.
+             */
+            class iterator {
+                public:
+                    using value_type = std::conditional_t<Indexed,
+                        std::tuple<std::size_t, Components &...>,
+                        std::tuple<Components &...>>;      ///< Yielded tuple.
+                    using reference = value_type;           ///< Returned by value (tuple of references).
+                    using pointer = void;                   ///< Pointer access not supported.
+                    using difference_type = std::ptrdiff_t; ///< Signed distance type.
+                    using iterator_category = std::input_iterator_tag; ///< Single pass.
+
+                    iterator(basic_view *view, std::size_t pos) : _view(view), _pos(pos) { skip(); }
+
+                    iterator &operator++() { ++_pos; skip(); return *this; }
+                    iterator operator++(int) { iterator tmp = *this; ++*this; return tmp; }
+
+                    /**
+                     * @brief Dereference operator.
+                     * @return Tuple of component references (prefixed by the entity index for indexed views).
+                     */
+                    value_type operator*() const { return _view->fetch(_view->candidate(_pos), sequence_t{}); }
+
+                    friend bool operator==(iterator const &lhs, iterator const &rhs) { return lhs._pos == rhs._pos; }
+                    friend bool operator!=(iterator const &lhs, iterator const &rhs) { return !(lhs == rhs); }
+
+                private:
+                    /**
+                     * @brief Move forward to the next candidate present in every pool.
+                     */
+                    void skip() {
+                        std::size_t pos = _pos;
+                        std::size_t const end = _view->_candidates;
+                        while (pos < end && !_view->all_contain(_view->candidate(pos), sequence_t{}))
+                            ++pos;
+                        _pos = pos;
+                    }
+
+                    basic_view *_view; ///< View being iterated.
+                    std::size_t _pos;  ///< Position in the driving pool.
+            };
+
+            /**
+             * @brief Build a view over the given pools and select the driving one.
+             * @param pools Sparse arrays of each requested component.
+             */
+            explicit basic_view(sparse_array<Components> &...pools) : _pools(pools...) { pick_driver(sequence_t{}); }
+
+            iterator begin() { return iterator(this, 0); }
+            iterator end() { return iterator(this, _candidates); }
+
+            /**
+             * @brief Upper bound of matches: number of candidates in the driving pool.
+             * @return Candidate count.
+             */
+            std::size_t size_hint() const { return _candidates; }
+
+        private:
+            template <class Pool>
+            static constexpr bool is_dense = is_dense_pool_v<Pool>;
+
+            /**
+             * @brief Select the pool with the fewest candidates.
+             *
+             * The slot range of the shortest optional pool is the fallback,
+             * since no match can exist past it; any pool listing fewer
+             * entities takes over. Owner lists of optional pools may hold
+             * indices left empty through operator[], so the chosen one is
+             * pruned first.
+             */
+            template <std::size_t... Is>
+            void pick_driver(std::index_sequence<Is...>) {
+                std::size_t slots = static_cast<std::size_t>(-1);
+                ((is_dense<sparse_array<Components>> ? 0
+                    : (slots = std::min<std::size_t>(slots, std::get<Is>(_pools).size()), 0)), ...);
+                _candidates = slots;
+                _ids = nullptr;
+                std::size_t driver = sizeof...(Components);
+                ((listed(std::get<Is>(_pools)) < _candidates
+                    ? (_candidates = listed(std::get<Is>(_pools)), driver = Is, 0) : 0), ...);
+                ((Is == driver ? (use_list(std::get<Is>(_pools)), 0) : 0), ...);
+            }
+
+            template <class Pool>
+            static std::size_t listed(Pool const &pool) {
+                if constexpr (is_dense<Pool>)
+                    return pool.dense_size();
+                else
+                    return pool.owners().size();
+            }
+
+            template <class Pool>
+            void use_list(Pool &pool) {
+                if constexpr (is_dense<Pool>) {
+                    _ids = pool.entities().data();
+                } else {
+                    _candidates = pool.prune_owners();
+                    _ids = pool.owners().data();
+                }
+            }
+
+            std::size_t candidate(std::size_t pos) const { return _ids ? _ids[pos] : pos; }
+
+            template <std::size_t... Is>
+            bool all_contain(std::size_t entity, std::index_sequence<Is...>) const {
+                return (probe(std::get<Is>(_pools), entity) && ...);
+            }
+
+            /**
+             * @brief Check one pool for an entity.
+             *
+             * When iteration is driven by slot range, every candidate is below
+             * the size of all optional pools, so their bounds check is skipped.
+             */
+            template <class Pool>
+            bool probe(Pool const &pool, std::size_t entity) const {
+                if constexpr (is_dense<Pool>)
+                    return pool.contains(entity);
+                else
+                    return _ids ? pool.contains(entity) : pool.begin()[entity].has_value();
+            }
+
+            template <std::size_t... Is>
+            typename iterator::value_type fetch(std::size_t entity, std::index_sequence<Is...>) const {
+                if constexpr (Indexed)
+                    return typename iterator::value_type{entity, std::get<Is>(_pools).get(entity)...};
+                else
+                    return typename iterator::value_type{std::get<Is>(_pools).get(entity)...};
+            }
+
+            pools_t _pools;                           ///< Pools of each requested component.
+            std::size_t const *_ids{nullptr};         ///< Entity list of the driving pool, null when driven by slot range.
+            std::size_t _candidates{0};               ///< Candidate count of the driving pool.
+    };
+
+    /**
+     * @brief View yielding component references only.
+     */
+    template <class... Components>
+    using view = basic_view<false, Components...>;
+
+    /**
+     * @brief View yielding the entity index followed by component references.
+     */
+    template <class... Components>
+    using indexed_view = basic_view<true, Components...>;
+
+} // namespace ecs::containers
@@ -14,6 +14,7 @@
 #include <type_traits>
 #include <algorithm>
 #include <initializer_list>
+#include "sparse_array.hpp"
 
 namespace ecs::containers {
 
@@ -29,6 +30,10 @@ namespace ecs::containers {
      */
     template <class... Containers>
     class zipper_iterator {
+        // Slot i of every container must be entity i; dense pools are packed instead.
+        static_assert((!is_dense_pool_v<Containers> && ...),
+            "zipper cannot walk dense_storage components: use registry::view");
+
         template <class Container>
         using iterator_t = decltype(std::declval<Container &>().begin());
 
@@ -159,6 +164,9 @@ namespace ecs::containers {
      * all containers have valid entries. This is essential for ECS systems that
      * operate on entities with specific component combinations.
      *
+     * Components stored with dense_storage are rejected at compile time, their
+     * iterators not being indexed by entity; registry::view handles them.
+     *
      * @tparam Containers Container types to zip together.
      */
     template <class... Containers>
@@ -187,9 +195,11 @@ namespace ecs::containers {
             /**
              * @brief Returns an iterator to the end.
              *
+             * Built with a zero bound so it never dereferences past the containers.
+             *
              * @return Iterator representing the end of iteration.
              */
-            iterator end() { return iterator(_end, _size); }
+            iterator end() { return iterator(_end, 0); }
 
         private:
             /**
@@ -198,9 +208,14 @@ namespace ecs::containers {
             static size_t _compute_size(Containers &...containers) { return std::min({static_cast<size_t>(containers.size())...}); }
 
             /**
-             * @brief Creates a tuple of end iterators from all containers.
+             * @brief Creates a tuple of iterators one past the last common index of all containers.
+             *
+             * Containers may have different sizes; iteration stops at the shortest one.
              */
-            static iterator_tuple _compute_end(Containers &...containers) { return std::make_tuple(containers.end()...); }
+            static iterator_tuple _compute_end(Containers &...containers) {
+                size_t size = _compute_size(containers...);
+                return std::make_tuple(std::next(containers.begin(), size)...);
+            }
 
         private:
             iterator_tuple _begin; ///< Tuple of begin iterators for all containers.
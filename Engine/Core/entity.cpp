@@ -9,13 +9,15 @@
 
 namespace ecs {
 
-entity_t::entity_t(std::size_t id) noexcept : _id(id) {}
+entity_t::entity_t(std::size_t id, generation_type generation) noexcept : _id(id), _generation(generation) {}
 
 entity_t::operator std::size_t() const noexcept { return _id; }
 
 std::size_t entity_t::value() const noexcept { return _id; }
 
-bool operator==(const entity_t &lhs, const entity_t &rhs) noexcept { return lhs._id == rhs._id; }
+entity_t::generation_type entity_t::generation() const noexcept { return _generation; }
+
+bool operator==(const entity_t &lhs, const entity_t &rhs) noexcept { return lhs._id == rhs._id && lhs._generation == rhs._generation; }
 
 bool operator!=(const entity_t &lhs, const entity_t &rhs) noexcept { return !(lhs == rhs); }
 
@@ -6,14 +6,11 @@
 */
 
 #include "Include/registry.hpp"
-#include <unordered_set>
 
 namespace ecs {
 
 void registry::run_systems() {
-    for (auto &sys : _systems) {
-        sys(*this);
-    }
+    _scheduler.run(*this);
 }
 
 entity_t registry::spawn_entity() {
@@ -23,37 +20,39 @@ entity_t registry::spawn_entity() {
         _free_ids.pop();
     } else {
         id = _next_entity_id++;
+        _generations.push_back(0);
+        _alive_slots.push_back(npos);
     }
-    return entity_t{id};
+    entity_t entity{id, _generations[id]};
+    _alive_slots[id] = _alive.size();
+    _alive.push_back(entity);
+    return entity;
 }
 
 entity_t registry::entity_from_index(std::size_t idx) const{
-    return entity_t{idx};
+    return entity_t{idx, idx < _generations.size() ? _generations[idx] : 0};
 }
 
-void registry::kill_entity(entity_t const &e) {
-    for (auto &erase_fn : _erasers) {
-        erase_fn(*this, e);
-    }
-    _free_ids.push(static_cast<std::size_t>(e));
+bool registry::is_alive(entity_t const &e) const {
+    std::size_t idx = static_cast<std::size_t>(e);
+    return idx < _generations.size() && _generations[idx] == e.generation() && _alive_slots[idx] != npos;
 }
 
-std::vector<entity_t> registry::alive_entities() const {
-    std::vector<entity_t> result;
-    result.reserve(_next_entity_id - _free_ids.size());
-    std::unordered_set<std::size_t> dead;
-    std::queue<std::size_t> copy = _free_ids;
-
-    while (!copy.empty()) {
-        dead.insert(copy.front());
-        copy.pop();
-    }
-    for (std::size_t i = 0; i < _next_entity_id; ++i) {
-        if (dead.find(i) == dead.end()) {
-            result.push_back(entity_from_index(i));
-        }
+void registry::kill_entity(entity_t const &e) {
+    if (!is_alive(e))
+        return;
+    std::size_t idx = static_cast<std::size_t>(e);
+    for (auto &p : _pools) {
+        if (p)
+            p->erase(idx);
     }
-    return result;
+    std::size_t slot = _alive_slots[idx];
+    _alive[slot] = _alive.back();
+    _alive_slots[static_cast<std::size_t>(_alive[slot])] = slot;
+    _alive.pop_back();
+    _alive_slots[idx] = npos;
+    ++_generations[idx];
+    _free_ids.push(idx);
 }
 
 } // namespace ecs
@@ -0,0 +1,222 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** System scheduler
+*/
+
+#include "Include/scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace ecs {
+
+namespace {
+
+    bool intersects(std::vector<std::size_t> const &lhs, std::vector<std::size_t> const &rhs)
+    {
+        for (std::size_t id : lhs) {
+            if (std::find(rhs.begin(), rhs.end(), id) != rhs.end())
+                return true;
+        }
+        return false;
+    }
+
+    std::size_t default_worker_count()
+    {
+        unsigned int hw = std::thread::hardware_concurrency();
+        return hw > 1 ? hw - 1 : 0;
+    }
+
+} // namespace
+
+bool system_access::conflicts_with(system_access const &other) const {
+    if (exclusive || other.exclusive)
+        return true;
+    return intersects(writes, other.writes) || intersects(writes, other.reads) || intersects(reads, other.writes);
+}
+
+/**
+ * @class scheduler::worker_pool
+ * @brief Fixed set of threads sharing one batch of jobs at a time with the caller.
+ */
+class scheduler::worker_pool {
+    public:
+        explicit worker_pool(std::size_t count)
+        {
+            _threads.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+                _threads.emplace_back([this]() { work(); });
+        }
+
+        ~worker_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _wake.notify_all();
+            for (auto &thread : _threads)
+                thread.join();
+        }
+
+        /**
+         * @brief Run job(0) .. job(count - 1) on the workers and the caller, and wait for all of them.
+         */
+        void run(std::size_t count, std::function<void(std::size_t)> const &job)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _job = &job;
+                _count = count;
+                _next.store(0, std::memory_order_relaxed);
+                _remaining = count;
+                _error = nullptr;
+                ++_round;
+            }
+            _wake.notify_all();
+            drain(job, count);
+
+            std::exception_ptr error;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _done.wait(lock, [this]() { return _remaining == 0 && _busy == 0; });
+                _job = nullptr;
+                _count = 0;
+                error = _error;
+            }
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+    private:
+        void work()
+        {
+            std::size_t seen = 0;
+            for (;;) {
+                std::function<void(std::size_t)> const *job;
+                std::size_t count;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _wake.wait(lock, [&]() { return _stop || _round != seen; });
+                    if (_stop)
+                        return;
+                    seen = _round;
+                    if (!_job)
+                        continue;
+                    job = _job;
+                    count = _count;
+                    ++_busy;
+                }
+                drain(*job, count);
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    --_busy;
+                }
+                _done.notify_all();
+            }
+        }
+
+        void drain(std::function<void(std::size_t)> const &job, std::size_t count)
+        {
+            for (std::size_t i = _next.fetch_add(1); i < count; i = _next.fetch_add(1)) {
+                std::exception_ptr error;
+                try {
+                    job(i);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (error && !_error)
+                    _error = error;
+                if (--_remaining == 0)
+                    _done.notify_all();
+            }
+        }
+
+        std::vector<std::thread> _threads;
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::condition_variable _done;
+        std::function<void(std::size_t)> const *_job{nullptr};
+        std::size_t _count{0};
+        std::atomic<std::size_t> _next{0};
+        std::size_t _remaining{0};
+        std::size_t _busy{0};
+        std::size_t _round{0};
+        bool _stop{false};
+        std::exception_ptr _error;
+};
+
+scheduler::scheduler() : scheduler(default_worker_count()) {}
+
+scheduler::scheduler(std::size_t workers) : _workers(workers) {}
+
+scheduler::~scheduler() = default;
+scheduler::scheduler(scheduler &&) noexcept = default;
+scheduler &scheduler::operator=(scheduler &&) noexcept = default;
+
+void scheduler::add(system_fn fn, system_access access) {
+    _systems.push_back(std::move(fn));
+    _accesses.push_back(std::move(access));
+    _dirty = true;
+}
+
+void scheduler::clear() {
+    _systems.clear();
+    _accesses.clear();
+    _stages.clear();
+    _dirty = false;
+}
+
+void scheduler::set_worker_count(std::size_t workers) {
+    if (workers == _workers)
+        return;
+    _pool.reset();
+    _workers = workers;
+}
+
+std::vector<std::vector<std::size_t>> const &scheduler::stages() {
+    if (_dirty)
+        build();
+    return _stages;
+}
+
+void scheduler::build() {
+    std::vector<std::size_t> stage_of(_systems.size(), 0);
+
+    _stages.clear();
+    for (std::size_t j = 0; j < _systems.size(); ++j) {
+        std::size_t stage = 0;
+        for (std::size_t i = 0; i < j; ++i) {
+            if (stage_of[i] + 1 > stage && _accesses[i].conflicts_with(_accesses[j]))
+                stage = stage_of[i] + 1;
+        }
+        stage_of[j] = stage;
+        if (stage == _stages.size())
+            _stages.emplace_back();
+        _stages[stage].push_back(j);
+    }
+    _dirty = false;
+}
+
+void scheduler::run(registry &reg) {
+    for (auto const &stage : stages()) {
+        if (stage.size() == 1 || _workers == 0) {
+            for (std::size_t idx : stage)
+                _systems[idx](reg);
+            continue;
+        }
+        if (!_pool)
+            _pool = std::make_unique<worker_pool>(_workers);
+        std::function<void(std::size_t)> const job = [&](std::size_t i) { _systems[stage[i]](reg); };
+        _pool->run(stage.size(), job);
+    }
+}
+
+} // namespace ecs
@@ -0,0 +1,323 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Structure-of-arrays projectile pool
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "SpatialGrid.hpp"
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define PHYSICS_PROJECTILE_SSE 1
+#endif
+
+#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+    #define PHYSICS_RESTRICT __restrict
+#else
+    #define PHYSICS_RESTRICT
+#endif
+
+namespace physics {
+
+    /**
+     * @struct projectile
+     * @brief Values of one projectile, as passed to projectile_pool::spawn().
+     */
+    struct projectile {
+        float x;
+        float y;
+        float vx;
+        float vy;
+        std::uint32_t owner;
+        float damage;
+        float width;
+        float height;
+    };
+
+    /**
+     * @class projectile_pool
+     * @brief Live projectiles stored as parallel arrays, one per field.
+     *
+     * Slots [0, size()) are always packed: despawn() moves the last projectile
+     * into the freed slot. Callers keep handles, not slots; a handle resolves
+     * to the current slot through a table and becomes stale once despawned, so
+     * it is safe to send it over the network and get it back later.
+     *
+     * integrate() and cull() are plain loops over the arrays so the compiler
+     * can vectorize them. An explicit SSE2 integrate_sse() is available on
+     * x86; define PHYSICS_USE_SSE to make integrate() use it. It measures
+     * the same as the auto-vectorized loop (see projectile_benchmark), which
+     * is why it is not the default.
+     */
+    class projectile_pool {
+        public:
+            using handle = std::uint32_t;
+
+            /** @brief Handle that never refers to a live projectile. */
+            static constexpr handle invalid_handle = 0;
+
+            /**
+             * @brief Add a projectile.
+             * @return Handle of the new projectile, never invalid_handle.
+             */
+            handle spawn(projectile const &p)
+            {
+                std::uint32_t index;
+                if (!_free.empty()) {
+                    index = _free.back();
+                    _free.pop_back();
+                } else {
+                    index = static_cast<std::uint32_t>(_slot_of.size());
+                    _slot_of.push_back(0);
+                    _generation.push_back(0);
+                }
+                std::uint32_t generation = (_generation[index] + 1) & GENERATION_MASK;
+                _generation[index] = generation == 0 ? 1 : generation;
+                handle h = (_generation[index] << INDEX_BITS) | index;
+
+                _slot_of[index] = static_cast<std::uint32_t>(_x.size());
+                _x.push_back(p.x);
+                _y.push_back(p.y);
+                _vx.push_back(p.vx);
+                _vy.push_back(p.vy);
+                _owner.push_back(p.owner);
+                _damage.push_back(p.damage);
+                _width.push_back(p.width);
+                _height.push_back(p.height);
+                _handle.push_back(h);
+                return h;
+            }
+
+            /**
+             * @brief Whether a handle refers to a live projectile.
+             */
+            bool contains(handle h) const noexcept
+            {
+                std::uint32_t index = h & INDEX_MASK;
+                return h != invalid_handle && index < _generation.size() && _generation[index] == (h >> INDEX_BITS)
+                    && _slot_of[index] < _handle.size();
+            }
+
+            /**
+             * @brief Current slot of a live projectile.
+             * @return The slot, or npos if the handle is stale.
+             */
+            std::size_t slot_of(handle h) const noexcept
+            {
+                return contains(h) ? _slot_of[h & INDEX_MASK] : npos;
+            }
+
+            /**
+             * @brief Remove a projectile by moving the last one into its slot.
+             * @return False if the handle was already stale.
+             */
+            bool despawn(handle h)
+            {
+                std::size_t slot = slot_of(h);
+                if (slot == npos)
+                    return false;
+                remove_slot(slot);
+                return true;
+            }
+
+            /**
+             * @brief Remove every projectile. Outstanding handles become stale.
+             */
+            void clear()
+            {
+                for (handle h : _handle)
+                    release(h & INDEX_MASK);
+                _x.clear();
+                _y.clear();
+                _vx.clear();
+                _vy.clear();
+                _owner.clear();
+                _damage.clear();
+                _width.clear();
+                _height.clear();
+                _handle.clear();
+            }
+
+            /**
+             * @brief Advance every projectile by its velocity.
+             */
+            void integrate(float dt)
+            {
+#if defined(PHYSICS_PROJECTILE_SSE) && defined(PHYSICS_USE_SSE)
+                integrate_sse(dt);
+#else
+                integrate_scalar(dt);
+#endif
+            }
+
+            /**
+             * @brief integrate() written for the auto-vectorizer.
+             */
+            void integrate_scalar(float dt)
+            {
+                std::size_t n = _x.size();
+                float *PHYSICS_RESTRICT x = _x.data();
+                float *PHYSICS_RESTRICT y = _y.data();
+                float const *PHYSICS_RESTRICT vx = _vx.data();
+                float const *PHYSICS_RESTRICT vy = _vy.data();
+                for (std::size_t i = 0; i < n; ++i)
+                    x[i] += vx[i] * dt;
+                for (std::size_t i = 0; i < n; ++i)
+                    y[i] += vy[i] * dt;
+            }
+
+#ifdef PHYSICS_PROJECTILE_SSE
+            /**
+             * @brief integrate() with explicit SSE2, eight projectiles per step.
+             */
+            void integrate_sse(float dt)
+            {
+                std::size_t n = _x.size();
+                integrate_axis_sse(_x.data(), _vx.data(), n, dt);
+                integrate_axis_sse(_y.data(), _vy.data(), n, dt);
+            }
+#endif
+
+            /**
+             * @brief Remove every projectile whose center left an area.
+             *
+             * A first branch-free pass flags the projectiles to drop, then the
+             * flagged slots are removed from the back so no projectile is
+             * visited twice.
+             *
+             * @param bounds Area to keep; a center on its edge is kept.
+             * @param on_removed Called as on_removed(handle) before each removal.
+             * @return Number of projectiles removed.
+             */
+            template <typename Fn>
+            std::size_t cull(aabb const &bounds, Fn &&on_removed)
+            {
+                std::size_t n = _x.size();
+                _outside.resize(n);
+                float const *PHYSICS_RESTRICT x = _x.data();
+                float const *PHYSICS_RESTRICT y = _y.data();
+                std::uint8_t *PHYSICS_RESTRICT out = _outside.data();
+                for (std::size_t i = 0; i < n; ++i)
+                    out[i] = static_cast<std::uint8_t>((x[i] < bounds.left) | (x[i] > bounds.right)
+                        | (y[i] < bounds.top) | (y[i] > bounds.bottom));
+
+                std::size_t removed = 0;
+                for (std::size_t i = n; i-- > 0;) {
+                    if (!_outside[i])
+                        continue;
+                    on_removed(_handle[i]);
+                    remove_slot(i);
+                    ++removed;
+                }
+                return removed;
+            }
+
+            /**
+             * @brief Number of live projectiles.
+             */
+            std::size_t size() const noexcept { return _x.size(); }
+
+            /**
+             * @brief Whether no projectile is live.
+             */
+            bool empty() const noexcept { return _x.empty(); }
+
+            /**
+             * @brief Handle of the projectile stored in a slot.
+             */
+            handle handle_at(std::size_t slot) const { return _handle[slot]; }
+
+            /**
+             * @brief Values of the projectile stored in a slot.
+             */
+            projectile at(std::size_t slot) const
+            {
+                return {_x[slot], _y[slot], _vx[slot], _vy[slot], _owner[slot], _damage[slot], _width[slot], _height[slot]};
+            }
+
+            /** @brief Field arrays, indexed by slot. */
+            std::vector<float> const &xs() const noexcept { return _x; }
+            std::vector<float> const &ys() const noexcept { return _y; }
+            std::vector<float> const &vxs() const noexcept { return _vx; }
+            std::vector<float> const &vys() const noexcept { return _vy; }
+            std::vector<std::uint32_t> const &owners() const noexcept { return _owner; }
+            std::vector<float> const &damages() const noexcept { return _damage; }
+            std::vector<float> const &widths() const noexcept { return _width; }
+            std::vector<float> const &heights() const noexcept { return _height; }
+
+            static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        private:
+            static constexpr std::uint32_t INDEX_BITS = 20;
+            static constexpr std::uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+            static constexpr std::uint32_t GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+
+#ifdef PHYSICS_PROJECTILE_SSE
+            static void integrate_axis_sse(float *PHYSICS_RESTRICT pos, float const *PHYSICS_RESTRICT vel,
+                                           std::size_t n, float dt)
+            {
+                std::size_t i = 0;
+                __m128 step = _mm_set1_ps(dt);
+                for (; i + 8 <= n; i += 8) {
+                    __m128 a = _mm_add_ps(_mm_loadu_ps(pos + i), _mm_mul_ps(_mm_loadu_ps(vel + i), step));
+                    __m128 b = _mm_add_ps(_mm_loadu_ps(pos + i + 4), _mm_mul_ps(_mm_loadu_ps(vel + i + 4), step));
+                    _mm_storeu_ps(pos + i, a);
+                    _mm_storeu_ps(pos + i + 4, b);
+                }
+                for (; i < n; ++i)
+                    pos[i] += vel[i] * dt;
+            }
+#endif
+
+            template <typename T>
+            static void move_last_into(std::vector<T> &values, std::size_t slot)
+            {
+                values[slot] = values.back();
+                values.pop_back();
+            }
+
+            void remove_slot(std::size_t slot)
+            {
+                release(_handle[slot] & INDEX_MASK);
+                std::size_t last = _x.size() - 1;
+                if (slot != last)
+                    _slot_of[_handle[last] & INDEX_MASK] = static_cast<std::uint32_t>(slot);
+                move_last_into(_x, slot);
+                move_last_into(_y, slot);
+                move_last_into(_vx, slot);
+                move_last_into(_vy, slot);
+                move_last_into(_owner, slot);
+                move_last_into(_damage, slot);
+                move_last_into(_width, slot);
+                move_last_into(_height, slot);
+                move_last_into(_handle, slot);
+            }
+
+            void release(std::uint32_t index)
+            {
+                _slot_of[index] = static_cast<std::uint32_t>(-1);
+                _free.push_back(index);
+            }
+
+            std::vector<float> _x;
+            std::vector<float> _y;
+            std::vector<float> _vx;
+            std::vector<float> _vy;
+            std::vector<std::uint32_t> _owner;
+            std::vector<float> _damage;
+            std::vector<float> _width;
+            std::vector<float> _height;
+            std::vector<handle> _handle;                ///< Handle of each slot.
+            std::vector<std::uint32_t> _slot_of;        ///< Slot of each handle index.
+            std::vector<std::uint32_t> _generation;     ///< Current generation of each handle index.
+            std::vector<std::uint32_t> _free;           ///< Handle indices ready for reuse.
+            std::vector<std::uint8_t> _outside;         ///< Scratch flags for cull().
+    };
+
+} // namespace physics
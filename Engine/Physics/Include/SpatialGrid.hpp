@@ -0,0 +1,193 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Uniform grid broadphase
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace physics {
+
+    /**
+     * @struct aabb
+     * @brief Axis-aligned bounding box, in screen coordinates (y grows downward).
+     */
+    struct aabb {
+        float left;
+        float top;
+        float right;
+        float bottom;
+
+        /**
+         * @brief Build a box from its center and size.
+         */
+        static aabb from_center(float x, float y, float width, float height)
+        {
+            return {x - width * 0.5f, y - height * 0.5f, x + width * 0.5f, y + height * 0.5f};
+        }
+
+        /**
+         * @brief Strict overlap test: touching edges do not overlap.
+         */
+        bool overlaps(aabb const &other) const
+        {
+            return left < other.right && right > other.left && top < other.bottom && bottom > other.top;
+        }
+    };
+
+    /**
+     * @class uniform_grid
+     * @brief Broadphase bucketing boxes into fixed-size cells over a bounded area.
+     *
+     * Usage per tick: clear(), insert() every box, build(), then query() as
+     * many times as needed. build() is a counting sort, so once the buffers
+     * have grown to their working size a tick allocates nothing.
+     *
+     * Boxes outside the area are clamped into the border cells: they are
+     * still found, only less efficiently. A box spanning several cells is
+     * stored in each of them, yet reported once per query.
+     */
+    class uniform_grid {
+        public:
+            /**
+             * @brief Create a grid covering [left, left + width] x [top, top + height].
+             * @param left Left edge of the covered area.
+             * @param top Top edge of the covered area.
+             * @param width Width of the covered area.
+             * @param height Height of the covered area.
+             * @param cell_size Side of a cell; about twice the common object size works well.
+             */
+            uniform_grid(float left, float top, float width, float height, float cell_size)
+                : _left(left), _top(top), _inv_cell(1.f / cell_size),
+                  _cols(std::max(1, static_cast<int>(std::ceil(width / cell_size)))),
+                  _rows(std::max(1, static_cast<int>(std::ceil(height / cell_size)))),
+                  _cell_start(static_cast<std::size_t>(_cols * _rows) + 1, 0)
+            {
+            }
+
+            /**
+             * @brief Remove every box. Buffers keep their capacity.
+             */
+            void clear()
+            {
+                _entries.clear();
+                _cell_items.clear();
+                std::fill(_cell_start.begin(), _cell_start.end(), 0);
+            }
+
+            /**
+             * @brief Queue a box for the next build().
+             * @param id Caller-defined identifier reported by query().
+             * @param box Bounds of the object.
+             * @param layer Bit identifying the kind of object, matched against query masks.
+             */
+            void insert(std::uint32_t id, aabb const &box, std::uint32_t layer = 1)
+            {
+                _entries.push_back({box, id, layer});
+            }
+
+            /**
+             * @brief Bucket every inserted box into its cells.
+             */
+            void build()
+            {
+                std::fill(_cell_start.begin(), _cell_start.end(), 0);
+                for (auto const &entry : _entries)
+                    for_each_cell(entry.box, [this](std::size_t cell) { ++_cell_start[cell + 1]; });
+                for (std::size_t i = 1; i < _cell_start.size(); ++i)
+                    _cell_start[i] += _cell_start[i - 1];
+                _cell_items.resize(_cell_start.back());
+                _cursor.assign(_cell_start.begin(), _cell_start.end() - 1);
+                for (std::uint32_t i = 0; i < _entries.size(); ++i)
+                    for_each_cell(_entries[i].box, [this, i](std::size_t cell) { _cell_items[_cursor[cell]++] = i; });
+            }
+
+            /**
+             * @brief Visit every built box overlapping a region.
+             *
+             * Each matching box is reported once, cells in row-major order.
+             *
+             * @param box Region to test.
+             * @param layers Mask of layers to report.
+             * @param fn Called as fn(id, box) for each overlapping box.
+             */
+            template <typename Fn>
+            void query(aabb const &box, std::uint32_t layers, Fn &&fn) const
+            {
+                int x0 = col_of(box.left);
+                int x1 = col_of(box.right);
+                int y0 = row_of(box.top);
+                int y1 = row_of(box.bottom);
+                bool single_cell = x0 == x1 && y0 == y1;
+                for (int y = y0; y <= y1; ++y) {
+                    for (int x = x0; x <= x1; ++x) {
+                        std::size_t cell = static_cast<std::size_t>(y * _cols + x);
+                        for (std::size_t k = _cell_start[cell]; k < _cell_start[cell + 1]; ++k) {
+                            entry const &other = _entries[_cell_items[k]];
+                            if (!(other.layer & layers) || !other.box.overlaps(box))
+                                continue;
+                            // Report the pair only from the cell holding the top-left corner of the overlap.
+                            if (!single_cell && (col_of(std::max(box.left, other.box.left)) != x
+                                || row_of(std::max(box.top, other.box.top)) != y))
+                                continue;
+                            fn(other.id, other.box);
+                        }
+                    }
+                }
+            }
+
+            /**
+             * @brief Number of boxes inserted since the last clear().
+             */
+            std::size_t size() const noexcept { return _entries.size(); }
+
+        private:
+            struct entry {
+                aabb box;
+                std::uint32_t id;
+                std::uint32_t layer;
+            };
+
+            static int clamp_cell(float value, int count)
+            {
+                if (!(value > 0.f))
+                    return 0;
+                if (value >= static_cast<float>(count - 1))
+                    return count - 1;
+                return static_cast<int>(value);
+            }
+
+            int col_of(float x) const { return clamp_cell((x - _left) * _inv_cell, _cols); }
+            int row_of(float y) const { return clamp_cell((y - _top) * _inv_cell, _rows); }
+
+            template <typename Fn>
+            void for_each_cell(aabb const &box, Fn &&fn) const
+            {
+                int x0 = col_of(box.left);
+                int x1 = col_of(box.right);
+                int y0 = row_of(box.top);
+                int y1 = row_of(box.bottom);
+                for (int y = y0; y <= y1; ++y)
+                    for (int x = x0; x <= x1; ++x)
+                        fn(static_cast<std::size_t>(y * _cols + x));
+            }
+
+            float _left;
+            float _top;
+            float _inv_cell;
+            int _cols;
+            int _rows;
+            std::vector<entry> _entries;               ///< Inserted boxes.
+            std::vector<std::size_t> _cell_start;      ///< Offset of each cell in _cell_items (cells + 1).
+            std::vector<std::uint32_t> _cell_items;    ///< Entry indices grouped by cell.
+            std::vector<std::size_t> _cursor;          ///< Fill position per cell during build().
+    };
+
+} // namespace physics
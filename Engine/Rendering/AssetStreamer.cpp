@@ -0,0 +1,254 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Asset decoding on worker threads
+*/
+
+#include "AssetStreamer.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace rendering {
+
+	AssetStreamer::AssetStreamer(AssetBackend backend, TextureCache &textures, std::size_t workers)
+		: _backend(std::move(backend)), _textures(textures) {
+		if (!_backend.now)
+			_backend.now = [] { return std::chrono::steady_clock::now(); };
+		for (std::size_t i = 0; i < std::max<std::size_t>(workers, 1); ++i)
+			_workers.emplace_back(&AssetStreamer::workerLoop, this);
+	}
+
+	AssetStreamer::~AssetStreamer() {
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stopping = true;
+			_jobs.clear();
+		}
+		_jobReady.notify_all();
+		for (auto &worker : _workers)
+			worker.join();
+		for (auto &[key, entry] : _entries)
+			unload(entry);
+	}
+
+	void AssetStreamer::workerLoop() {
+		std::unique_lock<std::mutex> lock(_mutex);
+		while (true) {
+			_jobReady.wait(lock, [this] { return _stopping || !_jobs.empty(); });
+			if (_stopping)
+				return;
+			std::function<void()> job = std::move(_jobs.front());
+			_jobs.pop_front();
+			++_busy;
+			lock.unlock();
+			job();
+			lock.lock();
+			--_busy;
+			_jobDone.notify_all();
+		}
+	}
+
+	void AssetStreamer::enqueue(std::function<void()> job) {
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_jobs.push_back(std::move(job));
+		}
+		_jobReady.notify_one();
+	}
+
+	void AssetStreamer::request(const std::string &path, Kind kind) {
+		if (path.empty())
+			return;
+		std::string key = TextureCache::normalize(path);
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (!_entries.try_emplace(key, Entry{kind}).second)
+				return;
+			++_stats.pending;
+		}
+		enqueue([this, key] { decode(key); });
+	}
+
+	void AssetStreamer::requestImage(const std::string &path) {
+		request(path, Kind::Image);
+	}
+
+	void AssetStreamer::requestTexture(const std::string &path) {
+		request(path, Kind::Texture);
+	}
+
+	void AssetStreamer::requestSound(const std::string &path) {
+		request(path, Kind::Sound);
+	}
+
+	void AssetStreamer::requestFont(const std::string &path) {
+		request(path, Kind::Font);
+	}
+
+	void AssetStreamer::decodeInto(Entry &entry, const std::string &key) {
+		switch (entry.kind) {
+			case Kind::Image:
+			case Kind::Texture:
+				entry.image = _backend.decodeImage(key);
+				entry.failed = entry.image.data == nullptr;
+				break;
+			case Kind::Sound:
+				entry.wave = _backend.decodeWave(key);
+				entry.failed = entry.wave.data == nullptr;
+				break;
+			case Kind::Font:
+				entry.font = _backend.decodeFont(key);
+				entry.failed = entry.font.atlas.data == nullptr;
+				break;
+		}
+		if (entry.failed)
+			LOG_WARN("Failed to decode asset " << key);
+	}
+
+	void AssetStreamer::decode(const std::string &key) {
+		Entry decoded{Kind::Image};
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			auto it = _entries.find(key);
+			// Taken or cleared while queued.
+			if (it == _entries.end() || it->second.state != State::Queued)
+				return;
+			it->second.state = State::Decoding;
+			decoded.kind = it->second.kind;
+		}
+
+		decodeInto(decoded, key);
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		// take() and clear() wait for decoding entries: it is still there.
+		Entry &entry = _entries.at(key);
+		entry = decoded;
+		entry.state = State::Ready;
+		++_stats.decoded;
+		if (entry.kind == Kind::Texture && !entry.failed)
+			_uploads.push_back(key);
+		_jobDone.notify_all();
+	}
+
+	std::optional<AssetStreamer::Entry> AssetStreamer::take(const std::string &path, std::initializer_list<Kind> kinds) {
+		if (path.empty())
+			return std::nullopt;
+		std::string key = TextureCache::normalize(path);
+		std::unique_lock<std::mutex> lock(_mutex);
+		auto it = _entries.find(key);
+		if (it == _entries.end() || std::find(kinds.begin(), kinds.end(), it->second.kind) == kinds.end())
+			return std::nullopt;
+		if (it->second.state == State::Decoding) {
+			_jobDone.wait(lock, [&] {
+				it = _entries.find(key);
+				return it == _entries.end() || it->second.state != State::Decoding;
+			});
+			if (it == _entries.end())
+				return std::nullopt;
+		}
+
+		Entry entry = it->second;
+		_entries.erase(it);
+		--_stats.pending;
+		++_stats.taken;
+		if (entry.state == State::Queued) {
+			// Still waiting for a worker: its job will find the entry gone.
+			lock.unlock();
+			decodeInto(entry, key);
+		}
+		if (entry.failed)
+			return std::nullopt;
+		return entry;
+	}
+
+	std::optional<Image> AssetStreamer::takeImage(const std::string &path) {
+		std::optional<Entry> entry = take(path, {Kind::Image, Kind::Texture});
+		if (!entry)
+			return std::nullopt;
+		return entry->image;
+	}
+
+	std::optional<Sound> AssetStreamer::takeSound(const std::string &path) {
+		std::optional<Entry> entry = take(path, {Kind::Sound});
+		if (!entry)
+			return std::nullopt;
+		Sound sound = _backend.uploadSound(entry->wave);
+		_backend.unloadWave(entry->wave);
+		return sound;
+	}
+
+	std::optional<Font> AssetStreamer::takeFont(const std::string &path) {
+		std::optional<Entry> entry = take(path, {Kind::Font});
+		if (!entry)
+			return std::nullopt;
+		Font font = _backend.uploadFont(entry->font);
+		_backend.unloadImage(entry->font.atlas);
+		return font;
+	}
+
+	std::size_t AssetStreamer::pump(std::chrono::microseconds budget) {
+		auto deadline = _backend.now() + budget;
+		std::size_t uploaded = 0;
+		std::unique_lock<std::mutex> lock(_mutex);
+		while (!_uploads.empty()) {
+			std::string key = std::move(_uploads.front());
+			_uploads.pop_front();
+			auto it = _entries.find(key);
+			if (it == _entries.end() || it->second.kind != Kind::Texture || it->second.state != State::Ready)
+				continue;
+			Image image = it->second.image;
+			_entries.erase(it);
+			--_stats.pending;
+			++_stats.uploaded;
+			lock.unlock();
+
+			// Nobody holds the handle: the texture stays in VRAM as unused
+			// until a scene acquires it, or the cache budget evicts it.
+			_textures.acquire(key, image);
+			_backend.unloadImage(image);
+			++uploaded;
+			if (_backend.now() >= deadline)
+				break;
+			lock.lock();
+		}
+		return uploaded;
+	}
+
+	void AssetStreamer::unload(Entry &entry) {
+		if (entry.state != State::Ready || entry.failed)
+			return;
+		switch (entry.kind) {
+			case Kind::Image:
+			case Kind::Texture:
+				_backend.unloadImage(entry.image);
+				break;
+			case Kind::Sound:
+				_backend.unloadWave(entry.wave);
+				break;
+			case Kind::Font:
+				_backend.unloadFont(entry.font);
+				break;
+		}
+	}
+
+	void AssetStreamer::clear() {
+		std::unique_lock<std::mutex> lock(_mutex);
+		_jobs.clear();
+		_jobDone.wait(lock, [this] { return _busy == 0; });
+		// Jobs that were running may have requested more.
+		_jobs.clear();
+		for (auto &[key, entry] : _entries)
+			unload(entry);
+		_entries.clear();
+		_uploads.clear();
+		_stats.pending = 0;
+	}
+
+	StreamStats AssetStreamer::stats() const {
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _stats;
+	}
+
+} // namespace rendering
@@ -0,0 +1,187 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Asset decoding on worker threads
+*/
+
+#ifndef RTYPE_ASSETSTREAMER_HPP
+#define RTYPE_ASSETSTREAMER_HPP
+
+#include <raylib.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "TextureCache.hpp"
+
+namespace rendering {
+
+	/**
+	 * @struct DecodedFont
+	 * @brief A font whose glyphs are rasterized but not uploaded yet:
+	 *        font.texture is empty and atlas holds its pixels.
+	 */
+	struct DecodedFont {
+		Font font{};
+		Image atlas{};
+	};
+
+	/**
+	 * @struct AssetBackend
+	 * @brief How assets are read: raylib in the game, fakes in tests.
+	 *
+	 * decode* run on the worker threads and must not touch the GPU nor the
+	 * audio device; upload* and unload* run on the render thread.
+	 */
+	struct AssetBackend {
+		std::function<Image(const std::string &)> decodeImage;
+		std::function<Wave(const std::string &)> decodeWave;
+		std::function<DecodedFont(const std::string &)> decodeFont;
+		std::function<Sound(const Wave &)> uploadSound;
+		std::function<Font(const DecodedFont &)> uploadFont;  ///< Takes over the glyphs, not the atlas.
+		std::function<void(Image)> unloadImage;
+		std::function<void(Wave)> unloadWave;
+		std::function<void(const DecodedFont &)> unloadFont;  ///< Frees a font never uploaded, atlas included.
+		std::function<std::chrono::steady_clock::time_point()> now;  ///< Defaults to steady_clock.
+	};
+
+	/**
+	 * @struct StreamStats
+	 * @brief Counters of an AssetStreamer.
+	 */
+	struct StreamStats {
+		std::size_t decoded{0};   ///< Assets decoded by the workers since the start.
+		std::size_t uploaded{0};  ///< Textures uploaded by pump().
+		std::size_t taken{0};     ///< Assets handed over by take*().
+		std::size_t pending{0};   ///< Assets requested and not handed over yet.
+	};
+
+	/**
+	 * @class AssetStreamer
+	 * @brief Reads images, sounds and fonts ahead of time, on worker threads,
+	 *        so that loading a scene or a level does not stall a frame.
+	 *
+	 * Requests only name a file. A worker decodes it into RAM; then:
+	 * - a texture is uploaded to the TextureCache by pump(), which the render
+	 *   loop calls once per frame with a time budget, so a level's textures
+	 *   trickle into VRAM over several frames and acquire() later hits;
+	 * - an image, a sound or a font waits in RAM until the render thread
+	 *   takes it, uploading it itself (e.g. an image packed into an atlas).
+	 *
+	 * Taking an asset still being decoded waits for it; taking one still
+	 * queued decodes it on the spot. Either way the caller gets std::nullopt
+	 * only for files never requested or that failed to decode, and then
+	 * loads them the usual way.
+	 *
+	 * Requests and enqueue() may come from any thread; take*(), pump() and
+	 * clear() belong on the render thread.
+	 */
+	class AssetStreamer {
+		public:
+			static constexpr std::size_t DEFAULT_WORKERS = 2;
+			static constexpr std::chrono::microseconds DEFAULT_FRAME_BUDGET{2000};
+
+			AssetStreamer(AssetBackend backend, TextureCache &textures, std::size_t workers = DEFAULT_WORKERS);
+			~AssetStreamer();
+
+			AssetStreamer(const AssetStreamer &) = delete;
+			AssetStreamer &operator=(const AssetStreamer &) = delete;
+
+			/** @brief Decode an image and keep it in RAM for takeImage(). */
+			void requestImage(const std::string &path);
+
+			/** @brief Decode an image and upload it to the texture cache in pump(). */
+			void requestTexture(const std::string &path);
+
+			/** @brief Decode a sound file for takeSound(). */
+			void requestSound(const std::string &path);
+
+			/** @brief Rasterize a font for takeFont(), at raylib's LoadFont() size. */
+			void requestFont(const std::string &path);
+
+			/**
+			 * @brief Run any job on a worker, e.g. read a level manifest and
+			 *        request its assets. The job may call the request functions.
+			 */
+			void enqueue(std::function<void()> job);
+
+			/** @brief The decoded image of a requested file; the caller unloads it. */
+			std::optional<Image> takeImage(const std::string &path);
+
+			/** @brief The sound of a requested file, uploaded to the audio device. */
+			std::optional<Sound> takeSound(const std::string &path);
+
+			/** @brief The font of a requested file, uploaded to the GPU. */
+			std::optional<Font> takeFont(const std::string &path);
+
+			/**
+			 * @brief Upload decoded textures until the budget is spent.
+			 *
+			 * At least one texture is uploaded when any is ready, so a budget
+			 * smaller than one upload still makes progress.
+			 *
+			 * @return Number of textures uploaded.
+			 */
+			std::size_t pump(std::chrono::microseconds budget = DEFAULT_FRAME_BUDGET);
+
+			/**
+			 * @brief Drop every request and free what was decoded and not taken.
+			 *        Waits for the jobs already running.
+			 */
+			void clear();
+
+			StreamStats stats() const;
+
+		private:
+			enum class Kind : uint8_t { Image, Texture, Sound, Font };
+			enum class State : uint8_t { Queued, Decoding, Ready };
+
+			struct Entry {
+				Kind kind;
+				State state{State::Queued};
+				bool failed{false};
+				Image image{};
+				Wave wave{};
+				DecodedFont font{};
+			};
+
+			void request(const std::string &path, Kind kind);
+			void decode(const std::string &key);
+			void decodeInto(Entry &entry, const std::string &key);
+			void unload(Entry &entry);
+			void workerLoop();
+
+			/**
+			 * @brief Wait until the entry of key is no longer being decoded, then
+			 *        hand it over, decoding it here if it was still queued.
+			 * @return The entry, or std::nullopt if key was not requested as one of kinds.
+			 */
+			std::optional<Entry> take(const std::string &path, std::initializer_list<Kind> kinds);
+
+			AssetBackend _backend;
+			TextureCache &_textures;
+
+			mutable std::mutex _mutex;
+			std::condition_variable _jobReady;            ///< Signals workers.
+			std::condition_variable _jobDone;             ///< Signals take() and clear().
+			std::deque<std::function<void()>> _jobs;
+			std::unordered_map<std::string, Entry> _entries;  ///< Normalized path -> request.
+			std::deque<std::string> _uploads;             ///< Decoded textures, oldest first.
+			std::size_t _busy{0};                         ///< Jobs running on a worker.
+			bool _stopping{false};
+			StreamStats _stats;
+			std::vector<std::thread> _workers;
+	};
+
+} // namespace rendering
+
+#endif //RTYPE_ASSETSTREAMER_HPP
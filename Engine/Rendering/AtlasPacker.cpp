@@ -0,0 +1,87 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Shelf packing of sprite sheets into atlas pages
+*/
+
+#include "AtlasPacker.hpp"
+#include <algorithm>
+#include <numeric>
+
+namespace rendering {
+
+	namespace {
+		struct Shelf {
+			int y;
+			int height;
+			int cursor;
+		};
+
+		struct Page {
+			std::vector<Shelf> shelves;
+			int bottom{0};  ///< Where the next shelf opens.
+		};
+	}
+
+	AtlasLayout packAtlas(const std::vector<AtlasSize> &sizes, int pageSize, int padding) {
+		AtlasLayout layout;
+		layout.placements.resize(sizes.size());
+
+		std::vector<std::size_t> order(sizes.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) {
+			if (sizes[a].height != sizes[b].height)
+				return sizes[a].height > sizes[b].height;
+			return sizes[a].width > sizes[b].width;
+		});
+
+		std::vector<Page> pages;
+		for (std::size_t index : order) {
+			int width = sizes[index].width + 2 * padding;
+			int height = sizes[index].height + 2 * padding;
+			if (sizes[index].width <= 0 || sizes[index].height <= 0 || width > pageSize || height > pageSize)
+				continue;
+
+			Shelf *target = nullptr;
+			std::size_t targetPage = 0;
+			for (std::size_t p = 0; p < pages.size() && !target; ++p) {
+				for (auto &shelf : pages[p].shelves) {
+					if (shelf.height >= height && shelf.cursor + width <= pageSize) {
+						target = &shelf;
+						targetPage = p;
+						break;
+					}
+				}
+			}
+			for (std::size_t p = 0; p < pages.size() && !target; ++p) {
+				if (pages[p].bottom + height <= pageSize) {
+					pages[p].shelves.push_back({pages[p].bottom, height, 0});
+					pages[p].bottom += height;
+					target = &pages[p].shelves.back();
+					targetPage = p;
+				}
+			}
+			if (!target) {
+				pages.emplace_back();
+				layout.pageWidths.push_back(0);
+				layout.pageHeights.push_back(0);
+				targetPage = pages.size() - 1;
+				pages.back().shelves.push_back({0, height, 0});
+				pages.back().bottom = height;
+				target = &pages.back().shelves.back();
+			}
+
+			AtlasPlacement &placement = layout.placements[index];
+			placement.packed = true;
+			placement.page = targetPage;
+			placement.x = target->cursor + padding;
+			placement.y = target->y + padding;
+			target->cursor += width;
+			layout.pageWidths[targetPage] = std::max(layout.pageWidths[targetPage], target->cursor);
+			layout.pageHeights[targetPage] = std::max(layout.pageHeights[targetPage], target->y + height);
+		}
+		return layout;
+	}
+
+} // namespace rendering
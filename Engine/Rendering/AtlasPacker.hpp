@@ -0,0 +1,64 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Shelf packing of sprite sheets into atlas pages
+*/
+
+#ifndef RTYPE_ATLASPACKER_HPP
+#define RTYPE_ATLASPACKER_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace rendering {
+
+	/**
+	 * @struct AtlasPlacement
+	 * @brief Where one image went: a page and the top-left corner of its pixels.
+	 */
+	struct AtlasPlacement {
+		bool packed{false};  ///< false when the image does not fit in a page.
+		std::size_t page{0};
+		int x{0};
+		int y{0};
+	};
+
+	/**
+	 * @struct AtlasLayout
+	 * @brief Result of packAtlas().
+	 */
+	struct AtlasLayout {
+		std::vector<AtlasPlacement> placements;  ///< One per input size, same order.
+		std::vector<int> pageWidths;             ///< Used width of each page, padding included.
+		std::vector<int> pageHeights;            ///< Used height of each page, padding included.
+	};
+
+	/**
+	 * @struct AtlasSize
+	 * @brief Size of an image to pack, in pixels.
+	 */
+	struct AtlasSize {
+		int width{0};
+		int height{0};
+	};
+
+	/**
+	 * @brief Packs images into as few square pages as possible.
+	 *
+	 * Shelf packing: images are taken tallest first and laid left to right
+	 * on horizontal shelves, a new shelf opening below the last one when an
+	 * image fits on none, and a new page when a page is full. Every image
+	 * keeps `padding` transparent pixels on each side so that sampling at
+	 * its border never reads a neighbour. Images larger than a page are
+	 * left unpacked.
+	 *
+	 * @param sizes Images to pack.
+	 * @param pageSize Width and height of a page.
+	 * @param padding Empty pixels around each image.
+	 */
+	AtlasLayout packAtlas(const std::vector<AtlasSize> &sizes, int pageSize, int padding);
+
+} // namespace rendering
+
+#endif //RTYPE_ATLASPACKER_HPP
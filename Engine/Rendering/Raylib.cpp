@@ -8,6 +8,7 @@
 #include "Raylib.hpp"
 #include <raylib.h>
 #include "rlgl.h"
+#include <algorithm>
 
 // rcore
 void Raylib::setResizableFlag(unsigned int flags) {
@@ -23,6 +24,8 @@ void Raylib::initWindow(int width, int height, const std::string &title) {
 }
 
 void Raylib::closeWindow() {
+	assets().clear();
+	textures().clear();
 	CloseWindow();
 }
 
@@ -182,6 +185,8 @@ void Raylib::drawPlane(Vector3 centerPos, Vector2 size, Color color) {
 // rtext
 
 Font Raylib::loadFont(std::string const &fileName) {
+	if (std::optional<Font> font = assets().takeFont(fileName))
+		return *font;
 	return LoadFont(fileName.c_str());
 }
 
@@ -271,6 +276,8 @@ void Raylib::setSoundVolume(Sound const &sound, float volume) {
 }
 
 Sound Raylib::loadSound(std::string const &fileName) {
+	if (std::optional<Sound> sound = assets().takeSound(fileName))
+		return *sound;
 	return LoadSound(fileName.c_str());
 }
 
@@ -332,6 +339,69 @@ void Raylib::unloadTexture(Texture2D texture) {
 	UnloadTexture(texture);
 }
 
+rendering::TextureCache &Raylib::textures() {
+	static rendering::TextureCache cache({
+		[](const std::string &fileName) { return LoadTexture(fileName.c_str()); },
+		[](const Image &image) { return LoadTextureFromImage(image); },
+		[](Texture2D texture) { UnloadTexture(texture); },
+	});
+	return cache;
+}
+
+namespace {
+	// What LoadFont() does for a TTF, minus the texture upload.
+	constexpr int FONT_SIZE = 32;
+	constexpr int FONT_GLYPHS = 95;
+	constexpr int FONT_PADDING = 4;
+
+	rendering::DecodedFont decodeFont(const std::string &fileName) {
+		rendering::DecodedFont decoded{};
+		if (!IsFileExtension(fileName.c_str(), ".ttf;.otf"))
+			return decoded;
+		int size = 0;
+		unsigned char *data = LoadFileData(fileName.c_str(), &size);
+		if (data == nullptr)
+			return decoded;
+		Font &font = decoded.font;
+		font.baseSize = FONT_SIZE;
+		font.glyphCount = FONT_GLYPHS;
+		font.glyphs = LoadFontData(data, size, FONT_SIZE, nullptr, FONT_GLYPHS, FONT_DEFAULT);
+		UnloadFileData(data);
+		if (font.glyphs == nullptr)
+			return decoded;
+		font.glyphPadding = FONT_PADDING;
+		decoded.atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
+		for (int i = 0; i < font.glyphCount; ++i) {
+			UnloadImage(font.glyphs[i].image);
+			font.glyphs[i].image = ImageFromImage(decoded.atlas, font.recs[i]);
+		}
+		return decoded;
+	}
+}
+
+rendering::AssetStreamer &Raylib::assets() {
+	static rendering::AssetStreamer streamer({
+		[](const std::string &fileName) { return LoadImage(fileName.c_str()); },
+		[](const std::string &fileName) { return LoadWave(fileName.c_str()); },
+		decodeFont,
+		[](const Wave &wave) { return LoadSoundFromWave(wave); },
+		[](const rendering::DecodedFont &decoded) {
+			Font font = decoded.font;
+			font.texture = LoadTextureFromImage(decoded.atlas);
+			return font;
+		},
+		[](Image image) { UnloadImage(image); },
+		[](Wave wave) { UnloadWave(wave); },
+		[](const rendering::DecodedFont &decoded) {
+			UnloadFontData(decoded.font.glyphs, decoded.font.glyphCount);
+			MemFree(decoded.font.recs);
+			UnloadImage(decoded.atlas);
+		},
+		{},
+	}, textures());
+	return streamer;
+}
+
 void Raylib::drawTexture(Texture2D texture, int posX, int posY, Color tint) {
 	DrawTexture(texture, posX, posY, tint);
 }
@@ -436,3 +506,35 @@ void Raylib::popMatrix() {
 void Raylib::drawTexturePro(Texture2D texture, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint) {
 	DrawTexturePro(texture, sourceRec, destRec, origin, rotation, tint);
 }
+
+std::size_t Raylib::drawQuads(Texture2D texture, const rendering::Quad *quads, std::size_t count) {
+	// Stay well under the default batch so a flush only happens between chunks.
+	constexpr std::size_t CHUNK = 1024;
+	std::size_t flushes = 0;
+
+	rlSetTexture(texture.id);
+	for (std::size_t first = 0; first < count; first += CHUNK) {
+		std::size_t chunk = std::min(CHUNK, count - first);
+		if (rlCheckRenderBatchLimit(static_cast<int>(chunk * 4))) {
+			++flushes;
+			rlSetTexture(texture.id);
+		}
+		rlBegin(RL_QUADS);
+		rlNormal3f(0.0f, 0.0f, 1.0f);
+		for (std::size_t i = first; i < first + chunk; ++i) {
+			const rendering::Quad &quad = quads[i];
+			rlColor4ub(quad.tint.r, quad.tint.g, quad.tint.b, quad.tint.a);
+			for (int corner = 0; corner < 4; ++corner) {
+				rlTexCoord2f(quad.uvs[corner].x, quad.uvs[corner].y);
+				rlVertex2f(quad.corners[corner].x, quad.corners[corner].y);
+			}
+		}
+		rlEnd();
+	}
+	rlSetTexture(0);
+	return flushes;
+}
+
+Texture2D Raylib::defaultTexture() {
+	return Texture2D{rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+}
@@ -10,6 +10,9 @@
 
 #include <string>
 #include <raylib.h>
+#include "TextureCache.hpp"
+#include "AssetStreamer.hpp"
+#include "SpriteBatch.hpp"
 
 // Type alias pour Rectangle de raylib
 using RaylibRectangle = Rectangle;
@@ -592,6 +595,21 @@ class Raylib {
 		 */
 		void unloadTexture(Texture2D texture);
 
+		/**
+		 * @brief Texture cache shared by every scene, loading through raylib.
+		 *        Prefer it to loadTexture for anything drawn from a file.
+		 * @return The process-wide cache
+		 */
+		rendering::TextureCache &textures();
+
+		/**
+		 * @brief Asset streamer shared by every scene, decoding through raylib
+		 *        and uploading into textures(). loadSound() and loadFont()
+		 *        take what it prefetched before reading the file themselves.
+		 * @return The process-wide streamer
+		 */
+		rendering::AssetStreamer &assets();
+
 		/**
 		 * @brief Draw a Texture2D
 		 * @param texture The texture to draw
@@ -769,6 +787,20 @@ class Raylib {
 		void popMatrix();
 
         void drawTexturePro(Texture2D texture, Rectangle sourceRec, Rectangle destRec, Vector2 origin, float rotation, Color tint);
+
+		/**
+		 * @brief Draw textured quads through rlgl, binding the texture once
+		 * @param texture Texture every quad samples from
+		 * @param quads Quads to draw
+		 * @param count Number of quads
+		 * @return Number of times the vertex buffer filled up and was flushed
+		 */
+		std::size_t drawQuads(Texture2D texture, const rendering::Quad *quads, std::size_t count);
+
+		/**
+		 * @brief 1x1 white texture rlgl uses for shapes
+		 */
+		Texture2D defaultTexture();
 };
 
 #endif /* !RAYLIB_HPP */
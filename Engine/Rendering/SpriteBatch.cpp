@@ -0,0 +1,109 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Sorted, batched sprite submission
+*/
+
+#include "SpriteBatch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <utility>
+
+namespace rendering {
+
+	Quad makeQuad(Vector2 textureSize, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+		bool flipX = false;
+		if (source.width < 0.f) {
+			flipX = true;
+			source.width = -source.width;
+		}
+		if (source.height < 0.f)
+			source.y -= source.height;
+
+		Vector2 topLeft, topRight, bottomLeft, bottomRight;
+		if (rotation == 0.f) {
+			float x = dest.x - origin.x;
+			float y = dest.y - origin.y;
+			topLeft = {x, y};
+			topRight = {x + dest.width, y};
+			bottomLeft = {x, y + dest.height};
+			bottomRight = {x + dest.width, y + dest.height};
+		} else {
+			float radians = rotation * std::numbers::pi_v<float> / 180.f;
+			float sinRotation = std::sin(radians);
+			float cosRotation = std::cos(radians);
+			float dx = -origin.x;
+			float dy = -origin.y;
+			auto corner = [&](float cx, float cy) {
+				return Vector2{dest.x + cx * cosRotation - cy * sinRotation, dest.y + cx * sinRotation + cy * cosRotation};
+			};
+			topLeft = corner(dx, dy);
+			topRight = corner(dx + dest.width, dy);
+			bottomLeft = corner(dx, dy + dest.height);
+			bottomRight = corner(dx + dest.width, dy + dest.height);
+		}
+
+		float left = source.x / textureSize.x;
+		float right = (source.x + source.width) / textureSize.x;
+		float top = source.y / textureSize.y;
+		float bottom = (source.y + source.height) / textureSize.y;
+		if (flipX)
+			std::swap(left, right);
+
+		return Quad{
+			{topLeft, bottomLeft, bottomRight, topRight},
+			{{left, top}, {left, bottom}, {right, bottom}, {right, top}},
+			tint,
+		};
+	}
+
+	SpriteBatch::SpriteBatch(Submit submit, Texture2D solid) : _submit(std::move(submit)), _solid(solid) {}
+
+	void SpriteBatch::draw(int layer, const AtlasRegion &region, Rectangle source, Rectangle dest,
+						   Vector2 origin, float rotation, Color tint) {
+		if (region.texture.id == 0 || region.texture.width <= 0 || region.texture.height <= 0)
+			return;
+		source.x += region.offset.x;
+		source.y += region.offset.y;
+		Vector2 size{static_cast<float>(region.texture.width), static_cast<float>(region.texture.height)};
+		_sprites.push_back({layer, region.texture, makeQuad(size, source, dest, origin, rotation, tint)});
+	}
+
+	void SpriteBatch::draw(int layer, const Texture2D &texture, Rectangle source, Rectangle dest,
+						   Vector2 origin, float rotation, Color tint) {
+		draw(layer, AtlasRegion{texture, {0.f, 0.f}}, source, dest, origin, rotation, tint);
+	}
+
+	void SpriteBatch::drawRectangle(int layer, Rectangle rect, Color color) {
+		draw(layer, _solid, {0.f, 0.f, 1.f, 1.f}, rect, {0.f, 0.f}, 0.f, color);
+	}
+
+	void SpriteBatch::flush() {
+		_stats = {};
+		_stats.sprites = _sprites.size();
+		std::stable_sort(_sprites.begin(), _sprites.end(), [](const Entry &a, const Entry &b) {
+			if (a.layer != b.layer)
+				return a.layer < b.layer;
+			return a.texture.id < b.texture.id;
+		});
+
+		std::size_t first = 0;
+		while (first < _sprites.size()) {
+			const Texture2D &texture = _sprites[first].texture;
+			std::size_t last = first;
+			_run.clear();
+			// A run may cross a layer boundary when both sides use the same texture.
+			while (last < _sprites.size() && _sprites[last].texture.id == texture.id) {
+				_run.push_back(_sprites[last].quad);
+				++last;
+			}
+			++_stats.textureBinds;
+			_stats.drawCalls += 1 + _submit(texture, _run.data(), _run.size());
+			first = last;
+		}
+		_sprites.clear();
+	}
+
+} // namespace rendering
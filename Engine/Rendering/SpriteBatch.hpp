@@ -0,0 +1,128 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Sorted, batched sprite submission
+*/
+
+#ifndef RTYPE_SPRITEBATCH_HPP
+#define RTYPE_SPRITEBATCH_HPP
+
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace rendering {
+
+	/**
+	 * @struct Quad
+	 * @brief One textured quad, ready for the GPU.
+	 *
+	 * Corners and texture coordinates go top-left, bottom-left,
+	 * bottom-right, top-right, the order rlgl expects for RL_QUADS.
+	 */
+	struct Quad {
+		Vector2 corners[4];
+		Vector2 uvs[4];
+		Color tint;
+	};
+
+	/**
+	 * @struct AtlasRegion
+	 * @brief A texture and the offset of a sprite sheet in it.
+	 *
+	 * For a sheet packed in an atlas, texture is the atlas page and offset
+	 * where the sheet starts; for a standalone texture the offset is zero.
+	 */
+	struct AtlasRegion {
+		Texture2D texture{};
+		Vector2 offset{0.f, 0.f};
+	};
+
+	/**
+	 * @struct BatchStats
+	 * @brief What the last flush sent to the GPU.
+	 */
+	struct BatchStats {
+		std::size_t sprites{0};
+		std::size_t textureBinds{0};  ///< Texture changes between consecutive quads.
+		std::size_t drawCalls{0};     ///< One per bind, plus one per vertex buffer filled up.
+	};
+
+	/**
+	 * @class SpriteBatch
+	 * @brief Collects the sprites of a frame and draws them sorted by layer,
+	 *        then texture, in as few draw calls as possible.
+	 *
+	 * Lower layers are drawn first. Within a layer sprites are grouped by
+	 * texture, each group keeping its submission order, so sprites of one
+	 * layer sharing a texture go out as one run of quads. Sprites that must
+	 * overlap in a given order belong on different layers.
+	 */
+	class SpriteBatch {
+		public:
+			/**
+			 * @brief Draws count quads of one texture.
+			 * @return How many times the vertex buffer filled up and was flushed.
+			 */
+			using Submit = std::function<std::size_t(const Texture2D &texture, const Quad *quads, std::size_t count)>;
+
+			/**
+			 * @param submit Sends quads to the GPU (Raylib::drawQuads in the game).
+			 * @param solid 1x1 white texture used by drawRectangle().
+			 */
+			SpriteBatch(Submit submit, Texture2D solid);
+
+			/**
+			 * @brief Queues a sprite, with the parameters of DrawTexturePro.
+			 *
+			 * source is relative to the region, so the same rectangle works
+			 * whether the sheet is packed in an atlas or not. A negative
+			 * source width or height flips the sprite.
+			 */
+			void draw(int layer, const AtlasRegion &region, Rectangle source, Rectangle dest,
+					  Vector2 origin, float rotation, Color tint);
+
+			/** @brief Same, for a whole standalone texture. */
+			void draw(int layer, const Texture2D &texture, Rectangle source, Rectangle dest,
+					  Vector2 origin, float rotation, Color tint);
+
+			/** @brief Queues a plain rectangle. */
+			void drawRectangle(int layer, Rectangle rect, Color color);
+
+			/**
+			 * @brief Draws every queued sprite and empties the batch.
+			 */
+			void flush();
+
+			/** @brief Counters of the last flush. */
+			const BatchStats &stats() const { return _stats; }
+
+			/** @brief Sprites queued and not flushed yet. */
+			std::size_t size() const { return _sprites.size(); }
+
+		private:
+			struct Entry {
+				int layer;
+				Texture2D texture;
+				Quad quad;
+			};
+
+			Submit _submit;
+			Texture2D _solid;
+			std::vector<Entry> _sprites;
+			std::vector<Quad> _run;
+			BatchStats _stats;
+	};
+
+	/**
+	 * @brief Corners and texture coordinates of a sprite, like DrawTexturePro.
+	 * @param textureSize Width and height of the texture source is taken from.
+	 */
+	Quad makeQuad(Vector2 textureSize, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);
+
+} // namespace rendering
+
+#endif //RTYPE_SPRITEBATCH_HPP
@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Sprite sheets packed into a few GPU textures
+*/
+
+#include "TextureAtlas.hpp"
+#include "AtlasPacker.hpp"
+#include "TextureCache.hpp"
+#include "Logger.hpp"
+#include <unordered_set>
+
+namespace rendering {
+
+	TextureAtlas::~TextureAtlas() {
+		clear();
+	}
+
+	void TextureAtlas::build(const std::vector<std::string> &paths, const Prefetched &prefetched) {
+		clear();
+
+		std::vector<std::string> keys;
+		std::vector<Image> images;
+		std::vector<AtlasSize> sizes;
+		std::unordered_set<std::string> seen;
+		std::size_t streamed = 0;
+		for (const auto &path : paths) {
+			if (path.empty())
+				continue;
+			std::string key = TextureCache::normalize(path);
+			if (!seen.insert(key).second)
+				continue;
+			std::optional<Image> ready = prefetched ? prefetched(key) : std::nullopt;
+			streamed += ready.has_value();
+			Image image = ready ? *ready : LoadImage(key.c_str());
+			if (image.data == nullptr)
+				continue;
+			keys.push_back(key);
+			images.push_back(image);
+			sizes.push_back({image.width, image.height});
+		}
+
+		AtlasLayout layout = packAtlas(sizes, PAGE_SIZE, PADDING);
+		std::vector<Image> canvases;
+		for (std::size_t page = 0; page < layout.pageWidths.size(); ++page)
+			canvases.push_back(GenImageColor(layout.pageWidths[page], layout.pageHeights[page], BLANK));
+
+		for (std::size_t i = 0; i < images.size(); ++i) {
+			const AtlasPlacement &placement = layout.placements[i];
+			if (placement.packed) {
+				Rectangle source{0.f, 0.f, static_cast<float>(images[i].width), static_cast<float>(images[i].height)};
+				Rectangle dest{static_cast<float>(placement.x), static_cast<float>(placement.y), source.width, source.height};
+				ImageDraw(&canvases[placement.page], images[i], source, dest, WHITE);
+			}
+			UnloadImage(images[i]);
+		}
+
+		for (auto &canvas : canvases) {
+			_pages.push_back(LoadTextureFromImage(canvas));
+			UnloadImage(canvas);
+		}
+		for (std::size_t i = 0; i < keys.size(); ++i) {
+			const AtlasPlacement &placement = layout.placements[i];
+			if (!placement.packed || _pages[placement.page].id == 0)
+				continue;
+			_regions[keys[i]] = AtlasRegion{_pages[placement.page], {static_cast<float>(placement.x), static_cast<float>(placement.y)}};
+		}
+		LOG_INFO("Texture atlas: " << _regions.size() << "/" << keys.size() << " sheets packed in "
+			<< _pages.size() << " page(s), " << bytes() / 1024 << " KiB, " << streamed << " decoded ahead");
+	}
+
+	const AtlasRegion *TextureAtlas::find(const std::string &path) const {
+		if (_regions.empty() || path.empty())
+			return nullptr;
+		auto it = _regions.find(TextureCache::normalize(path));
+		return it == _regions.end() ? nullptr : &it->second;
+	}
+
+	void TextureAtlas::clear() {
+		for (const auto &page : _pages) {
+			if (page.id != 0)
+				UnloadTexture(page);
+		}
+		_pages.clear();
+		_regions.clear();
+	}
+
+	std::size_t TextureAtlas::bytes() const {
+		std::size_t total = 0;
+		for (const auto &page : _pages)
+			total += static_cast<std::size_t>(page.width) * static_cast<std::size_t>(page.height) * 4;
+		return total;
+	}
+
+} // namespace rendering
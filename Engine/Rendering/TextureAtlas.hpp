@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Sprite sheets packed into a few GPU textures
+*/
+
+#ifndef RTYPE_TEXTUREATLAS_HPP
+#define RTYPE_TEXTUREATLAS_HPP
+
+#include <raylib.h>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "SpriteBatch.hpp"
+
+namespace rendering {
+
+	/**
+	 * @class TextureAtlas
+	 * @brief Packs the sprite sheets of a level into a few large textures,
+	 *        so that the sprite batch binds one texture for most of a frame.
+	 *
+	 * Sheets too large for a page are left out; find() then returns nullptr
+	 * and the caller draws them from their own texture. Sheets drawn with a
+	 * source rectangle larger than the sheet, counting on the texture to
+	 * repeat, must not be passed to build(): in a page they would sample
+	 * their neighbours.
+	 * Pages are owned by the atlas and unloaded by clear() or the next build().
+	 */
+	class TextureAtlas {
+		public:
+			static constexpr int PAGE_SIZE = 2048;
+			static constexpr int PADDING = 2;
+
+			/** @brief Image of a sheet decoded ahead of time, or std::nullopt to read the file. */
+			using Prefetched = std::function<std::optional<Image>(const std::string &)>;
+
+			TextureAtlas() = default;
+			~TextureAtlas();
+			TextureAtlas(const TextureAtlas &) = delete;
+			TextureAtlas &operator=(const TextureAtlas &) = delete;
+
+			/**
+			 * @brief Replaces the atlas with one holding the given sheets.
+			 *        Needs a window, the pages being uploaded to the GPU.
+			 * @param paths Image files; duplicates and unreadable files are skipped.
+			 * @param prefetched Asked first for each sheet (e.g. AssetStreamer::takeImage);
+			 *        the atlas unloads the images it hands over.
+			 */
+			void build(const std::vector<std::string> &paths, const Prefetched &prefetched = {});
+
+			/**
+			 * @brief Where a sheet lives in the atlas.
+			 * @return nullptr when the sheet was not packed.
+			 */
+			const AtlasRegion *find(const std::string &path) const;
+
+			/** @brief Unloads every page. */
+			void clear();
+
+			std::size_t pageCount() const { return _pages.size(); }
+			std::size_t sheetCount() const { return _regions.size(); }
+
+			/** @brief Estimated VRAM used by the pages, at 4 bytes per pixel. */
+			std::size_t bytes() const;
+
+		private:
+			std::vector<Texture2D> _pages;
+			std::unordered_map<std::string, AtlasRegion> _regions; ///< Normalized path -> region.
+	};
+
+} // namespace rendering
+
+#endif //RTYPE_TEXTUREATLAS_HPP
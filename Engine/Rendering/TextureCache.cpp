@@ -0,0 +1,218 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Reference-counted texture cache
+*/
+
+#include "TextureCache.hpp"
+#include "Logger.hpp"
+#include <filesystem>
+#include <utility>
+
+namespace rendering {
+
+	namespace {
+		constexpr std::size_t BYTES_PER_PIXEL = 4;
+
+		std::size_t estimateBytes(const Texture2D &texture) {
+			if (texture.id == 0 || texture.width <= 0 || texture.height <= 0)
+				return 0;
+			return static_cast<std::size_t>(texture.width) * static_cast<std::size_t>(texture.height) * BYTES_PER_PIXEL;
+		}
+
+		const Texture2D &emptyTexture() {
+			static const Texture2D empty{};
+			return empty;
+		}
+
+		const std::string &emptyPath() {
+			static const std::string empty;
+			return empty;
+		}
+	}
+
+	// TextureHandle
+
+	TextureHandle::TextureHandle(TextureCache *cache, TextureEntry *entry) : _cache(cache), _entry(entry) {
+		_cache->retain(*_entry);
+	}
+
+	TextureHandle::TextureHandle(const TextureHandle &other) : _cache(other._cache), _entry(other._entry) {
+		if (_entry)
+			_cache->retain(*_entry);
+	}
+
+	TextureHandle::TextureHandle(TextureHandle &&other) noexcept
+		: _cache(std::exchange(other._cache, nullptr)), _entry(std::exchange(other._entry, nullptr)) {}
+
+	TextureHandle &TextureHandle::operator=(TextureHandle other) noexcept {
+		std::swap(_cache, other._cache);
+		std::swap(_entry, other._entry);
+		return *this;
+	}
+
+	TextureHandle::~TextureHandle() {
+		reset();
+	}
+
+	const Texture2D &TextureHandle::get() const {
+		return _entry ? _entry->texture : emptyTexture();
+	}
+
+	const std::string &TextureHandle::path() const {
+		return _entry ? _entry->path : emptyPath();
+	}
+
+	void TextureHandle::reset() {
+		if (_entry)
+			_cache->release(*_entry);
+		_cache = nullptr;
+		_entry = nullptr;
+	}
+
+	// TextureCache
+
+	TextureCache::TextureCache(TextureBackend backend, std::size_t unusedBudget)
+		: _backend(std::move(backend)), _unusedBudget(unusedBudget) {}
+
+	TextureCache::~TextureCache() {
+		if (_stats.resident > _stats.unused)
+			LOG_WARN("Texture cache destroyed with " << _stats.resident - _stats.unused << " textures still in use");
+	}
+
+	std::string TextureCache::normalize(const std::string &path) {
+		if (path.empty())
+			return path;
+		std::error_code ec;
+		std::filesystem::path absolute = std::filesystem::absolute(path, ec);
+		if (ec)
+			absolute = path;
+		return absolute.lexically_normal().generic_string();
+	}
+
+	template <typename Load>
+	TextureHandle TextureCache::acquireWith(const std::string &path, Load &&load) {
+		if (path.empty())
+			return {};
+		std::string key = normalize(path);
+		auto [it, inserted] = _entries.try_emplace(key);
+		TextureEntry &entry = it->second;
+		if (!inserted && !entry.stale) {
+			++_stats.hits;
+			return TextureHandle(this, &entry);
+		}
+
+		entry.path = key;
+		entry.stale = false;
+		entry.texture = load(key);
+		entry.bytes = estimateBytes(entry.texture);
+		++_stats.loads;
+		++_stats.resident;
+		_stats.bytes += entry.bytes;
+		if (entry.texture.id == 0)
+			LOG_WARN("Failed to load texture " << key);
+		else
+			LOG_DEBUG("Loaded texture " << key << " (" << entry.texture.width << "x" << entry.texture.height << ")");
+
+		// A new entry starts unused, the handle below retains it. A stale one
+		// reloaded while referenced is already out of the unused list.
+		if (entry.refs == 0) {
+			entry.unusedPos = _unused.insert(_unused.begin(), &entry);
+			++_stats.unused;
+			_stats.unusedBytes += entry.bytes;
+		}
+		return TextureHandle(this, &entry);
+	}
+
+	TextureHandle TextureCache::acquire(const std::string &path) {
+		return acquireWith(path, [this](const std::string &key) { return _backend.loadFile(key); });
+	}
+
+	TextureHandle TextureCache::acquire(const std::string &path, const Image &image) {
+		return acquireWith(path, [this, &image](const std::string &) { return _backend.loadImage(image); });
+	}
+
+	bool TextureCache::contains(const std::string &path) const {
+		auto it = _entries.find(normalize(path));
+		return it != _entries.end() && !it->second.stale;
+	}
+
+	void TextureCache::retain(TextureEntry &entry) {
+		if (entry.refs++ == 0 && !entry.stale) {
+			_unused.erase(entry.unusedPos);
+			--_stats.unused;
+			_stats.unusedBytes -= entry.bytes;
+		}
+	}
+
+	void TextureCache::release(TextureEntry &entry) {
+		if (--entry.refs != 0)
+			return;
+		if (entry.stale) {
+			std::string key = entry.path;
+			_entries.erase(key);
+			return;
+		}
+		entry.unusedPos = _unused.insert(_unused.begin(), &entry);
+		++_stats.unused;
+		_stats.unusedBytes += entry.bytes;
+		enforceBudget();
+	}
+
+	void TextureCache::evict(TextureEntry &entry) {
+		if (entry.texture.id != 0)
+			_backend.unload(entry.texture);
+		_unused.erase(entry.unusedPos);
+		--_stats.unused;
+		--_stats.resident;
+		_stats.unusedBytes -= entry.bytes;
+		_stats.bytes -= entry.bytes;
+		++_stats.evictions;
+		std::string key = entry.path;
+		_entries.erase(key);
+	}
+
+	void TextureCache::enforceBudget() {
+		while (_stats.unusedBytes > _unusedBudget && !_unused.empty()) {
+			LOG_DEBUG("Evicting texture " << _unused.back()->path);
+			evict(*_unused.back());
+		}
+	}
+
+	void TextureCache::setUnusedBudget(std::size_t bytes) {
+		_unusedBudget = bytes;
+		enforceBudget();
+	}
+
+	void TextureCache::trim() {
+		while (!_unused.empty())
+			evict(*_unused.back());
+	}
+
+	void TextureCache::clear() {
+		trim();
+		for (auto &[path, entry] : _entries) {
+			if (entry.stale)
+				continue;
+			if (entry.texture.id != 0)
+				_backend.unload(entry.texture);
+			entry.texture = {};
+			entry.stale = true;
+			--_stats.resident;
+			_stats.bytes -= entry.bytes;
+			entry.bytes = 0;
+		}
+	}
+
+	TextureStats TextureCache::stats() const {
+		return _stats;
+	}
+
+	std::ostream &operator<<(std::ostream &os, const TextureStats &stats) {
+		return os << stats.resident << " textures (" << stats.unused << " unused), "
+			<< (stats.bytes + 1023) / 1024 << " KiB of VRAM (" << (stats.unusedBytes + 1023) / 1024 << " KiB unused), "
+			<< stats.loads << " loads, " << stats.hits << " hits, " << stats.evictions << " evictions";
+	}
+
+} // namespace rendering
@@ -0,0 +1,180 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Reference-counted texture cache
+*/
+
+#ifndef RTYPE_TEXTURECACHE_HPP
+#define RTYPE_TEXTURECACHE_HPP
+
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace rendering {
+
+	class TextureCache;
+
+	/**
+	 * @struct TextureEntry
+	 * @brief One texture in VRAM and the handles using it. Owned by the cache.
+	 */
+	struct TextureEntry {
+		std::string path;
+		Texture2D texture{};
+		std::size_t bytes{0};                             ///< Estimated VRAM size.
+		uint32_t refs{0};                                 ///< Live handles.
+		bool stale{false};                                ///< Unloaded by clear() while still referenced.
+		std::list<TextureEntry *>::iterator unusedPos{};  ///< Place in the unused list when refs is 0.
+	};
+
+	/**
+	 * @class TextureHandle
+	 * @brief Shared reference to a cached texture.
+	 *
+	 * Copies share the texture; when the last handle of a path goes away the
+	 * texture becomes unused and may be evicted. An empty handle reads as a
+	 * zeroed Texture2D (id 0), like a failed LoadTexture.
+	 */
+	class TextureHandle {
+		public:
+			TextureHandle() = default;
+			TextureHandle(const TextureHandle &other);
+			TextureHandle(TextureHandle &&other) noexcept;
+			TextureHandle &operator=(TextureHandle other) noexcept;
+			~TextureHandle();
+
+			const Texture2D &get() const;
+			const Texture2D &operator*() const { return get(); }
+			const Texture2D *operator->() const { return &get(); }
+
+			/** @brief Whether the handle holds a texture that loaded. */
+			explicit operator bool() const { return get().id != 0; }
+
+			/** @brief Normalized path of the texture, empty for an empty handle. */
+			const std::string &path() const;
+
+			/** @brief Releases the texture, leaving the handle empty. */
+			void reset();
+
+		private:
+			friend class TextureCache;
+			TextureHandle(TextureCache *cache, TextureEntry *entry);
+
+			TextureCache *_cache{nullptr};
+			TextureEntry *_entry{nullptr};
+	};
+
+	/**
+	 * @struct TextureBackend
+	 * @brief GPU side of the cache: raylib in the game, fakes in tests.
+	 */
+	struct TextureBackend {
+		std::function<Texture2D(const std::string &)> loadFile;
+		std::function<Texture2D(const Image &)> loadImage;
+		std::function<void(Texture2D)> unload;
+	};
+
+	/**
+	 * @struct TextureStats
+	 * @brief Counters of a TextureCache.
+	 */
+	struct TextureStats {
+		std::size_t loads{0};        ///< Textures decoded and uploaded since the start.
+		std::size_t hits{0};         ///< Acquires served by a texture already in VRAM.
+		std::size_t evictions{0};    ///< Unused textures unloaded to stay under the budget.
+		std::size_t resident{0};     ///< Textures in VRAM.
+		std::size_t unused{0};       ///< Resident textures no handle references.
+		std::size_t bytes{0};        ///< Estimated VRAM of the resident textures.
+		std::size_t unusedBytes{0};  ///< Part of bytes held by unused textures.
+	};
+
+	std::ostream &operator<<(std::ostream &os, const TextureStats &stats);
+
+	/**
+	 * @class TextureCache
+	 * @brief Loads each texture file once, however many entities draw it.
+	 *
+	 * Textures are keyed by their normalized absolute path and shared through
+	 * TextureHandle. A texture nobody references stays in VRAM, so a scene
+	 * opened again or the next level reuses it, until the unused textures
+	 * exceed the budget: the least recently released ones are evicted first.
+	 * VRAM is estimated at 4 bytes per pixel, the RGBA8 PNGs decode to.
+	 *
+	 * Not thread-safe: textures are uploaded on the thread owning the GL
+	 * context, so every call belongs on the render thread.
+	 */
+	class TextureCache {
+		public:
+			static constexpr std::size_t DEFAULT_UNUSED_BUDGET = 64 * 1024 * 1024;
+
+			explicit TextureCache(TextureBackend backend, std::size_t unusedBudget = DEFAULT_UNUSED_BUDGET);
+			~TextureCache();
+
+			TextureCache(const TextureCache &) = delete;
+			TextureCache &operator=(const TextureCache &) = delete;
+
+			/**
+			 * @brief Returns the texture of a file, loading it on first use.
+			 *
+			 * A file that fails to load is remembered as a texture with id 0,
+			 * so a missing sprite is not read again every frame.
+			 *
+			 * @param path Texture file; relative paths start at the working directory.
+			 * @return Handle to the texture, empty when path is empty.
+			 */
+			TextureHandle acquire(const std::string &path);
+
+			/**
+			 * @brief Same, uploading an image the caller already decoded when
+			 *        the file is not cached yet.
+			 */
+			TextureHandle acquire(const std::string &path, const Image &image);
+
+			/** @brief Whether a file has a texture in VRAM. */
+			bool contains(const std::string &path) const;
+
+			/** @brief Sets the VRAM kept for unused textures, evicting what is over. */
+			void setUnusedBudget(std::size_t bytes);
+
+			/** @brief Evicts every unused texture. */
+			void trim();
+
+			/**
+			 * @brief Unloads every texture, before the GL context goes away.
+			 *
+			 * Handles still alive read as id 0 afterwards.
+			 */
+			void clear();
+
+			TextureStats stats() const;
+
+			/** @brief Key of a path: absolute, lexically normal, with '/' separators. */
+			static std::string normalize(const std::string &path);
+
+		private:
+			friend class TextureHandle;
+
+			template <typename Load>
+			TextureHandle acquireWith(const std::string &path, Load &&load);
+			void retain(TextureEntry &entry);
+			void release(TextureEntry &entry);
+			void evict(TextureEntry &entry);
+			void enforceBudget();
+
+			TextureBackend _backend;
+			std::size_t _unusedBudget;
+			std::unordered_map<std::string, TextureEntry> _entries;
+			std::list<TextureEntry *> _unused;  ///< Most recently released first.
+			TextureStats _stats;
+	};
+
+} // namespace rendering
+
+#endif //RTYPE_TEXTURECACHE_HPP
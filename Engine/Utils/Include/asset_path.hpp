@@ -0,0 +1,31 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** asset_path
+*/
+
+#pragma once
+
+#include <string>
+
+/**
+ * @namespace game::assets
+ * @brief Locates asset files named by level files or by another machine.
+ */
+namespace game::assets {
+
+    /**
+     * @brief Maps an asset path onto this build's ASSETS_PATH.
+     *
+     * Existing absolute paths are kept. Other absolute paths, such as the
+     * server's own build directory, are rebased on the part after "assets/".
+     * Paths relative to the assets root, or to the legacy "../Game/Assets/"
+     * root, are prefixed with ASSETS_PATH.
+     *
+     * @param path Path as written in a level file or received from the network.
+     * @return Path of the same asset for this process, or an empty string if path is empty.
+     */
+    std::string resolve_path(const std::string &path);
+
+} // namespace game::assets
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <vector>
+#include <string>
 #include <iostream>
 #include <nlohmann/json.hpp>
 #include "../../Core/Include/registry.hpp"
@@ -45,4 +46,24 @@ namespace game::storage {
      */
     void store_level_entities(ecs::registry &reg, const json &level_data);
 
+    /**
+     * @struct level_images
+     * @brief Distinct image_path values of a level, as written in the file.
+     */
+    struct level_images {
+        std::vector<std::string> backgrounds; ///< Images of the "backgrounds" entries.
+        std::vector<std::string> sprites;     ///< Images of every other entity.
+    };
+
+    /**
+     * @brief Lists the images used by a level, without creating any entity.
+     *
+     * Lets the client read them ahead of time, e.g. while the previous level
+     * is still being played.
+     *
+     * @param level_data JSON object containing level configuration and entity definitions.
+     * @return The level's images, backgrounds apart since they are not drawn like sprites.
+     */
+    level_images list_level_images(const json &level_data);
+
 } // namespace game::storage
\ No newline at end of file
@@ -0,0 +1,139 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** registry_snapshot
+*/
+
+#pragma once
+
+#include "../../Core/Include/registry.hpp"
+#include "../../Core/Entities/Include/components.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * @brief Components carried by a registry snapshot, with their fields.
+ *
+ * This table is the whole description of the format: the component bits, the
+ * encoder, the decoder and the restore code are generated from it. Components
+ * and fields are written in table order, so any change here requires bumping
+ * SNAPSHOT_VERSION. The C++ type of a field picks its wire encoding: 4 bytes
+ * for float, int, uint32_t and entity_t, 1 byte for bool, color channels and
+ * entity_type, and a string table index for std::string.
+ *
+ * @param COMPONENT Macro called as COMPONENT(name, fields) for component::name.
+ * @param FIELD Macro called as FIELD(member) for each field of the component.
+ */
+#define RTYPE_SNAPSHOT_COMPONENTS(COMPONENT, FIELD) \
+    COMPONENT(type, FIELD(value)) \
+    COMPONENT(position, FIELD(x) FIELD(y) FIELD(z)) \
+    COMPONENT(previous_position, FIELD(x) FIELD(y) FIELD(z)) \
+    COMPONENT(velocity, FIELD(vx) FIELD(vy) FIELD(vz)) \
+    COMPONENT(rotation, FIELD(pitch) FIELD(yaw) FIELD(roll)) \
+    COMPONENT(scale, FIELD(x) FIELD(y) FIELD(z)) \
+    COMPONENT(drawable, FIELD(width) FIELD(height) FIELD(depth) \
+        FIELD(color.r) FIELD(color.g) FIELD(color.b) FIELD(color.a)) \
+    COMPONENT(sprite, FIELD(image_path) FIELD(scale) FIELD(rotation)) \
+    COMPONENT(pattern_element, FIELD(pattern_name)) \
+    COMPONENT(model3D, FIELD(model_path) FIELD(scale) \
+        FIELD(rotation_angles.pitch) FIELD(rotation_angles.yaw) FIELD(rotation_angles.roll)) \
+    COMPONENT(audio, FIELD(sound_path) FIELD(volume) FIELD(loop) FIELD(autoplay)) \
+    COMPONENT(text, FIELD(content) FIELD(font_size) FIELD(spacing) \
+        FIELD(color.r) FIELD(color.g) FIELD(color.b) FIELD(color.a)) \
+    COMPONENT(font, FIELD(font_path)) \
+    COMPONENT(clickable, FIELD(id) FIELD(enabled)) \
+    COMPONENT(hoverable, FIELD(id) FIELD(isHovered)) \
+    COMPONENT(controllable, FIELD(speed) FIELD(can_jump) FIELD(can_fly)) \
+    COMPONENT(health, FIELD(current) FIELD(max)) \
+    COMPONENT(damage, FIELD(amount)) \
+    COMPONENT(collision_box, FIELD(width) FIELD(height) FIELD(depth)) \
+    COMPONENT(hitbox_link, FIELD(owner) FIELD(offsetX) FIELD(offsetY) FIELD(offsetZ)) \
+    COMPONENT(client_id, FIELD(id))
+
+/** @brief FIELD argument of RTYPE_SNAPSHOT_COMPONENTS for expansions that only list components. */
+#define RTYPE_SNAPSHOT_NO_FIELD(member)
+
+/**
+ * @namespace game::serializer
+ */
+namespace game::serializer {
+
+    /** @brief Format version written in every snapshot; decode_snapshot() rejects any other. */
+    constexpr uint8_t SNAPSHOT_VERSION = 1;
+
+    /**
+     * @enum SnapshotComponent
+     * @brief Bit index of each component in SnapshotEntity::mask.
+     */
+    enum class SnapshotComponent : uint8_t {
+#define RTYPE_SNAPSHOT_ENUM(name, fields) name,
+        RTYPE_SNAPSHOT_COMPONENTS(RTYPE_SNAPSHOT_ENUM, RTYPE_SNAPSHOT_NO_FIELD)
+#undef RTYPE_SNAPSHOT_ENUM
+        Count
+    };
+
+    static_assert(static_cast<std::size_t>(SnapshotComponent::Count) <= 32, "the component mask is 32 bits");
+
+    constexpr uint32_t snapshot_bit(SnapshotComponent component) noexcept {
+        return 1u << static_cast<uint32_t>(component);
+    }
+
+    /**
+     * @struct SnapshotEntity
+     * @brief One entity of a decoded snapshot.
+     *
+     * Only the components whose bit is set in mask hold decoded values.
+     */
+    struct SnapshotEntity {
+        uint32_t entity_id{0}; ///< Index of the entity in the server registry.
+        uint32_t mask{0};      ///< snapshot_bit() of each component present.
+#define RTYPE_SNAPSHOT_MEMBER(name, fields) component::name name{};
+        RTYPE_SNAPSHOT_COMPONENTS(RTYPE_SNAPSHOT_MEMBER, RTYPE_SNAPSHOT_NO_FIELD)
+#undef RTYPE_SNAPSHOT_MEMBER
+
+        bool has(SnapshotComponent component) const noexcept { return mask & snapshot_bit(component); }
+    };
+
+    /**
+     * @struct RegistrySnapshot
+     * @brief Decoded full registry, in the order the server wrote it.
+     */
+    struct RegistrySnapshot {
+        std::vector<SnapshotEntity> entities;
+    };
+
+    /**
+     * @brief Encodes the entities a client rebuilds: those with a type, and
+     *        the hitboxes linked to them.
+     *
+     * Layout: "RSNP", version, reserved byte, string count (u16), entity
+     * count (u32), string table offset (u32), then for each entity its ID
+     * (u32), its component mask (u32) and the fields of each component present,
+     * and finally the string table, each string once as a u16 length and its
+     * bytes. Integers are big-endian.
+     *
+     * @throws std::length_error if a string is longer than 65535 bytes or
+     *         there are more than 65535 different strings.
+     */
+    std::vector<uint8_t> encode_snapshot(const ecs::registry &reg);
+
+    /**
+     * @brief Decodes a buffer produced by encode_snapshot().
+     * @return std::nullopt if the buffer is truncated, corrupt or of another version.
+     */
+    std::optional<RegistrySnapshot> decode_snapshot(const uint8_t *data, std::size_t size);
+
+    /**
+     * @brief Creates the snapshot's entities in reg, with their components.
+     *
+     * Hitbox owners are remapped to the new entities; a hitbox whose owner is
+     * not in the snapshot loses its hitbox_link. Sprite, model, sound and font
+     * paths go through game::assets::resolve_path(), since they name files
+     * of the sender's build.
+     */
+    void restore_snapshot(ecs::registry &reg, const RegistrySnapshot &snapshot);
+
+} // namespace game::serializer
@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** asset_path
+*/
+
+#include "Include/asset_path.hpp"
+#include <cstring>
+#include <exception>
+#include <filesystem>
+
+namespace game::assets {
+
+    std::string resolve_path(const std::string &path)
+    {
+        if (path.empty()) return path;
+        if ((path.size() > 1 && path[1] == ':') || (!path.empty() && (path[0] == '/' || path[0] == '\\'))) {
+            std::filesystem::path absolute(path);
+            try {
+                if (std::filesystem::exists(absolute)) {
+                    return absolute.generic_string();
+                }
+            } catch (const std::exception &) {
+            }
+
+            std::string generic = absolute.generic_string();
+            const std::string marker = "assets/";
+            auto pos = generic.find(marker);
+            if (pos != std::string::npos) {
+                std::string relative = generic.substr(pos + marker.size());
+                if (!relative.empty() && relative.front() == '/')
+                    relative.erase(relative.begin());
+                return std::string(ASSETS_PATH) + "/" + relative;
+            }
+
+            if (!generic.empty() && generic.front() == '/')
+                generic.erase(generic.begin());
+            return std::string(ASSETS_PATH) + "/" + generic;
+        }
+        const char *legacyRoot = "../Game/Assets/";
+        if (path.rfind(legacyRoot, 0) == 0) {
+            return std::string(ASSETS_PATH) + "/" + path.substr(std::strlen(legacyRoot));
+        }
+        if (path.rfind("assets/", 0) == 0) {
+            return std::string(ASSETS_PATH) + "/" + path.substr(std::strlen("assets/"));
+        }
+        return std::string(ASSETS_PATH) + "/" + path;
+    }
+
+} // namespace game::assets
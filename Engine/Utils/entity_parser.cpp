@@ -23,48 +23,13 @@
 #include "../Core/Entities/Include/spawner.hpp"
 #include "../Core/Entities/Include/checkpoint.hpp"
 #include "../Core/Entities/Include/triggerzone.hpp"
+#include "Include/asset_path.hpp"
 #include <fstream>
 #include <stdexcept>
 #include <initializer_list>
 #include <cstring>
 #include <filesystem>
 
-static std::string resolve_asset_path(const std::string &path)
-{
-    if (path.empty()) return path;
-    if ((path.size() > 1 && path[1] == ':') || (!path.empty() && (path[0] == '/' || path[0] == '\\'))) {
-        std::filesystem::path absolute(path);
-        try {
-            if (std::filesystem::exists(absolute)) {
-                return absolute.generic_string();
-            }
-        } catch (const std::exception &) {
-        }
-
-        std::string generic = absolute.generic_string();
-        const std::string marker = "assets/";
-        auto pos = generic.find(marker);
-        if (pos != std::string::npos) {
-            std::string relative = generic.substr(pos + marker.size());
-            if (!relative.empty() && relative.front() == '/')
-                relative.erase(relative.begin());
-            return std::string(ASSETS_PATH) + "/" + relative;
-        }
-
-        if (!generic.empty() && generic.front() == '/')
-            generic.erase(generic.begin());
-        return std::string(ASSETS_PATH) + "/" + generic;
-    }
-    const char *legacyRoot = "../Game/Assets/";
-    if (path.rfind(legacyRoot, 0) == 0) {
-        return std::string(ASSETS_PATH) + "/" + path.substr(std::strlen(legacyRoot));
-    }
-    if (path.rfind("assets/", 0) == 0) {
-        return std::string(ASSETS_PATH) + "/" + path.substr(std::strlen("assets/"));
-    }
-    return std::string(ASSETS_PATH) + "/" + path;
-}
-
 namespace game::parsing
 {
     static void check_field(const nlohmann::json &data, const std::string &field, nlohmann::json::value_t expected_type)
@@ -123,8 +88,8 @@ namespace game::parsing
             float height = bg_data.value("height", 200.0f);
             float depth  = bg_data.value("depth", 1.0f);
 
-            std::string image_path = resolve_asset_path(bg_data.value("image_path", ""));
-            std::string model_path = resolve_asset_path(bg_data.value("model_path", ""));
+            std::string image_path = game::assets::resolve_path(bg_data.value("image_path", ""));
+            std::string model_path = game::assets::resolve_path(bg_data.value("model_path", ""));
             float scale = bg_data.value("scale", 1.0f);
 
             if (!image_path.empty() && !std::ifstream(image_path).good()) {
@@ -164,8 +129,8 @@ namespace game::parsing
             int health = player_data.value("health", 100);
             float speed = player_data.value("speed", 300.0f);
 
-            std::string image_path = resolve_asset_path(player_data.value("image_path", ""));
-            std::string model_path = resolve_asset_path(player_data.value("model_path", ""));
+            std::string image_path = game::assets::resolve_path(player_data.value("image_path", ""));
+            std::string model_path = game::assets::resolve_path(player_data.value("model_path", ""));
 
             if (!image_path.empty() && !std::ifstream(image_path).good()) {
                 std::cerr << "[WARNING] Player image file not found: " << image_path << std::endl;
@@ -203,8 +168,8 @@ namespace game::parsing
             velocity = enemy_data.value("speed", 0.0f);
             width = enemy_data.value("w", 0.0f);
             height = enemy_data.value("h", 0.0f);
-            std::string image_path = resolve_asset_path(enemy_data.value("image_path", ""));
-            std::string model_path = resolve_asset_path(enemy_data.value("model_path", ""));
+            std::string image_path = game::assets::resolve_path(enemy_data.value("image_path", ""));
+            std::string model_path = game::assets::resolve_path(enemy_data.value("model_path", ""));
             std::string pattern = enemy_data.value("pattern", "");
 
             if (!image_path.empty() && !std::ifstream(image_path).good()) {
@@ -236,8 +201,8 @@ namespace game::parsing
                 z = obstacle_data.value("z", 0.0f);
             }
 
-            std::string image_path = resolve_asset_path(obstacle_data.value("image_path", ""));
-            std::string model_path = resolve_asset_path(obstacle_data.value("model_path", ""));
+            std::string image_path = game::assets::resolve_path(obstacle_data.value("image_path", ""));
+            std::string model_path = game::assets::resolve_path(obstacle_data.value("model_path", ""));
             velocity = obstacle_data.value("speed", 0.0f);
             width = read_dimension(obstacle_data, {"width", "w"}, 0.0f);
             height = read_dimension(obstacle_data, {"height", "h"}, 0.0f);
@@ -273,7 +238,7 @@ namespace game::parsing
             velocity = element_data.value("speed", 0.0f);
             width = element_data.value("w", 0.0f);
             height = element_data.value("h", 0.0f);
-            std::string image_path = resolve_asset_path(element_data.value("image_path", ""));
+            std::string image_path = game::assets::resolve_path(element_data.value("image_path", ""));
             std::string type;
             if (element_data.contains("type")) {
                 if (element_data["type"].is_string())
@@ -299,7 +264,7 @@ namespace game::parsing
     ecs::entity_t parse_sound(ecs::registry &reg, const nlohmann::json &sound_data)
     {
         try {
-            std::string sound_path = resolve_asset_path(sound_data.value("sound_path", ""));
+            std::string sound_path = game::assets::resolve_path(sound_data.value("sound_path", ""));
             
             if (sound_path.empty()) {
                 throw std::runtime_error("Missing sound_path field");
@@ -338,7 +303,7 @@ namespace game::parsing
 
             std::string content = text_data.value("content", "");
             int font_size = text_data.value("font_size", 12);
-            std::string font_path = resolve_asset_path(text_data.value("font_path", ""));
+            std::string font_path = game::assets::resolve_path(text_data.value("font_path", ""));
 
             if (!font_path.empty() && !std::ifstream(font_path).good()) {
                 std::cerr << "[WARNING] Font file not found: " << font_path << std::endl;
@@ -360,8 +325,8 @@ namespace game::parsing
             float height = item_data.value("height", 32.f);
             float depth  = item_data.value("depth", 32.f);
 
-            std::string image_path = resolve_asset_path(item_data.value("image_path", ""));
-            std::string model_path = resolve_asset_path(item_data.value("model_path", ""));
+            std::string image_path = game::assets::resolve_path(item_data.value("image_path", ""));
+            std::string model_path = game::assets::resolve_path(item_data.value("model_path", ""));
 
             if (!image_path.empty() && !std::ifstream(image_path).good()) {
                 std::cerr << "[WARNING] Item image file not found: " << image_path << std::endl;
@@ -389,8 +354,8 @@ namespace game::parsing
             float height = data.value("height", 32.f);
             float depth  = data.value("depth", 32.f);
 
-            std::string image_path = resolve_asset_path(data.value("image_path", ""));
-            std::string model_path = resolve_asset_path(data.value("model_path", ""));
+            std::string image_path = game::assets::resolve_path(data.value("image_path", ""));
+            std::string model_path = game::assets::resolve_path(data.value("model_path", ""));
 
             if (!image_path.empty() && !std::ifstream(image_path).good()) {
                 std::cerr << "[WARNING] Powerup image file not found: " << image_path << std::endl;
@@ -416,8 +381,8 @@ namespace game::parsing
             float height = data.value("height", 32.f);
             float depth  = data.value("depth", 32.f);
 
-            std::string image_path = resolve_asset_path(data.value("image_path", ""));
-            std::string model_path = resolve_asset_path(data.value("model_path", ""));
+            std::string image_path = game::assets::resolve_path(data.value("image_path", ""));
+            std::string model_path = game::assets::resolve_path(data.value("model_path", ""));
 
             if (!image_path.empty() && !std::ifstream(image_path).good()) {
                 std::cerr << "[WARNING] Trap image file not found: " << image_path << std::endl;
@@ -443,8 +408,8 @@ namespace game::parsing
             float height = data.value("height", 128.f);
             float depth  = data.value("depth", 32.f);
 
-            std::string image_path = resolve_asset_path(data.value("image_path", ""));
-            std::string model_path = resolve_asset_path(data.value("model_path", ""));
+            std::string image_path = game::assets::resolve_path(data.value("image_path", ""));
+            std::string model_path = game::assets::resolve_path(data.value("model_path", ""));
 
             if (!image_path.empty() && !std::ifstream(image_path).good()) {
                 std::cerr << "[WARNING] Gate image file not found: " << image_path << std::endl;
@@ -470,8 +435,8 @@ namespace game::parsing
             float height = data.value("height", 32.f);
             float depth  = data.value("depth", 32.f);
 
-            std::string image_path = resolve_asset_path(data.value("image_path", ""));
-            std::string model_path = resolve_asset_path(data.value("model_path", ""));
+            std::string image_path = game::assets::resolve_path(data.value("image_path", ""));
+            std::string model_path = game::assets::resolve_path(data.value("model_path", ""));
 
             if (!image_path.empty() && !std::ifstream(image_path).good()) {
                 std::cerr << "[WARNING] Weapon image file not found: " << image_path << std::endl;
@@ -497,8 +462,8 @@ namespace game::parsing
             float height = data.value("height", 100.f);
             float depth  = data.value("depth", 10.f);
 
-            std::string image_path = resolve_asset_path(data.value("image_path", ""));
-            std::string model_path = resolve_asset_path(data.value("model_path", ""));
+            std::string image_path = game::assets::resolve_path(data.value("image_path", ""));
+            std::string model_path = game::assets::resolve_path(data.value("model_path", ""));
 
             if (!image_path.empty() && !std::ifstream(image_path).good()) {
                 std::cerr << "[WARNING] PNG image file not found: " << image_path << std::endl;
@@ -524,8 +489,8 @@ namespace game::parsing
             float height = read_dimension(data, {"height", "h"}, 40.f);
             float depth  = read_dimension(data, {"depth", "d"}, 20.f);
 
-            std::string image_path = resolve_asset_path(data.value("image_path", ""));
-            std::string model_path = resolve_asset_path(data.value("model_path", ""));
+            std::string image_path = game::assets::resolve_path(data.value("image_path", ""));
+            std::string model_path = game::assets::resolve_path(data.value("model_path", ""));
 
             if (!image_path.empty() && !std::ifstream(image_path).good()) {
                 std::cerr << "[WARNING] Platform image file not found: " << image_path << std::endl;
@@ -553,8 +518,8 @@ namespace game::parsing
             float height = data.value("height", 50.f);
             float depth  = data.value("depth", 50.f);
 
-            std::string image_path = resolve_asset_path(data.value("image_path", ""));
-            std::string model_path = resolve_asset_path(data.value("model_path", ""));
+            std::string image_path = game::assets::resolve_path(data.value("image_path", ""));
+            std::string model_path = game::assets::resolve_path(data.value("model_path", ""));
 
             if (!image_path.empty() && !std::ifstream(image_path).good()) {
                 std::cerr << "[WARNING] Decoration image file not found: " << image_path << std::endl;
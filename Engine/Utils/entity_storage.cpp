@@ -8,6 +8,7 @@
 #include "Include/entity_storage.hpp"
 #include "Include/entity_parser.hpp"
 #include <iostream>
+#include <algorithm>
 
 namespace game::storage {
 
@@ -149,4 +150,24 @@ namespace game::storage {
         }
     }
 
+    level_images list_level_images(const nlohmann::json &level_data) {
+        level_images images;
+        if (!level_data.contains("level") || !level_data.at("level").is_object())
+            return images;
+
+        for (const auto &[field, entities] : level_data.at("level").items()) {
+            if (!entities.is_array())
+                continue;
+            std::vector<std::string> &list = field == "backgrounds" ? images.backgrounds : images.sprites;
+            for (const auto &entity_data : entities) {
+                if (!entity_data.is_object() || !entity_data.contains("image_path") || !entity_data.at("image_path").is_string())
+                    continue;
+                std::string path = entity_data.at("image_path").get<std::string>();
+                if (!path.empty() && std::find(list.begin(), list.end(), path) == list.end())
+                    list.push_back(path);
+            }
+        }
+        return images;
+    }
+
 } // namespace game::storage
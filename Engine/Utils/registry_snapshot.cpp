@@ -0,0 +1,324 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** registry_snapshot
+*/
+
+#include "Include/registry_snapshot.hpp"
+#include "Include/asset_path.hpp"
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace game::serializer {
+
+    namespace {
+        constexpr uint8_t MAGIC[4] = {'R', 'S', 'N', 'P'};
+        constexpr std::size_t HEADER_SIZE = 16;
+        constexpr std::size_t ENTITY_HEADER_SIZE = 8;
+        constexpr uint32_t KNOWN_COMPONENTS = static_cast<uint32_t>((1ull << static_cast<unsigned>(SnapshotComponent::Count)) - 1);
+
+        void putU16(uint8_t *out, uint16_t value) {
+            out[0] = static_cast<uint8_t>(value >> 8);
+            out[1] = static_cast<uint8_t>(value);
+        }
+
+        void putU32(uint8_t *out, uint32_t value) {
+            out[0] = static_cast<uint8_t>(value >> 24);
+            out[1] = static_cast<uint8_t>(value >> 16);
+            out[2] = static_cast<uint8_t>(value >> 8);
+            out[3] = static_cast<uint8_t>(value);
+        }
+
+        uint16_t getU16(const uint8_t *in) {
+            return static_cast<uint16_t>((in[0] << 8) | in[1]);
+        }
+
+        uint32_t getU32(const uint8_t *in) {
+            return (static_cast<uint32_t>(in[0]) << 24) | (static_cast<uint32_t>(in[1]) << 16)
+                | (static_cast<uint32_t>(in[2]) << 8) | static_cast<uint32_t>(in[3]);
+        }
+
+        /** Appends fields to a snapshot; strings are interned and written as table indices. */
+        class Writer {
+            public:
+                explicit Writer(std::vector<uint8_t> &out) : _out(out) {}
+
+                void put_u16(uint16_t value) { putU16(grow(2), value); }
+                void put_u32(uint32_t value) { putU32(grow(4), value); }
+
+                void put(float value) { put_u32(std::bit_cast<uint32_t>(value)); }
+                void put(int value) { put_u32(static_cast<uint32_t>(value)); }
+                void put(uint32_t value) { put_u32(value); }
+                void put(bool value) { _out.push_back(value ? 1 : 0); }
+                void put(unsigned char value) { _out.push_back(value); }
+                void put(component::entity_type value) { _out.push_back(static_cast<uint8_t>(value)); }
+                void put(ecs::entity_t value) { put_u32(static_cast<uint32_t>(value.value())); }
+                void put(const std::string &value) { put_u16(intern(value)); }
+
+                /** Appends the string table, in index order. */
+                void write_strings()
+                {
+                    for (const auto &string : _strings) {
+                        put_u16(static_cast<uint16_t>(string.size()));
+                        _out.insert(_out.end(), string.begin(), string.end());
+                    }
+                }
+
+                std::size_t string_count() const noexcept { return _strings.size(); }
+
+            private:
+                uint8_t *grow(std::size_t size)
+                {
+                    _out.resize(_out.size() + size);
+                    return _out.data() + _out.size() - size;
+                }
+
+                uint16_t intern(const std::string &value)
+                {
+                    auto it = _indices.find(value);
+                    if (it != _indices.end())
+                        return it->second;
+                    if (value.size() > std::numeric_limits<uint16_t>::max())
+                        throw std::length_error("encode_snapshot: string longer than 65535 bytes");
+                    if (_strings.size() > std::numeric_limits<uint16_t>::max())
+                        throw std::length_error("encode_snapshot: more than 65535 different strings");
+                    auto index = static_cast<uint16_t>(_strings.size());
+                    _strings.push_back(value);
+                    _indices.emplace(_strings.back(), index);
+                    return index;
+                }
+
+                std::vector<uint8_t> &_out;
+                std::vector<std::string> _strings;
+                std::unordered_map<std::string, uint16_t> _indices;
+        };
+
+        /** Reads fields back; any overrun or bad value turns ok() false and yields zeroes. */
+        class Reader {
+            public:
+                Reader(const uint8_t *data, std::size_t size, const std::vector<std::string> &strings)
+                    : _data(data), _size(size), _strings(strings) {}
+
+                bool ok() const noexcept { return _ok; }
+                std::size_t offset() const noexcept { return _offset; }
+
+                uint8_t get_u8() { const uint8_t *in = take(1); return in ? in[0] : 0; }
+                uint16_t get_u16() { const uint8_t *in = take(2); return in ? getU16(in) : 0; }
+                uint32_t get_u32() { const uint8_t *in = take(4); return in ? getU32(in) : 0; }
+
+                void get(float &value) { value = std::bit_cast<float>(get_u32()); }
+                void get(int &value) { value = static_cast<int>(get_u32()); }
+                void get(uint32_t &value) { value = get_u32(); }
+                void get(bool &value) { value = get_u8() != 0; }
+                void get(unsigned char &value) { value = get_u8(); }
+                void get(ecs::entity_t &value) { value = ecs::entity_t(get_u32()); }
+
+                void get(component::entity_type &value)
+                {
+                    uint8_t raw = get_u8();
+                    if (raw > static_cast<uint8_t>(component::entity_type::PATTERN_ELEMENT))
+                        _ok = false;
+                    value = static_cast<component::entity_type>(raw);
+                }
+
+                void get(std::string &value)
+                {
+                    uint16_t index = get_u16();
+                    if (index >= _strings.size()) {
+                        _ok = false;
+                        return;
+                    }
+                    value = _strings[index];
+                }
+
+            private:
+                const uint8_t *take(std::size_t size)
+                {
+                    if (!_ok || _size - _offset < size) {
+                        _ok = false;
+                        return nullptr;
+                    }
+                    const uint8_t *in = _data + _offset;
+                    _offset += size;
+                    return in;
+                }
+
+                const uint8_t *_data;
+                std::size_t _size;
+                std::size_t _offset{0};
+                const std::vector<std::string> &_strings;
+                bool _ok{true};
+        };
+
+        bool read_strings(const uint8_t *data, std::size_t size, std::size_t count, std::vector<std::string> &strings)
+        {
+            std::size_t offset = 0;
+            strings.reserve(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                if (size - offset < 2)
+                    return false;
+                std::size_t length = getU16(data + offset);
+                offset += 2;
+                if (size - offset < length)
+                    return false;
+                strings.emplace_back(reinterpret_cast<const char *>(data + offset), length);
+                offset += length;
+            }
+            return offset == size;
+        }
+    }
+
+    std::vector<uint8_t> encode_snapshot(const ecs::registry &reg) {
+#define RTYPE_SNAPSHOT_ARRAY(name, fields) \
+        const auto *name##_array = reg.has_components<component::name>() ? &reg.get_components<component::name>() : nullptr;
+        RTYPE_SNAPSHOT_COMPONENTS(RTYPE_SNAPSHOT_ARRAY, RTYPE_SNAPSHOT_NO_FIELD)
+#undef RTYPE_SNAPSHOT_ARRAY
+
+        std::vector<uint8_t> out(HEADER_SIZE);
+        out.reserve(HEADER_SIZE + reg.alive_entities().size() * 64);
+        Writer writer(out);
+        uint32_t count = 0;
+
+        for (auto entity : reg.alive_entities()) {
+            std::size_t index = entity.value();
+            bool typed = type_array && type_array->contains(index);
+            bool hitbox = hitbox_link_array && hitbox_link_array->contains(index);
+            if (!typed && !hitbox)
+                continue;
+
+            std::size_t entityStart = out.size();
+            writer.put_u32(static_cast<uint32_t>(index));
+            writer.put_u32(0);
+            uint32_t mask = 0;
+#define RTYPE_SNAPSHOT_WRITE_FIELD(member) writer.put(c.member);
+#define RTYPE_SNAPSHOT_ENCODE(name, fields) \
+            if (name##_array && name##_array->contains(index)) { \
+                const auto &c = *(*name##_array)[index]; \
+                mask |= snapshot_bit(SnapshotComponent::name); \
+                fields \
+            }
+            RTYPE_SNAPSHOT_COMPONENTS(RTYPE_SNAPSHOT_ENCODE, RTYPE_SNAPSHOT_WRITE_FIELD)
+#undef RTYPE_SNAPSHOT_ENCODE
+#undef RTYPE_SNAPSHOT_WRITE_FIELD
+            putU32(out.data() + entityStart + 4, mask);
+            ++count;
+        }
+
+        std::size_t stringsOffset = out.size();
+        if (stringsOffset > std::numeric_limits<uint32_t>::max())
+            throw std::length_error("encode_snapshot: snapshot larger than 4 GiB");
+        writer.write_strings();
+
+        std::copy(std::begin(MAGIC), std::end(MAGIC), out.begin());
+        out[4] = SNAPSHOT_VERSION;
+        out[5] = 0;
+        putU16(out.data() + 6, static_cast<uint16_t>(writer.string_count()));
+        putU32(out.data() + 8, count);
+        putU32(out.data() + 12, static_cast<uint32_t>(stringsOffset));
+        return out;
+    }
+
+    std::optional<RegistrySnapshot> decode_snapshot(const uint8_t *data, std::size_t size) {
+        if (size < HEADER_SIZE || !std::equal(std::begin(MAGIC), std::end(MAGIC), data) || data[4] != SNAPSHOT_VERSION)
+            return std::nullopt;
+        std::size_t stringCount = getU16(data + 6);
+        std::size_t entityCount = getU32(data + 8);
+        std::size_t stringsOffset = getU32(data + 12);
+        if (stringsOffset < HEADER_SIZE || stringsOffset > size
+            || entityCount > (stringsOffset - HEADER_SIZE) / ENTITY_HEADER_SIZE)
+            return std::nullopt;
+
+        std::vector<std::string> strings;
+        if (!read_strings(data + stringsOffset, size - stringsOffset, stringCount, strings))
+            return std::nullopt;
+
+        RegistrySnapshot snapshot;
+        snapshot.entities.resize(entityCount);
+        Reader reader(data + HEADER_SIZE, stringsOffset - HEADER_SIZE, strings);
+        for (auto &entity : snapshot.entities) {
+            entity.entity_id = reader.get_u32();
+            entity.mask = reader.get_u32();
+            if (entity.mask & ~KNOWN_COMPONENTS)
+                return std::nullopt;
+#define RTYPE_SNAPSHOT_READ_FIELD(member) reader.get(c.member);
+#define RTYPE_SNAPSHOT_DECODE(name, fields) \
+            if (entity.has(SnapshotComponent::name)) { \
+                auto &c = entity.name; \
+                fields \
+            }
+            RTYPE_SNAPSHOT_COMPONENTS(RTYPE_SNAPSHOT_DECODE, RTYPE_SNAPSHOT_READ_FIELD)
+#undef RTYPE_SNAPSHOT_DECODE
+#undef RTYPE_SNAPSHOT_READ_FIELD
+            if (!reader.ok())
+                return std::nullopt;
+        }
+        if (reader.offset() != stringsOffset - HEADER_SIZE)
+            return std::nullopt;
+        return snapshot;
+    }
+
+    namespace {
+        // Asset paths are the sender's: point them at this build's assets.
+        template <typename Component>
+        Component localized(Component c) { return c; }
+
+        component::sprite localized(component::sprite c) {
+            c.image_path = game::assets::resolve_path(c.image_path);
+            return c;
+        }
+
+        component::model3D localized(component::model3D c) {
+            c.model_path = game::assets::resolve_path(c.model_path);
+            return c;
+        }
+
+        component::audio localized(component::audio c) {
+            c.sound_path = game::assets::resolve_path(c.sound_path);
+            return c;
+        }
+
+        component::font localized(component::font c) {
+            c.font_path = game::assets::resolve_path(c.font_path);
+            return c;
+        }
+    }
+
+    void restore_snapshot(ecs::registry &reg, const RegistrySnapshot &snapshot) {
+#define RTYPE_SNAPSHOT_REGISTER(name, fields) reg.register_component<component::name>();
+        RTYPE_SNAPSHOT_COMPONENTS(RTYPE_SNAPSHOT_REGISTER, RTYPE_SNAPSHOT_NO_FIELD)
+#undef RTYPE_SNAPSHOT_REGISTER
+
+        std::vector<ecs::entity_t> created;
+        std::unordered_map<uint32_t, ecs::entity_t> byServerId;
+        created.reserve(snapshot.entities.size());
+        byServerId.reserve(snapshot.entities.size());
+        for (const auto &state : snapshot.entities) {
+            created.push_back(reg.spawn_entity());
+            byServerId.emplace(state.entity_id, created.back());
+        }
+
+        for (std::size_t i = 0; i < snapshot.entities.size(); ++i) {
+            const SnapshotEntity &state = snapshot.entities[i];
+            ecs::entity_t entity = created[i];
+#define RTYPE_SNAPSHOT_RESTORE(name, fields) \
+            if (state.has(SnapshotComponent::name)) \
+                reg.add_component<component::name>(entity, localized(component::name(state.name)));
+            RTYPE_SNAPSHOT_COMPONENTS(RTYPE_SNAPSHOT_RESTORE, RTYPE_SNAPSHOT_NO_FIELD)
+#undef RTYPE_SNAPSHOT_RESTORE
+
+            if (!state.has(SnapshotComponent::hitbox_link))
+                continue;
+            auto owner = byServerId.find(static_cast<uint32_t>(state.hitbox_link.owner.value()));
+            if (owner != byServerId.end())
+                reg.get_components<component::hitbox_link>()[entity.value()]->owner = owner->second;
+            else
+                reg.remove_component<component::hitbox_link>(entity);
+        }
+    }
+
+} // namespace game::serializer
@@ -11,22 +11,14 @@
 #include <cstring>
 #include <thread>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <cmath>
 #include <string>
 #include <cctype>
 #include "WeaponDefinition.hpp"
-
-#define RESET_COLOR   "\033[0m"
-#define RED_COLOR     "\033[31m"
-#define GREEN_COLOR   "\033[32m"
-#define YELLOW_COLOR  "\033[33m"
-#define BLUE_COLOR    "\033[34m"
-#define LOG_ERROR(msg)   std::cerr << RED_COLOR << "[ERROR] " << msg << RESET_COLOR << std::endl
-#define LOG_INFO(msg)    std::cout << GREEN_COLOR << "[INFO] " << msg << RESET_COLOR << std::endl
-#define LOG_DEBUG(msg)   std::cout << YELLOW_COLOR << "[DEBUG] " << msg << RESET_COLOR << std::endl
-#define LOG(msg)         std::cout << BLUE_COLOR << msg << RESET_COLOR << std::endl
-
+#include "PlayerMovement.hpp"
+#include "Logger.hpp"
 
 static nlohmann::json load_json_from_file(const std::string &path) {
     std::ifstream file(path);
@@ -38,7 +30,20 @@ static nlohmann::json load_json_from_file(const std::string &path) {
     return data;
 }
 
+static std::string level_path(int level) {
+    return ASSETS_PATH "/Config_assets/Levels/level_0" + std::to_string(level) + ".json";
+}
+
 ServerGame::ServerGame(Connexion &conn) : connexion(conn), registry_server() {
+    _profiler = std::make_shared<metrics::TickProfiler>(std::vector<std::string>{
+        "messages", "inputs",
+        "update_projectiles", "update_elements", "update_enemies", "update_obstacles", "update_enemy_projectiles",
+        "broadphase",
+        "check_enemy_projectiles_players", "check_projectiles_obstacles", "check_projectiles_enemies",
+        "check_players_enemies", "check_players_elements",
+        "broadcast_snapshot", "broadcast_health", "broadcast_scores",
+        "level_transition",
+    });
     _roomId = -1;
     registry_server.register_component<component::position>();
     registry_server.register_component<component::previous_position>();
@@ -73,13 +78,14 @@ void ServerGame::setInitialPlayerWeapons(const std::unordered_map<uint32_t, std:
 }
 
 
-void ServerGame::run(int roomId) {
-    LOG("[Server] Starting game loop...");
+void ServerGame::start(int roomId) {
+    LOG("[Server] Starting game for room " << roomId);
     _roomId = roomId;
     load_players(ASSETS_PATH "/Config_assets/Players/players.json");
-    load_level(ASSETS_PATH "/Config_assets/Levels/level_01.json");
+    load_level(level_path(currentLevel));
     initialize_player_positions();
     index_existing_entities();
+    prefetch_level(currentLevel + 1);
 
     if (!_playerSkins.empty()) {
         const std::string assetsPlayerDir = std::string(ASSETS_PATH) + "/sprites/player/";
@@ -96,60 +102,80 @@ void ServerGame::run(int roomId) {
             broadcast_player_skin(entry.first, entry.second);
         }
     }
+    _isEndless = false;
+}
 
-    const int tick_ms = 16;
-    float dt = 0.016f;
-    _isEndless = false; 
-
-    while (true) {
-        auto tick_start = std::chrono::high_resolution_clock::now();
-
-        process_pending_messages();
-        process_player_inputs(dt);
-
-        if (!gameCompleted) {
-            update_projectiles_server_only(dt);
-            update_element(dt);
-            update_enemies(dt);
-            update_obstacles(dt);
-            update_enemy_projectiles_server_only(dt);
+bool ServerGame::tick(float dt) {
+    if (_stopRequested.load(std::memory_order_acquire)) {
+        LOG("[Server] Game of room " << _roomId << " stopped");
+        return false;
+    }
 
-            check_enemy_projectile_player_collisions();
-            check_projectile_collisions();
-            check_projectile_enemy_collisions();
-            check_player_enemy_collisions();
-            check_player_element_collisions();
+    metrics::PhaseTimer timer(*_profiler);
+    process_pending_messages();
+    timer.lap(PHASE_MESSAGES);
+    process_player_inputs(dt);
+    send_input_acks();
+    timer.lap(PHASE_INPUTS);
+
+    if (!gameCompleted) {
+        update_projectiles_server_only(dt);
+        timer.lap(PHASE_UPDATE_PROJECTILES);
+        update_element(dt);
+        timer.lap(PHASE_UPDATE_ELEMENTS);
+        update_enemies(dt);
+        timer.lap(PHASE_UPDATE_ENEMIES);
+        update_obstacles(dt);
+        timer.lap(PHASE_UPDATE_OBSTACLES);
+        update_enemy_projectiles_server_only(dt);
+        timer.lap(PHASE_UPDATE_ENEMY_PROJECTILES);
+
+        rebuild_broadphase();
+        timer.lap(PHASE_BROADPHASE);
+        check_enemy_projectile_player_collisions();
+        timer.lap(PHASE_CHECK_ENEMY_PROJECTILES_PLAYERS);
+        check_projectile_collisions();
+        timer.lap(PHASE_CHECK_PROJECTILES_OBSTACLES);
+        check_projectile_enemy_collisions();
+        timer.lap(PHASE_CHECK_PROJECTILES_ENEMIES);
+        check_player_enemy_collisions();
+        timer.lap(PHASE_CHECK_PLAYERS_ENEMIES);
+        check_player_element_collisions();
+        timer.lap(PHASE_CHECK_PLAYERS_ELEMENTS);
+    }
 
-            broadcast_projectile_positions();
-            broadcast_obstacle_positions();
-            broadcast_enemy_positions();
-            broadcast_element_positions();
-            broadcast_enemy_projectile_positions();
+    broadcast_snapshot(!gameCompleted);
+    timer.lap(PHASE_BROADCAST_SNAPSHOT);
+    broadcast_player_health();
+    timer.lap(PHASE_BROADCAST_HEALTH);
+    broadcast_global_score();
+    broadcast_individual_scores();
+    timer.lap(PHASE_BROADCAST_SCORES);
+
+    if (levelTransitionPending && !gameCompleted) {
+        auto now = std::chrono::steady_clock::now();
+        auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
+            now - levelTransitionTime
+        ).count();
+
+        if (elapsed >= LEVEL_TRANSITION_DELAY) {
+            load_next_level();
+            levelTransitionPending = false;
         }
-
-        broadcast_states_to_clients();
-        broadcast_player_health();
-        broadcast_global_score();
-        broadcast_individual_scores();
-
-        if (levelTransitionPending && !gameCompleted) {
-            auto now = std::chrono::steady_clock::now();
-            auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
-                now - levelTransitionTime
-            ).count();
-            
-            if (elapsed >= LEVEL_TRANSITION_DELAY) {
-                load_next_level();
-                levelTransitionPending = false;
-            }
-        }       
-        sleep_to_maintain_tick(tick_start, tick_ms);
     }
+    timer.lap(PHASE_LEVEL_TRANSITION);
+    return true;
+}
+
+void ServerGame::stop() {
+    _stopRequested.store(true, std::memory_order_release);
 }
 
-void ServerGame::enqueuePacket(const std::vector<uint8_t> &data, const asio::ip::udp::endpoint &from) {
-    std::lock_guard<std::mutex> lock(packetMutex);
-    pendingPackets.push(PendingPacket{data, from});
+void ServerGame::enqueuePacket(Connexion::ReceivedPacket &packet) {
+    _profiler->packetsIn.add(1);
+    _profiler->bytesIn.add(packet.data.size());
+    if (!packetRing.try_push(packet))
+        _profiler->droppedPackets.add(1);
 }
 
 void ServerGame::setInitialClients(const std::map<uint32_t, bool> &clients) {
@@ -174,20 +200,58 @@ bool ServerGame::check_aabb_overlap(float left1, float right1, float top1, float
     return right1 > left2 && left1 < right2 && bottom1 > top2 && top1 < bottom2;
 }
 
+void ServerGame::rebuild_broadphase() {
+    const float ENEMY_SIZE = 30.f;
+
+    auto &positions = registry_server.get_components<component::position>();
+    auto &collisionBoxes = registry_server.get_components<component::collision_box>();
+    auto &types = registry_server.get_components<component::type>();
+
+    _broadphase.clear();
+    _broadphaseEntities.clear();
+
+    auto insert_entity = [&](ecs::entity_t entity, float width, float height, BroadphaseLayer layer) {
+        auto id = static_cast<std::size_t>(entity);
+        _broadphase.insert(static_cast<uint32_t>(_broadphaseEntities.size()),
+                           physics::aabb::from_center(positions[id]->x, positions[id]->y, width, height), layer);
+        _broadphaseEntities.push_back(entity);
+    };
+
+    for (auto enemy : _enemies) {
+        auto id = static_cast<std::size_t>(enemy);
+        if (id >= positions.size() || !positions[id])
+            continue;
+        bool hasBox = id < collisionBoxes.size() && collisionBoxes[id];
+        insert_entity(enemy, hasBox ? collisionBoxes[id]->width : ENEMY_SIZE,
+                      hasBox ? collisionBoxes[id]->height : ENEMY_SIZE, LAYER_ENEMY);
+    }
+    for (auto element : _randomElements) {
+        auto id = static_cast<std::size_t>(element);
+        if (id >= positions.size() || !positions[id] || id >= collisionBoxes.size() || !collisionBoxes[id] ||
+            id >= types.size() || !types[id] || types[id]->value != component::entity_type::RANDOM_ELEMENT)
+            continue;
+        insert_entity(element, collisionBoxes[id]->width, collisionBoxes[id]->height, LAYER_ELEMENT);
+    }
+    for (auto obstacle : _obstacles) {
+        auto id = static_cast<std::size_t>(obstacle);
+        if (id >= positions.size() || !positions[id] || id >= collisionBoxes.size() || !collisionBoxes[id])
+            continue;
+        insert_entity(obstacle, collisionBoxes[id]->width, collisionBoxes[id]->height, LAYER_OBSTACLE);
+    }
+    _broadphase.build();
+}
+
 void ServerGame::broadcast_full_registry_to(uint32_t clientId) {
-    nlohmann::json root;
-    root["type"] = "FullRegistry";
-    root["entities"] = nlohmann::json::array();
-
-    for (auto entity : registry_server.alive_entities()) {
-        auto j = game::serializer::serialize_entity(registry_server, entity);
-        if (!j.empty()) {
-            root["entities"].push_back(j);
-        }
+    std::vector<uint8_t> snapshot;
+    try {
+        snapshot = game::serializer::encode_snapshot(registry_server);
+    } catch (const std::exception &e) {
+        LOG_ERROR("broadcast_full_registry_to failed: " << e.what());
+        return;
     }
-    connexion.sendJsonToClient(clientId, root);
-    LOG_DEBUG("[Server] Sent full registry to client " << clientId 
-              << " with " << root["entities"].size() << " entities");
+    connexion.sendReliable(clientId, reliable::Channel::Registry, snapshot.data(), snapshot.size());
+    LOG_DEBUG("[Server] Sent full registry to client " << clientId
+              << " (" << snapshot.size() << " bytes)");
 }
 
 void ServerGame::load_players(const std::string &path) {
@@ -210,7 +274,11 @@ void ServerGame::load_players(const std::string &path) {
 
 void ServerGame::load_level(const std::string &path) {
     try {
-        auto json = load_json_from_file(path);
+        nlohmann::json json;
+        if (_nextLevelJson.valid() && path == _nextLevelPath)
+            json = _nextLevelJson.get();
+        else
+            json = load_json_from_file(path);
         game::storage::store_level_entities(registry_server, json);
         auto &positions = registry_server.get_components<component::position>();
         for (std::size_t i = 0; i < positions.size(); ++i) {
@@ -224,6 +292,16 @@ void ServerGame::load_level(const std::string &path) {
     }
 }
 
+void ServerGame::prefetch_level(int level) {
+    if (level > MAX_LEVELS) {
+        if (!_isEndless)
+            return;
+        level = 1;
+    }
+    _nextLevelPath = level_path(level);
+    _nextLevelJson = std::async(std::launch::async, load_json_from_file, _nextLevelPath);
+}
+
 void ServerGame::index_existing_entities() {
     _obstacles.clear();
     _enemies.clear();
@@ -349,8 +427,7 @@ void ServerGame::load_next_level() {
     clear_level_entities();
     initialize_player_positions();
 
-    std::string levelPath = ASSETS_PATH "/Config_assets/Levels/level_0" 
-                          + std::to_string(currentLevel) + ".json";
+    std::string levelPath = level_path(currentLevel);
     try {
         std::ifstream testFile(levelPath);
         if (!testFile.good()) {
@@ -362,8 +439,9 @@ void ServerGame::load_next_level() {
         testFile.close();
         load_level(levelPath);
         index_existing_entities();
-        for (const auto& kv : connexion.getClients()) {
-            broadcast_full_registry_to(kv.second);
+        prefetch_level(currentLevel + 1);
+        for (uint32_t clientId : collectRoomClients()) {
+            broadcast_full_registry_to(clientId);
         }
         LOG_INFO("[Server] Level " << currentLevel << " loaded successfully!");
     } catch (const std::exception &e) {
@@ -401,16 +479,15 @@ void ServerGame::clear_level_entities() {
     for (auto entity : entitiesToKill) {
         registry_server.kill_entity(entity);
     }
-    for (const auto &kv : projectiles) {
-        uint32_t projId = kv.first;
-        broadcast_projectile_despawn(projId);
+    for (std::size_t slot = 0; slot < projectiles.size(); ++slot) {
+        broadcast_projectile_despawn(projectiles.handle_at(slot));
     }
-    for (const auto &kv : enemyProjectiles) {
-        uint32_t projId = kv.first;
-        broadcast_enemy_projectile_despawn(projId);
+    for (std::size_t slot = 0; slot < enemyProjectiles.size(); ++slot) {
+        broadcast_enemy_projectile_despawn(enemyProjectiles.handle_at(slot));
     }
 
     _enemies.clear();
+    _enemyMotion.clear();
     _obstacles.clear();
     projectiles.clear();
     enemyProjectiles.clear();
@@ -428,21 +505,27 @@ void ServerGame::handle_client_message(const std::vector<uint8_t>& data, const a
                 uint32_t id = ntohl(msg->clientId);
                 if (deadPlayers.find(id) != deadPlayers.end())
                     break;
-                InputCode code = static_cast<InputCode>(msg->inputCode);
-                bool pressed = msg->isPressed != 0;
-                switch (code) {
-                    case InputCode::Up:
-                    case InputCode::Down:
-                    case InputCode::Left:
-                    case InputCode::Right:
-                        playerInputBuffers[id].push_back({code, pressed});
-                        break;
-                    default:
-                        break;
+                auto &commands = playerCommands[id];
+                uint32_t newest = ntohl(msg->sequence);
+                std::size_t count = std::min<std::size_t>(msg->count, INPUT_REDUNDANCY);
+                for (std::size_t i = count; i-- > 0;) {
+                    uint32_t sequence = newest - static_cast<uint32_t>(i);
+                    if (static_cast<int32_t>(sequence - commands.lastReceived) <= 0)
+                        continue;
+                    commands.lastReceived = sequence;
+                    if (commands.queued.size() < MAX_QUEUED_COMMANDS)
+                        commands.queued.push_back({sequence, msg->buttons[i]});
                 }
             }
             break;
         }
+        case MessageType::SnapshotAck: {
+            if (data.size() >= sizeof(SnapshotAckMessage)) {
+                const SnapshotAckMessage* msg = reinterpret_cast<const SnapshotAckMessage*>(data.data());
+                handle_snapshot_ack(ntohl(msg->clientId), ntohl(msg->tick));
+            }
+            break;
+        }
         case MessageType::SceneState: {
             if (data.size() >= sizeof(SceneStateMessage)) {
                 const SceneStateMessage* msg = reinterpret_cast<const SceneStateMessage*>(data.data());
@@ -592,7 +675,6 @@ void ServerGame::handle_client_message(const std::vector<uint8_t>& data, const a
                     }
                     _playerLastShot[clientId] = now;
 
-                    uint32_t projId = nextProjectileId++;
                     float projX = playerX + 20.f;
                     float projY = playerY;
                     float projZ = 0.f;
@@ -600,18 +682,16 @@ void ServerGame::handle_client_message(const std::vector<uint8_t>& data, const a
                     float projVelY = 0.f;
                     float projVelZ = 0.f;
 
-                    projectiles[projId] = ProjectileState{
+                    uint32_t projId = projectiles.spawn(physics::projectile{
                         .x = projX,
                         .y = projY,
-                        .z = projZ,
                         .vx = projVelX,
                         .vy = projVelY,
-                        .vz = projVelZ,
-                        .ownerId = clientId,
+                        .owner = clientId,
                         .damage = definition.damage,
                         .width = definition.projectileWidth,
                         .height = definition.projectileHeight
-                    };
+                    });
 
                     broadcast_projectile_spawn(projId, clientId, projX, projY, projZ, projVelX, projVelY, projVelZ);
 
@@ -711,107 +791,68 @@ void ServerGame::handle_client_message(const std::vector<uint8_t>& data, const a
 }
 
 void ServerGame::process_pending_messages() {
-    std::queue<PendingPacket> localQueue;
-
-    {
-        std::lock_guard<std::mutex> lock(packetMutex);
-        while (!pendingPackets.empty()) {
-            localQueue.push(std::move(pendingPackets.front()));
-            pendingPackets.pop();
-        }
-    }
-
-    int processed = 0;
-    constexpr int maxMessagesPerTick = 32;
-    while (!localQueue.empty() && processed < maxMessagesPerTick) {
-        auto packet = std::move(localQueue.front());
-        localQueue.pop();
-        handle_client_message(packet.data, packet.endpoint);
-        processed++;
+    _profiler->pendingPackets.sample(packetRing.size());
+    for (std::size_t processed = 0; processed < MAX_MESSAGES_PER_TICK; ++processed) {
+        if (!packetRing.try_pop(incomingPacket))
+            break;
+        handle_client_message(incomingPacket.data, incomingPacket.endpoint);
     }
 }
 
 void ServerGame::process_player_inputs(float dt) {
-    constexpr float speedPerSecond = 200.f;
-    constexpr float playerWidth = 30.f;
-    constexpr float playerHeight = 30.f;
-
+    const std::size_t maxCommands = movement::commands_per_tick(dt);
     for (auto &kv : playerPositions) {
         uint32_t clientId = kv.first;
         if (deadPlayers.find(clientId) != deadPlayers.end())
             continue;
 
-        auto &buffer = playerInputBuffers[clientId];
-        auto &state = playerInputStates[clientId];
-
-        for (const auto &event : buffer) {
-            switch (event.code) {
-                case InputCode::Up:
-                    state.up = event.pressed;
-                    break;
-                case InputCode::Down:
-                    state.down = event.pressed;
-                    break;
-                case InputCode::Left:
-                    state.left = event.pressed;
-                    break;
-                case InputCode::Right:
-                    state.right = event.pressed;
-                    break;
-                default:
-                    break;
-            }
-        }
-        buffer.clear();
-
-        float inputX = 0.f;
-        float inputY = 0.f;
-
-        if (state.left != state.right)
-            inputX = state.left ? -1.f : 1.f;
-        if (state.up != state.down)
-            inputY = state.up ? -1.f : 1.f;
-
-        if (inputX == 0.f && inputY == 0.f)
-            continue;
-
+        auto &commands = playerCommands[clientId];
         auto &pos = kv.second;
-        float distance = speedPerSecond * dt;
-        float newX = pos.first + inputX * distance;
-        float newY = pos.second + inputY * distance;
-
-        if (!is_position_blocked(newX, pos.second, playerWidth, playerHeight, _obstacles))
-            pos.first = newX;
-        if (!is_position_blocked(pos.first, newY, playerWidth, playerHeight, _obstacles))
-            pos.second = newY;
+        _profiler->queuedCommands.sample(commands.queued.size());
+        for (std::size_t i = 0; i < maxCommands && !commands.queued.empty(); ++i) {
+            const QueuedCommand &command = commands.queued.front();
+            movement::step(pos.first, pos.second, command.buttons, [this](float x, float y) {
+                return is_position_blocked(x, y, movement::PLAYER_WIDTH, movement::PLAYER_HEIGHT, _obstacles);
+            });
+            commands.lastApplied = command.sequence;
+            commands.applied = true;
+            commands.queued.pop_front();
+        }
     }
 }
 
-void ServerGame::broadcast_states_to_clients() {
-    auto recipients = collectRoomClients(false);
-    if (recipients.empty())
-        return;
+void ServerGame::send_input_acks() {
+    for (const auto &kv : playerPositions) {
+        uint32_t clientId = kv.first;
+        if (deadPlayers.find(clientId) != deadPlayers.end())
+            continue;
 
-    for (uint32_t id : recipients) {
-        auto it = playerPositions.find(id);
-        if (it == playerPositions.end())
+        auto &commands = playerCommands[clientId];
+        float x = kv.second.first;
+        float y = kv.second.second;
+        ++commands.ticksSinceAck;
+        bool moved = x != commands.ackedX || y != commands.ackedY;
+        if (!commands.applied && !moved && commands.ticksSinceAck < INPUT_ACK_INTERVAL_TICKS)
             continue;
 
-        StateUpdateMessage m;
-        m.type = MessageType::StateUpdate;
-        m.clientId = htonl(id);
-        
-        uint32_t xbits, ybits, zbits;
+        PlayerInputAckMessage msg{};
+        msg.type = MessageType::PlayerInputAck;
+        msg.clientId = htonl(clientId);
+        msg.sequence = htonl(commands.lastApplied);
         float z = 0.f;
-        std::memcpy(&xbits, &it->second.first, sizeof(float));
-        std::memcpy(&ybits, &it->second.second, sizeof(float));
-        std::memcpy(&zbits, &z, sizeof(float));
-        
-        m.pos.xBits = htonl(xbits);
-        m.pos.yBits = htonl(ybits);
-        m.pos.zBits = htonl(zbits);
-        
-        connexion.broadcastToClients(recipients, &m, sizeof(m));
+        uint32_t xb, yb, zb;
+        std::memcpy(&xb, &x, sizeof(float));
+        std::memcpy(&yb, &y, sizeof(float));
+        std::memcpy(&zb, &z, sizeof(float));
+        msg.pos.xBits = htonl(xb);
+        msg.pos.yBits = htonl(yb);
+        msg.pos.zBits = htonl(zb);
+        connexion.sendToClient(clientId, &msg, sizeof(msg));
+
+        commands.applied = false;
+        commands.ackedX = x;
+        commands.ackedY = y;
+        commands.ticksSinceAck = 0;
     }
 }
 
@@ -823,7 +864,7 @@ void ServerGame::broadcast_obstacle_despawn(uint32_t obstacleId) {
     ObstacleDespawnMessage m;
     m.type = MessageType::ObstacleDespawn;
     m.obstacleId = htonl(obstacleId);
-    connexion.broadcastToClients(recipients, &m, sizeof(m));
+    connexion.broadcastReliable(recipients, reliable::Channel::Events, &m, sizeof(m));
 }
 
 void ServerGame::broadcast_player_health() {
@@ -963,14 +1004,6 @@ void ServerGame::send_player_weapons_to(uint32_t clientId) {
     }
 }
 
-void ServerGame::sleep_to_maintain_tick(const std::chrono::high_resolution_clock::time_point& start, int tick_ms) {
-    auto tick_end = std::chrono::high_resolution_clock::now();
-    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(tick_end - start).count();
-    if (elapsed_ms < tick_ms) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(tick_ms - elapsed_ms));
-    }
-}
-
 std::vector<uint32_t> ServerGame::collectRoomClients(bool includeDead) const {
     std::vector<uint32_t> ids;
     ids.reserve(playerPositions.size());
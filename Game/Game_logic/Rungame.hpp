@@ -8,13 +8,20 @@
 #pragma once
 
 #include "../../Server/Include/IServerGame.hpp"
+#include "../../Engine/Physics/Include/ProjectilePool.hpp"
+#include "../../Engine/Physics/Include/SpatialGrid.hpp"
+#include "../../Shared/Snapshot.hpp"
 #include <asio/ip/udp.hpp>
+#include <nlohmann/json.hpp>
+#include <atomic>
+#include <future>
+#include <random>
 #include <unordered_map>
 #include <unordered_set>
 #include <string>
 #include <chrono>
+#include <deque>
 #include <mutex>
-#include <queue>
 #include <vector>
 
 /**
@@ -22,7 +29,7 @@
  * @brief Implementation of IServerGame for R-Type multiplayer gameplay.
  *
  * This class handles:
- * - The main server game loop (~60 FPS).
+ * - The server game tick (30, 60 or 120 Hz), run by the shared room pool.
  * - Player management, movement, shooting, and death.
  * - Enemy spawning, movement patterns, and AI projectiles.
  * - Collision detection between all entities.
@@ -37,17 +44,28 @@ class ServerGame : public IServerGame {
         explicit ServerGame(Connexion &conn);
 
         /**
-         * @brief Main server game loop.
+         * @brief Loads players and the first level, then announces them.
          * @param roomId The id of the room to listen on
          */
-        void run(int roomId) override;
+        void start(int roomId) override;
+
+        /**
+         * @brief Runs one server tick (at the room pool's tick rate, 60 per second by default).
+         * @param dt Duration of the tick, in seconds.
+         * @return false once stop() was called.
+         */
+        bool tick(float dt) override;
+
+        /**
+         * @brief Ends the game at the next tick.
+         */
+        void stop() override;
 
         /**
          * @brief Enqueues a received network packet for processing.
-         * @param data The raw packet data.
-         * @param from The sender's network endpoint.
+         * @param packet The packet, swapped into packetRing; receives a recycled buffer.
          */
-        void enqueuePacket(const std::vector<uint8_t> &data, const asio::ip::udp::endpoint &from) override;
+        void enqueuePacket(Connexion::ReceivedPacket &packet) override;
         
         /**
          * @brief Sets the initial clients connected to the server.
@@ -55,6 +73,12 @@ class ServerGame : public IServerGame {
          */
         void setInitialClients(const std::map<uint32_t, bool> &clients) override;
 
+        /**
+         * @brief Gets the profiler timing each phase of tick().
+         * @return The profiler, shared with the room pool and the stats dump.
+         */
+        std::shared_ptr<metrics::TickProfiler> getProfiler() const override { return _profiler; }
+
         /**
          * @brief Loads player data from a JSON configuration file.
          */
@@ -65,6 +89,12 @@ class ServerGame : public IServerGame {
          */
         void load_level(const std::string &path);
 
+        /**
+         * @brief Starts parsing the JSON file of a level on another thread,
+         *        so that load_level() does not read it during the tick.
+         */
+        void prefetch_level(int level);
+
         /**
          * @brief Sends the complete game registry state to a specific client.
          */
@@ -82,8 +112,40 @@ class ServerGame : public IServerGame {
          */
         void setInitialPlayerWeapons(const std::unordered_map<uint32_t, std::string> &weapons);
 
+        /**
+         * @brief Bytes of snapshot datagrams sent during the last tick, all clients included.
+         */
+        std::size_t snapshot_bytes_last_tick() const { return _snapshotBytesLastTick; }
+
     private:
 
+        /** @brief Set by stop(); checked at the start of each tick. */
+        std::atomic<bool> _stopRequested{false};
+
+        /** @brief Phases of tick(), in order; indexes of _profiler's histograms. */
+        enum Phase : std::size_t {
+            PHASE_MESSAGES,
+            PHASE_INPUTS,
+            PHASE_UPDATE_PROJECTILES,
+            PHASE_UPDATE_ELEMENTS,
+            PHASE_UPDATE_ENEMIES,
+            PHASE_UPDATE_OBSTACLES,
+            PHASE_UPDATE_ENEMY_PROJECTILES,
+            PHASE_BROADPHASE,
+            PHASE_CHECK_ENEMY_PROJECTILES_PLAYERS,
+            PHASE_CHECK_PROJECTILES_OBSTACLES,
+            PHASE_CHECK_PROJECTILES_ENEMIES,
+            PHASE_CHECK_PLAYERS_ENEMIES,
+            PHASE_CHECK_PLAYERS_ELEMENTS,
+            PHASE_BROADCAST_SNAPSHOT,
+            PHASE_BROADCAST_HEALTH,
+            PHASE_BROADCAST_SCORES,
+            PHASE_LEVEL_TRANSITION,
+        };
+
+        /** @brief Per-phase timings, traffic and queue depths of this game. */
+        std::shared_ptr<metrics::TickProfiler> _profiler;
+
         /** @brief Maximum number of levels in the game. */
         static constexpr int MAX_LEVELS = 3;
 
@@ -93,11 +155,8 @@ class ServerGame : public IServerGame {
         /** @brief Indicates if the game has been completed. */
         bool gameCompleted = false;
 
-        /** @brief Maps enemy projectile IDs to their (x,y,z,velX,velY,velZ,ownerId). */
-        std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, uint32_t>> enemyProjectiles;
-
-        /** @brief Counter for assigning unique enemy projectile IDs. */
-        uint32_t nextEnemyProjectileId = 100000;
+        /** @brief Live enemy projectiles; the owner is the firing enemy and pool handles are the network IDs. */
+        physics::projectile_pool enemyProjectiles;
 
         /** @brief Reference to the network connection handler. */
         Connexion &connexion;
@@ -114,55 +173,44 @@ class ServerGame : public IServerGame {
         /** @brief Maps obstacle IDs to their (x, y, z, width, height, depth). */
         std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float>> obstacles;
 
-        /** @brief Maps projectile IDs to their (x, y, z, velX, velY, velZ, ownerId). */
-        struct ProjectileState {
-            float x;
-            float y;
-            float z;
-            float vx;
-            float vy;
-            float vz;
-            uint32_t ownerId;
-            float damage;
-            float width;
-            float height;
-        };
+        /** @brief Live player projectiles; the owner is the firing client and pool handles are the network IDs. */
+        physics::projectile_pool projectiles;
 
-        /** @brief Maps projectile IDs to their runtime state. */
-        std::unordered_map<uint32_t, ProjectileState> projectiles;
+        /** @brief Projectiles whose center leaves this area are despawned. */
+        static constexpr physics::aabb PROJECTILE_BOUNDS{-50.f, -50.f, 1970.f, 1130.f};
 
         /** @brief Cooldown timestamps to avoid damage spam. */
         std::unordered_map<uint32_t, std::chrono::high_resolution_clock::time_point> playerDamageCooldown;
 
-        /** @brief Structure to represent a player's input event. */
-        struct InputEvent {
-            InputCode code;
-            bool pressed;
+        /** @brief A movement command waiting to be applied. */
+        struct QueuedCommand {
+            uint32_t sequence;
+            uint8_t buttons; ///< See movement::Button.
         };
 
-        /** @brief Structure to represent the current input state of a player. */
-        struct PlayerInputState {
-            bool up{false};
-            bool down{false};
-            bool left{false};
-            bool right{false};
+        /** @brief Movement commands of a player, see Shared/PlayerMovement.hpp. */
+        struct PlayerCommands {
+            std::deque<QueuedCommand> queued;   ///< Received and not applied yet, oldest first.
+            uint32_t lastReceived{0};           ///< Sequence of the newest command received.
+            uint32_t lastApplied{0};            ///< Sequence of the last command applied, sent in acks.
+            bool applied{false};                ///< Commands were applied since the last ack.
+            float ackedX{0.f};                  ///< Position sent in the last ack.
+            float ackedY{0.f};                  ///< Position sent in the last ack.
+            uint32_t ticksSinceAck{0};          ///< Ticks since the last ack was sent.
         };
 
-        /** @brief Buffers of input events per player. */
-        std::unordered_map<uint32_t, std::vector<InputEvent>> playerInputBuffers;
+        /** @brief Most commands queued per player; later ones are dropped. */
+        static constexpr std::size_t MAX_QUEUED_COMMANDS = 32;
 
-        /** @brief Current input states per player. */
-        std::unordered_map<uint32_t, PlayerInputState> playerInputStates;
+        /** @brief Ticks after which an unchanged position is acked again, in case the last ack was lost. */
+        static constexpr uint32_t INPUT_ACK_INTERVAL_TICKS = 30;
 
-        /** @brief Counter for assigning unique projectile IDs. */
-        uint32_t nextProjectileId = 1;
+        /** @brief Movement commands per player. */
+        std::unordered_map<uint32_t, PlayerCommands> playerCommands;
 
         /** @brief Mutex for thread-safe access. */
         std::mutex mtx;
 
-        /** @brief Mutex for thread-safe packet queue access. */
-        std::mutex packetMutex;
-
         /** @brief Mutex for thread-safe access to initial clients. */
         mutable std::mutex initialClientsMutex;
 
@@ -205,6 +253,25 @@ class ServerGame : public IServerGame {
         /** @brief Enemy movement pattern registry. */
         std::unordered_map<uint32_t, std::string> enemyPatterns;
 
+        /** @brief Progress of an enemy along its movement pattern, and its turret timer. */
+        struct EnemyMotion {
+            bool started{false};    ///< Whether the pattern fields below were initialized.
+            float time{0.f};        ///< Seconds spent in the pattern.
+            float angle{0.f};       ///< Current angle of circle and spiral patterns.
+            float originX{0.f};     ///< Scrolling center of the pattern.
+            float originY{0.f};     ///< Vertical center of the pattern.
+            float radius{0.f};      ///< Current spiral radius.
+            bool bossActive{false}; ///< Whether the boss reached its firing position.
+            bool turretReady{false}; ///< Whether lastShot was initialized.
+            std::chrono::high_resolution_clock::time_point lastShot{}; ///< Time of the last turret shot.
+        };
+
+        /** @brief Pattern state per enemy ID, erased when the enemy is killed. */
+        std::unordered_map<uint32_t, EnemyMotion> _enemyMotion;
+
+        /** @brief Randomizes the first turret shot of each enemy. */
+        std::minstd_rand _rng{std::random_device{}()};
+
         /** @brief Cached references for obstacles. */
         std::vector<ecs::entity_t> _obstacles;
 
@@ -214,6 +281,39 @@ class ServerGame : public IServerGame {
         /** @brief Cached references for elements. */
         std::vector<ecs::entity_t> _randomElements;
 
+        /** @brief Broadphase layers, used as query masks. */
+        enum BroadphaseLayer : uint32_t {
+            LAYER_ENEMY = 1u << 0,
+            LAYER_ELEMENT = 1u << 1,
+            LAYER_OBSTACLE = 1u << 2
+        };
+        physics::uniform_grid _broadphase{-128.f, -128.f, 2176.f, 1336.f, 64.f}; ///< Play area plus despawn margins.
+        std::vector<ecs::entity_t> _broadphaseEntities; ///< Entity of each enemy/element/obstacle id in _broadphase.
+
+        /** @brief Encodes each tick's snapshot into datagrams; reused across ticks. */
+        snapshot::SnapshotWriter _snapshotWriter;
+
+        /** @brief World state of the last ticks, used as delta baselines. */
+        snapshot::SnapshotHistory _snapshotHistory;
+
+        /** @brief Scratch world state of the tick being sent. */
+        snapshot::WorldState _snapshotWorld;
+
+        /** @brief Newest snapshot tick acked by each client. */
+        std::unordered_map<uint32_t, uint32_t> _snapshotAcks;
+
+        /** @brief Number of the last snapshot sent, never 0. */
+        uint32_t _snapshotTick = 0;
+
+        /** @brief Ticks between two snapshot bandwidth log lines (about 5 s). */
+        static constexpr uint32_t SNAPSHOT_STATS_TICKS = 300;
+
+        /** @brief Snapshot bytes sent during the last tick. */
+        std::size_t _snapshotBytesLastTick = 0;
+
+        /** @brief Snapshot bytes sent since the last bandwidth log line. */
+        std::size_t _snapshotBytesWindow = 0;
+
         /** @brief Current level number. */
         int currentLevel = 1;
 
@@ -226,17 +326,26 @@ class ServerGame : public IServerGame {
         /** @brief Delay before transitioning to the next level. */
         const float LEVEL_TRANSITION_DELAY = 6.0f;
 
+        /** @brief Next level's JSON, parsed in the background by prefetch_level(). */
+        std::future<nlohmann::json> _nextLevelJson;
+
+        /** @brief File being parsed into _nextLevelJson. */
+        std::string _nextLevelPath;
+
         /** @brief The id of the room to listen on */
         int _roomId;
 
-        /** @brief Structure representing a pending network packet. */
-        struct PendingPacket {
-            std::vector<uint8_t> data;
-            asio::ip::udp::endpoint endpoint;
-        };
+        /** @brief Packets routed to this room that can wait for a tick; later ones are dropped. */
+        static constexpr std::size_t PACKET_RING_SIZE = 256;
+
+        /** @brief Most queued packets handled by one tick; the rest wait for the next one. */
+        static constexpr std::size_t MAX_MESSAGES_PER_TICK = 32;
+
+        /** @brief Packets routed by the server loop, waiting for a tick. */
+        MpscRing<Connexion::ReceivedPacket> packetRing{PACKET_RING_SIZE};
 
-        /** @brief Queue of pending network packets to process. */
-        std::queue<PendingPacket> pendingPackets;
+        /** @brief Tick thread: packet being handled, its buffer goes back to packetRing. */
+        Connexion::ReceivedPacket incomingPacket;
 
         /**
         * @brief Initializes player starting positions. 
@@ -261,9 +370,21 @@ class ServerGame : public IServerGame {
         void handle_client_message(const std::vector<uint8_t>& data, const asio::ip::udp::endpoint& from);
 
         /** 
-         * @brief Broadcasts the current game states to all connected clients. 
+         * @brief Sends this tick's positions of players, enemies, obstacles, elements and projectiles.
+         *
+         * Each client gets the snapshot delta-encoded against the newest tick it
+         * acked, or in full if that tick is no longer in _snapshotHistory.
+         * Clients sharing a baseline share the same datagrams.
+         * @param includeWorld Whether to include non-player entities (false once the game is completed).
          */
-        void broadcast_states_to_clients();
+        void broadcast_snapshot(bool includeWorld);
+
+        /**
+         * @brief Records that a client fully received a snapshot, making it its next baseline.
+         * @param clientId Client that sent the ack.
+         * @param tick Acked snapshot tick; older or future ticks are ignored.
+         */
+        void handle_snapshot_ack(uint32_t clientId, uint32_t tick);
 
         /** 
          * @brief Processes buffered player inputs and updates their states. 
@@ -297,48 +418,18 @@ class ServerGame : public IServerGame {
          */
         void broadcast_obstacle_spawn(uint32_t obstacleId, float x, float y, float z, float w, float h, float d, float vx, float vy, float vz);
         
-        /** 
-         * @brief Broadcasts obstacle positions to clients.
-         */
-        void broadcast_obstacle_positions();
-
-        /** 
-         * @brief Broadcasts obstacle update event to clients.
-         * @param obstacleId The unique ID of the obstacle.
-         * @param x X position.
-         * @param y Y position.
-         * @param z Z position.
-         * @param vx Velocity in X.
-         * @param vy Velocity in Y.
-         * @param vz Velocity in Z.
-         */
-        void broadcast_obstacle_update(uint32_t obstacleId, float x, float y, float z,
-                                          float vx, float vy, float vz);
-
         /** 
          * @brief Broadcasts obstacle despawn event to clients.
          * @param obstacleId The unique ID of the obstacle.
          */
         void broadcast_obstacle_despawn(uint32_t obstacleId);
 
-        /** 
-         * @brief Sleeps the thread to maintain a consistent tick rate.
-         * @param start The start time of the tick.
-         * @param tick_ms Desired tick duration in milliseconds.
-         */
-        void sleep_to_maintain_tick(const std::chrono::high_resolution_clock::time_point& start, int tick_ms);
-
         /** 
          * @brief Updates all projectiles on the server side.
          * @param dt Delta time since last update.
          */
         void update_projectiles_server_only(float dt);
 
-        /** 
-         * @brief Broadcasts projectile positions to clients.
-         */
-        void broadcast_projectile_positions();
-
         /** 
          * @brief Checks for collisions between projectiles and other entities.
          */
@@ -438,11 +529,6 @@ class ServerGame : public IServerGame {
          */
         void update_element(float dt);
 
-        /** 
-         * @brief Broadcasts all element positions to clients.
-         */
-        void broadcast_element_positions();
-
         /** 
          * @brief Broadcasts element spawn event to clients.
          * @param elementId The unique ID of the element.
@@ -463,15 +549,6 @@ class ServerGame : public IServerGame {
          */
         void broadcast_element_despawn(uint32_t elementId);
         
-        /** 
-         * @brief Broadcasts element update event to clients.
-         * @param elementId The unique ID of the element.
-         * @param x X position.
-         * @param y Y position.
-         * @param z Z position.
-         */
-        void broadcast_element_update(uint32_t elementId, float x, float y, float z);
-
         /** 
          * @brief Broadcasts enemy spawn event to clients.
          * @param enemyId The unique ID of the enemy.
@@ -486,20 +563,6 @@ class ServerGame : public IServerGame {
          */
         void broadcast_enemy_spawn(uint32_t enemyId, float x, float y, float z, float vx, float vy, float vz, float width, float height);
         
-        /** 
-         * @brief Broadcasts enemy positions to clients.
-         */
-        void broadcast_enemy_positions();
-
-        /** 
-         * @brief Broadcasts enemy update event to clients.
-         * @param enemyId The unique ID of the enemy.
-         * @param x X position.
-         * @param y Y position.
-         * @param z Z position.
-         */
-        void broadcast_enemy_update(uint32_t enemyId, float x, float y, float z);
-
         /** 
          * @brief Broadcasts enemy despawn event to clients.
          * @param enemyId The unique ID of the enemy.
@@ -551,11 +614,6 @@ class ServerGame : public IServerGame {
          */
         void broadcast_enemy_projectile_spawn(uint32_t projId, uint32_t ownerId, float x, float y, float z, float vx, float vy, float vz);
         
-        /** 
-         * @brief Broadcasts enemy projectile positions to clients.
-         */
-        void broadcast_enemy_projectile_positions();
-
         /** 
          * @brief Broadcasts enemy projectile despawn event to clients.
          * @param projId The unique ID of the projectile.
@@ -605,10 +663,16 @@ class ServerGame : public IServerGame {
         void clear_level_entities();
 
         /** 
-         * @brief Processes buffered player inputs and updates their states.
-         * @param dt Delta time since last update.
+         * @brief Applies the queued movement commands of every player, in order.
+         * @param dt Duration of the tick, which sets how many commands one player may use
+         *        (movement::commands_per_tick()).
          */
         void process_player_inputs(float dt);
+
+        /**
+         * @brief Sends each player the last command applied and its position.
+         */
+        void send_input_acks();
         
         /** 
          * @brief Checks for AABB overlap between two rectangles.
@@ -625,6 +689,15 @@ class ServerGame : public IServerGame {
         bool check_aabb_overlap(float left1, float right1, float top1, float bottom1,
                                 float left2, float right2, float top2, float bottom2);
 
+        /** 
+         * @brief Rebuilds the collision broadphase from current enemies, elements and obstacles.
+         *
+         * Called once per tick after movement; the check_*_collisions functions then
+         * query it instead of testing every pair. Players are few enough to be
+         * tested directly and are not inserted.
+         */
+        void rebuild_broadphase();
+
         /** 
          * @brief Checks if a position is blocked by any obstacles.
          * @param testX X position to test.
@@ -56,20 +56,7 @@ void ServerGame::broadcast_element_spawn(uint32_t enemyId, float x, float y, flo
     msg.width = htonl(w);
     msg.height = htonl(h);
 
-    connexion.broadcastToClients(recipients, &msg, sizeof(msg));
-}
-
-void ServerGame::broadcast_element_positions() {
-auto &positions = registry_server.get_components<component::position>();
-    
-    for (auto elementEntity : _randomElements) {
-        uint32_t elementId = static_cast<uint32_t>(elementEntity);
-        
-        if (elementId < positions.size() && positions[elementId]) {
-            const auto& pos = *positions[elementId];
-            broadcast_element_update(elementId, pos.x, pos.y, pos.z);
-        }
-    }
+    connexion.broadcastReliable(recipients, reliable::Channel::Events, &msg, sizeof(msg));
 }
 
 void ServerGame::update_element(float dt) {
@@ -88,101 +75,39 @@ void ServerGame::update_element(float dt) {
     }
 }
 
-void ServerGame::broadcast_element_update(uint32_t elementId, float x, float y, float z) {
-    auto recipients = collectRoomClients();
-    if (recipients.empty())
-        return;
-
-    ElementUpdateMessage msg{};
-    msg.type = MessageType::ElementUpdate;
-    msg.elementId = htonl(elementId);
-
-    uint32_t xb, yb, zb;
-    std::memcpy(&xb, &x, sizeof(float));
-    std::memcpy(&yb, &y, sizeof(float));
-    std::memcpy(&zb, &z, sizeof(float));
-
-    msg.pos.xBits = htonl(xb);
-    msg.pos.yBits = htonl(yb);
-    msg.pos.zBits = htonl(zb);
-
-    uint32_t vxb = 0;
-    uint32_t vyb = 0;
-    auto& velocities = registry_server.get_components<component::velocity>();
-    if (elementId < velocities.size() && velocities[elementId]) {
-        float vx = velocities[elementId]->vx;
-        float vy = velocities[elementId]->vy;
-        std::memcpy(&vxb, &vx, sizeof(float));
-        std::memcpy(&vyb, &vy, sizeof(float));
-    }
-
-    msg.velXBits = htonl(vxb);
-    msg.velYBits = htonl(vyb);
-
-    connexion.broadcastToClients(recipients, &msg, sizeof(msg));
-}
-
 void ServerGame::check_player_element_collisions() {
-    auto &positions = registry_server.get_components<component::position>();
-    auto &collisionBoxes = registry_server.get_components<component::collision_box>();
-    auto &types = registry_server.get_components<component::type>();
     auto &healths = registry_server.get_components<component::health>();
     auto &clientIds = registry_server.get_components<component::client_id>();
 
     std::vector<uint32_t> elementsToRemove;
 
     for (const auto& [playerId, playerPosPair] : playerPositions) {
-        float playerX = playerPosPair.first;
-        float playerY = playerPosPair.second;
         const float PLAYER_WIDTH = 30.f;
         const float PLAYER_HEIGHT = 30.f;
-
-        for (auto element : _randomElements) {
-            uint32_t elemId = static_cast<uint32_t>(element);
-            if (elemId >= positions.size() || !positions[elemId] ||
-                elemId >= collisionBoxes.size() || !collisionBoxes[elemId] ||
-                elemId >= types.size() || !types[elemId])
-                continue;
-
-            if (types[elemId]->value != component::entity_type::RANDOM_ELEMENT)
-                continue;
-
-            float elemX = positions[elemId]->x;
-            float elemY = positions[elemId]->y;
-            float elemW = collisionBoxes[elemId]->width;
-            float elemH = collisionBoxes[elemId]->height;
-
-            float playerLeft = playerX - PLAYER_WIDTH / 2;
-            float playerRight = playerX + PLAYER_WIDTH / 2;
-            float playerTop = playerY - PLAYER_HEIGHT / 2;
-            float playerBottom = playerY + PLAYER_HEIGHT / 2;
-            
-            float elemLeft = elemX - elemW / 2;
-            float elemRight = elemX + elemW / 2;
-            float elemTop = elemY - elemH / 2;
-            float elemBottom = elemY + elemH / 2;
-
-            if (check_aabb_overlap(playerLeft, playerRight, playerTop, playerBottom,
-                                   elemLeft, elemRight, elemTop, elemBottom)) {
-                LOG_INFO("[Server] Player " << playerId << " collected element " << elemId);                
-                for (std::size_t i = 0; i < healths.size() && i < clientIds.size(); ++i) {
-                    if (clientIds[i] && clientIds[i]->id == playerId && healths[i]) {
-                        healths[i]->current = std::min(healths[i]->current + 25, healths[i]->max);
-                        LOG_INFO("[Server] Player " << playerId << " healed to " 
-                                << healths[i]->current << "/" << healths[i]->max);
-                        break;
-                    }
+        auto playerBox = physics::aabb::from_center(playerPosPair.first, playerPosPair.second,
+                                                    PLAYER_WIDTH, PLAYER_HEIGHT);
+
+        _broadphase.query(playerBox, LAYER_ELEMENT, [&](uint32_t id, const physics::aabb &) {
+            uint32_t elemId = static_cast<uint32_t>(_broadphaseEntities[id]);
+            LOG_INFO("[Server] Player " << playerId << " collected element " << elemId);                
+            for (std::size_t i = 0; i < healths.size() && i < clientIds.size(); ++i) {
+                if (clientIds[i] && clientIds[i]->id == playerId && healths[i]) {
+                    healths[i]->current = std::min(healths[i]->current + 25, healths[i]->max);
+                    LOG_INFO("[Server] Player " << playerId << " healed to " 
+                            << healths[i]->current << "/" << healths[i]->max);
+                    break;
                 }
-                
-                elementsToRemove.push_back(elemId);
             }
-        }
+            
+            elementsToRemove.push_back(elemId);
+        });
     }    
     for (uint32_t elemId : elementsToRemove) {
-        registry_server.kill_entity(static_cast<ecs::entity_t>(elemId));
+        ecs::entity_t entity = registry_server.entity_from_index(elemId);
+        registry_server.kill_entity(entity);
         _randomElements.erase(
             std::remove(_randomElements.begin(), _randomElements.end(), 
-                       static_cast<ecs::entity_t>(elemId)),
+                       entity),
             _randomElements.end()
         );
         broadcast_element_despawn(elemId);
@@ -197,5 +122,5 @@ void ServerGame::broadcast_element_despawn(uint32_t elemId) {
     msg.type = MessageType::ElementDespawn;
     msg.elementId = htonl(elemId);
 
-    connexion.broadcastToClients(recipients, &msg, sizeof(msg));
+    connexion.broadcastReliable(recipients, reliable::Channel::Events, &msg, sizeof(msg));
 }
@@ -52,14 +52,11 @@ void ServerGame::update_enemies(float dt) {
         else if (pattern == "figure") update_enemy_figure8(id, dt);
         else if (pattern == "boss_phase1") update_enemy_boss(id, dt);
         else update_enemy_default(id, dt);
-
-        pos = get_component_ptr<component::position>(registry_server, entity);
-        if (pos) broadcast_enemy_update(id, pos->x, pos->y, pos->z);
     }
 }
 
 void ServerGame::update_enemy_default(uint32_t id, float dt) {
-    ecs::entity_t entity = static_cast<ecs::entity_t>(id);
+    ecs::entity_t entity = registry_server.entity_from_index(id);
     auto pos = get_component_ptr<component::position>(registry_server, entity);
     auto vel = get_component_ptr<component::velocity>(registry_server, entity);
     if (!pos) return;
@@ -76,7 +73,7 @@ void ServerGame::update_enemy_straight(uint32_t id, float dt) {
 }
 
 void ServerGame::update_enemy_zigzag(uint32_t id, float dt) {
-    ecs::entity_t entity = static_cast<ecs::entity_t>(id);
+    ecs::entity_t entity = registry_server.entity_from_index(id);
     auto pos = get_component_ptr<component::position>(registry_server, entity);
     auto vel = get_component_ptr<component::velocity>(registry_server, entity);
     if (!pos) return;
@@ -91,51 +88,46 @@ void ServerGame::update_enemy_zigzag(uint32_t id, float dt) {
 }
 
 void ServerGame::update_enemy_circle(uint32_t id, float dt) {
-    static std::unordered_map<uint32_t, float> angles;
-    static std::unordered_map<uint32_t, float> initialX;
-    static std::unordered_map<uint32_t, float> time;
-
-    ecs::entity_t entity = static_cast<ecs::entity_t>(id);
+    ecs::entity_t entity = registry_server.entity_from_index(id);
     auto pos = get_component_ptr<component::position>(registry_server, entity);
     auto vel = get_component_ptr<component::velocity>(registry_server, entity);
     if (!pos) return;
 
-    if (angles.find(id) == angles.end()) {
-        angles[id] = 0.f;
-        initialX[id] = pos->x;
-        time[id] = 0.f;
+    EnemyMotion &motion = _enemyMotion[id];
+    if (!motion.started) {
+        motion.started = true;
+        motion.angle = 0.f;
+        motion.originX = pos->x;
+        motion.time = 0.f;
     }
 
-    time[id] += dt;
+    motion.time += dt;
     float baseVelocityX = -50.f;
     if (vel) baseVelocityX = vel->vx;
     const float circleRadius = 25.f;
     const float angularSpeed = 4.0f;
     const float waveAmplitude = 20.f;
     const float waveFrequency = 0.5f;
-    angles[id] += angularSpeed * dt;
-    initialX[id] += baseVelocityX * dt;
-    float baseY = 540.f + std::sin(time[id] * waveFrequency) * waveAmplitude;
-    pos->x = initialX[id] + std::cos(angles[id]) * circleRadius;
-    pos->y = baseY + std::sin(angles[id]) * circleRadius;
+    motion.angle += angularSpeed * dt;
+    motion.originX += baseVelocityX * dt;
+    float baseY = 540.f + std::sin(motion.time * waveFrequency) * waveAmplitude;
+    pos->x = motion.originX + std::cos(motion.angle) * circleRadius;
+    pos->y = baseY + std::sin(motion.angle) * circleRadius;
 }
 
 void ServerGame::update_enemy_spiral(uint32_t id, float dt) {
-    static std::unordered_map<uint32_t, float> angles;
-    static std::unordered_map<uint32_t, float> initialX;
-    static std::unordered_map<uint32_t, float> initialY;
-    static std::unordered_map<uint32_t, float> currentRadius;
-
-    ecs::entity_t entity = static_cast<ecs::entity_t>(id);
+    ecs::entity_t entity = registry_server.entity_from_index(id);
     auto pos = get_component_ptr<component::position>(registry_server, entity);
     auto vel = get_component_ptr<component::velocity>(registry_server, entity);
     if (!pos) return;
 
-    if (angles.find(id) == angles.end()) {
-        angles[id] = 0.f;
-        initialX[id] = pos->x;
-        initialY[id] = pos->y;
-        currentRadius[id] = 10.f;
+    EnemyMotion &motion = _enemyMotion[id];
+    if (!motion.started) {
+        motion.started = true;
+        motion.angle = 0.f;
+        motion.originX = pos->x;
+        motion.originY = pos->y;
+        motion.radius = 10.f;
     }
 
     float baseVelocityX = -50.f;
@@ -143,50 +135,45 @@ void ServerGame::update_enemy_spiral(uint32_t id, float dt) {
     const float angularSpeed = 3.0f;
     const float radiusGrowth = 15.f;
     const float maxRadius = 80.f;
-    angles[id] += angularSpeed * dt;
-    initialX[id] += baseVelocityX * dt;
-    currentRadius[id] = std::min(currentRadius[id] + radiusGrowth * dt, maxRadius);
-    pos->x = initialX[id] + std::cos(angles[id]) * currentRadius[id];
-    pos->y = initialY[id] + std::sin(angles[id]) * currentRadius[id];
+    motion.angle += angularSpeed * dt;
+    motion.originX += baseVelocityX * dt;
+    motion.radius = std::min(motion.radius + radiusGrowth * dt, maxRadius);
+    pos->x = motion.originX + std::cos(motion.angle) * motion.radius;
+    pos->y = motion.originY + std::sin(motion.angle) * motion.radius;
     update_enemy_turret(id, dt, 1.0f);
 }
 
 void ServerGame::update_enemy_figure8(uint32_t id, float dt) {
-    static std::unordered_map<uint32_t, float> time;
-    static std::unordered_map<uint32_t, float> initialX;
-    static std::unordered_map<uint32_t, float> initialY;
-
-    ecs::entity_t entity = static_cast<ecs::entity_t>(id);
+    ecs::entity_t entity = registry_server.entity_from_index(id);
     auto pos = get_component_ptr<component::position>(registry_server, entity);
     auto vel = get_component_ptr<component::velocity>(registry_server, entity);
     if (!pos) return;
 
-    if (time.find(id) == time.end()) {
-        time[id] = 0.f;
-        initialX[id] = pos->x;
-        initialY[id] = pos->y;
+    EnemyMotion &motion = _enemyMotion[id];
+    if (!motion.started) {
+        motion.started = true;
+        motion.time = 0.f;
+        motion.originX = pos->x;
+        motion.originY = pos->y;
     }
 
-    time[id] += dt;
+    motion.time += dt;
     float baseVelocityX = -50.f;
     if (vel) baseVelocityX = vel->vx;
     const float scale = 40.f;
     const float speed = 2.0f;
-    initialX[id] += baseVelocityX * dt;
-    float t = time[id] * speed;
+    motion.originX += baseVelocityX * dt;
+    float t = motion.time * speed;
     float denominator = 1.f + std::sin(t) * std::sin(t);
-    pos->x = initialX[id] + (scale * std::cos(t)) / denominator;
-    pos->y = initialY[id] + (scale * std::sin(t) * std::cos(t)) / denominator;
+    pos->x = motion.originX + (scale * std::cos(t)) / denominator;
+    pos->y = motion.originY + (scale * std::sin(t) * std::cos(t)) / denominator;
     update_enemy_turret(id, dt, 2.0f);
 }
 
 void ServerGame::update_enemy_turret(uint32_t id, float dt, float rapidfire) {
     if (levelTransitionPending) return;
-    static std::unordered_map<uint32_t, std::chrono::high_resolution_clock::time_point> lastShootTime;
-    static std::unordered_map<uint32_t, float> shootCooldowns;
-    static std::unordered_map<uint32_t, bool> initialized;
-    
-    ecs::entity_t entity = static_cast<ecs::entity_t>(id);
+
+    ecs::entity_t entity = registry_server.entity_from_index(id);
     auto pos = get_component_ptr<component::position>(registry_server, entity);
     auto vel = get_component_ptr<component::velocity>(registry_server, entity);
     if (!pos) return;
@@ -200,20 +187,20 @@ void ServerGame::update_enemy_turret(uint32_t id, float dt, float rapidfire) {
     auto currentTime = std::chrono::high_resolution_clock::now();
     
     float cooldown = 10.0f / rapidfire;
-    if (!initialized[id]) {
-        float randomOffset = (static_cast<float>(rand() % 1000) / 1000.0f) * cooldown;
-        lastShootTime[id] = currentTime - std::chrono::milliseconds(
+    EnemyMotion &motion = _enemyMotion[id];
+    if (!motion.turretReady) {
+        float randomOffset = std::uniform_real_distribution<float>(0.f, 1.f)(_rng) * cooldown;
+        motion.lastShot = currentTime - std::chrono::milliseconds(
             static_cast<int>(randomOffset * 1000)
         );
-        initialized[id] = true;
+        motion.turretReady = true;
     }
-    shootCooldowns[id] = cooldown;
     
     auto elapsed = std::chrono::duration_cast<std::chrono::duration<float>>(
-        currentTime - lastShootTime[id]
+        currentTime - motion.lastShot
     ).count();
 
-    if (elapsed >= shootCooldowns[id]) {
+    if (elapsed >= cooldown) {
         float enemyWidth = 30.f;
         auto cbox = get_component_ptr<component::collision_box>(registry_server, entity);
         if (cbox) {
@@ -221,37 +208,36 @@ void ServerGame::update_enemy_turret(uint32_t id, float dt, float rapidfire) {
         }
         float shootX = pos->x - (enemyWidth / 2.0f);
         shoot_enemy_projectile(id, shootX, pos->y, -200.f, 0.f);
-        lastShootTime[id] = currentTime;
+        motion.lastShot = currentTime;
     }
 }
 
 void ServerGame::update_enemy_boss(uint32_t id, float dt) {
-    ecs::entity_t entity = static_cast<ecs::entity_t>(id);
+    ecs::entity_t entity = registry_server.entity_from_index(id);
     auto pos = get_component_ptr<component::position>(registry_server, entity);
     auto vel = get_component_ptr<component::velocity>(registry_server, entity);
     if (!pos) return;
 
-    static std::unordered_map<uint32_t, float> bossTime;
-    static std::unordered_map<uint32_t, float> initialY;
-    static std::unordered_map<uint32_t, bool> bossActive;
-    if (bossTime.find(id) == bossTime.end()) {
-        bossTime[id] = 0.0f;
-        initialY[id] = pos->y;
-        bossActive[id] = false;
+    EnemyMotion &motion = _enemyMotion[id];
+    if (!motion.started) {
+        motion.started = true;
+        motion.time = 0.0f;
+        motion.originY = pos->y;
+        motion.bossActive = false;
     }
-    bossTime[id] += dt;
+    motion.time += dt;
 
     const float right_side_x = 1700.0f;
     float approachVx = -30.0f;
     if (vel)
         approachVx = (vel->vx != 0.f) ? vel->vx : -30.0f;
-    if (!bossActive[id]) {
+    if (!motion.bossActive) {
         pos->x += approachVx * dt;
         if (pos->x <= right_side_x) {
             pos->x = right_side_x;
-            initialY[id] = pos->y;
-            bossActive[id] = true;
-            bossTime[id] = 0.0f;
+            motion.originY = pos->y;
+            motion.bossActive = true;
+            motion.time = 0.0f;
         } else {
             return;
         }
@@ -259,7 +245,7 @@ void ServerGame::update_enemy_boss(uint32_t id, float dt) {
     pos->x = right_side_x;
     const float verticalAmplitude = 300.0f;
     const float verticalFrequency = 0.25f;
-    pos->y = initialY[id] + std::sin(bossTime[id] * 2.0f * 3.14159265f * verticalFrequency) * verticalAmplitude;
+    pos->y = motion.originY + std::sin(motion.time * 2.0f * 3.14159265f * verticalFrequency) * verticalAmplitude;
     const float baseRapidfire = 12.0f;
     float turretRapidfire = baseRapidfire * (1 + (currentLevel - 1));
 
@@ -274,8 +260,6 @@ void ServerGame::check_player_enemy_collisions() {
     
     std::vector<uint32_t> playersHit;
     auto now = std::chrono::high_resolution_clock::now();
-    
-    auto &collision_boxes = registry_server.get_components<component::collision_box>();
 
     for (const auto& playerKv : playerPositions) {
         uint32_t playerId = playerKv.first;
@@ -283,52 +267,30 @@ void ServerGame::check_player_enemy_collisions() {
         if (deadPlayers.find(playerId) != deadPlayers.end())
             continue;
         
-        float playerX = playerKv.second.first;
-        float playerY = playerKv.second.second;
+        auto playerBox = physics::aabb::from_center(playerKv.second.first, playerKv.second.second,
+                                                    PLAYER_WIDTH, PLAYER_HEIGHT);
+
+        // Enemies killed earlier in the tick are still in the broadphase until the next rebuild.
+        bool touched = false;
+        _broadphase.query(playerBox, LAYER_ENEMY, [&](uint32_t id, const physics::aabb &) {
+            if (registry_server.is_alive(_broadphaseEntities[id]))
+                touched = true;
+        });
+        if (!touched)
+            continue;
+
+        auto it = playerDamageCooldown.find(playerId);
+        bool canTakeDamage = (it == playerDamageCooldown.end());
         
-        float playerLeft = playerX - PLAYER_WIDTH * 0.5f;
-        float playerRight = playerX + PLAYER_WIDTH * 0.5f;
-        float playerTop = playerY - PLAYER_HEIGHT * 0.5f;
-        float playerBottom = playerY + PLAYER_HEIGHT * 0.5f;
+        if (!canTakeDamage) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - it->second).count();
+            canTakeDamage = (elapsed >= COOLDOWN_MS);
+        }
         
-        for (const auto& enemy : _enemies) {
-            uint32_t eid = static_cast<uint32_t>(enemy);
-            auto epos = get_component_ptr<component::position>(registry_server, enemy);
-            if (!epos)
-                continue;
-            float enemyWidth = 30.f;
-            float enemyHeight = 30.f;
-            if (eid < collision_boxes.size() && collision_boxes[eid]) {
-                enemyWidth = collision_boxes[eid]->width;
-                enemyHeight = collision_boxes[eid]->height;
-            }
-
-            float enemyX = epos->x;
-            float enemyY = epos->y;
-            
-            float enemyLeft = enemyX - enemyWidth * 0.5f;
-            float enemyRight = enemyX + enemyWidth * 0.5f;
-            float enemyTop = enemyY - enemyHeight * 0.5f;
-            float enemyBottom = enemyY + enemyHeight * 0.5f;
-            
-            if (check_aabb_overlap(playerLeft, playerRight, playerTop, playerBottom,
-                                  enemyLeft, enemyRight, enemyTop, enemyBottom)) {
-                
-                auto it = playerDamageCooldown.find(playerId);
-                bool canTakeDamage = (it == playerDamageCooldown.end());
-                
-                if (!canTakeDamage) {
-                    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - it->second).count();
-                    canTakeDamage = (elapsed >= COOLDOWN_MS);
-                }
-                
-                if (canTakeDamage) {
-                    playersHit.push_back(playerId);
-                    playerDamageCooldown[playerId] = now;
-                    LOG_DEBUG("[Server] Cooldown set for player " << playerId);
-                }
-                break;
-            }
+        if (canTakeDamage) {
+            playersHit.push_back(playerId);
+            playerDamageCooldown[playerId] = now;
+            LOG_DEBUG("[Server] Cooldown set for player " << playerId);
         }
     }
     
@@ -353,19 +315,6 @@ void ServerGame::check_player_enemy_collisions() {
     }
 }
 
-void ServerGame::broadcast_enemy_positions() {
-    auto &positions = registry_server.get_components<component::position>();
-    
-    for (auto enemyEntity : _enemies) {
-        uint32_t enemyId = static_cast<uint32_t>(enemyEntity);
-        
-        if (enemyId < positions.size() && positions[enemyId]) {
-            const auto& pos = *positions[enemyId];
-            broadcast_enemy_update(enemyId, pos.x, pos.y, pos.z);
-        }
-    }
-}
-
 void ServerGame::broadcast_enemy_spawn(uint32_t enemyId, float x, float y, float z, float vx, float vy, float vz, float width, float height) {
     auto recipients = collectRoomClients();
     if (recipients.empty())
@@ -393,7 +342,7 @@ void ServerGame::broadcast_enemy_spawn(uint32_t enemyId, float x, float y, float
     msg.width = htonl(w);
     msg.height = htonl(h);
 
-    connexion.broadcastToClients(recipients, &msg, sizeof(msg));
+    connexion.broadcastReliable(recipients, reliable::Channel::Events, &msg, sizeof(msg));
     LOG_DEBUG("[Server] Broadcast enemy spawn: ID=" << enemyId << " pos=(" << x << "," << y << "," << z << ")");
 }
 
@@ -406,7 +355,7 @@ void ServerGame::broadcast_enemy_despawn(uint32_t enemyId) {
     msg.type = MessageType::EnemyDespawn;
     msg.enemyId = htonl(enemyId);
 
-    connexion.broadcastToClients(recipients, &msg, sizeof(msg));
+    connexion.broadcastReliable(recipients, reliable::Channel::Events, &msg, sizeof(msg));
     LOG_DEBUG("[Server] Broadcast enemy despawn: ID=" << enemyId);
 }
 
@@ -418,42 +367,9 @@ void ServerGame::broadcast_boss_death(uint32_t bossId) {
 
     auto recipients = collectRoomClients();
     if (!recipients.empty())
-        connexion.broadcastToClients(recipients, &msg, sizeof(msg));
+        connexion.broadcastReliable(recipients, reliable::Channel::Events, &msg, sizeof(msg));
 
     levelTransitionPending = true;
     levelTransitionTime = std::chrono::steady_clock::now();
 }
 
-void ServerGame::broadcast_enemy_update(uint32_t enemyId, float x, float y, float z) {
-    auto recipients = collectRoomClients();
-    if (recipients.empty())
-        return;
-
-    EnemyUpdateMessage msg{};
-    msg.type = MessageType::EnemyUpdate;
-    msg.enemyId = htonl(enemyId);
-
-    uint32_t xb, yb, zb;
-    std::memcpy(&xb, &x, sizeof(float));
-    std::memcpy(&yb, &y, sizeof(float));
-    std::memcpy(&zb, &z, sizeof(float));
-
-    msg.pos.xBits = htonl(xb);
-    msg.pos.yBits = htonl(yb);
-    msg.pos.zBits = htonl(zb);
-
-    uint32_t vxb = 0;
-    uint32_t vyb = 0;
-    auto& velocities = registry_server.get_components<component::velocity>();
-    if (enemyId < velocities.size() && velocities[enemyId]) {
-        float vx = velocities[enemyId]->vx;
-        float vy = velocities[enemyId]->vy;
-        std::memcpy(&vxb, &vx, sizeof(float));
-        std::memcpy(&vyb, &vy, sizeof(float));
-    }
-
-    msg.velXBits = htonl(vxb);
-    msg.velYBits = htonl(vyb);
-
-    connexion.broadcastToClients(recipients, &msg, sizeof(msg));
-}
\ No newline at end of file
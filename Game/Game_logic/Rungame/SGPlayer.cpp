@@ -25,7 +25,7 @@ void ServerGame::broadcast_player_death(uint32_t clientId) {
     PlayerDeathMessage msg;
     msg.type = MessageType::PlayerDeath;
     msg.clientId = htonl(clientId);
-    connexion.broadcastToClients(recipients, &msg, sizeof(msg));
+    connexion.broadcastReliable(recipients, reliable::Channel::Events, &msg, sizeof(msg));
     LOG_INFO("[Server] Player " << clientId << " died!");
 }
 
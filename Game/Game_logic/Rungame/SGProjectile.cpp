@@ -17,8 +17,7 @@
 
 
 template <typename Component>
-inline Component* get_component_ptr(ecs::registry &registry, ecs::entity_t entity) {
-    auto &arr = registry.get_components<Component>();
+inline Component* get_component_ptr(ecs::sparse_array<Component> &arr, ecs::entity_t entity) {
     auto idx = static_cast<std::size_t>(entity);
     if (idx >= arr.size() || !arr[idx].has_value()) {
         return nullptr;
@@ -32,136 +31,79 @@ void ServerGame::check_projectile_enemy_collisions() {
     const float PROJ_WIDTH = 10.f;
     const float PROJ_HEIGHT = 5.f;
     const int DAMAGE_PER_HIT = 1;
+    const uint32_t NO_HIT = UINT32_MAX;
 
-    auto &collision_boxes = registry_server.get_components<component::collision_box>();
+    auto &healths = registry_server.get_components<component::health>();
+    auto &patterns = registry_server.get_components<component::pattern_element>();
 
-    for (const auto& projKv : projectiles) {
-        uint32_t projId = projKv.first;
-        const ProjectileState &projState = projKv.second;
+    for (std::size_t slot = 0; slot < projectiles.size(); ++slot) {
+        uint32_t projId = projectiles.handle_at(slot);
+        const physics::projectile projState = projectiles.at(slot);
 
         float width = projState.width > 0.f ? projState.width : PROJ_WIDTH;
         float height = projState.height > 0.f ? projState.height : PROJ_HEIGHT;
-        float projLeft = projState.x - width * 0.5f;
-        float projRight = projState.x + width * 0.5f;
-        float projTop = projState.y - height * 0.5f;
-        float projBottom = projState.y + height * 0.5f;
-
-        for (auto enemyEntity : _enemies) {
-            uint32_t eid = static_cast<uint32_t>(enemyEntity);
-            auto pos = get_component_ptr<component::position>(registry_server, enemyEntity);
-            auto health = get_component_ptr<component::health>(registry_server, enemyEntity);
-            if (!pos || !health)
-                continue;
-
-            float enemyWidth = 30.f;
-            float enemyHeight = 30.f;
-            if (eid < collision_boxes.size() && collision_boxes[eid]) {
-                enemyWidth = collision_boxes[eid]->width;
-                enemyHeight = collision_boxes[eid]->height;
+        auto projBox = physics::aabb::from_center(projState.x, projState.y, width, height);
+
+        // Enemies are inserted in _enemies order: the lowest id is the one the projectile meets first.
+        uint32_t hit = NO_HIT;
+        _broadphase.query(projBox, LAYER_ENEMY, [&](uint32_t id, const physics::aabb &) {
+            if (id < hit && get_component_ptr(healths, _broadphaseEntities[id]))
+                hit = id;
+        });
+        if (hit == NO_HIT)
+            continue;
+
+        ecs::entity_t enemyEntity = _broadphaseEntities[hit];
+        auto health = get_component_ptr(healths, enemyEntity);
+        projectilesToRemove.push_back(projId);
+
+        int damageApplied = static_cast<int>(std::round(std::max(projState.damage, 0.f)));
+        if (damageApplied <= 0) {
+            damageApplied = DAMAGE_PER_HIT;
+        }
+        health->current -= damageApplied;
+
+        uint32_t enemyId = static_cast<uint32_t>(enemyEntity);
+        uint32_t killerId = projState.owner;
+        if (health->current <= 0) {
+            bool isBoss = false;
+            auto pattern_comp = get_component_ptr(patterns, enemyEntity);
+            if (pattern_comp && !pattern_comp->pattern_name.empty()) {
+                std::string pattern = pattern_comp->pattern_name;
+                isBoss = (pattern.find("boss_phase1") != std::string::npos);
             }
-            
-            float enemyX = pos->x;
-            float enemyY = pos->y;
-            float enemyLeft = enemyX - enemyWidth * 0.5f;
-            float enemyRight = enemyX + enemyWidth * 0.5f;
-            float enemyTop = enemyY - enemyHeight * 0.5f;
-            float enemyBottom = enemyY + enemyHeight * 0.5f;
-
-            if (check_aabb_overlap(projLeft, projRight, projTop, projBottom,
-                                  enemyLeft, enemyRight, enemyTop, enemyBottom)) {
-                
-                projectilesToRemove.push_back(projId);
-                
-                int damageApplied = static_cast<int>(std::round(std::max(projState.damage, 0.f)));
-                if (damageApplied <= 0) {
-                    damageApplied = DAMAGE_PER_HIT;
-                }
-                health->current -= damageApplied;
-                
-                uint32_t enemyId = static_cast<uint32_t>(enemyEntity);
-                uint32_t killerId = projState.ownerId;
-                if (health->current <= 0) {
-                    bool isBoss = false;
-                    auto pattern_comp = get_component_ptr<component::pattern_element>(registry_server, enemyEntity);
-                    if (pattern_comp && !pattern_comp->pattern_name.empty()) {
-                        std::string pattern = pattern_comp->pattern_name;
-                        isBoss = (pattern.find("boss_phase1") != std::string::npos);
-                    }
-                    if (isBoss) {
-                        broadcast_boss_death(enemyId);
-                        totalScore += 100;
-                    } else {
-                        totalScore += 10;
-                    }
-                    enemiesToRemove.push_back(enemyId);
-                    if (playerIndividualScores.find(killerId) == playerIndividualScores.end()) {
-                        playerIndividualScores[killerId] = 0;
-                    }
-                    playerIndividualScores[killerId] += (isBoss ? 100 : 10);
-                }
-                break;
+            if (isBoss) {
+                broadcast_boss_death(enemyId);
+                totalScore += 100;
+            } else {
+                totalScore += 10;
+            }
+            enemiesToRemove.push_back(enemyId);
+            if (playerIndividualScores.find(killerId) == playerIndividualScores.end()) {
+                playerIndividualScores[killerId] = 0;
             }
+            playerIndividualScores[killerId] += (isBoss ? 100 : 10);
         }
     }
 
     for (uint32_t projId : projectilesToRemove) {
-        projectiles.erase(projId);
+        projectiles.despawn(projId);
         broadcast_projectile_despawn(projId);
     }
 
     for (uint32_t enemyId : enemiesToRemove) {
-        registry_server.kill_entity(static_cast<ecs::entity_t>(enemyId));
+        ecs::entity_t entity = registry_server.entity_from_index(enemyId);
+        registry_server.kill_entity(entity);
         broadcast_enemy_despawn(enemyId);
+        _enemyMotion.erase(enemyId);
         _enemies.erase(std::remove(_enemies.begin(), _enemies.end(), 
-                                   static_cast<ecs::entity_t>(enemyId)), _enemies.end());
-    }
-}
-
-void ServerGame::broadcast_projectile_positions() {
-    auto recipients = collectRoomClients();
-    if (recipients.empty())
-        return;
-
-    for (const auto& kv : projectiles) {
-        uint32_t id = kv.first;
-        const ProjectileState &state = kv.second;
-
-        ProjectileUpdateMessage msg;
-        msg.type = MessageType::ProjectileUpdate;
-        msg.projectileId = htonl(id);
-
-        uint32_t xb, yb, zb;
-        std::memcpy(&xb, &state.x, sizeof(float));
-        std::memcpy(&yb, &state.y, sizeof(float));
-        std::memcpy(&zb, &state.z, sizeof(float));
-
-        msg.pos.xBits = htonl(xb);
-        msg.pos.yBits = htonl(yb);
-        msg.pos.zBits = htonl(zb);
-
-        connexion.broadcastToClients(recipients, &msg, sizeof(msg));
+                                   entity), _enemies.end());
     }
 }
 
 void ServerGame::update_projectiles_server_only(float dt) {
-    std::vector<uint32_t> toRemove;
-
-    for (auto& kv : projectiles) {
-        uint32_t id = kv.first;
-        ProjectileState &state = kv.second;
-
-        state.x += state.vx * dt;
-        state.y += state.vy * dt;
-        state.z += state.vz * dt;
-
-        if (state.x < -50.f || state.x > 1970.f || state.y < -50.f || state.y > 1130.f) {
-            toRemove.push_back(id);
-        }
-    }
-    for (uint32_t id : toRemove) {
-        projectiles.erase(id);
-        broadcast_projectile_despawn(id);
-    }
+    projectiles.integrate(dt);
+    projectiles.cull(PROJECTILE_BOUNDS, [this](uint32_t id) { broadcast_projectile_despawn(id); });
 }
 
 void ServerGame::broadcast_projectile_spawn(uint32_t projId, uint32_t ownerId,
@@ -210,85 +152,51 @@ void ServerGame::check_projectile_collisions() {
     const float PROJ_WIDTH = 10.f;
     const float PROJ_HEIGHT = 5.f;
 
-    for (const auto& projKv : projectiles) {
-        uint32_t projId = projKv.first;
-        const ProjectileState &projState = projKv.second;
+    for (std::size_t slot = 0; slot < projectiles.size(); ++slot) {
+        uint32_t projId = projectiles.handle_at(slot);
+        const physics::projectile projState = projectiles.at(slot);
 
         float width = projState.width > 0.f ? projState.width : PROJ_WIDTH;
         float height = projState.height > 0.f ? projState.height : PROJ_HEIGHT;
+        auto projBox = physics::aabb::from_center(projState.x, projState.y, width, height);
 
-        float projLeft = projState.x - width * 0.5f;
-        float projRight = projState.x + width * 0.5f;
-        float projTop = projState.y - height * 0.5f;
-        float projBottom = projState.y + height * 0.5f;
-
-        for (auto obstacleEntity : _obstacles) {
-            auto pos = get_component_ptr<component::position>(registry_server, obstacleEntity);
-            auto box = get_component_ptr<component::collision_box>(registry_server, obstacleEntity);
-
-            if (!pos || !box)
-                continue;
-
-            float obsX = pos->x;
-            float obsY = pos->y;
-            float obsW = box->width;
-            float obsH = box->height;
-
-            float obsLeft = obsX - obsW * 0.5f;
-            float obsRight = obsX + obsW * 0.5f;
-            float obsTop = obsY - obsH * 0.5f;
-            float obsBottom = obsY + obsH * 0.5f;
-
-            if (check_aabb_overlap(projLeft, projRight, projTop, projBottom,
-                                  obsLeft, obsRight, obsTop, obsBottom)) {
-                projectilesToRemove.push_back(projId);
-                break;
-            }
-        }
+        bool blocked = false;
+        _broadphase.query(projBox, LAYER_OBSTACLE, [&](uint32_t, const physics::aabb &) { blocked = true; });
+        if (blocked)
+            projectilesToRemove.push_back(projId);
     }
 
     for (uint32_t projId : projectilesToRemove) {
-        projectiles.erase(projId);
+        projectiles.despawn(projId);
         broadcast_projectile_despawn(projId);
     }
 }
 
 void ServerGame::shoot_enemy_projectile(uint32_t enemyId, float x, float y, float vx, float vy) {
-    uint32_t projId = nextEnemyProjectileId++;
-    
+    const float PROJ_WIDTH = 10.f;
+    const float PROJ_HEIGHT = 5.f;
+
     float spawnX = x - 20.f;
     float spawnY = y;
     float spawnZ = 0.f;
     float velZ = 0.f;
     
-    enemyProjectiles[projId] = std::make_tuple(spawnX, spawnY, spawnZ, vx, vy, velZ, enemyId);
+    uint32_t projId = enemyProjectiles.spawn(physics::projectile{
+        .x = spawnX,
+        .y = spawnY,
+        .vx = vx,
+        .vy = vy,
+        .owner = enemyId,
+        .damage = 0.f,
+        .width = PROJ_WIDTH,
+        .height = PROJ_HEIGHT
+    });
     broadcast_enemy_projectile_spawn(projId, enemyId, spawnX, spawnY, spawnZ, vx, vy, velZ);
 }
 
 void ServerGame::update_enemy_projectiles_server_only(float dt) {
-    std::vector<uint32_t> toRemove;
-
-    for (auto& kv : enemyProjectiles) {
-        uint32_t id = kv.first;
-        float& x = std::get<0>(kv.second);
-        float& y = std::get<1>(kv.second);
-        float& z = std::get<2>(kv.second);
-        float vx = std::get<3>(kv.second);
-        float vy = std::get<4>(kv.second);
-        float vz = std::get<5>(kv.second);
-        
-        x += vx * dt;
-        y += vy * dt;
-        z += vz * dt;
-        
-        if (x < -50.f || x > 1970.f || y < -50.f || y > 1130.f) {
-            toRemove.push_back(id);
-        }
-    }
-    for (uint32_t id : toRemove) {
-        enemyProjectiles.erase(id);
-        broadcast_enemy_projectile_despawn(id);
-    }
+    enemyProjectiles.integrate(dt);
+    enemyProjectiles.cull(PROJECTILE_BOUNDS, [this](uint32_t id) { broadcast_enemy_projectile_despawn(id); });
 }
 
 void ServerGame::check_enemy_projectile_player_collisions() {
@@ -301,10 +209,10 @@ void ServerGame::check_enemy_projectile_player_collisions() {
     const float PROJ_HEIGHT = 5.f;
     const int DAMAGE = 15;
     
-    for (const auto& projKv : enemyProjectiles) {
-        uint32_t projId = projKv.first;
-        float projX = std::get<0>(projKv.second);
-        float projY = std::get<1>(projKv.second);
+    for (std::size_t slot = 0; slot < enemyProjectiles.size(); ++slot) {
+        uint32_t projId = enemyProjectiles.handle_at(slot);
+        float projX = enemyProjectiles.xs()[slot];
+        float projY = enemyProjectiles.ys()[slot];
         
         float projLeft = projX - PROJ_WIDTH * 0.5f;
         float projRight = projX + PROJ_WIDTH * 0.5f;
@@ -336,7 +244,7 @@ void ServerGame::check_enemy_projectile_player_collisions() {
     }
     
     for (uint32_t projId : projectilesToRemove) {
-        enemyProjectiles.erase(projId);
+        enemyProjectiles.despawn(projId);
         broadcast_enemy_projectile_despawn(projId);
     }
     
@@ -389,34 +297,6 @@ void ServerGame::broadcast_enemy_projectile_spawn(uint32_t projId, uint32_t owne
     connexion.broadcastToClients(recipients, &msg, sizeof(msg));
 }
 
-void ServerGame::broadcast_enemy_projectile_positions() {
-    auto recipients = collectRoomClients();
-    if (recipients.empty())
-        return;
-
-    for (const auto& kv : enemyProjectiles) {
-        uint32_t id = kv.first;
-        float x = std::get<0>(kv.second);
-        float y = std::get<1>(kv.second);
-        float z = std::get<2>(kv.second);
-
-        EnemyProjectileUpdateMessage msg;
-        msg.type = MessageType::EnemyProjectileUpdate;
-        msg.projectileId = htonl(id);
-
-        uint32_t xb, yb, zb;
-        std::memcpy(&xb, &x, sizeof(float));
-        std::memcpy(&yb, &y, sizeof(float));
-        std::memcpy(&zb, &z, sizeof(float));
-
-        msg.pos.xBits = htonl(xb);
-        msg.pos.yBits = htonl(yb);
-        msg.pos.zBits = htonl(zb);
-
-        connexion.broadcastToClients(recipients, &msg, sizeof(msg));
-    }
-}
-
 void ServerGame::broadcast_enemy_projectile_despawn(uint32_t projId) {
     auto recipients = collectRoomClients();
     if (recipients.empty())
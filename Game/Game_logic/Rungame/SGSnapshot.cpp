@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** SGSnapshot
+*/
+
+#include "../Rungame.hpp"
+#include "Logger.hpp"
+
+void ServerGame::broadcast_snapshot(bool includeWorld) {
+    auto recipients = collectRoomClients();
+    if (recipients.empty())
+        return;
+
+    auto &positions = registry_server.get_components<component::position>();
+    auto &velocities = registry_server.get_components<component::velocity>();
+
+    if (++_snapshotTick == 0)
+        ++_snapshotTick;
+    _snapshotWorld.clear();
+
+    for (const auto &[playerId, pos] : playerPositions) {
+        if (deadPlayers.find(playerId) != deadPlayers.end())
+            continue;
+        _snapshotWorld.push_back(snapshot::quantize(
+            {snapshot::EntityKind::Player, playerId, pos.first, pos.second, 0.f, 0.f, 0.f, 0.f}));
+    }
+
+    if (includeWorld) {
+        auto add_entities = [&](const std::vector<ecs::entity_t> &entities, snapshot::EntityKind kind) {
+            for (auto entity : entities) {
+                auto id = static_cast<std::size_t>(entity);
+                if (id >= positions.size() || !positions[id])
+                    continue;
+                snapshot::EntityState state{kind, static_cast<uint32_t>(id),
+                                            positions[id]->x, positions[id]->y, positions[id]->z, 0.f, 0.f, 0.f};
+                if (id < velocities.size() && velocities[id]) {
+                    state.vx = velocities[id]->vx;
+                    state.vy = velocities[id]->vy;
+                    if (kind == snapshot::EntityKind::Obstacle)
+                        state.vz = velocities[id]->vz;
+                }
+                _snapshotWorld.push_back(snapshot::quantize(state));
+            }
+        };
+        add_entities(_enemies, snapshot::EntityKind::Enemy);
+        add_entities(_obstacles, snapshot::EntityKind::Obstacle);
+        add_entities(_randomElements, snapshot::EntityKind::Element);
+
+        for (std::size_t slot = 0; slot < projectiles.size(); ++slot) {
+            _snapshotWorld.push_back(snapshot::quantize({snapshot::EntityKind::Projectile, projectiles.handle_at(slot),
+                projectiles.xs()[slot], projectiles.ys()[slot], 0.f, 0.f, 0.f, 0.f}));
+        }
+        for (std::size_t slot = 0; slot < enemyProjectiles.size(); ++slot) {
+            _snapshotWorld.push_back(snapshot::quantize({snapshot::EntityKind::EnemyProjectile,
+                enemyProjectiles.handle_at(slot), enemyProjectiles.xs()[slot], enemyProjectiles.ys()[slot],
+                0.f, 0.f, 0.f, 0.f}));
+        }
+    }
+    snapshot::sortWorld(_snapshotWorld);
+
+    std::map<uint32_t, std::vector<uint32_t>> recipientsByBaseline;
+    for (uint32_t clientId : recipients) {
+        auto ack = _snapshotAcks.find(clientId);
+        uint32_t baselineTick = 0;
+        if (ack != _snapshotAcks.end() && _snapshotHistory.find(ack->second))
+            baselineTick = ack->second;
+        recipientsByBaseline[baselineTick].push_back(clientId);
+    }
+
+    _snapshotBytesLastTick = 0;
+    for (const auto &[baselineTick, group] : recipientsByBaseline) {
+        const auto *baseline = baselineTick != 0 ? _snapshotHistory.find(baselineTick) : nullptr;
+        for (const auto &chunk : _snapshotWriter.encode(_snapshotTick, _snapshotWorld, baselineTick, baseline)) {
+            connexion.broadcastToClients(group, chunk.data(), chunk.size());
+            _snapshotBytesLastTick += chunk.size() * group.size();
+            _profiler->packetsOut.add(group.size());
+        }
+    }
+    _snapshotHistory.store(_snapshotTick, _snapshotWorld);
+
+    _profiler->bytesOut.add(_snapshotBytesLastTick);
+    _snapshotBytesWindow += _snapshotBytesLastTick;
+    if (_snapshotTick % SNAPSHOT_STATS_TICKS == 0) {
+        LOG_DEBUG("[Server] Room " << _roomId << " snapshots: "
+            << _snapshotBytesWindow / SNAPSHOT_STATS_TICKS << " bytes/tick");
+        _snapshotBytesWindow = 0;
+    }
+}
+
+void ServerGame::handle_snapshot_ack(uint32_t clientId, uint32_t tick) {
+    if (tick == 0 || static_cast<int32_t>(_snapshotTick - tick) < 0)
+        return;
+    auto [it, inserted] = _snapshotAcks.try_emplace(clientId, tick);
+    if (!inserted && static_cast<int32_t>(tick - it->second) > 0)
+        it->second = tick;
+}
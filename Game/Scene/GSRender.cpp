@@ -17,12 +17,26 @@
 #include <filesystem>
 #include "WeaponDefinition.hpp"
 
+namespace {
+    /** Draw order of the sprite batch, back to front. */
+    enum SpriteLayer : int {
+        BACKGROUND_LAYER = 0,
+        OBSTACLE_LAYER,
+        ELEMENT_LAYER,
+        ENEMY_LAYER,
+        PROJECTILE_LAYER,
+        PLAYER_LAYER,
+        PLAYER_MISSILE_LAYER,
+        ENEMY_MISSILE_LAYER,
+    };
+}
+
 namespace game::scene {
     void GameScene::render() {
         _raylib.beginDrawing();
         _raylib.clearBackground(GRAY);
         if (!_isWin)
-            _isDead = (_game.getGameClient().players.find(_game.getGameClient().clientId) == _game.getGameClient().players.end());
+            _isDead = !_game.getGameClient().world().players.contains(_game.getGameClient().clientId);
         _isWin = _isWin = _game.getGameClient().bossDefeated.load();
         _lastBoss = _game.getGameClient()._lastBoss;
         
@@ -30,7 +44,8 @@ namespace game::scene {
         render_entities();
         render_network_projectiles();
         render_network_enemy_projectiles();
-        
+        _batch->flush();
+
         _ui.render();
         if (_isDead) {
             render_death_screen();
@@ -46,6 +61,8 @@ namespace game::scene {
             }
         }
         _chat.render();
+        if (_showRenderStats)
+            render_stats_overlay();
         if (_isDead && !_defeatSoundPlayed) {
             _raylib.stopMusicStream(_music);
             if (_game.isSoundEnabled()) {
@@ -92,21 +109,16 @@ namespace game::scene {
         auto &drawables = _registry.get_components<component::drawable>();
         auto &types = _registry.get_components<component::type>();
 
-        for (std::size_t i = 0; i < positions.size() && i < drawables.size() && i < types.size(); ++i) {
-            if (!positions[i] || !drawables[i] || !types[i])
-                continue;
-            if (types[i]->value == component::entity_type::BACKGROUND) {
-                ecs::entity_t entity = _registry.entity_from_index(i);
-                render_background(entity, *positions[i], *drawables[i]);
-            }
-        }
-        
+        // One pass: the batch puts backgrounds behind everything else by layer.
         for (std::size_t i = 0; i < positions.size() && i < drawables.size() && i < types.size(); ++i) {
             if (!positions[i] || !drawables[i] || !types[i]) continue;
 
             ecs::entity_t entity = _registry.entity_from_index(i);
 
             switch (types[i]->value) {
+                case component::entity_type::BACKGROUND:
+                    render_background(entity, *positions[i], *drawables[i]);
+                    break;
                 case component::entity_type::OBSTACLE:
                     render_obstacle(entity, *positions[i], *drawables[i]);
                     break;
@@ -129,21 +141,17 @@ namespace game::scene {
     }
 
     void GameScene::render_network_projectiles() {
-        std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, uint32_t>>  projs;
-        {
-            std::lock_guard<std::mutex> g(_game.getGameClient().stateMutex);
-            projs = _game.getGameClient().projectiles;
-        }
-        
         auto it = _projectileTextures.find("player_missile");
         bool hasTexture = (it != _projectileTextures.end());
         
-        for (auto &kv : projs) {
-            float x = std::get<0>(kv.second);
-            float y = std::get<1>(kv.second);
+        for (const auto &state : _interpolated) {
+            if (state.kind != snapshot::EntityKind::Projectile)
+                continue;
+            float x = state.x;
+            float y = state.y;
             
             if (hasTexture) {
-                Texture2D &texture = it->second;
+                const rendering::AtlasRegion &texture = it->second.region;
                 
                 Rectangle sourceRec = {
                     170.0f, 135.0f, 50.0f, 15.0f 
@@ -156,15 +164,15 @@ namespace game::scene {
                 Vector2 origin = {0.0f, 0.0f};
                 float rotation = 0.0f;
                 
-                _raylib.drawTexturePro(texture, sourceRec, destRec, origin, rotation, WHITE);
+                _batch->draw(PLAYER_MISSILE_LAYER, texture, sourceRec, destRec, origin, rotation, WHITE);
             } else {
-                _raylib.drawRectangle((int)(x - 8), (int)(y - 2), 16, 5, WHITE);
+                _batch->drawRectangle(PLAYER_MISSILE_LAYER, {(float)(int)(x - 8), (float)(int)(y - 2), 16.0f, 5.0f}, WHITE);
             }
         }
     }
 
     void GameScene::render_player(ecs::entity_t entity, const component::position &pos, const component::drawable &draw) {
-        Texture2D* texture = get_entity_texture(entity);
+        const rendering::AtlasRegion* texture = get_entity_texture(entity);
 
         if (texture != nullptr) {
             uint32_t clientId = 0;
@@ -190,7 +198,7 @@ namespace game::scene {
                 scale = sprites[entity.value()]->scale;
                 rotation = sprites[entity.value()]->rotation;
             }
-            _raylib.drawTexturePro(*texture, sourceRec, destRec, origin, rotation, WHITE);
+            _batch->draw(PLAYER_LAYER, *texture, sourceRec, destRec, origin, rotation, WHITE);
         } else {
             uint32_t idForColor = 0;
             for (auto const &kv : _playerEntities) {
@@ -200,12 +208,12 @@ namespace game::scene {
                 }
             }
             Color playerColor = get_color_for_id(idForColor);
-            _raylib.drawRectangle((int)(pos.x - draw.width / 2), (int)(pos.y - draw.height / 2), (int)draw.width, (int)draw.height, playerColor);
+            _batch->drawRectangle(PLAYER_LAYER, {pos.x - draw.width / 2, pos.y - draw.height / 2, draw.width, draw.height}, playerColor);
         }
     }
 
     void GameScene::render_enemy(ecs::entity_t entity, const component::position &pos, const component::drawable &draw) {
-        Texture2D* texture = get_entity_texture(entity);
+        const rendering::AtlasRegion* texture = get_entity_texture(entity);
 
         static std::unordered_map<uint32_t, float> spriteOffsets;
         static std::unordered_map<uint32_t, float> lastFrameTime;
@@ -235,14 +243,14 @@ namespace game::scene {
             if (entity.value() < sprites.size() && sprites[entity.value()]) {
                 rotation = sprites[entity.value()]->rotation;
             }
-            _raylib.drawTexturePro(*texture, sourceRec, destRec, origin, rotation, WHITE);
+            _batch->draw(ENEMY_LAYER, *texture, sourceRec, destRec, origin, rotation, WHITE);
         } else {
-            _raylib.drawRectangle((int)(pos.x - draw.width / 2), (int)(pos.y - draw.height / 2), (int)draw.width, (int)draw.height, YELLOW);
+            _batch->drawRectangle(ENEMY_LAYER, {pos.x - draw.width / 2, pos.y - draw.height / 2, draw.width, draw.height}, YELLOW);
         }
     }
 
     void GameScene::render_obstacle(ecs::entity_t entity, const component::position &pos, const component::drawable &draw) {
-        Texture2D* texture = get_entity_texture(entity);
+        const rendering::AtlasRegion* texture = get_entity_texture(entity);
 
         if (texture != nullptr) {
             Rectangle sourceRec = {0.0f, 0.0f, (float)draw.width, (float)draw.height};
@@ -254,14 +262,14 @@ namespace game::scene {
             if (entity.value() < sprites.size() && sprites[entity.value()]) {
                 rotation = sprites[entity.value()]->rotation;
             }
-            _raylib.drawTexturePro(*texture, sourceRec, destRec, origin, rotation, WHITE);
+            _batch->draw(OBSTACLE_LAYER, *texture, sourceRec, destRec, origin, rotation, WHITE);
         } else {
-            _raylib.drawRectangle((int)(pos.x - draw.width / 2), (int)(pos.y - draw.height / 2), (int)draw.width, (int)draw.height, GRAY);
+            _batch->drawRectangle(OBSTACLE_LAYER, {pos.x - draw.width / 2, pos.y - draw.height / 2, draw.width, draw.height}, GRAY);
         }
     }
 
     void GameScene::render_background(ecs::entity_t entity, const component::position &pos, const component::drawable &draw) {
-        Texture2D* texture = get_entity_texture(entity);
+        const rendering::AtlasRegion* texture = get_entity_texture(entity);
 
         if (texture != nullptr) {
             _backgroundScrollX -= 0.2f;
@@ -270,15 +278,15 @@ namespace game::scene {
             Rectangle sourceRec = {0.0f, 0.0f, (float)draw.width, (float)draw.height};
             Rectangle destRec = {_backgroundScrollX, 0.0f, (float)_width, (float)_height};
             Vector2 origin = {0.0f, 0.0f};
-            _raylib.drawTexturePro(*texture, sourceRec, destRec, origin, 0.0f, WHITE);
+            _batch->draw(BACKGROUND_LAYER, *texture, sourceRec, destRec, origin, 0.0f, WHITE);
             Rectangle destRec2 = {_backgroundScrollX + _width, 0.0f, (float)_width, (float)_height};
-            _raylib.drawTexturePro(*texture, sourceRec, destRec2, origin, 0.0f, WHITE);
+            _batch->draw(BACKGROUND_LAYER, *texture, sourceRec, destRec2, origin, 0.0f, WHITE);
         }
     }
 
     void GameScene::render_powerup(ecs::entity_t entity, const component::position &pos, const component::drawable &draw) {
         
-        Texture2D* texture = get_entity_texture(entity);
+        const rendering::AtlasRegion* texture = get_entity_texture(entity);
 
         if (texture != nullptr) {
             Rectangle sourceRec = {0.0f, 0.0f, (float)draw.width, (float)draw.height};
@@ -290,21 +298,15 @@ namespace game::scene {
             if (entity.value() < sprites.size() && sprites[entity.value()]) {
                 rotation = sprites[entity.value()]->rotation;
             }
-            _raylib.drawTexturePro(*texture, sourceRec, destRec, origin, rotation, WHITE);
+            _batch->draw(ELEMENT_LAYER, *texture, sourceRec, destRec, origin, rotation, WHITE);
         } else {
             std::cout << "[WARNING] Element has NO texture, drawing fallback rectangle" << std::endl;
-            _raylib.drawRectangle(
-                (int)(pos.x - draw.width / 2), 
-                (int)(pos.y - draw.height / 2), 
-                (int)draw.width, 
-                (int)draw.height, 
-                GOLD
-            );            
+            _batch->drawRectangle(ELEMENT_LAYER, {pos.x - draw.width / 2, pos.y - draw.height / 2, draw.width, draw.height}, GOLD);
         }
     }
 
     void GameScene::render_projectile(ecs::entity_t entity, const component::position &pos, const component::drawable &draw) {
-        Texture2D* texture = get_entity_texture(entity);
+        const rendering::AtlasRegion* texture = get_entity_texture(entity);
 
         if (texture != nullptr) {
             Rectangle sourceRec = {0.0f, 0.0f, (float)draw.width, (float)draw.height};
@@ -316,20 +318,14 @@ namespace game::scene {
             if (entity.value() < sprites.size() && sprites[entity.value()]) {
                 rotation = sprites[entity.value()]->rotation;
             }
-            _raylib.drawTexturePro(*texture, sourceRec, destRec, origin, rotation, WHITE);
+            _batch->draw(PROJECTILE_LAYER, *texture, sourceRec, destRec, origin, rotation, WHITE);
         } else {
-            _raylib.drawRectangle((int)(pos.x - draw.width / 2), (int)(pos.y - draw.height / 2), (int)draw.width, (int)draw.height, YELLOW);
+            _batch->drawRectangle(PROJECTILE_LAYER, {pos.x - draw.width / 2, pos.y - draw.height / 2, draw.width, draw.height}, YELLOW);
         }
     }
 
     void GameScene::render_network_obstacles() {
-        std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, float, float, float>> obs;
-        {
-            std::lock_guard<std::mutex> g(_game.getGameClient().stateMutex);
-            obs = _game.getGameClient().obstacles;
-        }
-
-        for (auto const &kv: obs) {
+        for (auto const &kv: _game.getGameClient().world().obstacles) {
             float x = std::get<0>(kv.second);
             float y = std::get<1>(kv.second);
             float w = std::get<3>(kv.second);
@@ -339,21 +335,17 @@ namespace game::scene {
     }
 
     void GameScene::render_network_enemy_projectiles() {
-        std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, uint32_t>> enemyProjs;
-        {
-            std::lock_guard<std::mutex> g(_game.getGameClient().stateMutex);
-            enemyProjs = _game.getGameClient().enemyProjectiles;
-        }
-        
         auto it = _projectileTextures.find("enemy_missile");
         bool hasTexture = (it != _projectileTextures.end());
         
-        for (auto &kv : enemyProjs) {
-            float x = std::get<0>(kv.second);
-            float y = std::get<1>(kv.second);
+        for (const auto &state : _interpolated) {
+            if (state.kind != snapshot::EntityKind::EnemyProjectile)
+                continue;
+            float x = state.x;
+            float y = state.y;
             
             if (hasTexture) {
-                Texture2D &texture = it->second;
+                const rendering::AtlasRegion &texture = it->second.region;
                 
                 Rectangle sourceRec = {
                     170.0f, 135.0f, 50.0f, 15.0f 
@@ -366,13 +358,29 @@ namespace game::scene {
                 Vector2 origin = {0.0f, 0.0f};
                 float rotation = 180.0f;
                 
-                _raylib.drawTexturePro(texture, sourceRec, destRec, origin, rotation, RED);
+                _batch->draw(ENEMY_MISSILE_LAYER, texture, sourceRec, destRec, origin, rotation, RED);
             } else {
-                _raylib.drawRectangle((int)(x - 8), (int)(y - 2), 16, 5, RED);
+                _batch->drawRectangle(ENEMY_MISSILE_LAYER, {(float)(int)(x - 8), (float)(int)(y - 2), 16.0f, 5.0f}, RED);
             }
         }
     }
 
+    void GameScene::render_stats_overlay() {
+        const rendering::BatchStats &stats = _batch->stats();
+        std::string lines[] = {
+            "FPS: " + std::to_string(_raylib.getFPS()),
+            "Sprites: " + std::to_string(stats.sprites),
+            "Draw calls: " + std::to_string(stats.drawCalls),
+            "Texture binds: " + std::to_string(stats.textureBinds),
+        };
+        int y = _height - 110;
+        _raylib.drawRectangle(10, y - 10, 260, 110, Color{0, 0, 0, 160});
+        for (const auto &line : lines) {
+            _raylib.drawText(line, 20, y, 20, GREEN);
+            y += 24;
+        }
+    }
+
     void GameScene::render_death_screen() {
         _raylib.drawRectangle(0, 0, _width, _height, Color{255, 0, 0, 100});
         bool isFrench = (_game.getLanguage() == Game::Language::FRENCH);
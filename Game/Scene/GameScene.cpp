@@ -10,12 +10,18 @@
 #include <cmath>
 #include <tuple>
 #include <algorithm>
+#include <optional>
+#include <utility>
 #include <string>
-#include <nlohmann/json.hpp>
-#include "../../Engine/Utils/Include/serializer.hpp"
+#include "../../Engine/Utils/Include/registry_snapshot.hpp"
 #include <vector>
 #include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include "../../Engine/Utils/Include/entity_storage.hpp"
+#include "../../Engine/Utils/Include/asset_path.hpp"
 #include "WeaponDefinition.hpp"
+#include "Logger.hpp"
 
 namespace {
     std::string normalizeNetworkAssetPath(const std::string &rawPath)
@@ -46,6 +52,38 @@ namespace {
 
         return std::string(ASSETS_PATH) + "/" + generic;
     }
+
+    std::string level_manifest_path(int level)
+    {
+        return std::string(ASSETS_PATH) + "/Config_assets/Levels/level_0" + std::to_string(level) + ".json";
+    }
+
+    /** The server loops back to the first level after the last one in endless mode. */
+    int level_after(int level)
+    {
+        return std::filesystem::exists(level_manifest_path(level + 1)) ? level + 1 : 1;
+    }
+
+    void request_level_images(rendering::AssetStreamer &assets, int level)
+    {
+        assets.enqueue([&assets, level] {
+            try {
+                std::ifstream file(level_manifest_path(level));
+                if (!file.is_open())
+                    return;
+                nlohmann::json data;
+                file >> data;
+                game::storage::level_images images = game::storage::list_level_images(data);
+                // Sprites are packed in the level atlas; backgrounds get their own texture.
+                for (const auto &path : images.sprites)
+                    assets.requestImage(game::assets::resolve_path(path));
+                for (const auto &path : images.backgrounds)
+                    assets.requestTexture(game::assets::resolve_path(path));
+            } catch (const std::exception &e) {
+                LOG_WARN("Could not prefetch level " << level << ": " << e.what());
+            }
+        });
+    }
 }
 
 namespace game::scene {
@@ -60,9 +98,15 @@ namespace game::scene {
         _registry.clear();
         _isOpen = true;
         _startTime = _raylib.getTime();
+        _level = 0;
+        _predictor.reset();
+        _inputAccumulator = 0.f;
         _raylib.disableCursor();
         _raylib.setTargetFPS(60);
         toggleFullScreen();
+        _batch.emplace([this](const Texture2D &texture, const rendering::Quad *quads, std::size_t count) {
+            return _raylib.drawQuads(texture, quads, count);
+        }, _raylib.defaultTexture());
 
         _registry.register_component<component::position>();
         _registry.register_component<component::previous_position>();
@@ -89,8 +133,11 @@ namespace game::scene {
         _ui.init();
         _chat.init();
         _chat.setUsername(_game.getGameClient().getClientName());
-        _game.getGameClient().sendSceneState(SceneState::GAME, &_registry);
+        _game.getGameClient().sendSceneState(SceneState::GAME);
 
+        // No stage below holds two systems that do real work, so a worker pool
+        // would only add a cross-thread handoff per frame.
+        _registry.set_system_workers(0);
         setup_movement_system();
         setup_render_system();
         setup_health_system();
@@ -100,19 +147,15 @@ namespace game::scene {
 
         game::entities::create_text(_registry, {20.f, 30.f}, "R-Type", WHITE, 1.0f, 32);
         game::entities::create_sound(_registry, std::string(ASSETS_PATH) + "/sounds/BATTLE-PRESSURE.wav", 0.8f, true, true);
-        
-        if (!processPendingFullRegistry()) {
-            std::cerr << "[WARN] Aucun full registry disponible lors de l'initialisation." << std::endl;
-        }
+
+        // render() applies the first level registry once it arrives, like the next ones.
+        _levelReloadPending = true;
         load_projectile_textures();
         load_music();
     }
 
     void GameScene::index_existing_entities() {
         _player = ecs::entity_t{0};
-        _obstacles.clear();
-        _enemys.clear();
-        _elements.clear();
         _playerEntities.clear();
 
         auto &types = _registry.get_components<component::type>();
@@ -134,31 +177,70 @@ namespace game::scene {
                     }
                     break;
 
-                case component::entity_type::ENEMY:
-                    _enemys.push_back(entity);
-                    break;
-                case component::entity_type::RANDOM_ELEMENT:
-                    _elements.push_back(entity);
-                    break;
-                case component::entity_type::OBSTACLE:
-                    _obstacles.push_back(entity);
-                    break;
-
                 default:
                     break;
             }
         }
 
         std::cout << "[DEBUG] Indexed entities: "
-                << "Players=" << _playerEntities.size()
-                << ", Enemies=" << _enemys.size()
-                << ", Elements=" << _elements.size()
-                << ", Obstacles=" << _obstacles.size() << std::endl;
+                << "Players=" << _playerEntities.size() << std::endl;
     }
 
     void GameScene::load_projectile_textures() {
-        _projectileTextures["player_missile"] = _raylib.loadTexture(std::string(ASSETS_PATH) + "/sprites/r-typesheet1.png");
-        _projectileTextures["enemy_missile"] = _raylib.loadTexture(std::string(ASSETS_PATH) + "/sprites/r-typesheet1.png");
+        _projectileTextures["player_missile"] = make_sprite(std::string(ASSETS_PATH) + "/sprites/r-typesheet1.png");
+        _projectileTextures["enemy_missile"] = make_sprite(std::string(ASSETS_PATH) + "/sprites/r-typesheet1.png");
+    }
+
+    GameScene::EntitySprite GameScene::make_sprite(const std::string &path) {
+        if (const rendering::AtlasRegion *region = _atlas.find(path))
+            return {rendering::TextureHandle(), *region};
+        rendering::TextureHandle texture = _raylib.textures().acquire(path);
+        rendering::AtlasRegion region{texture.get(), {0.0f, 0.0f}};
+        return {std::move(texture), region};
+    }
+
+    void GameScene::build_level_atlas() {
+        auto &sprites = _registry.get_components<component::sprite>();
+        auto &types = _registry.get_components<component::type>();
+        std::vector<std::string> paths{std::string(ASSETS_PATH) + "/sprites/r-typesheet1.png"};
+
+        for (std::size_t i = 0; i < sprites.size(); ++i) {
+            if (!sprites[i] || sprites[i]->image_path.empty())
+                continue;
+            // Backgrounds are drawn with a source wider than their sheet and
+            // rely on the texture repeating: they keep a texture of their own.
+            if (i < types.size() && types[i] && types[i]->value == component::entity_type::BACKGROUND)
+                continue;
+            paths.push_back(sprites[i]->image_path);
+        }
+        for (auto const &kv : _enemySpriteMap)
+            paths.push_back(kv.second);
+        for (auto const &kv : _obstacleSpriteMap)
+            paths.push_back(kv.second);
+        for (auto const &kv : _elementSpriteMap)
+            paths.push_back(kv.second);
+
+        // Regions point into the old pages: drop them before the rebuild unloads those.
+        _entityTextures.clear();
+        _projectileTextures.clear();
+        _atlas.build(paths, [this](const std::string &path) { return _raylib.assets().takeImage(path); });
+        load_projectile_textures();
+    }
+
+    void GameScene::prefetch_level(int level) {
+        request_level_images(_raylib.assets(), level);
+    }
+
+    void GameScene::prefetch_start(Raylib &raylib) {
+        rendering::AssetStreamer &assets = raylib.assets();
+        request_level_images(assets, 1);
+        assets.requestImage(std::string(ASSETS_PATH) + "/sprites/r-typesheet1.png");
+        assets.requestTexture(std::string(ASSETS_PATH) + "/sprites/heart.png");
+        assets.requestTexture(std::string(ASSETS_PATH) + "/sprites/heart_empty.png");
+        assets.requestFont(std::string(ASSETS_PATH) + "/fonts/PressStart2P.ttf");
+        assets.requestSound(std::string(ASSETS_PATH) + "/sounds/shoot.wav");
+        assets.requestSound(std::string(ASSETS_PATH) + "/sounds/victory.wav");
+        assets.requestSound(std::string(ASSETS_PATH) + "/sounds/defeat.wav");
     }
 
     void GameScene::load_entity_textures() {
@@ -170,76 +252,48 @@ namespace game::scene {
         uint32_t localClientId = _game.getGameClient().clientId;
 
         for (std::size_t i = 0; i < sprites.size(); ++i) {
-            if (sprites[i]) {
-                if (!selectedSkin.empty() &&
-                    i < types.size() && types[i] &&
-                    types[i]->value == component::entity_type::PLAYER &&
-                    i < clientIds.size() && clientIds[i] &&
-                    clientIds[i]->id == localClientId &&
-                    sprites[i]->image_path != selectedSkin) {
-                    sprites[i]->image_path = selectedSkin;
-                }
-
-                if (sprites[i]->image_path.empty()) {
-                    continue;
-                }
-
-                ecs::entity_t entity = _registry.entity_from_index(i);
-                
-                if (_entityTextures.find(entity.value()) == _entityTextures.end()) {
-                    try {
-                        Texture2D texture = _raylib.loadTexture(sprites[i]->image_path);
-                        _entityTextures[entity.value()] = texture;
-                        std::cout << "[DEBUG] Loaded texture for entity " << entity.value()
-                                << " from " << sprites[i]->image_path << std::endl;
-                    } catch (const std::exception &e) {
-                        std::cerr << "[ERROR] Failed to load texture for entity " << entity.value()
-                                << " from " << sprites[i]->image_path << ": " << e.what() << std::endl;
-                    }
-                }
+            if (sprites[i] && !selectedSkin.empty() &&
+                i < types.size() && types[i] &&
+                types[i]->value == component::entity_type::PLAYER &&
+                i < clientIds.size() && clientIds[i] &&
+                clientIds[i]->id == localClientId) {
+                sprites[i]->image_path = selectedSkin;
             }
         }
+        build_level_atlas();
+
+        for (std::size_t i = 0; i < sprites.size(); ++i) {
+            if (!sprites[i] || sprites[i]->image_path.empty())
+                continue;
+            ecs::entity_t entity = _registry.entity_from_index(i);
+            _entityTextures.emplace(entity.value(), make_sprite(sprites[i]->image_path));
+        }
+        LOG_INFO("Level textures: " << _raylib.textures().stats() << ", atlas: " << _atlas.sheetCount()
+            << " sheets in " << _atlas.pageCount() << " page(s)");
     }
 
     void GameScene::unload_projectile_textures() {
-        for (auto &pair : _projectileTextures) {
-            _raylib.unloadTexture(pair.second);
-        }
         _projectileTextures.clear();
         std::cout << "[DEBUG] Unloaded all projectile textures" << std::endl;
     }
 
     void GameScene::unload_entity_textures() {
-        for (auto &pair : _entityTextures) {
-            _raylib.unloadTexture(pair.second);
-        }
         _entityTextures.clear();
         std::cout << "[DEBUG] Unloaded all entity textures" << std::endl;
     }
 
-    Texture2D* GameScene::get_entity_texture(ecs::entity_t entity) {
+    const rendering::AtlasRegion* GameScene::get_entity_texture(ecs::entity_t entity) {
         auto cachedIt = _entityTextures.find(entity.value());
         if (cachedIt != _entityTextures.end()) {
-            return &cachedIt->second;
+            return &cachedIt->second.region;
         }
 
         auto &sprites = _registry.get_components<component::sprite>();
         if (entity.value() < sprites.size() && sprites[entity.value()]) {
             const std::string &imagePath = sprites[entity.value()]->image_path;
             if (!imagePath.empty()) {
-                try {
-                    Texture2D texture = _raylib.loadTexture(imagePath);
-                    auto [insertIt, inserted] = _entityTextures.emplace(entity.value(), texture);
-                    if (inserted) {
-                        std::cout << "[DEBUG] Lazily loaded texture for entity "
-                                  << entity.value() << " from " << imagePath << std::endl;
-                    }
-                    return &insertIt->second;
-                } catch (const std::exception &e) {
-                    std::cerr << "[ERROR] Failed to lazily load texture for entity "
-                              << entity.value() << " from " << imagePath
-                              << ": " << e.what() << std::endl;
-                }
+                auto insertIt = _entityTextures.emplace(entity.value(), make_sprite(imagePath)).first;
+                return &insertIt->second.region;
             }
         }
         return nullptr;
@@ -248,82 +302,37 @@ namespace game::scene {
 void GameScene::update() {
     if (!_game_running) return;
 
-    std::unordered_map<uint32_t, std::tuple<float, float, float>> netPlayers;
-    std::unordered_map<uint32_t, std::string> skinSelections;
-    {
-        std::lock_guard<std::mutex> g(_game.getGameClient().stateMutex);
-        netPlayers = _game.getGameClient().players;
-        skinSelections = _game.getGameClient().playerSkins;
-    }
-
-    for (auto it = _playerEntities.begin(); it != _playerEntities.end(); ) {
-        if (netPlayers.find(it->first) == netPlayers.end()) {
-            _registry.kill_entity(it->second);
-            it = _playerEntities.erase(it);
-        } else {
-            ++it;
-        }
+    GameClient &client = _game.getGameClient();
+    const WorldState &world = client.world();
+    std::optional<GameClient::InputAck> inputAck;
+    if (world.inputAckCount != _inputAckCount) {
+        _inputAckCount = world.inputAckCount;
+        inputAck = world.inputAck;
     }
 
-    auto &positions = _registry.get_components<component::position>();
-    const std::string &selectedSkinPath = _game.getSelectedSkinPath();
-    uint32_t myClientId = _game.getGameClient().clientId;
-    const std::string assetsPlayerDir = std::string(ASSETS_PATH) + "/sprites/player/";
-    const std::string fallbackPlayerSkin = assetsPlayerDir + "r-typesheet42.png";
-    for (auto const &kv : netPlayers) {
-        uint32_t id = kv.first;
-        float x = std::get<0>(kv.second);
-        float y = std::get<1>(kv.second);
-        float z = std::get<2>(kv.second);
-        auto f = _playerEntities.find(id);
-        if (f == _playerEntities.end()) {
-            bool isLocalPlayer = (id == myClientId);
-            std::string spritePath = fallbackPlayerSkin;
-            auto skinIt = skinSelections.find(id);
-            if (skinIt != skinSelections.end() && !skinIt->second.empty()) {
-                spritePath = assetsPlayerDir + skinIt->second;
-            }
-            if (isLocalPlayer && !selectedSkinPath.empty()) {
-                spritePath = selectedSkinPath;
-            }
+    if (_worldResyncPending || world.firstEvent > _nextEvent)
+        resync_world(world);
+    else
+        apply_world_events(world);
+    client.acknowledgeEvents(_nextEvent);
 
-            ecs::entity_t e = game::entities::create_player(_registry, x, y, z, 32.f, 32.f, 0.f, spritePath, "", id);
-            _playerEntities.emplace(id, e);
-        } else {
-            ecs::entity_t e = f->second;
-            auto skinIt = skinSelections.find(id);
-            std::string desiredPath = fallbackPlayerSkin;
-            if (skinIt != skinSelections.end() && !skinIt->second.empty()) {
-                desiredPath = assetsPlayerDir + skinIt->second;
-            }
-            if (id == myClientId && !selectedSkinPath.empty()) {
-                desiredPath = selectedSkinPath;
-            }
-
-            auto &sprites = _registry.get_components<component::sprite>();
-            if (e.value() < sprites.size() && sprites[e.value()]) {
-                if (sprites[e.value()]->image_path != desiredPath && !desiredPath.empty()) {
-                    auto texIt = _entityTextures.find(e.value());
-                    if (texIt != _entityTextures.end()) {
-                        _raylib.unloadTexture(texIt->second);
-                        _entityTextures.erase(texIt);
-                    }
-                    sprites[e.value()]->image_path = desiredPath;
-                }
-            }
-
-            if (e.value() < positions.size() && positions[e.value()]) {
-                positions[e.value()]->x = x;
-                positions[e.value()]->y = y;
-                positions[e.value()]->z = z;
-            }
-        }
-    }
-    
+    uint32_t myClientId = client.clientId;
     auto myPlayerIt = _playerEntities.find(myClientId);
     if (myPlayerIt != _playerEntities.end())
         _player = myPlayerIt->second;
-    
+
+    collect_obstacle_boxes(world);
+    auto myNetIt = world.players.find(myClientId);
+    if (myNetIt == world.players.end()) {
+        _predictor.reset();
+    } else {
+        if (inputAck)
+            _predictor.reconcile(inputAck->sequence, inputAck->x, inputAck->y, _obstacleBoxes);
+        else
+            _predictor.seed(std::get<0>(myNetIt->second), std::get<1>(myNetIt->second));
+    }
+
+    auto &positions = _registry.get_components<component::position>();
     auto &pp = _registry.get_components<component::previous_position>();
     for (std::size_t i = 0; i < positions.size() && i < pp.size(); ++i) {
         if (positions[i] && pp[i]) {
@@ -333,256 +342,305 @@ void GameScene::update() {
         }
     }
 
-    std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, float, float>> netEnemies;
-    {
-        std::lock_guard<std::mutex> g(_game.getGameClient().stateMutex);
-        netEnemies = _game.getGameClient().enemies;
-    }
+    apply_interpolated_positions();
+    apply_predicted_position();
+    _registry.run_systems();
+}
 
-    for (auto it = _enemyMap.begin(); it != _enemyMap.end(); ) {
-        uint32_t serverId = it->first;
-        
-        if (netEnemies.find(serverId) == netEnemies.end()) {
-            ecs::entity_t clientEntity = it->second;
-            _registry.kill_entity(clientEntity);
-            _enemys.erase(
-                std::remove(_enemys.begin(), _enemys.end(), clientEntity),
-                _enemys.end()
-            );
-            it = _enemyMap.erase(it);
-        } else {
-            ++it;
+    void GameScene::resync_world(const WorldState &world) {
+        for (auto it = _playerEntities.begin(); it != _playerEntities.end(); ) {
+            if (world.players.find(it->first) == world.players.end()) {
+                _registry.kill_entity(it->second);
+                it = _playerEntities.erase(it);
+            } else {
+                ++it;
+            }
         }
+        std::vector<uint32_t> gone;
+        auto collectGone = [&gone](const ecs::entity_index<uint32_t> &index, const auto &netEntities) {
+            for (uint32_t serverId : index.keys()) {
+                if (netEntities.find(serverId) == netEntities.end())
+                    gone.push_back(serverId);
+            }
+        };
+        collectGone(_enemies, world.enemies);
+        for (uint32_t serverId : gone)
+            despawn_network_entity(snapshot::EntityKind::Enemy, serverId);
+        gone.clear();
+        collectGone(_obstacles, world.obstacles);
+        for (uint32_t serverId : gone)
+            despawn_network_entity(snapshot::EntityKind::Obstacle, serverId);
+        gone.clear();
+        collectGone(_elements, world.elements);
+        for (uint32_t serverId : gone)
+            despawn_network_entity(snapshot::EntityKind::Element, serverId);
+
+        for (auto const &kv : world.players)
+            sync_player(world, kv.first, kv.second);
+        for (auto const &kv : world.enemies)
+            sync_enemy(kv.first, kv.second);
+        for (auto const &kv : world.obstacles)
+            sync_obstacle(kv.first, kv.second);
+        for (auto const &kv : world.elements)
+            sync_element(kv.first, kv.second);
+
+        _nextEvent = world.endEvent();
+        _worldResyncPending = false;
     }
 
-    auto &velocities = _registry.get_components<component::velocity>();
-
-    for (auto const &kv : netEnemies) {
-        uint32_t serverId = kv.first;
-        float x = std::get<0>(kv.second);
-        float y = std::get<1>(kv.second);
-        float z = std::get<2>(kv.second);
-        float vx = std::get<3>(kv.second);
-        float vy = std::get<4>(kv.second);
-        float vz = std::get<5>(kv.second);
-        float width = std::get<6>(kv.second);
-        float height = std::get<7>(kv.second);
-        
-        auto it = _enemyMap.find(serverId);
-        
-        if (it == _enemyMap.end()) {
-            std::string spritePath = std::string(ASSETS_PATH) + "/sprites/ennemies/r-typesheet19.png";
-            
-            auto spriteIt = _enemySpriteMap.find(serverId);
-            if (spriteIt != _enemySpriteMap.end()) {
-                spritePath = spriteIt->second;
-            }
-            ecs::entity_t newEnemy = game::entities::create_enemy(_registry, x, y, z, spritePath, width, height);
-            _enemyMap.emplace(serverId, newEnemy);
-            _enemys.push_back(newEnemy);
-            if (newEnemy.value() < positions.size() && positions[newEnemy.value()]) {
-                positions[newEnemy.value()]->x = x;
-                positions[newEnemy.value()]->y = y;
-                positions[newEnemy.value()]->z = z;
-            }
-            if (newEnemy.value() < velocities.size() && velocities[newEnemy.value()]) {
-                velocities[newEnemy.value()]->vx = vx;
-                velocities[newEnemy.value()]->vy = vy;
-                velocities[newEnemy.value()]->vz = vz;
-            }
-        } else {
-            ecs::entity_t clientEnemy = it->second;
-            if (clientEnemy.value() < positions.size() && positions[clientEnemy.value()]) {
-                positions[clientEnemy.value()]->x = x;
-                positions[clientEnemy.value()]->y = y;
-                positions[clientEnemy.value()]->z = z;
+    void GameScene::apply_world_events(const WorldState &world) {
+        if (_nextEvent >= world.endEvent())
+            return;
+        for (std::size_t i = static_cast<std::size_t>(_nextEvent - world.firstEvent); i < world.events.size(); ++i) {
+            const WorldEvent &event = world.events[i];
+            if (event.type == WorldEvent::Type::Despawn) {
+                despawn_network_entity(event.kind, event.id);
+                continue;
             }
-            if (clientEnemy.value() < velocities.size() && velocities[clientEnemy.value()]) {
-                velocities[clientEnemy.value()]->vx = vx;
-                velocities[clientEnemy.value()]->vy = vy;
-                velocities[clientEnemy.value()]->vz = vz;
+            // Spawn and Update both bring the entity to its published state;
+            // an entity missing from the world was despawned by a later event.
+            switch (event.kind) {
+                case snapshot::EntityKind::Player: {
+                    auto it = world.players.find(event.id);
+                    if (it != world.players.end())
+                        sync_player(world, event.id, it->second);
+                    break;
+                }
+                case snapshot::EntityKind::Enemy: {
+                    auto it = world.enemies.find(event.id);
+                    if (it != world.enemies.end())
+                        sync_enemy(event.id, it->second);
+                    break;
+                }
+                case snapshot::EntityKind::Obstacle: {
+                    auto it = world.obstacles.find(event.id);
+                    if (it != world.obstacles.end())
+                        sync_obstacle(event.id, it->second);
+                    break;
+                }
+                case snapshot::EntityKind::Element: {
+                    auto it = world.elements.find(event.id);
+                    if (it != world.elements.end())
+                        sync_element(event.id, it->second);
+                    break;
+                }
+                default:
+                    break;
             }
         }
+        _nextEvent = world.endEvent();
     }
 
-    std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, float, float, float>> netObstacles;
-    {
-        std::lock_guard<std::mutex> g(_game.getGameClient().stateMutex);
-        netObstacles = _game.getGameClient().obstacles;
+    void GameScene::sync_player(const WorldState &world, uint32_t id, const std::tuple<float, float, float> &state) {
+        const std::string assetsPlayerDir = std::string(ASSETS_PATH) + "/sprites/player/";
+        const std::string &selectedSkinPath = _game.getSelectedSkinPath();
+        std::string spritePath = assetsPlayerDir + "r-typesheet42.png";
+        auto skinIt = world.playerSkins.find(id);
+        if (skinIt != world.playerSkins.end() && !skinIt->second.empty()) {
+            spritePath = assetsPlayerDir + skinIt->second;
+        }
+        if (id == _game.getGameClient().clientId && !selectedSkinPath.empty()) {
+            spritePath = selectedSkinPath;
+        }
+
+        float x = std::get<0>(state);
+        float y = std::get<1>(state);
+        float z = std::get<2>(state);
+        auto f = _playerEntities.find(id);
+        if (f == _playerEntities.end()) {
+            ecs::entity_t e = game::entities::create_player(_registry, x, y, z, 32.f, 32.f, 0.f, spritePath, "", id);
+            _playerEntities.emplace(id, e);
+            return;
+        }
+
+        ecs::entity_t e = f->second;
+        auto &sprites = _registry.get_components<component::sprite>();
+        if (e.value() < sprites.size() && sprites[e.value()]) {
+            if (sprites[e.value()]->image_path != spritePath) {
+                _entityTextures.erase(e.value());
+                sprites[e.value()]->image_path = spritePath;
+            }
+        }
+        auto &positions = _registry.get_components<component::position>();
+        if (e.value() < positions.size() && positions[e.value()]) {
+            positions[e.value()]->x = x;
+            positions[e.value()]->y = y;
+            positions[e.value()]->z = z;
+        }
     }
 
-    for (auto it = _obstacleMap.begin(); it != _obstacleMap.end(); ) {
-        uint32_t serverId = it->first;
-        
-        if (netObstacles.find(serverId) == netObstacles.end()) {
-            ecs::entity_t clientEntity = it->second;
-            _registry.kill_entity(clientEntity);
-            _obstacles.erase(
-                std::remove(_obstacles.begin(), _obstacles.end(), clientEntity),
-                _obstacles.end()
-            );
-            it = _obstacleMap.erase(it);
-        } else {
-            ++it;
+    void GameScene::sync_enemy(uint32_t id, const std::tuple<float, float, float, float, float, float, float, float> &state) {
+        auto [x, y, z, vx, vy, vz, width, height] = state;
+        const ecs::entity_t *found = _enemies.find(id);
+        ecs::entity_t enemy = found ? *found : ecs::entity_t{0};
+        if (!found) {
+            std::string spritePath = std::string(ASSETS_PATH) + "/sprites/ennemies/r-typesheet19.png";
+            auto spriteIt = _enemySpriteMap.find(id);
+            if (spriteIt != _enemySpriteMap.end()) {
+                spritePath = spriteIt->second;
+            }
+            enemy = game::entities::create_enemy(_registry, x, y, z, spritePath, width, height);
+            _enemies.insert(id, enemy);
+        }
+
+        auto &positions = _registry.get_components<component::position>();
+        auto &velocities = _registry.get_components<component::velocity>();
+        if (enemy.value() < positions.size() && positions[enemy.value()]) {
+            positions[enemy.value()]->x = x;
+            positions[enemy.value()]->y = y;
+            positions[enemy.value()]->z = z;
+        }
+        if (enemy.value() < velocities.size() && velocities[enemy.value()]) {
+            velocities[enemy.value()]->vx = vx;
+            velocities[enemy.value()]->vy = vy;
+            velocities[enemy.value()]->vz = vz;
         }
     }
 
-    for (auto const &kv : netObstacles) {
-        uint32_t serverId = kv.first;
-        float x = std::get<0>(kv.second);
-        float y = std::get<1>(kv.second);
-        float z = std::get<2>(kv.second);
-        float width = std::get<3>(kv.second);
-        float height = std::get<4>(kv.second);
-        float depth = std::get<5>(kv.second);
-        float vx = std::get<6>(kv.second);
-        float vy = std::get<7>(kv.second);
-        float vz = std::get<8>(kv.second);
-        
-        auto it = _obstacleMap.find(serverId);
-        
-        if (it == _obstacleMap.end()) {
+    void GameScene::sync_obstacle(uint32_t id, const std::tuple<float, float, float, float, float, float, float, float, float> &state) {
+        auto [x, y, z, width, height, depth, vx, vy, vz] = state;
+        auto &positions = _registry.get_components<component::position>();
+        auto &velocities = _registry.get_components<component::velocity>();
+        const ecs::entity_t *found = _obstacles.find(id);
+        ecs::entity_t obstacle = found ? *found : ecs::entity_t{0};
+        if (!found) {
             std::string spritePath = std::string(ASSETS_PATH) + "/sprites/obstacles/default_obstacle.png";
-            
-            auto spriteIt = _obstacleSpriteMap.find(serverId);
+            auto spriteIt = _obstacleSpriteMap.find(id);
             if (spriteIt != _obstacleSpriteMap.end()) {
                 spritePath = spriteIt->second;
             }
-            
-            ecs::entity_t newObstacle = game::entities::create_obstacle(
-                _registry, x, y, z, spritePath, "", vx, width, height
-            );
-            
-            _obstacleMap.emplace(serverId, newObstacle);
-            _obstacles.push_back(newObstacle);
-            
-            if (newObstacle.value() < positions.size() && positions[newObstacle.value()]) {
-                positions[newObstacle.value()]->x = x;
-                positions[newObstacle.value()]->y = y;
-                positions[newObstacle.value()]->z = z;
-            }
-            if (newObstacle.value() < velocities.size() && velocities[newObstacle.value()]) {
-                velocities[newObstacle.value()]->vx = vx;
-                velocities[newObstacle.value()]->vy = vy;
-                velocities[newObstacle.value()]->vz = vz;
-            }
-        } else {
-            ecs::entity_t clientObstacle = it->second;
-
-            if (clientObstacle.value() < velocities.size() && velocities[clientObstacle.value()]) {
-                velocities[clientObstacle.value()]->vx = vx;
-                velocities[clientObstacle.value()]->vy = vy;
-                velocities[clientObstacle.value()]->vz = vz;
+            obstacle = game::entities::create_obstacle(_registry, x, y, z, spritePath, "", vx, width, height);
+            _obstacles.insert(id, obstacle);
+            if (obstacle.value() < positions.size() && positions[obstacle.value()]) {
+                positions[obstacle.value()]->x = x;
+                positions[obstacle.value()]->y = y;
+                positions[obstacle.value()]->z = z;
             }
         }
-    }
-
-       std::unordered_map<uint32_t, std::tuple<float, float, float, float, float, float, float, float>> netElements;
-    {
-        std::lock_guard<std::mutex> g(_game.getGameClient().stateMutex);
-        netElements = _game.getGameClient().elements;
-    }
 
-    if (!netElements.empty() && _elementMap.empty()) {
-        std::cout << "[DEBUG] Received " << netElements.size() << " elements from network" << std::endl;
-    }
-
-    for (auto it = _elementMap.begin(); it != _elementMap.end(); ) {
-        uint32_t serverId = it->first;
-        
-        if (netElements.find(serverId) == netElements.end()) {
-            ecs::entity_t clientEntity = it->second;
-            std::cout << "[DEBUG] Removing element serverId=" << serverId << std::endl;
-            _registry.kill_entity(clientEntity);
-            _elements.erase(
-                std::remove(_elements.begin(), _elements.end(), clientEntity),
-                _elements.end()
-            );
-            it = _elementMap.erase(it);
-        } else {
-            ++it;
+        // Positions of existing obstacles come from the interpolated snapshots.
+        if (obstacle.value() < velocities.size() && velocities[obstacle.value()]) {
+            velocities[obstacle.value()]->vx = vx;
+            velocities[obstacle.value()]->vy = vy;
+            velocities[obstacle.value()]->vz = vz;
         }
     }
 
-    for (auto const &kv : netElements) {
-        uint32_t serverId = kv.first;
-        float x = std::get<0>(kv.second);
-        float y = std::get<1>(kv.second);
-        float z = std::get<2>(kv.second);
-        float vx = std::get<3>(kv.second);
-        float vy = std::get<4>(kv.second);
-        float vz = std::get<5>(kv.second);
-        float width = std::get<6>(kv.second);
-        float height = std::get<7>(kv.second);
-        
-        auto it = _elementMap.find(serverId);
-        
-        if (it == _elementMap.end()) {
+    void GameScene::sync_element(uint32_t id, const std::tuple<float, float, float, float, float, float, float, float> &state) {
+        auto [x, y, z, vx, vy, vz, width, height] = state;
+        const ecs::entity_t *found = _elements.find(id);
+        ecs::entity_t element = found ? *found : ecs::entity_t{0};
+        if (!found) {
             std::string spritePath = "";
-
-            auto spriteIt = _elementSpriteMap.find(serverId);
+            auto spriteIt = _elementSpriteMap.find(id);
             if (spriteIt != _elementSpriteMap.end()) {
                 spritePath = spriteIt->second;
             }
-            
-            ecs::entity_t newElement = game::entities::create_random_element(
+            element = game::entities::create_random_element(
                 _registry, x, y, z, spritePath, width, height, "powerup", 0.0f
             );
+            _entityTextures.erase(element.value());
+            _elements.insert(id, element);
+        }
 
-            auto texIt = _entityTextures.find(newElement.value());
-            if (texIt != _entityTextures.end()) {
-                std::cout << "[DEBUG] Clearing old texture for entity " << newElement.value() << std::endl;
-                _raylib.unloadTexture(texIt->second);
-                _entityTextures.erase(texIt);
-            }
-            
-            _elementMap.emplace(serverId, newElement);
-            _elements.push_back(newElement);
-                
-            if (newElement.value() < positions.size() && positions[newElement.value()]) {
-                positions[newElement.value()]->x = x;
-                positions[newElement.value()]->y = y;
-                positions[newElement.value()]->z = z;
-            }
-            if (newElement.value() < velocities.size() && velocities[newElement.value()]) {
-                velocities[newElement.value()]->vx = vx;
-                velocities[newElement.value()]->vy = vy;
-                velocities[newElement.value()]->vz = vz;
+        auto &positions = _registry.get_components<component::position>();
+        auto &velocities = _registry.get_components<component::velocity>();
+        if (element.value() < positions.size() && positions[element.value()]) {
+            positions[element.value()]->x = x;
+            positions[element.value()]->y = y;
+            positions[element.value()]->z = z;
+        }
+        if (element.value() < velocities.size() && velocities[element.value()]) {
+            velocities[element.value()]->vx = vx;
+            velocities[element.value()]->vy = vy;
+            velocities[element.value()]->vz = vz;
+        }
+    }
+
+    void GameScene::despawn_network_entity(snapshot::EntityKind kind, uint32_t id) {
+        std::optional<ecs::entity_t> entity;
+        switch (kind) {
+            case snapshot::EntityKind::Player: {
+                auto it = _playerEntities.find(id);
+                if (it != _playerEntities.end()) {
+                    entity = it->second;
+                    _playerEntities.erase(it);
+                }
+                break;
             }
-        } else {
-            ecs::entity_t clientElement = it->second;
-            if (clientElement.value() < positions.size() && positions[clientElement.value()]) {
-                positions[clientElement.value()]->x = x;
-                positions[clientElement.value()]->y = y;
-                positions[clientElement.value()]->z = z;
+            case snapshot::EntityKind::Enemy: entity = _enemies.erase(id); break;
+            case snapshot::EntityKind::Obstacle: entity = _obstacles.erase(id); break;
+            case snapshot::EntityKind::Element:
+                entity = _elements.erase(id);
+                if (entity)
+                    std::cout << "[DEBUG] Removing element serverId=" << id << std::endl;
+                break;
+            default: break;
+        }
+        if (entity)
+            _registry.kill_entity(*entity);
+    }
+
+    void GameScene::apply_interpolated_positions() {
+        _game.getGameClient().interpolation.sample(snapshot::InterpolationBuffer::now(), _interpolated);
+
+        auto &positions = _registry.get_components<component::position>();
+        for (const auto &state : _interpolated) {
+            const ecs::entity_t *entity = nullptr;
+            switch (state.kind) {
+                case snapshot::EntityKind::Player: {
+                    auto it = _playerEntities.find(state.id);
+                    if (it != _playerEntities.end())
+                        entity = &it->second;
+                    break;
+                }
+                case snapshot::EntityKind::Enemy: entity = _enemies.find(state.id); break;
+                case snapshot::EntityKind::Obstacle: entity = _obstacles.find(state.id); break;
+                case snapshot::EntityKind::Element: entity = _elements.find(state.id); break;
+                default: break;
             }
-            if (clientElement.value() < velocities.size() && velocities[clientElement.value()]) {
-                velocities[clientElement.value()]->vx = vx;
-                velocities[clientElement.value()]->vy = vy;
-                velocities[clientElement.value()]->vz = vz;
+            if (!entity)
+                continue;
+            std::size_t index = entity->value();
+            if (index < positions.size() && positions[index]) {
+                positions[index]->x = state.x;
+                positions[index]->y = state.y;
+                positions[index]->z = state.z;
             }
         }
     }
-    float dt = _raylib.getFrameTime();
-    std::lock_guard<std::mutex> g(_game.getGameClient().stateMutex);
-    for (auto &kv : _game.getGameClient().projectiles) {
-        float &x = std::get<0>(kv.second);
-        float &y = std::get<1>(kv.second);
-        float vx = std::get<3>(kv.second);
-        float vy = std::get<4>(kv.second);
-        x += vx * dt;
-        y += vy * dt;
+
+    void GameScene::collect_obstacle_boxes(const WorldState &world) {
+        auto &hitboxes = _registry.get_components<component::collision_box>();
+
+        // The entities are drawn INTERPOLATION_DELAY in the past; the server
+        // moves the player against the obstacles where they are now, and the
+        // newest snapshot is the closest to that.
+        _obstacleBoxes.clear();
+        for (const auto &[id, state] : world.obstacles) {
+            const ecs::entity_t *obstacle = _obstacles.find(id);
+            if (!obstacle)
+                continue;
+            std::size_t index = obstacle->value();
+            if (index >= hitboxes.size() || !hitboxes[index])
+                continue;
+            _obstacleBoxes.push_back({std::get<0>(state), std::get<1>(state), hitboxes[index]->width, hitboxes[index]->height});
+        }
     }
-    for (auto &kv : _game.getGameClient().enemyProjectiles) {
-        float &x = std::get<0>(kv.second);
-        float &y = std::get<1>(kv.second);
-        float vx = std::get<3>(kv.second);
-        float vy = std::get<4>(kv.second);
-        x += vx * dt;
-        y += vy * dt;
+
+    void GameScene::apply_predicted_position() {
+        if (!_predictor.has_position())
+            return;
+        auto it = _playerEntities.find(_game.getGameClient().clientId);
+        if (it == _playerEntities.end())
+            return;
+        auto &positions = _registry.get_components<component::position>();
+        std::size_t index = it->second.value();
+        if (index < positions.size() && positions[index]) {
+            positions[index]->x = _predictor.x();
+            positions[index]->y = _predictor.y();
+        }
     }
-    _registry.run_systems();
-}
 
     void GameScene::clearLevelEntitiesForReload() {
         auto &types = _registry.get_components<component::type>();
@@ -607,18 +665,11 @@ void GameScene::update() {
         }
 
         for (auto entity : toKill) {
-            auto texIt = _entityTextures.find(entity.value());
-            if (texIt != _entityTextures.end()) {
-                _raylib.unloadTexture(texIt->second);
-                _entityTextures.erase(texIt);
-            }
+            _entityTextures.erase(entity.value());
             _registry.kill_entity(entity);
         }
 
-        _enemyMap.clear();
-        _obstacleMap.clear();
-        _elementMap.clear();
-        _enemys.clear();
+        _enemies.clear();
         _obstacles.clear();
         _elements.clear();
         _playerEntities.clear();
@@ -637,54 +688,35 @@ void GameScene::update() {
         }
 
         for (auto entity : toKill) {
-            auto texIt = _entityTextures.find(entity.value());
-            if (texIt != _entityTextures.end()) {
-                _raylib.unloadTexture(texIt->second);
-                _entityTextures.erase(texIt);
-            }
+            _entityTextures.erase(entity.value());
             _registry.kill_entity(entity);
         }
     }
 
-    void GameScene::buildSpriteMapsFromRegistry(const nlohmann::json &registryJson) {
+    void GameScene::buildSpriteMapsFromRegistry(const game::serializer::RegistrySnapshot &snapshot) {
+        using game::serializer::SnapshotComponent;
+
         _enemySpriteMap.clear();
         _obstacleSpriteMap.clear();
         _elementSpriteMap.clear();
 
-        if (registryJson.is_null())
-            return;
-
-        const nlohmann::json &entities = registryJson.contains("entities")
-            ? registryJson.at("entities")
-            : registryJson;
-
-        if (!entities.is_array())
-            return;
-
-        for (const auto &entity : entities) {
-            if (!entity.contains("entity_id") || !entity.contains("type"))
-                continue;
-
-            uint32_t serverEntityId = entity.at("entity_id").get<uint32_t>();
-            int typeValue = entity.at("type").get<int>();
-            auto imageIt = entity.find("image_path");
-            if (imageIt == entity.end() || !imageIt->is_string())
+        for (const auto &entity : snapshot.entities) {
+            if (!entity.has(SnapshotComponent::type) || !entity.has(SnapshotComponent::sprite)
+                || entity.sprite.image_path.empty())
                 continue;
 
-            std::string imagePath = imageIt->get<std::string>();
+            uint32_t serverEntityId = entity.entity_id;
+            const std::string &imagePath = entity.sprite.image_path;
 
-            switch (static_cast<component::entity_type>(typeValue)) {
+            switch (entity.type.value) {
                 case component::entity_type::ENEMY:
-                    if (!imagePath.empty())
-                        _enemySpriteMap[serverEntityId] = normalizeNetworkAssetPath(imagePath);
+                    _enemySpriteMap[serverEntityId] = normalizeNetworkAssetPath(imagePath);
                     break;
                 case component::entity_type::OBSTACLE:
-                    if (!imagePath.empty())
-                        _obstacleSpriteMap[serverEntityId] = normalizeNetworkAssetPath(imagePath);
+                    _obstacleSpriteMap[serverEntityId] = normalizeNetworkAssetPath(imagePath);
                     break;
                 case component::entity_type::RANDOM_ELEMENT:
-                    if (!imagePath.empty())
-                        _elementSpriteMap[serverEntityId] = normalizeNetworkAssetPath(imagePath);
+                    _elementSpriteMap[serverEntityId] = normalizeNetworkAssetPath(imagePath);
                     break;
                 default:
                     break;
@@ -697,18 +729,22 @@ void GameScene::update() {
         if (!registryOpt.has_value())
             return false;
 
-        const nlohmann::json &fullRegistry = registryOpt.value();
+        const game::serializer::RegistrySnapshot &fullRegistry = registryOpt.value();
 
-        if (_hasLevelData) {
+        if (_hasLevelData)
             clearLevelEntitiesForReload();
-            game::serializer::deserialize_entities(_registry, fullRegistry);
-        }
+        game::serializer::restore_snapshot(_registry, fullRegistry);
 
         buildSpriteMapsFromRegistry(fullRegistry);
         removeEntitiesOfType(component::entity_type::ENEMY);
         removeEntitiesOfType(component::entity_type::OBSTACLE);
         load_entity_textures();
         index_existing_entities();
+        _worldResyncPending = true;
+        if (_level == 0 || _levelReloadPending) {
+            _level = _level == 0 ? 1 : level_after(_level);
+            prefetch_level(level_after(_level));
+        }
         _hasLevelData = true;
         return true;
     }
@@ -753,13 +789,8 @@ void GameScene::update() {
         update();
         float deltaTime = _raylib.getFrameTime();
         _chat.update(deltaTime);
-        int globalScore = 0;
-        uint32_t myClientId = 0;
-        {
-            std::lock_guard<std::mutex> g(_game.getGameClient().stateMutex);
-            globalScore = _game.getGameClient().globalScore;
-            myClientId = _game.getGameClient().clientId;
-        }
+        int globalScore = _game.getGameClient().world().globalScore;
+        uint32_t myClientId = _game.getGameClient().clientId;
         const auto &weaponDef = weapon::getDefinition(_game.getSelectedWeaponId());
         float progress = std::clamp(globalScore / 150.0f, 0.0f, 1.0f);
         float SHOOT_COOLDOWN = weaponDef.fireCooldown - progress * (weaponDef.fireCooldown - weaponDef.minCooldown);
@@ -781,6 +812,9 @@ void GameScene::update() {
             case KEY_F11:
                 toggleFullScreen();
                 break;
+            case KEY_F3:
+                _showRenderStats = !_showRenderStats;
+                break;
             default:
                 break;
         }
@@ -794,7 +828,7 @@ void GameScene::update() {
                 _chat.removeLastCharacter();
             } else if (keyPressed == KEY_ESCAPE) {
                 _chat.toggleFocus();
-                dispatch_input_events(false, false, false, false);
+                predict_movement(false, false, false, false, deltaTime);
                 if (myClientId != 0) {
                     moovePlayer[myClientId] = 0.0f;
                 }
@@ -806,7 +840,7 @@ void GameScene::update() {
                 _chat.appendCharacter(codepoint);
             }
 
-            dispatch_input_events(false, false, false, false);
+            predict_movement(false, false, false, false, deltaTime);
             if (myClientId != 0) {
                 moovePlayer[myClientId] = 0.0f;
             }
@@ -844,12 +878,9 @@ void GameScene::update() {
             handle_shoot(weaponDef, SHOOT_COOLDOWN);
         }
 
-        dispatch_input_events(upPressed, downPressed, leftPressed, rightPressed);
+        predict_movement(upPressed, downPressed, leftPressed, rightPressed, deltaTime);
 
-        float input_x = 0.f;
         float input_y = 0.f;
-        if (leftPressed != rightPressed)
-            input_x = leftPressed ? -1.f : 1.f;
         if (upPressed != downPressed)
             input_y = upPressed ? -1.f : 1.f;
 
@@ -861,8 +892,6 @@ void GameScene::update() {
             else
                 moovePlayer[myClientId] = 0.0f;
         }
-
-        handle_input(input_x, input_y);
     }
 
     void GameScene::handle_shoot(const weapon::WeaponDefinition &weaponDef, float cooldown) {
@@ -927,64 +956,42 @@ void GameScene::update() {
         }
     }
 
-    void GameScene::handle_input(float input_x, float input_y) {
-        if (_isDead)
-            return;
-        auto &positions = _registry.get_components<component::position>();
-        auto &controls  = _registry.get_components<component::controllable>();
-        auto &hitboxes  = _registry.get_components<component::collision_box>();
-        uint32_t myClientId = _game.getGameClient().clientId;
-        auto myPlayerIt = _playerEntities.find(myClientId);
-        if (myPlayerIt == _playerEntities.end())
-            return;
+    void GameScene::predict_movement(bool upPressed, bool downPressed, bool leftPressed, bool rightPressed, float deltaTime) {
+        constexpr int MAX_STEPS_PER_FRAME = 5;
+        uint8_t buttons = 0;
 
-        ecs::entity_t myPlayer = myPlayerIt->second;
-
-        if (myPlayer.value() < positions.size() && positions[myPlayer.value()] &&
-            myPlayer.value() < controls.size() && controls[myPlayer.value()]) {
-            float speed = controls[myPlayer.value()]->speed;
-            float dt = 0.016f;
-
-            ecs::entity_t playerHitbox = collision::find_player_hitbox(*this);
-            if (playerHitbox.value() < hitboxes.size() && hitboxes[playerHitbox.value()]) {
-                auto &playerPos = *positions[myPlayer.value()];
-                auto &playerBox = *hitboxes[playerHitbox.value()];
-                float ix = input_x;
-                float iy = input_y;
-                float testX = playerPos.x + ix * speed * dt;
-                float testY = playerPos.y + iy * speed * dt;
-
-                if (collision::is_blocked(*this, testX, playerPos.y, playerPos, playerBox))
-                    ix = 0.f;
-                if (collision::is_blocked(*this, playerPos.x, testY, playerPos, playerBox))
-                    iy = 0.f;
-                if (ix != 0.f || iy != 0.f) {
-                    playerPos.x += ix * speed * dt;
-                    playerPos.y += iy * speed * dt;
-                }
-            }
+        if (!_isDead) {
+            buttons |= upPressed ? movement::Up : 0;
+            buttons |= downPressed ? movement::Down : 0;
+            buttons |= leftPressed ? movement::Left : 0;
+            buttons |= rightPressed ? movement::Right : 0;
         }
-    }
 
-    void GameScene::dispatch_input_events(bool upPressed, bool downPressed, bool leftPressed, bool rightPressed) {
-        auto sendIfChanged = [this](InputCode code, bool newState, bool &cachedState) {
-            if (newState == cachedState)
-                return;
-            cachedState = newState;
-            _game.getGameClient().sendInputEvent(code, newState);
-        };
-
-        sendIfChanged(InputCode::Up, upPressed, _inputState.up);
-        sendIfChanged(InputCode::Down, downPressed, _inputState.down);
-        sendIfChanged(InputCode::Left, leftPressed, _inputState.left);
-        sendIfChanged(InputCode::Right, rightPressed, _inputState.right);
+        _inputAccumulator += deltaTime;
+        if (_inputAccumulator < movement::STEP_SECONDS)
+            return;
+        for (int i = 0; i < MAX_STEPS_PER_FRAME && _inputAccumulator >= movement::STEP_SECONDS; ++i) {
+            _inputAccumulator -= movement::STEP_SECONDS;
+            if (buttons && _predictor.has_position())
+                _predictor.apply(buttons, _obstacleBoxes);
+            if (_predictor.has_unacked()) {
+                uint8_t commands[INPUT_REDUNDANCY];
+                uint32_t sequence = 0;
+                std::size_t count = _predictor.unacked(sequence, commands, INPUT_REDUNDANCY);
+                _game.getGameClient().sendInputCommands(sequence, commands, count);
+            }
+        }
+        // After a long frame, drop the time that could not be stepped instead of catching up later.
+        if (_inputAccumulator >= movement::STEP_SECONDS)
+            _inputAccumulator = 0.f;
+        apply_predicted_position();
     }
 
     void GameScene::setup_movement_system() {
-        _registry.add_system<component::position, component::velocity>(
+        _registry.add_system(ecs::reads<component::velocity>{}, ecs::writes<component::position>{},
             [](ecs::registry &reg,
-               ecs::sparse_array<component::position> &pos,
-               ecs::sparse_array<component::velocity> &vel) {
+               ecs::sparse_array<component::velocity> const &vel,
+               ecs::sparse_array<component::position> &pos) {
                 float dt = 0.016f;
                 for (std::size_t i = 0; i < pos.size() && i < vel.size(); ++i) {
                     if (pos[i] && vel[i]) {
@@ -997,10 +1004,10 @@ void GameScene::update() {
     }
 
     void GameScene::setup_render_system() {
-        _registry.add_system<component::position, component::drawable>(
+        _registry.add_system(ecs::reads<component::position, component::drawable>{}, ecs::writes<>{},
             [this](ecs::registry &reg,
-                   ecs::sparse_array<component::position> &pos,
-                   ecs::sparse_array<component::drawable> &drw) {
+                   ecs::sparse_array<component::position> const &pos,
+                   ecs::sparse_array<component::drawable> const &drw) {
             });
     }
 
@@ -1048,5 +1055,8 @@ void GameScene::update() {
         _ui.unload();
         unload_entity_textures();
         unload_projectile_textures();
+        _atlas.clear();
+        _raylib.assets().clear();
+        LOG_INFO("Textures after the game: " << _raylib.textures().stats());
     }
 } // namespace game::scene
@@ -7,15 +7,21 @@
 
 #pragma once
 
+#include <optional>
 #include <unordered_map>
-#include <nlohmann/json_fwd.hpp>
 #include "UI.hpp"
 #include "../Game.hpp"
 #include "ChatSystem.hpp"
 #include "../../Engine/Rendering/scene/Include/AScene.hpp"
+#include "../../Engine/Core/Include/entity_index.hpp"
 #include "../../Engine/Core/Entities/Include/components.hpp"
+#include "../../Engine/Utils/Include/registry_snapshot.hpp"
 #include "../../Shared/protocol.hpp"
+#include "../../Shared/Snapshot.hpp"
+#include "../../Shared/PlayerMovement.hpp"
 #include "../../Shared/WeaponDefinition.hpp"
+#include "../../Engine/Rendering/SpriteBatch.hpp"
+#include "../../Engine/Rendering/TextureAtlas.hpp"
 
 namespace game::scene {
     /**
@@ -65,6 +71,14 @@ namespace game::scene {
          */
         void onClose() override;
 
+        /**
+         * @brief Start decoding what the game loads first (first level, sounds,
+         *        HUD), so that opening the scene does not read it all at once.
+         *        Called by the waiting room while players get ready.
+         * @param raylib Any Raylib wrapper: the asset streamer is shared.
+         */
+        static void prefetch_start(Raylib &raylib);
+
         // --- Event handling ---
         /**
          * @brief Handle shooting action from the player.
@@ -73,13 +87,6 @@ namespace game::scene {
          */
         void handle_shoot(const weapon::WeaponDefinition &weaponDef, float cooldown);
 
-        /**
-         * @brief Handle movement input from the player.
-         * @param input_x Horizontal input (-1.0 to 1.0).
-         * @param input_y Vertical input (-1.0 to 1.0).
-         */
-        void handle_input(float input_x, float input_y);
-
         // --- Accessors ---
         /**
          * @brief Get the ECS registry.
@@ -97,7 +104,7 @@ namespace game::scene {
          * @brief Get the current obstacles in the scene.
          * @return Vector of obstacle entity IDs.
          */
-        const std::vector<ecs::entity_t> &get_obstacles() const { return _obstacles; }
+        const std::vector<ecs::entity_t> &get_obstacles() const { return _obstacles.entities(); }
 
         /**
          * @brief Get the main Game instance.
@@ -106,13 +113,6 @@ namespace game::scene {
         Game &getGame() { return _game; }
 
     private:
-        struct InputState {
-            bool up{false};    ///< Is up key pressed
-            bool down{false};  ///< Is down key pressed
-            bool left{false};  ///< Is left key pressed
-            bool right{false}; ///< Is right key pressed
-        } _inputState;
-
         // --- Game logic ---
         /**
          * @brief Update the game state; called every frame.
@@ -204,11 +204,41 @@ namespace game::scene {
         void unload_projectile_textures();
 
         /**
-         * @brief Get the texture associated with a given entity.
-         * @param entity Entity to get texture for.
-         * @return Pointer to Texture2D or nullptr if not found.
+         * @brief Get the sprite sheet associated with a given entity.
+         * @param entity Entity to get the sheet for.
+         * @return Pointer to its region, or nullptr if the entity has no sprite.
+         */
+        const rendering::AtlasRegion* get_entity_texture(ecs::entity_t entity);
+
+        /**
+         * @brief Sprite sheet for an image: its place in the level atlas,
+         *        or its own texture when it was not packed.
+         */
+        struct EntitySprite {
+            rendering::TextureHandle texture; ///< Empty when the sheet is in the atlas.
+            rendering::AtlasRegion region;
+        };
+
+        /**
+         * @brief Look an image up in the atlas, loading it on its own otherwise.
          */
-        Texture2D* get_entity_texture(ecs::entity_t entity);
+        EntitySprite make_sprite(const std::string &path);
+
+        /**
+         * @brief Pack every sprite sheet of the level, plus the projectile sheet, in one atlas.
+         *
+         * Background sheets are left out: render_background() samples past
+         * their edges, which only wraps on a texture of their own.
+         */
+        void build_level_atlas();
+
+        /**
+         * @brief Start decoding the images of a level on the asset streamer:
+         *        sprite sheets for build_level_atlas() to take when the level
+         *        arrives, backgrounds for pump() to upload to the texture cache.
+         * @param level Number of the level file.
+         */
+        void prefetch_level(int level);
 
         /**
          * @brief Process a full ECS registry received from the network.
@@ -228,10 +258,10 @@ namespace game::scene {
         void removeEntitiesOfType(component::entity_type type);
 
         /**
-         * @brief Build sprite maps from a JSON representation of the registry.
-         * @param registryJson JSON object representing the registry.
+         * @brief Build sprite maps from the full registry sent by the server.
+         * @param snapshot Decoded full registry.
          */
-        void buildSpriteMapsFromRegistry(const nlohmann::json &registryJson);
+        void buildSpriteMapsFromRegistry(const game::serializer::RegistrySnapshot &snapshot);
 
         /**
          * @brief Toggle fullscreen mode for the game window.
@@ -319,6 +349,55 @@ namespace game::scene {
          */
         void render_network_projectiles();
 
+        /**
+         * @brief Rebuild the networked entities from the whole published world.
+         *
+         * Runs when the scene starts, after a level reload, and when the
+         * network dropped events the scene did not consume in time.
+         * Skips the events already reflected by @p world.
+         */
+        void resync_world(const WorldState &world);
+
+        /**
+         * @brief Apply the entity events published since the last frame.
+         *
+         * Costs one lookup per event: entities that did not change are not visited.
+         */
+        void apply_world_events(const WorldState &world);
+
+        /**
+         * @brief Create or update the entity of a networked player.
+         */
+        void sync_player(const WorldState &world, uint32_t id, const std::tuple<float, float, float> &state);
+
+        /**
+         * @brief Create or update the entity of a networked enemy.
+         */
+        void sync_enemy(uint32_t id, const std::tuple<float, float, float, float, float, float, float, float> &state);
+
+        /**
+         * @brief Create an obstacle entity, or update its velocity.
+         */
+        void sync_obstacle(uint32_t id, const std::tuple<float, float, float, float, float, float, float, float, float> &state);
+
+        /**
+         * @brief Create or update the entity of a networked random element.
+         */
+        void sync_element(uint32_t id, const std::tuple<float, float, float, float, float, float, float, float> &state);
+
+        /**
+         * @brief Kill the entity of a networked entity, if it has one.
+         */
+        void despawn_network_entity(snapshot::EntityKind kind, uint32_t id);
+
+        /**
+         * @brief Move networked entities to their interpolated snapshot positions.
+         *
+         * Samples GameClient::interpolation into _interpolated, which the
+         * projectile renderers then read, so no network lock is taken.
+         */
+        void apply_interpolated_positions();
+
         /**
          * @brief Render enemy projectiles received from the network.
          */
@@ -339,6 +418,11 @@ namespace game::scene {
          */
         void render_final_win_screen();
 
+        /**
+         * @brief Draw FPS, sprites, draw calls and texture binds of the last frame.
+         */
+        void render_stats_overlay();
+
         /**
          * @brief Get a unique color associated with a client ID.
          * @param id Client ID.
@@ -347,9 +431,27 @@ namespace game::scene {
         Color get_color_for_id(uint32_t id);
 
         /**
-         * @brief Dispatch input events to the InputState struct.
+         * @brief Turn held directions into movement commands, predicted locally and sent to the server.
+         *
+         * One command is made per movement::STEP_SECONDS of frame time while
+         * a direction is held. Commands the server has not acked yet are sent
+         * again every step, so the last ones of a move survive packet loss.
+         *
+         * @param deltaTime Duration of the frame, in seconds.
+         */
+        void predict_movement(bool upPressed, bool downPressed, bool leftPressed, bool rightPressed, float deltaTime);
+
+        /**
+         * @brief Rebuild _obstacleBoxes from the newest snapshot positions of the obstacles,
+         *        not their interpolated entities.
+         * @param world Latest world state published by the network thread.
+         */
+        void collect_obstacle_boxes(const WorldState &world);
+
+        /**
+         * @brief Move the local player entity to its predicted position.
          */
-        void dispatch_input_events(bool upPressed, bool downPressed, bool leftPressed, bool rightPressed);
+        void apply_predicted_position();
 
         // --- Game state ---
         ecs::entity_t _player; ///< Local player entity.
@@ -359,26 +461,34 @@ namespace game::scene {
         Sound _defeatSound; ///< Sound effect for defeat.
         bool _victorySoundPlayed = false; ///< Flag to track if victory sound has been played.
         bool _defeatSoundPlayed = false; ///< Flag to track if defeat sound has been played.
-        std::vector<ecs::entity_t> _obstacles; ///< List of active obstacle entities.
-        std::unordered_map<uint32_t, ecs::entity_t> _obstacleMap;  // Map serverId -> client entity
+        ecs::entity_index<uint32_t> _obstacles; ///< Map: network obstacle ID -> ECS entity.
         std::unordered_map<uint32_t, std::string> _obstacleSpriteMap;  // Map serverId -> sprite path
-        std::vector<ecs::entity_t> _enemys; ///< List of active enemy entities.
-        std::vector<ecs::entity_t> _elements; ///< List of active random element entities.
-        std::unordered_map<uint32_t, ecs::entity_t> _elementMap; ///< Map: network element ID -> ECS entity.
+        ecs::entity_index<uint32_t> _elements; ///< Map: network element ID -> ECS entity.
         std::unordered_map<uint32_t, std::string> _elementSpriteMap;  // Map serverId -> sprite path
-        std::unordered_map<uint32_t, ecs::entity_t> _enemyMap; ///< Map: network enemy ID -> ECS entity.
+        ecs::entity_index<uint32_t> _enemies; ///< Map: network enemy ID -> ECS entity.
         std::unordered_map<uint32_t, std::string> _enemySpriteMap; ///< Map: network enemy ID -> sprite path.
         std::unordered_map<uint32_t, ecs::entity_t> _playerEntities; ///< Map: network player ID -> ECS entity.
+        uint64_t _nextEvent = 0; ///< Sequence number of the first WorldState event not applied yet.
+        bool _worldResyncPending = true; ///< The networked entities must be rebuilt from the whole world.
+        std::vector<snapshot::EntityState> _interpolated; ///< Networked entities at the current render time.
+        movement::Predictor _predictor; ///< Local player position, ahead of the server.
+        uint32_t _inputAckCount = 0; ///< WorldState::inputAckCount of the last ack given to _predictor.
+        float _inputAccumulator = 0.f; ///< Frame time not yet turned into movement commands.
+        std::vector<movement::Box> _obstacleBoxes; ///< Obstacles the local player collides with.
         bool _isDead = false; ///< Flag indicating if the local player is dead.
         bool _isWin = false; ///< Flag indicating if the local player has won.
-        std::unordered_map<uint32_t, Texture2D> _entityTextures; ///< Map: entity ID -> loaded texture.
-        std::unordered_map<std::string, Texture2D> _projectileTextures; ///< Map: projectile type -> loaded texture.
+        std::unordered_map<uint32_t, EntitySprite> _entityTextures; ///< Map: entity ID -> sprite sheet.
+        std::unordered_map<std::string, EntitySprite> _projectileTextures; ///< Map: projectile type -> sprite sheet.
+        rendering::TextureAtlas _atlas; ///< Sprite sheets of the current level.
+        std::optional<rendering::SpriteBatch> _batch; ///< Sprites of the frame, created once the window exists.
+        bool _showRenderStats = false; ///< F3 overlay with draw calls and texture binds.
         std::unordered_map<uint32_t, float> moovePlayer; ///< Map: client ID -> movement offset for sprite rendering.
         float _backgroundScrollX = 0.0f; ///< Background scrolling offset.
         float _victoryStartTime = 0.0f;
         float _stopShoot = false;
         bool _hasLevelData = false;
         bool _levelReloadPending = false;
+        int _level = 0; ///< Level being played, counted from the level registries received; 0 before the first.
         struct WeaponUsageState {
             float lastShotTime{0.f};
             float burstStartTime{0.f};
@@ -98,10 +98,10 @@ class UI {
 		float _heartSpacing;
 
 		/** @brief Texture for a full heart (representing full health). */
-		Texture2D _fullHeart{};
+		rendering::TextureHandle _fullHeart;
 
 		/** @brief Texture for an empty heart (representing lost health). */
-		Texture2D _emptyHeart{};
+		rendering::TextureHandle _emptyHeart;
 
 		/** @brief Player's individual score (points earned by this player). */
 		int _playerScore = 0;
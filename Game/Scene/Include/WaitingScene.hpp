@@ -67,7 +67,7 @@ class WaitingScene: public AScene {
             std::string name;
             std::string path;
             std::string filename;
-            Texture2D texture{};
+            rendering::TextureHandle texture;
             Rectangle source{0.f, 0.f, 0.f, 0.f};
         };
 
@@ -75,7 +75,7 @@ class WaitingScene: public AScene {
             std::string name;
             std::string path;
             std::string id;
-            Texture2D texture{};
+            rendering::TextureHandle texture;
             Rectangle source{0.f, 0.f, 0.f, 0.f};
         };
 
@@ -62,6 +62,7 @@ void SceneHandler::open(const std::string &name) {
 	while (scene->isOpen() && !_raylib.windowShouldClose()) {
 		scene->handleEvents();
 		scene->render();
+		_raylib.assets().pump();
 	}
 	scene->onClose();
 	_scenes[name].second = false;
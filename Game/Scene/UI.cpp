@@ -24,13 +24,8 @@ UI::UI(game::scene::GameScene &scene, ecs::registry &reg, Raylib &raylib) : _sce
 void UI::init() {
 	Color textColor = WHITE;
 	_font = _raylib.loadFont(ASSETS_PATH"/fonts/PressStart2P.ttf");
-	Image heartImage = LoadImage(ASSETS_PATH"/sprites/heart.png");
-	Image heartEmptyImage = LoadImage(ASSETS_PATH"/sprites/heart_empty.png");
-	_fullHeart = LoadTextureFromImage(heartImage);
-	_emptyHeart = LoadTextureFromImage(heartEmptyImage);
-
-	UnloadImage(heartImage);
-	UnloadImage(heartEmptyImage);
+	_fullHeart = _raylib.textures().acquire(ASSETS_PATH"/sprites/heart.png");
+	_emptyHeart = _raylib.textures().acquire(ASSETS_PATH"/sprites/heart_empty.png");
 
 	bool isFrench = (_scene.getGame().getLanguage() == Game::Language::FRENCH);
 	bool isItalian = (_scene.getGame().getLanguage() == Game::Language::ITALIAN);
@@ -75,8 +70,9 @@ void UI::init() {
 	int playerHealth = 100;
 	int maxHealth = 100;
 	int playerID = 0;
-	auto it = _scene._game.getGameClient().playerHealth.find(myClientId);
-	if (it != _scene._game.getGameClient().playerHealth.end()) {
+	const WorldState &world = _scene._game.getGameClient().world();
+	auto it = world.playerHealth.find(myClientId);
+	if (it != world.playerHealth.end()) {
 		playerHealth = it->second.first;
 		maxHealth = it->second.second;
 		playerID = myClientId;
@@ -85,8 +81,8 @@ void UI::init() {
 
 	float offsetX = 0;
 	for (size_t i = 0; i < maxPlayerLives; ++i) {
-		game::entities::create_image(_reg, _fullHeart, TOP_LEFT, Vector3{offsetX, 0.f, 0.f});
-		offsetX += (_fullHeart.width * _heartScale) + _heartSpacing;
+		game::entities::create_image(_reg, *_fullHeart, TOP_LEFT, Vector3{offsetX, 0.f, 0.f});
+		offsetX += (_fullHeart->width * _heartScale) + _heartSpacing;
 	}
 }
 
@@ -101,12 +97,12 @@ void UI::render() {
     int maxHealth = 100;
     int playerID = 0;
 	int score = 0;
+    const WorldState &world = _scene._game.getGameClient().world();
     {
-        std::lock_guard<std::mutex> g(_scene._game.getGameClient().stateMutex);
         uint32_t myClientId = _scene._game.getGameClient().clientId;
         
-        auto it = _scene._game.getGameClient().playerHealth.find(myClientId);
-        if (it != _scene._game.getGameClient().playerHealth.end()) {
+        auto it = world.playerHealth.find(myClientId);
+        if (it != world.playerHealth.end()) {
             playerHealth = it->second.first;
             maxHealth = it->second.second;
             playerID = myClientId;
@@ -119,8 +115,8 @@ void UI::render() {
 
 	float offsetX = 0;
     for (size_t i = 0; i < playerLives; ++i) {
-        game::entities::create_image(_reg, _fullHeart, TOP_LEFT, Vector3{offsetX, 0.f, 0.f});
-        offsetX += (_fullHeart.width * _heartScale) + _heartSpacing;
+        game::entities::create_image(_reg, *_fullHeart, TOP_LEFT, Vector3{offsetX, 0.f, 0.f});
+        offsetX += (_fullHeart->width * _heartScale) + _heartSpacing;
     }
 
     for (std::size_t i = 0; i < dynamic_pos.size() && i < text.size(); ++i) {
@@ -133,29 +129,18 @@ void UI::render() {
         switch (types[i]->value) {
             case component::entity_type::TEXT:
                 if (text[i]->content.starts_with("Players:")) {
-                    int numPlayers = 0;
-                    {
-                        std::lock_guard<std::mutex> g(_scene._game.getGameClient().stateMutex);
-                        numPlayers = _scene._game.getGameClient().players.size();
-                    }
+                    int numPlayers = world.players.size();
                     text[i]->content = std::format("Players: {}", numPlayers);
                 }
                 if (text[i]->content.starts_with("Total:")) {
-                    int globalScore = 0;
-                    {
-                        std::lock_guard<std::mutex> g(_scene._game.getGameClient().stateMutex);
-                        globalScore = _scene._game.getGameClient().globalScore;
-                    }
+                    int globalScore = world.globalScore;
                     text[i]->content = std::format("Total: {}", globalScore);
                 }
                 if (text[i]->content.starts_with("Individual:")) {
 					uint32_t playerScore = 0;
-					{
-						std::lock_guard<std::mutex> g(_scene._game.getGameClient().stateMutex);
-						auto it = _scene._game.getGameClient().playerIndividualScores.find(_scene._game.getGameClient().clientId);
-						if (it != _scene._game.getGameClient().playerIndividualScores.end()) {
-							playerScore = it->second;
-						}
+					auto it = world.playerIndividualScores.find(_scene._game.getGameClient().clientId);
+					if (it != world.playerIndividualScores.end()) {
+						playerScore = it->second;
 					}
 					text[i]->content = std::format("Individual: {}", playerScore);
 				}
@@ -163,9 +148,9 @@ void UI::render() {
                 _raylib.drawTextEx(text[i]->font, text[i]->content, pos, text[i]->font_size, text[i]->spacing, text[i]->color);
                 break;
             case component::entity_type::IMAGE:
-				sprite[i]->texture = _emptyHeart;
+				sprite[i]->texture = *_emptyHeart;
 				if (currentLive <= playerLives)
-					sprite[i]->texture = _fullHeart;
+					sprite[i]->texture = *_fullHeart;
 				_raylib.drawTextureEx(sprite[i]->texture, pos, 0, _heartScale, WHITE);
 				++currentLive;
 				break;
@@ -190,8 +175,8 @@ void UI::render() {
 
 void UI::unload() {
 	_raylib.unloadFont(_font);
-	_raylib.unloadTexture(_fullHeart);
-	_raylib.unloadTexture(_emptyHeart);
+	_fullHeart.reset();
+	_emptyHeart.reset();
 }
 
 void UI::addScore(int points) { 
@@ -6,6 +6,7 @@
 */
 
 #include "Include/WaitingScene.hpp"
+#include "Include/GameScene.hpp"
 #include "button.hpp"
 #include "components.hpp"
 #include "text.hpp"
@@ -127,6 +128,7 @@ namespace scene {
 		_ignoreInitialClick = true;
 
 		_font = _raylib.loadFont(ASSETS_PATH "/fonts/PressStart2P.ttf");
+		game::scene::GameScene::prefetch_start(_raylib);
 
 		_registry.register_component<component::position>();
 		_registry.register_component<component::drawable>();
@@ -338,38 +340,36 @@ namespace scene {
             option.path = fullPath;
             option.filename = path.filename().string();
 
-            option.texture = _raylib.loadTexture(option.path);
-            if (option.texture.id == 0) {
+            // Decoded once, for the texture and for the alpha border.
+            Image image = LoadImage(option.path.c_str());
+            if (image.data == nullptr) {
                 _skinOptions.push_back(std::move(option));
                 continue;
             }
-
-            option.source = {0.f, 0.f, static_cast<float>(option.texture.width), static_cast<float>(option.texture.height)};
-
-            Image image = LoadImage(option.path.c_str());
-            if (image.data != nullptr) {
-                Rectangle alpha = GetImageAlphaBorder(image, 0.05f);
-                if (alpha.width > 0.f && alpha.height > 0.f) {
-                    option.source = alpha;
-                    constexpr float desiredWidth = 33.f;
-                    constexpr float desiredHeight = 16.f;
-
-                    if (option.source.width > desiredWidth) {
-                        float reduce = option.source.width - desiredWidth;
-                        option.source.x += reduce * 0.5f;
-                        option.source.width = desiredWidth;
-                    }
-                    if (option.source.height > desiredHeight) {
-                        float reduce = option.source.height - desiredHeight;
-                        option.source.y += reduce * 0.5f;
-                        option.source.height = desiredHeight;
-                    }
-
-                    option.source.x = std::clamp(option.source.x, 0.f, static_cast<float>(option.texture.width) - option.source.width);
-                    option.source.y = std::clamp(option.source.y, 0.f, static_cast<float>(option.texture.height) - option.source.height);
+            option.texture = _raylib.textures().acquire(option.path, image);
+            option.source = {0.f, 0.f, static_cast<float>(option.texture->width), static_cast<float>(option.texture->height)};
+
+            Rectangle alpha = GetImageAlphaBorder(image, 0.05f);
+            if (alpha.width > 0.f && alpha.height > 0.f) {
+                option.source = alpha;
+                constexpr float desiredWidth = 33.f;
+                constexpr float desiredHeight = 16.f;
+
+                if (option.source.width > desiredWidth) {
+                    float reduce = option.source.width - desiredWidth;
+                    option.source.x += reduce * 0.5f;
+                    option.source.width = desiredWidth;
                 }
-                UnloadImage(image);
+                if (option.source.height > desiredHeight) {
+                    float reduce = option.source.height - desiredHeight;
+                    option.source.y += reduce * 0.5f;
+                    option.source.height = desiredHeight;
+                }
+
+                option.source.x = std::clamp(option.source.x, 0.f, static_cast<float>(option.texture->width) - option.source.width);
+                option.source.y = std::clamp(option.source.y, 0.f, static_cast<float>(option.texture->height) - option.source.height);
             }
+            UnloadImage(image);
 
             _skinOptions.push_back(std::move(option));
         }
@@ -434,31 +434,30 @@ namespace scene {
 		auto hydrateTexture = [this](WeaponOption &option) {
 			if (option.path.empty())
 				return;
-			option.texture = _raylib.loadTexture(option.path);
-			if (option.texture.id == 0)
+			// Decoded once, for the texture and for the alpha border.
+			Image image = LoadImage(option.path.c_str());
+			if (image.data == nullptr)
 				return;
+			option.texture = _raylib.textures().acquire(option.path, image);
 			option.source = {
 				0.f, 0.f,
-				static_cast<float>(option.texture.width),
-				static_cast<float>(option.texture.height)
+				static_cast<float>(option.texture->width),
+				static_cast<float>(option.texture->height)
 			};
 
-			Image image = LoadImage(option.path.c_str());
-			if (image.data != nullptr) {
-				Rectangle alpha = GetImageAlphaBorder(image, 0.05f);
-				if (alpha.width > 0.f && alpha.height > 0.f) {
-					option.source = alpha;
-					option.source.x = std::clamp(
-						option.source.x, 0.f,
-						static_cast<float>(option.texture.width) - option.source.width
-					);
-					option.source.y = std::clamp(
-						option.source.y, 0.f,
-						static_cast<float>(option.texture.height) - option.source.height
-					);
-				}
-				UnloadImage(image);
+			Rectangle alpha = GetImageAlphaBorder(image, 0.05f);
+			if (alpha.width > 0.f && alpha.height > 0.f) {
+				option.source = alpha;
+				option.source.x = std::clamp(
+					option.source.x, 0.f,
+					static_cast<float>(option.texture->width) - option.source.width
+				);
+				option.source.y = std::clamp(
+					option.source.y, 0.f,
+					static_cast<float>(option.texture->height) - option.source.height
+				);
 			}
+			UnloadImage(image);
 		};
 
 		const std::string defaultWeaponId = "basic_shot";
@@ -544,21 +543,13 @@ namespace scene {
 	}
 
 	void WaitingScene::unloadSkinTextures() {
-		for (auto &skin : _skinOptions) {
-			if (skin.texture.id != 0) {
-				_raylib.unloadTexture(skin.texture);
-				skin.texture = {};
-			}
-		}
+		for (auto &skin : _skinOptions)
+			skin.texture.reset();
 	}
 
 	void WaitingScene::unloadWeaponTextures() {
-		for (auto &weapon : _weaponOptions) {
-			if (weapon.texture.id != 0) {
-				_raylib.unloadTexture(weapon.texture);
-				weapon.texture = {};
-			}
-		}
+		for (auto &weapon : _weaponOptions)
+			weapon.texture.reset();
 	}
 
 	void WaitingScene::selectSkin(std::size_t index) {
@@ -633,7 +624,7 @@ namespace scene {
 		};
 		_raylib.drawRectangleRounded(inner, 0.12f, 12, Color{10, 24, 40, 255});
 
-		if (_skinOptions.empty() || _skinOptions[_currentSkinIndex].texture.id == 0) {
+		if (_skinOptions.empty() || _skinOptions[_currentSkinIndex].texture->id == 0) {
 			std::string fallback =
 				(_game.getLanguage() == Game::Language::FRENCH) ? "Apercu indisponible" :
 				(_game.getLanguage() == Game::Language::ITALIAN) ? "Anteprima non disponibile" :
@@ -645,7 +636,7 @@ namespace scene {
 		}
 
 		SkinOption &current = _skinOptions[_currentSkinIndex];
-		Texture2D &texture = current.texture;
+		const Texture2D &texture = *current.texture;
 
 		Rectangle source = current.source;
 		if (source.width <= 0.f || source.height <= 0.f) {
@@ -694,7 +685,7 @@ namespace scene {
 		};
 		_raylib.drawRectangleRounded(inner, 0.12f, 10, Color{8, 20, 34, 255});
 
-		if (_weaponOptions.empty() || _weaponOptions[_currentWeaponIndex].texture.id == 0) {
+		if (_weaponOptions.empty() || _weaponOptions[_currentWeaponIndex].texture->id == 0) {
 			std::string fallback =
 				(_game.getLanguage() == Game::Language::FRENCH) ? "Arme indisponible" :
 				(_game.getLanguage() == Game::Language::ITALIAN) ? "Arma non disponibile" :
@@ -706,7 +697,7 @@ namespace scene {
 		}
 
 		WeaponOption &current = _weaponOptions[_currentWeaponIndex];
-		Texture2D &texture = current.texture;
+		const Texture2D &texture = *current.texture;
 
 		Rectangle source = current.source;
 		if (source.width <= 0.f || source.height <= 0.f) {
@@ -25,6 +25,10 @@ static nlohmann::json load_json_from_file(const std::string &path) {
 }
 
 ServerGame::ServerGame(Connexion &conn) : connexion(conn), registry_server() {
+    _profiler = std::make_shared<metrics::TickProfiler>(std::vector<std::string>{
+        "messages", "inputs", "gravity", "check_death_zone", "check_win_condition",
+        "broadcast_states", "broadcast_health", "broadcast_scores",
+    });
     registry_server.register_component<component::position>();
     registry_server.register_component<component::previous_position>();
     registry_server.register_component<component::velocity>();
@@ -48,9 +52,11 @@ ServerGame::ServerGame(Connexion &conn) : connexion(conn), registry_server() {
     registry_server.register_component<component::client_id>();
 }
 
-void ServerGame::enqueuePacket(const std::vector<uint8_t> &data, const asio::ip::udp::endpoint &from) {
-    std::lock_guard<std::mutex> lock(packetMutex);
-    pendingPackets.push(PendingPacket{data, from});
+void ServerGame::enqueuePacket(Connexion::ReceivedPacket &packet) {
+    _profiler->packetsIn.add(1);
+    _profiler->bytesIn.add(packet.data.size());
+    if (!packetRing.try_push(packet))
+        _profiler->droppedPackets.add(1);
 }
 
 void ServerGame::setInitialClients(const std::map<uint32_t, bool> &clients) {
@@ -58,13 +64,10 @@ void ServerGame::setInitialClients(const std::map<uint32_t, bool> &clients) {
     initialClients = clients;
 }
 
-void ServerGame::run(int roomId) {
-    LOG("[Server] Starting game loop...");
+void ServerGame::start(int roomId) {
+    LOG("[Server] Starting game for room " << roomId);
     _roomId = roomId;
     setup_game_state();
-    const int tickMs = 16;
-    const float dt = 0.016f;
-    game_loop(tickMs, dt);
 }
 
 void ServerGame::setup_game_state() {
@@ -74,28 +77,40 @@ void ServerGame::setup_game_state() {
     index_existing_entities();
 }
 
-void ServerGame::game_loop(int tickMs, float dt) {
-    while (true) {
-        auto tickStart = std::chrono::high_resolution_clock::now();
-        service_players(dt);
-        broadcast_player_updates();
-        sleep_to_maintain_tick(tickStart, tickMs);
-    }
+bool ServerGame::tick(float dt) {
+    if (_stopRequested.load(std::memory_order_acquire))
+        return false;
+    metrics::PhaseTimer timer(*_profiler);
+    service_players(dt, timer);
+    broadcast_player_updates(timer);
+    return true;
 }
 
-void ServerGame::service_players(float dt) {
+void ServerGame::stop() {
+    _stopRequested.store(true, std::memory_order_release);
+}
+
+void ServerGame::service_players(float dt, metrics::PhaseTimer &timer) {
     process_pending_messages();
+    timer.lap(PHASE_MESSAGES);
     process_player_inputs(dt);
+    timer.lap(PHASE_INPUTS);
     apply_gravity(dt);
+    timer.lap(PHASE_GRAVITY);
     check_death_zone();
+    timer.lap(PHASE_CHECK_DEATH_ZONE);
     check_win_condition();
+    timer.lap(PHASE_CHECK_WIN_CONDITION);
 }
 
-void ServerGame::broadcast_player_updates() {
+void ServerGame::broadcast_player_updates(metrics::PhaseTimer &timer) {
     broadcast_states_to_clients();
+    timer.lap(PHASE_BROADCAST_STATES);
     broadcast_player_health();
+    timer.lap(PHASE_BROADCAST_HEALTH);
     broadcast_global_score();
     broadcast_individual_scores();
+    timer.lap(PHASE_BROADCAST_SCORES);
 }
 
 bool ServerGame::check_aabb_overlap(float left1, float right1, float top1, float bottom1,
@@ -153,9 +168,9 @@ void ServerGame::handle_client_message(const std::vector<uint8_t> &data, const a
         return;
     auto type = *reinterpret_cast<const MessageType *>(data.data());
     switch (type) {
-        case MessageType::ClientInput:
-            if (data.size() >= sizeof(ClientInputMessage))
-                handle_client_input_message(*reinterpret_cast<const ClientInputMessage *>(data.data()));
+        case MessageType::ClientInputEvent:
+            if (data.size() >= sizeof(ClientInputEventMessage))
+                handle_client_input_message(*reinterpret_cast<const ClientInputEventMessage *>(data.data()));
             break;
         case MessageType::SceneState:
             if (data.size() >= sizeof(SceneStateMessage))
@@ -170,7 +185,7 @@ void ServerGame::handle_client_message(const std::vector<uint8_t> &data, const a
     }
 }
 
-void ServerGame::handle_client_input_message(const ClientInputMessage &msg) {
+void ServerGame::handle_client_input_message(const ClientInputEventMessage &msg) {
     uint32_t clientId = ntohl(msg.clientId);
     if (deadPlayers.find(clientId) != deadPlayers.end())
         return;
@@ -318,22 +333,11 @@ void ServerGame::apply_horizontal_knockback(uint32_t clientId, float dt, std::pa
 }
 
 void ServerGame::process_pending_messages() {
-    std::queue<PendingPacket> localQueue;
-    {
-        std::lock_guard<std::mutex> lock(packetMutex);
-        while (!pendingPackets.empty()) {
-            localQueue.push(std::move(pendingPackets.front()));
-            pendingPackets.pop();
-        }
-    }
-
-    constexpr int maxMessagesPerTick = 32;
-    int processed = 0;
-    while (!localQueue.empty() && processed < maxMessagesPerTick) {
-        PendingPacket packet = std::move(localQueue.front());
-        localQueue.pop();
-        handle_client_message(packet.data, packet.endpoint);
-        ++processed;
+    _profiler->pendingPackets.sample(packetRing.size());
+    for (std::size_t processed = 0; processed < MAX_MESSAGES_PER_TICK; ++processed) {
+        if (!packetRing.try_pop(incomingPacket))
+            break;
+        handle_client_message(incomingPacket.data, incomingPacket.endpoint);
     }
 }
 
@@ -385,6 +389,7 @@ void ServerGame::process_player_inputs(float dt) {
         ensure_player_tracking(clientId);
         auto &state = playerInputStates[clientId];
         auto &buffer = playerInputBuffers[clientId];
+        _profiler->queuedCommands.sample(buffer.size());
         for (const auto &event : buffer)
             process_input_event(clientId, state, event);
         buffer.clear();
@@ -509,11 +514,3 @@ void ServerGame::reset_player_motion(uint32_t clientId) {
     playerVerticalKnockback[clientId] = 0.f;
     playerVelocities[clientId] = 0.f;
 }
-
-void ServerGame::sleep_to_maintain_tick(const std::chrono::high_resolution_clock::time_point& start, int tick_ms) {
-    auto tick_end = std::chrono::high_resolution_clock::now();
-    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(tick_end - start).count();
-    if (elapsed_ms < tick_ms) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(tick_ms - elapsed_ms));
-    }
-}
@@ -7,13 +7,13 @@
 
 #include "../../Server/Include/IServerGame.hpp"
 #include <asio/ip/udp.hpp>
+#include <atomic>
 #include <unordered_map>
 #include <unordered_set>
 #include <string>
 #include <chrono>
 #include <mutex>
 #include <vector>
-#include <queue>
 #include <map>
 #include <optional>
 
@@ -42,23 +42,32 @@ class ServerGame : public IServerGame {
         explicit ServerGame(Connexion &conn);
 
         /**
-         * @brief Starts the game loop for a specific room
+         * @brief Prepares the game for a specific room
          * @param roomId Unique identifier of the game room
          * 
-         * Initializes game state and begins the fixed-tick update loop
-         * that continues until the game ends or is interrupted.
+         * Loads players and the world; ticks are then driven by the room pool.
          */
-        void run(int roomId) override;
+        void start(int roomId) override;
+
+        /**
+         * @brief Runs one fixed tick of the game
+         * @param dt Duration of the tick, in seconds
+         * @return false once stop() was called
+         */
+        bool tick(float dt) override;
+
+        /**
+         * @brief Ends the game at the next tick
+         */
+        void stop() override;
         
         /**
          * @brief Enqueues a network packet for processing
-         * @param data Raw packet data received from client
-         * @param from Endpoint address of the sender
+         * @param packet Packet swapped into packetRing; receives a recycled buffer
          * 
-         * Thread-safe method to queue incoming packets for processing
-         * in the game loop thread.
+         * Lock-free: the server loop pushes, the tick drains the ring.
          */
-        void enqueuePacket(const std::vector<uint8_t> &data, const asio::ip::udp::endpoint &from) override;
+        void enqueuePacket(Connexion::ReceivedPacket &packet) override;
         
         /**
          * @brief Sets the initial client list for the game session
@@ -69,6 +78,12 @@ class ServerGame : public IServerGame {
          */
         void setInitialClients(const std::map<uint32_t, bool> &clients) override;
 
+        /**
+         * @brief Gets the profiler timing each phase of tick()
+         * @return The profiler, shared with the room pool and the stats dump
+         */
+        std::shared_ptr<metrics::TickProfiler> getProfiler() const override { return _profiler; }
+
         /**
          * @brief Loads player configurations from file
          * @param path File path to player configuration data
@@ -163,23 +178,19 @@ class ServerGame : public IServerGame {
          */
         void setup_game_state();
         
-        /**
-         * @brief Main game update loop iteration
-         * @param tickMs Milliseconds per tick
-         * @param dt Delta time in seconds
-         */
-        void game_loop(int tickMs, float dt);
         
         /**
          * @brief Updates player-specific logic
          * @param dt Delta time in seconds
+         * @param timer Times each step into its phase
          */
-        void service_players(float dt);
+        void service_players(float dt, metrics::PhaseTimer &timer);
         
         /**
          * @brief Broadcasts player position updates to all clients
+         * @param timer Times each broadcast into its phase
          */
-        void broadcast_player_updates();
+        void broadcast_player_updates(metrics::PhaseTimer &timer);
         
         /**
          * @brief Indexes all existing entities for quick lookup
@@ -207,7 +218,7 @@ class ServerGame : public IServerGame {
          * @brief Processes client input message
          * @param msg Parsed input message
          */
-        void handle_client_input_message(const ClientInputMessage &msg);
+        void handle_client_input_message(const ClientInputEventMessage &msg);
         
         /**
          * @brief Processes client scene state change
@@ -543,17 +554,27 @@ class ServerGame : public IServerGame {
             return &arr[idx].value();
         }
 
+        std::atomic<bool> _stopRequested{false}; ///< Set by stop(), checked by tick()
+
         /**
-         * @struct PendingPacket
-         * @brief Queued network packet awaiting processing
-         */
-        struct PendingPacket {
-            std::vector<uint8_t> data;       ///< Raw packet data
-            asio::ip::udp::endpoint endpoint; ///< Sender address
+         * @brief Phases of tick(), in order; indexes of _profiler's histograms
+         */
+        enum Phase : std::size_t {
+            PHASE_MESSAGES,
+            PHASE_INPUTS,
+            PHASE_GRAVITY,
+            PHASE_CHECK_DEATH_ZONE,
+            PHASE_CHECK_WIN_CONDITION,
+            PHASE_BROADCAST_STATES,
+            PHASE_BROADCAST_HEALTH,
+            PHASE_BROADCAST_SCORES,
         };
 
-        std::mutex packetMutex; ///< Mutex for packet queue thread safety
-        std::queue<PendingPacket> pendingPackets; ///< Queue of incoming packets
+        std::shared_ptr<metrics::TickProfiler> _profiler; ///< Per-phase timings, traffic and queue depths
+        static constexpr std::size_t PACKET_RING_SIZE = 256; ///< Packets that can wait for a tick; later ones are dropped
+        static constexpr std::size_t MAX_MESSAGES_PER_TICK = 32; ///< Most packets handled per tick; the rest wait
+        MpscRing<Connexion::ReceivedPacket> packetRing{PACKET_RING_SIZE}; ///< Packets routed by the server loop
+        Connexion::ReceivedPacket incomingPacket; ///< Tick thread: packet being handled, its buffer goes back to packetRing
         std::mutex initialClientsMutex; ///< Mutex for initial clients map
         std::map<uint32_t, bool> initialClients; ///< Map of initial client IDs to ready status
 
@@ -606,11 +627,4 @@ class ServerGame : public IServerGame {
          * @param obstacleId Obstacle entity ID to remove
          */
         void broadcast_obstacle_despawn(uint32_t obstacleId);
-
-        /**
-         * @brief Sleeps to maintain consistent tick rate
-         * @param start Tick start time
-         * @param tick_ms Target tick duration in milliseconds
-         */
-        void sleep_to_maintain_tick(const std::chrono::high_resolution_clock::time_point &start, int tick_ms);
 };
\ No newline at end of file
@@ -17,19 +17,16 @@ static uint32_t to_network_bits(float value) {
 }
 
 void ServerGame::broadcast_full_registry_to(uint32_t clientId) {
-    nlohmann::json root;
-    root["type"] = "FullRegistry";
-    root["entities"] = nlohmann::json::array();
-
-    for (auto entity : registry_server.alive_entities()) {
-        auto j = game::serializer::serialize_entity(registry_server, entity);
-        if (!j.empty()) {
-            root["entities"].push_back(j);
-        }
+    std::vector<uint8_t> snapshot;
+    try {
+        snapshot = game::serializer::encode_snapshot(registry_server);
+    } catch (const std::exception &e) {
+        LOG_ERROR("broadcast_full_registry_to failed: " << e.what());
+        return;
     }
-    connexion.sendJsonToClient(clientId, root);
-    LOG_DEBUG("[Server] Sent full registry to client " << clientId 
-              << " with " << root["entities"].size() << " entities");
+    connexion.sendReliable(clientId, reliable::Channel::Registry, snapshot.data(), snapshot.size());
+    LOG_DEBUG("[Server] Sent full registry to client " << clientId
+              << " (" << snapshot.size() << " bytes)");
 }
 
 void ServerGame::broadcast_player_death(uint32_t clientId) {
@@ -55,6 +52,8 @@ void ServerGame::broadcast_states_to_clients() {
         m.pos.yBits = to_network_bits(it->second.second);
         m.pos.zBits = to_network_bits(0.f);
         connexion.broadcast(&m, sizeof(m));
+        _profiler->packetsOut.add(connexion.getClientCount());
+        _profiler->bytesOut.add(sizeof(m) * connexion.getClientCount());
     }
 }
 
@@ -86,8 +86,11 @@ namespace game::scene {
         _registry.register_component<component::type>();
         _registry.register_component<component::client_id>();
         _ui.init();
-        _game.getGameClient().sendSceneState(SceneState::GAME, &_registry);
+        _game.getGameClient().sendSceneState(SceneState::GAME);
 
+        // No stage below holds two systems that do real work, so a worker pool
+        // would only add a cross-thread handoff per frame.
+        _registry.set_system_workers(0);
         setup_movement_system();
         setup_render_system();
         setup_health_system();
@@ -101,6 +104,19 @@ namespace game::scene {
         index_existing_entities();
         load_entity_textures();
         load_music();
+        // render() applies the registry once the server sends it.
+        _registryPending = true;
+    }
+
+    bool GameScene::processPendingFullRegistry() {
+        auto registryOpt = _game.getGameClient().consumeFullRegistry();
+        if (!registryOpt.has_value())
+            return false;
+
+        game::serializer::restore_snapshot(_registry, registryOpt.value());
+        index_existing_entities();
+        load_entity_textures();
+        return true;
     }
 
     void GameScene::index_existing_entities() {
@@ -289,6 +305,8 @@ namespace game::scene {
             _isDead = (_game.getGameClient().players.find(_game.getGameClient().clientId) == _game.getGameClient().players.end());
         _isWin = (30 <= _game.getGameClient().globalScore);
         
+        if (_registryPending && processPendingFullRegistry())
+            _registryPending = false;
         _raylib.updateMusicStream(_music);
         render_entities();
         render_network_obstacles();
@@ -419,7 +437,7 @@ namespace game::scene {
             auto &sprites = _registry.get_components<component::sprite>();
             const component::sprite *spriteComp = nullptr;
             if (entity.value() < sprites.size()) {
-                auto &spriteOpt = sprites[entity.value()];
+                auto spriteOpt = sprites[entity.value()];
                 if (spriteOpt.has_value()) {
                     spriteComp = &spriteOpt.value();
                 }
@@ -469,7 +487,7 @@ namespace game::scene {
             auto &sprites = _registry.get_components<component::sprite>();
             const component::sprite *spriteComp = nullptr;
             if (entity.value() < sprites.size()) {
-                auto &spriteOpt = sprites[entity.value()];
+                auto spriteOpt = sprites[entity.value()];
                 if (spriteOpt.has_value()) {
                     spriteComp = &spriteOpt.value();
                 }
@@ -497,7 +515,7 @@ namespace game::scene {
             auto &sprites = _registry.get_components<component::sprite>();
             const component::sprite *spriteComp = nullptr;
             if (entity.value() < sprites.size()) {
-                auto &spriteOpt = sprites[entity.value()];
+                auto spriteOpt = sprites[entity.value()];
                 if (spriteOpt.has_value()) {
                     spriteComp = &spriteOpt.value();
                 }
@@ -525,7 +543,7 @@ namespace game::scene {
             auto &sprites = _registry.get_components<component::sprite>();
             const component::sprite *spriteComp = nullptr;
             if (entity.value() < sprites.size()) {
-                auto &spriteOpt = sprites[entity.value()];
+                auto spriteOpt = sprites[entity.value()];
                 if (spriteOpt.has_value()) {
                     spriteComp = &spriteOpt.value();
                 }
@@ -564,7 +582,7 @@ namespace game::scene {
             auto &sprites = _registry.get_components<component::sprite>();
             const component::sprite *spriteComp = nullptr;
             if (entity.value() < sprites.size()) {
-                auto &spriteOpt = sprites[entity.value()];
+                auto spriteOpt = sprites[entity.value()];
                 if (spriteOpt.has_value()) {
                     spriteComp = &spriteOpt.value();
                 }
@@ -966,10 +984,10 @@ namespace game::scene {
     }
 
     void GameScene::setup_movement_system() {
-        _registry.add_system<component::position, component::velocity>(
+        _registry.add_system(ecs::reads<component::velocity>{}, ecs::writes<component::position>{},
             [](ecs::registry &reg,
-               ecs::sparse_array<component::position> &pos,
-               ecs::sparse_array<component::velocity> &vel) {
+               ecs::sparse_array<component::velocity> const &vel,
+               ecs::sparse_array<component::position> &pos) {
                 float dt = 0.016f;
                 for (std::size_t i = 0; i < pos.size() && i < vel.size(); ++i) {
                     if (pos[i] && vel[i]) {
@@ -982,10 +1000,10 @@ namespace game::scene {
     }
 
     void GameScene::setup_render_system() {
-        _registry.add_system<component::position, component::drawable>(
+        _registry.add_system(ecs::reads<component::position, component::drawable>{}, ecs::writes<>{},
             [this](ecs::registry &reg,
-                   ecs::sparse_array<component::position> &pos,
-                   ecs::sparse_array<component::drawable> &drw) {
+                   ecs::sparse_array<component::position> const &pos,
+                   ecs::sparse_array<component::drawable> const &drw) {
             });
     }
 
@@ -221,6 +221,7 @@ namespace game::scene {
         std::unordered_map<uint32_t, float> moovePlayer; ///< Player movement data
 
         bool _game_running;                             ///< Whether the game is currently running
+        bool _registryPending = false;                  ///< Whether the registry from the server is still awaited
         double _startTime;                              ///< Game start timestamp
         UI _ui;                                         ///< User interface manager
 
@@ -229,6 +230,12 @@ namespace game::scene {
          */
         void index_existing_entities();
 
+        /**
+         * @brief Applies the full registry received from the server, if any
+         * @return True if a registry was applied
+         */
+        bool processPendingFullRegistry();
+
         /**
          * @brief Renders all entities in the scene
          */
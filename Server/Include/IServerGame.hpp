@@ -8,11 +8,15 @@
 #pragma once
 
 #include "connexion.hpp"
+#include "../../Shared/Sockets/Include/UDP_socket.hpp"
 #include "../../Shared/protocol.hpp"
+#include "../../Shared/TickProfiler.hpp"
 #include "../../Engine/Utils/Include/serializer.hpp"
+#include "../../Engine/Utils/Include/registry_snapshot.hpp"
 #include "../../Engine/Core/Include/registry.hpp"
 #include "../../Engine/Utils/Include/entity_storage.hpp"
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 /**
@@ -32,25 +36,48 @@ class IServerGame {
         virtual ~IServerGame() = default;
 
         /**
-         * @brief Starts the game instance's main loop for a specific room.
+         * @brief Prepares the game instance for a specific room.
          *
-         * Initializes the game state, begins the gameplay loop, and handles
-         * all game logic until the game ends or is interrupted.
+         * Loads players and the first level and sends the initial state. Called
+         * once, on the worker thread that then runs the instance's first tick.
          *
          * @param roomId The unique identifier of the room this game instance manages.
          */
-        virtual void run(int roomId) = 0;
+        virtual void start(int roomId) = 0;
+
+        /**
+         * @brief Runs one simulation tick: inputs, game logic and broadcasts.
+         *
+         * Ticks of an instance never overlap, but successive ticks may run on
+         * different worker threads. Every tick simulates the same dt, the
+         * period of the room pool's fixed timestep, even when several run
+         * back to back to catch up.
+         *
+         * @param dt Simulated time of the tick, in seconds.
+         * @return false once the game is over and the instance can be released.
+         */
+        virtual bool tick(float dt) = 0;
+
+        /**
+         * @brief Asks the game to end; the next tick() returns false.
+         *
+         * Safe to call from any thread.
+         */
+        virtual void stop() = 0;
 
         /**
          * @brief Enqueues a network packet for processing by the game instance.
          *
          * Receives player input and other game-related packets from the network layer
-         * and queues them for processing in the game loop.
+         * and queues them for processing in the game loop. The packet is swapped
+         * in, not copied: the caller gets back the buffer of a packet the game
+         * already processed, to receive into again.
+         *
+         * Called from the server loop only; the game reads its queue during tick().
          *
-         * @param data Raw packet data received from a client.
-         * @param from The UDP endpoint (address and port) of the packet sender.
+         * @param packet Packet to queue; receives a recycled buffer.
          */
-        virtual void enqueuePacket(const std::vector<uint8_t> &data, const asio::ip::udp::endpoint &from) = 0;
+        virtual void enqueuePacket(UDP_socket::Datagram &packet) = 0;
 
         /**
          * @brief Sets the initial list of clients participating in this game.
@@ -61,4 +88,14 @@ class IServerGame {
          * @param clients Map of client IDs to their ready status (true = ready, false = not ready).
          */
         virtual void setInitialClients(const std::map<uint32_t, bool> &clients) = 0;
+
+        /**
+         * @brief Gets the profiler the instance records its tick phases and traffic into.
+         *
+         * The room pool adds whole-tick timings to it and publishes it in the
+         * server stats while the game runs.
+         *
+         * @return The profiler, or nullptr if the game records nothing.
+         */
+        virtual std::shared_ptr<metrics::TickProfiler> getProfiler() const = 0;
 };
\ No newline at end of file
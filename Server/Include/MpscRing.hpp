@@ -0,0 +1,112 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** MpscRing
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+/**
+ * @class MpscRing
+ * @brief Bounded lock-free queue, many producers and a single consumer.
+ *
+ * Every slot owns a T for the whole life of the ring. Pushing and popping
+ * swap values with the slot instead of copying them, so a T holding a heap
+ * buffer (e.g. a std::vector) is handed over without copy and the caller
+ * gets back the buffer of an older element to reuse: once every buffer has
+ * been around the ring, no push nor pop allocates.
+ *
+ * Each slot carries a sequence number telling whether it is free for the
+ * producer at a given position or holds the element the consumer expects
+ * there (D. Vyukov's bounded queue).
+ */
+template <typename T>
+class MpscRing {
+    public:
+        /**
+         * @param capacity Number of slots, rounded up to a power of two.
+         */
+        explicit MpscRing(std::size_t capacity)
+        {
+            std::size_t size = 2;
+            while (size < capacity)
+                size <<= 1;
+            _mask = size - 1;
+            _slots = std::make_unique<Slot[]>(size);
+            for (std::size_t i = 0; i < size; ++i)
+                _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        MpscRing(const MpscRing &) = delete;
+        MpscRing &operator=(const MpscRing &) = delete;
+
+        /**
+         * @brief Any thread: queue a value.
+         * @param value Swapped into the ring; receives a previously popped value.
+         * @return false if the ring is full; value is then left untouched.
+         */
+        bool try_push(T &value)
+        {
+            std::size_t pos = _tail.load(std::memory_order_relaxed);
+            Slot *slot;
+            for (;;) {
+                slot = &_slots[pos & _mask];
+                std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+                if (diff == 0) {
+                    if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = _tail.load(std::memory_order_relaxed);
+                }
+            }
+            std::swap(slot->value, value);
+            slot->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Consumer thread only: take the oldest value.
+         * @param value Receives the value; its previous content goes back to the ring.
+         * @return false if the ring is empty.
+         */
+        bool try_pop(T &value)
+        {
+            Slot &slot = _slots[_head & _mask];
+            if (slot.sequence.load(std::memory_order_acquire) != _head + 1)
+                return false;
+            std::swap(value, slot.value);
+            slot.sequence.store(_head + _mask + 1, std::memory_order_release);
+            ++_head;
+            return true;
+        }
+
+        std::size_t capacity() const noexcept { return _mask + 1; }
+
+        /**
+         * @brief Consumer thread only: number of queued values.
+         *
+         * Producers may push meanwhile, so this is a lower bound once returned.
+         */
+        std::size_t size() const noexcept { return _tail.load(std::memory_order_acquire) - _head; }
+
+    private:
+        struct Slot {
+            std::atomic<std::size_t> sequence{0};
+            T value{};
+        };
+
+        std::unique_ptr<Slot[]> _slots;
+        std::size_t _mask{0};
+        alignas(64) std::atomic<std::size_t> _tail{0}; ///< Next position to write, shared by producers.
+        alignas(64) std::size_t _head{0};              ///< Next position to read, consumer only.
+};
@@ -8,9 +8,10 @@
 #pragma once
 
 #include "../../Shared/Sockets/Include/UDP_socket.hpp"
-#include "../../Shared/Sockets/Include/TCP_socket.hpp"
+#include "../../Shared/Sockets/Include/ReliableChannel.hpp"
 #include "../../Shared/protocol.hpp"
 #include "../../Server/Room/Room.hpp"
+#include "MpscRing.hpp"
 #include <asio.hpp>
 #include <atomic>
 #include <condition_variable>
@@ -20,7 +21,6 @@
 #include <memory>
 #include <string>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
 
@@ -30,24 +30,35 @@ class Room;
  * @class Connexion
  * @brief Manages network connections for the R-Type game server.
  *
- * This class provides a high-level interface for handling both UDP and TCP connections.
+ * This class provides a high-level interface over the server's UDP socket.
  * It manages client registration, message transmission (unicast and broadcast),
  * and asynchronous packet reception. The class supports:
- * - Fast UDP communication for game state updates
- * - Reliable TCP communication for critical data
+ * - Fast UDP communication for game state updates, received in batches
+ *   by a thread that sleeps until the socket is readable
+ * - Reliable ordered messages for critical data (registry sync, gameplay
+ *   events), on the same socket; the receiver thread handles their acks
+ *   and resends
  * - Client lifecycle management (registration and disconnection)
  * - Room-based message broadcasting
  */
 class Connexion {
     public:
         /**
-         * @struct ReceivedPacket
-         * @brief Contains data from a received UDP packet and its source endpoint.
+         * @brief Data of a received UDP packet and its source endpoint.
          */
-        struct ReceivedPacket {
-            std::vector<uint8_t> data;           ///< Raw packet data.
-            asio::ip::udp::endpoint endpoint;    ///< Source address and port.
-        };
+        using ReceivedPacket = UDP_socket::Datagram;
+
+        /** @brief Most datagrams read from the socket per wakeup. */
+        static constexpr size_t RECEIVE_BATCH = 32;
+
+        /** @brief Received packets that can wait for the server loop; later ones are dropped. */
+        static constexpr size_t PACKET_RING_SIZE = 1024;
+
+        /** @brief Longest the receiver sleeps before checking whether it must stop. */
+        static constexpr std::chrono::milliseconds RECEIVE_POLL_TIMEOUT{100};
+
+        /** @brief Longest the receiver sleeps while reliable fragments wait for an ack. */
+        static constexpr std::chrono::milliseconds RELIABLE_FLUSH_INTERVAL{20};
 
         /**
          * @brief Constructs a Connexion instance and binds to a UDP port.
@@ -76,6 +87,15 @@ class Connexion {
          */
         void sendTo(const void* msg, size_t size, const asio::ip::udp::endpoint& to);
 
+        /**
+         * @brief Sends a UDP message to a client by ID.
+         *
+         * @param id Client ID of the recipient; ignored if not connected.
+         * @param msg Pointer to the data buffer to send.
+         * @param size Size of the data in bytes.
+         */
+        void sendToClient(uint32_t id, const void* msg, size_t size);
+
         /**
          * @brief Broadcasts a UDP message to all connected clients.
          *
@@ -110,7 +130,7 @@ class Connexion {
         /**
          * @brief Disconnects a client and removes them from the manager.
          *
-         * Cleans up all resources associated with the client, including UDP and TCP connections.
+         * Cleans up all resources associated with the client, including its reliable channels.
          *
          * @param id Unique identifier of the client to disconnect.
          */
@@ -138,34 +158,27 @@ class Connexion {
         const std::unordered_map<std::string, asio::ip::udp::endpoint>& getEndpoints() const;
 
         /**
-         * @brief Accepts a TCP connection from a client on a specific port.
+         * @brief Sends a message to a client on a reliable channel.
          *
-         * Establishes a reliable TCP connection for sending critical game data.
+         * The message arrives exactly once, after the ones sent before on
+         * the same channel; it may be of any size.
          *
-         * @param id Client ID to associate with the TCP connection.
-         * @param port TCP port to listen on for this client.
-         * @return true if the connection was established successfully, false otherwise.
+         * @param id Client ID of the recipient; ignored if not connected.
+         * @param channel Channel ordering the message.
+         * @param data Pointer to the message.
+         * @param size Size of the message in bytes.
          */
-        bool acceptTcpClient(uint32_t id, uint16_t port);
+        void sendReliable(uint32_t id, reliable::Channel channel, const void* data, size_t size);
 
         /**
-         * @brief Sends a JSON object to a specific TCP client.
-         *
-         * Uses the reliable TCP connection to transmit structured data.
+         * @brief Sends a message to a set of clients on a reliable channel.
          *
-         * @param id Client ID of the recipient.
-         * @param j JSON object to send.
-         */
-        void sendJsonToClient(uint32_t id, const nlohmann::json& j);
-
-        /**
-         * @brief Broadcasts a JSON object to all connected TCP clients.
-         *
-         * Sends the same JSON data to every client with an active TCP connection.
-         *
-         * @param j JSON object to broadcast.
+         * @param clientIds Vector of client IDs to send the message to.
+         * @param channel Channel ordering the message.
+         * @param data Pointer to the message.
+         * @param size Size of the message in bytes.
          */
-        void broadcastJson(const nlohmann::json& j);
+        void broadcastReliable(const std::vector<uint32_t> &clientIds, reliable::Channel channel, const void* data, size_t size);
 
         /**
          * @brief Starts the asynchronous packet reception thread.
@@ -184,7 +197,10 @@ class Connexion {
         /**
          * @brief Waits for a packet to arrive with a timeout.
          *
-         * Blocks until a packet is received or the timeout expires.
+         * Blocks until a packet is received or the timeout expires. Must only
+         * be called from one thread, like tryPopPacket(). The previous buffer
+         * of packet is recycled for later packets: reuse the same packet
+         * object across calls so that no buffer gets allocated.
          *
          * @param packet Output parameter that receives the packet data.
          * @param timeout Maximum time to wait for a packet.
@@ -229,22 +245,78 @@ class Connexion {
          */
         [[nodiscard]] std::string getClientName(uint32_t id) const;
 
+        /**
+         * @brief Gets the datagrams and bytes sent and received on the socket.
+         *
+         * @return Totals since the server started; safe to call from any thread.
+         */
+        [[nodiscard]] UDP_socket::Traffic getTraffic() const;
+
+        /**
+         * @brief Gets the number of received packets dropped because the server loop fell behind.
+         *
+         * @return Total since the server started; safe to call from any thread.
+         */
+        [[nodiscard]] uint64_t getDroppedPackets() const;
+
     private:
         UDP_socket socket; ///< UDP socket for fast, unreliable message transmission.
         std::unordered_map<std::string, uint32_t> clients; ///< Maps client endpoint strings to their unique IDs.
         std::unordered_map<std::string, asio::ip::udp::endpoint> endpoints; ///< Maps client endpoint strings to UDP endpoint objects.
-        std::unordered_map<uint32_t, std::shared_ptr<TCP_socket>> tcpClients; ///< Maps client IDs to their TCP connections.
         std::unordered_map<uint32_t, std::string> clientNames; ///< Maps client IDs to their display names.
         std::atomic<bool> listening{false}; ///< Flag indicating whether the receiver thread is active.
         std::thread receiverThread; ///< Background thread for receiving UDP packets.
-        std::mutex queueMutex; ///< Protects access to the packet queue.
-        std::condition_variable queueCv; ///< Notifies waiting threads when packets arrive.
-        std::queue<ReceivedPacket> packetQueue; ///< Queue of received packets waiting to be processed.
+        MpscRing<ReceivedPacket> packetRing{PACKET_RING_SIZE}; ///< Received packets waiting to be processed.
+        std::atomic<bool> consumerWaiting{false}; ///< Set while waitForPacket() sleeps on wakeCv.
+        std::mutex wakeMutex; ///< Guards the sleep of waitForPacket().
+        std::condition_variable wakeCv; ///< Wakes waitForPacket() when packets arrive or listening stops.
+        std::atomic<uint64_t> droppedPackets{0}; ///< Packets dropped because packetRing was full.
+
+        /**
+         * @struct ReliablePeer
+         * @brief Reliable channels with one client, indexed by client ID.
+         */
+        struct ReliablePeer {
+            bool connected{false};                 ///< false for IDs never added or disconnected.
+            asio::ip::udp::endpoint endpoint;      ///< Only datagrams from there are accepted.
+            reliable::Connection connection;       ///< Sequence, ack and resend state.
+        };
+
+        std::vector<ReliablePeer> reliablePeers; ///< Reliable state by client ID.
+        std::mutex reliableMutex; ///< Guards reliablePeers, used by game threads and the receiver.
+        std::atomic<bool> reliableBacklog{false}; ///< Some reliable fragment waits for an ack.
+        ReceivedPacket reliableMessage; ///< Receiver thread: message completed on a reliable channel.
 
         /**
          * @brief Main loop for the receiver thread.
          *
-         * Continuously receives UDP packets and adds them to the queue.
+         * Sleeps until the socket is readable, receives up to RECEIVE_BATCH
+         * datagrams into buffers recycled through packetRing, and queues them.
          */
         void receiverLoop();
+
+        /**
+         * @brief Wakes waitForPacket() if it sleeps, once per received batch.
+         */
+        void wakeConsumer();
+
+        /**
+         * @brief Receiver thread: handles a MessageType::Reliable datagram.
+         *
+         * Processes its acks, queues the gameplay messages it completes
+         * like any received packet, and answers with the datagrams due.
+         */
+        void handleReliable(ReceivedPacket &packet);
+
+        /**
+         * @brief Sends the datagrams due on the reliable channels of one peer.
+         *
+         * Called with reliableMutex held.
+         */
+        void flushReliable(ReliablePeer &peer, reliable::Connection::Clock::time_point now);
+
+        /**
+         * @brief Receiver thread: resends unacked fragments of every peer.
+         */
+        void flushAllReliable();
 };
\ No newline at end of file
@@ -40,7 +40,7 @@
 class GameServer {
 		int maxPlayers = 10; ///< Maximum number of players per game room.
 		asio::io_context ioContext; ///< ASIO I/O context for asynchronous network operations.
-		Connexion connexion; ///< Network connection manager handling UDP and TCP communications.
+		Connexion connexion; ///< Network connection manager over the UDP socket, with reliable channels.
 		bool serverRunning{false}; ///< Flag indicating if the server is currently running.
 		uint32_t nextClientId = 1; ///< Counter for assigning unique client IDs.
 		std::unordered_map<uint32_t, std::pair<float, float>> playerPositions; ///< Maps player IDs to their (x, y) positions.
@@ -51,17 +51,34 @@ class GameServer {
 		std::unordered_map<uint32_t, std::string> waitingPlayerSkins; ///< Stores skin selections for players in lobby.
 		std::unordered_map<uint32_t, std::string> waitingPlayerWeapons; ///< Stores weapon selections for players in lobby.
 		RoomManager roomManager; ///< Manages all game rooms and their states.
+		std::chrono::steady_clock::time_point startTime; ///< When run() was called.
+		std::chrono::steady_clock::time_point nextStatsDump; ///< When writeStats() runs next.
+
+		/** @brief Time between two dumps of the stats file. */
+		static constexpr std::chrono::seconds STATS_INTERVAL{1};
+
+		/** @brief File the stats are dumped to, in the working directory. */
+		static constexpr const char *STATS_FILE = "server_stats.json";
 
 	public:
+		/** @brief Rooms created when no room count is given. */
+		static constexpr int DEFAULT_ROOMS = 4;
+
+		/** @brief Most rooms whose list still fits in one ServerSendRoomsMessage. */
+		static constexpr int MAX_ROOMS = 20;
+
 		/**
 		 * @brief Constructs a GameServer instance and initializes networking.
 		 *
 		 * Binds the UDP socket to the specified port and prepares the server
-		 * to accept incoming client connections.
+		 * to accept incoming client connections. Rooms past the default four
+		 * take four players each; load tests use them to seat many clients.
 		 *
 		 * @param port UDP port number to listen on for client connections.
+		 * @param tickRate Ticks per second of the games (30, 60 or 120).
+		 * @param roomCount Number of rooms, 1 to MAX_ROOMS.
 		 */
-		GameServer(uint16_t port);
+		GameServer(uint16_t port, uint32_t tickRate = timing::DEFAULT_TICK_RATE, int roomCount = DEFAULT_ROOMS);
 
 		/**
 		 * @brief Starts the main server loop.
@@ -146,9 +163,10 @@ class GameServer {
 		 *
 		 * Determines the message type and routes the packet to the appropriate handler.
 		 *
-		 * @param packet The received packet containing data and sender information.
+		 * @param packet The received packet containing data and sender information;
+		 *               holds a recycled buffer afterwards if it was routed to a game.
 		 */
-		void processIncomingPacket(const Connexion::ReceivedPacket &packet);
+		void processIncomingPacket(Connexion::ReceivedPacket &packet);
 
 		/**
 		 * @brief Routes a gameplay packet to the appropriate game instance.
@@ -156,10 +174,11 @@ class GameServer {
 		 * Forwards packets intended for active game instances (e.g., player input,
 		 * shoot commands) to the correct running game.
 		 *
-		 * @param packet The received packet to route.
+		 * @param packet The received packet to route, swapped into the game's queue
+		 *               without copy; receives a buffer to receive into again.
 		 * @param type The type of message contained in the packet.
 		 */
-		void routePacketToGame(const Connexion::ReceivedPacket &packet, MessageType type);
+		void routePacketToGame(Connexion::ReceivedPacket &packet, MessageType type);
 
 		/**
 		 * @brief Handles client messages during active gameplay.
@@ -193,6 +212,17 @@ class GameServer {
 		 */
 		void handlePlayerWeaponUpdate(const std::vector<uint8_t>& data, const asio::ip::udp::endpoint& from);
 
+		/**
+		 * @brief Dumps the live server metrics to STATS_FILE.
+		 *
+		 * Writes, as JSON, the socket traffic since startup and, for every running
+		 * game, the p50/p99/max of each tick phase, of whole ticks and of their
+		 * lateness, with packets, bytes and queue depths, all over the time since
+		 * the previous dump. The file is replaced atomically, so it can be
+		 * polled (e.g. `watch cat server_stats.json`) while the server runs.
+		 */
+		void writeStats();
+
 		/**
 		 * @brief Maintains a consistent server tick rate by sleeping.
 		 *
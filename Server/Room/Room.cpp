@@ -6,6 +6,7 @@
 */
 
 #include "Room.hpp"
+#include <algorithm>
 
 #include "Rungame.hpp"
 
@@ -43,6 +44,10 @@ std::map<uint32_t, bool> Room::getClients() const {
 	return _clients;
 }
 
+const std::vector<uint32_t> &Room::getClientIds() const {
+	return _clientIds;
+}
+
 bool Room::isFull() const {
 	return _maxPlayers == _clients.size();
 }
@@ -80,12 +85,14 @@ void Room::addClient(uint32_t clientId) {
 	if (isClientInRoom(clientId) || isFull())
 		return;
 	_clients.insert_or_assign(clientId, false);
+	_clientIds.insert(std::lower_bound(_clientIds.begin(), _clientIds.end(), clientId), clientId);
 }
 
 void Room::removeClient(uint32_t clientId) {
 	for (auto it = _clients.begin(); it != _clients.end(); ++it) {
 		if (it->first == clientId) {
 			_clients.erase(it);
+			_clientIds.erase(std::find(_clientIds.begin(), _clientIds.end(), clientId));
 			return;
 		}
 	}
@@ -103,8 +110,18 @@ void Room::setGameStatus(GameStatus status) {
 	_gameStatus = status;
 }
 
-void Room::startGame(int roomId) {
+std::shared_ptr<IServerGame> Room::startGame() {
 	_isGameServerStarted = true;
+	_gameStatus = GameStatus::RUNNING;
 	_game->setInitialClients(_clients);
-	_game->run(roomId);
+	return _game;
+}
+
+void Room::stopGame() {
+	if (!_isGameServerStarted)
+		return;
+	_game->stop();
+	_game = std::make_shared<ServerGame>(_connexion);
+	_isGameServerStarted = false;
+	_gameStatus = GameStatus::WAITING_PLAYERS;
 }
@@ -25,7 +25,7 @@ class Connexion;
  * A Room manages a group of players waiting to play or actively playing together.
  * It tracks player connections, ready states, game configuration, and coordinates
  * the lifecycle of the associated game instance. Each room has a minimum and maximum
- * player count and runs its own independent game server thread when the game starts.
+ * player count and, once the game starts, its game instance is ticked by the shared RoomPool.
  */
 class Room {
 	private:
@@ -35,8 +35,9 @@ class Room {
 		std::string _gameName; ///< Display name for this game room.
 		GameStatus _gameStatus; ///< Current status of the room (waiting, ready, playing, etc.).
 		std::shared_ptr<IServerGame> _game; ///< Pointer to the active game instance.
-		bool _isGameServerStarted; ///< Flag indicating if the game server thread has started.
+		bool _isGameServerStarted; ///< Flag indicating if the game instance was handed to the RoomPool.
 		std::map<uint32_t, bool> _clients; ///< Maps client IDs to their ready status (true = ready).
+		std::vector<uint32_t> _clientIds; ///< IDs of _clients, kept in sync for broadcasts.
 		int _roomHost; ///< Client ID of the room host/creator (-1 if no host).
 
 	public:
@@ -98,6 +99,13 @@ class Room {
 		 */
 		std::map<uint32_t, bool> getClients() const;
 
+		/**
+		 * @brief Gets the IDs of the clients in the room, without copying.
+		 *
+		 * @return Reference to the client IDs, in ascending order.
+		 */
+		const std::vector<uint32_t> &getClientIds() const;
+
 		/**
 		 * @brief Checks if the room is at maximum capacity.
 		 *
@@ -191,12 +199,21 @@ class Room {
 		void setGameStatus(GameStatus status);
 
 		/**
-		 * @brief Starts the game instance for this room.
+		 * @brief Marks the game of this room as started and hands it the players.
 		 *
-		 * Initializes the game server, creates a new game instance, and launches
-		 * it in a separate thread. Players transition from the lobby to active gameplay.
+		 * The caller schedules the returned instance on the RoomPool, which
+		 * loads it and ticks it. Players transition from the lobby to active gameplay.
+		 *
+		 * @return The game instance to run.
+		 */
+		std::shared_ptr<IServerGame> startGame();
+
+		/**
+		 * @brief Ends the running game and gets the room ready for a new one.
 		 *
-		 * @param roomId The unique identifier for this room.
+		 * The old instance is stopped and released by the RoomPool after its
+		 * current tick; the room gets a fresh instance and waits for players again.
+		 * Does nothing if the game was not started.
 		 */
-		void startGame(int roomId);
+		void stopGame();
 };
\ No newline at end of file
@@ -7,8 +7,9 @@
 
 #include "RoomManager.hpp"
 #include "Logger.hpp"
+#include <format>
 
-RoomManager::RoomManager(int maxRooms) {
+RoomManager::RoomManager(int maxRooms, uint32_t tickRate) : _pool(0, tickRate) {
 	_maxRooms = maxRooms;
 	_currentId = 0;
 }
@@ -17,6 +18,14 @@ int RoomManager::getMaxRooms() const {
 	return _maxRooms;
 }
 
+uint32_t RoomManager::getTickRate() const {
+	return _pool.getTickRate();
+}
+
+std::map<int, std::shared_ptr<metrics::TickProfiler>> RoomManager::getProfilers() const {
+	return _pool.getProfilers();
+}
+
 bool RoomManager::roomExists(int id) const {
 	for (auto &room: _rooms) {
 		if (room.first == id)
@@ -55,21 +64,34 @@ void RoomManager::addClientInRoom(uint32_t clientId, int roomId) {
 	auto room = getRoom(roomId);
 
 	for (auto &r: _rooms) {
-		for (auto &p: r.second->getClients()) {
-			if (p.first == clientId)
-				r.second->removeClient(clientId);
-		}
+		if (r.second->isClientInRoom(clientId))
+			removeClientFromRoom(clientId, r.first);
 	}
 	room->addClient(clientId);
 }
 
+void RoomManager::removeClientFromRoom(uint32_t clientId, int roomId) {
+	if (!roomExists(roomId))
+		return;
+	auto room = getRoom(roomId);
+
+	room->removeClient(clientId);
+	if (room->isEmpty() && room->isGameServerStarted()) {
+		LOG_INFO(std::format("Room {} is empty, stopping its game", roomId));
+		room->stopGame();
+	}
+}
+
 void RoomManager::removeRoom(int id) {
 	if (!roomExists(id))
 		return;
+	_rooms.at(id)->stopGame();
 	_rooms.erase(id);
 }
 
 void RoomManager::clearRooms() {
+	for (auto &room: _rooms)
+		room.second->stopGame();
 	_rooms.clear();
 }
 
@@ -81,6 +103,5 @@ void RoomManager::startRoom(int id) {
 	if (room->isGameServerStarted())
 		return;
 	LOG_INFO(std::format("Starting game for room {}", id));
-	std::thread t(&Room::startGame, room, id);
-	t.detach();
+	_pool.add(room->startGame(), id);
 }
@@ -9,6 +9,7 @@
 
 #include <cstdint>
 #include "Room.hpp"
+#include "RoomPool.hpp"
 #include <map>
 #include <optional>
 
@@ -20,23 +21,26 @@
  * It maintains a registry of active rooms, handles room capacity limits, and provides
  * utilities for finding rooms by ID or by client membership. The manager ensures
  * proper resource allocation and prevents exceeding the maximum number of concurrent rooms.
+ * Started games all run on one RoomPool sized to the machine, whatever the number of rooms.
  */
 class RoomManager {
 	private:
 		std::map<int, std::shared_ptr<Room>> _rooms; ///< Maps room IDs to room instances.
 		int _currentId; ///< Counter for generating unique room IDs.
 		int _maxRooms; ///< Maximum number of concurrent rooms allowed.
+		RoomPool _pool; ///< Worker threads ticking the games of every started room.
 
 	public:
 		/**
 		 * @brief Constructs a RoomManager with a specified maximum room capacity.
 		 *
 		 * @param maxRooms Maximum number of rooms that can exist simultaneously (default: 5).
+		 * @param tickRate Ticks per second of the games (default: 60).
 		 */
-		RoomManager(int maxRooms = 5);
+		RoomManager(int maxRooms = 5, uint32_t tickRate = timing::DEFAULT_TICK_RATE);
 
 		/**
-		 * @brief Destructor that cleans up all rooms.
+		 * @brief Destructor that stops the RoomPool and cleans up all rooms.
 		 */
 		~RoomManager() = default;
 
@@ -47,6 +51,20 @@ class RoomManager {
 		 */
 		int getMaxRooms() const;
 
+		/**
+		 * @brief Gets the tick rate the games run at.
+		 *
+		 * @return Ticks per second.
+		 */
+		uint32_t getTickRate() const;
+
+		/**
+		 * @brief Gets the profilers of the running games, by room.
+		 *
+		 * @return Room ID and profiler of every game running on the pool.
+		 */
+		std::map<int, std::shared_ptr<metrics::TickProfiler>> getProfilers() const;
+
 		/**
 		 * @brief Retrieves a room by its unique ID.
 		 *
@@ -100,10 +118,18 @@ class RoomManager {
 		 */
 		void addClientInRoom(uint32_t clientId, int roomId);
 
+		/**
+		 * @brief Removes a client from a room, ending its game if nobody is left.
+		 *
+		 * @param clientId The client ID to remove.
+		 * @param roomId The room the client leaves.
+		 */
+		void removeClientFromRoom(uint32_t clientId, int roomId);
+
 		/**
 		 * @brief Removes a room from the manager.
 		 *
-		 * Deletes the specified room and frees its resources.
+		 * Deletes the specified room and frees its resources, stopping its game.
 		 *
 		 * @param id The room ID to remove.
 		 */
@@ -119,7 +145,7 @@ class RoomManager {
 		/**
 		 * @brief Starts the game for a specific room.
 		 *
-		 * Initiates gameplay for the specified room if it meets the ready conditions.
+		 * Schedules the room's game on the RoomPool if it is not running yet.
 		 *
 		 * @param id The room ID to start.
 		 */
@@ -0,0 +1,139 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** RoomPool
+*/
+
+#include "RoomPool.hpp"
+#include "../Include/IServerGame.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <format>
+
+RoomPool::RoomPool(std::size_t workers, uint32_t tickRate) : _tickRate(tickRate) {
+	if (workers == 0)
+		workers = std::max(1u, std::thread::hardware_concurrency());
+	_workers.reserve(workers);
+	for (std::size_t i = 0; i < workers; ++i)
+		_workers.emplace_back(&RoomPool::workerLoop, this);
+	LOG_INFO(std::format("Room pool started with {} workers at {} ticks per second", workers, _tickRate));
+}
+
+RoomPool::~RoomPool() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stopping = true;
+	}
+	_wake.notify_all();
+	for (auto &worker: _workers)
+		worker.join();
+}
+
+void RoomPool::add(std::shared_ptr<IServerGame> game, int roomId) {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto profiler = game->getProfiler();
+		if (profiler)
+			_profilers[roomId] = profiler;
+		_tasks.push_back(Task{Clock::now(), std::move(game), roomId, false, timing::FixedTimestep(_tickRate), std::move(profiler)});
+		std::push_heap(_tasks.begin(), _tasks.end(), laterThan);
+	}
+	_wake.notify_one();
+}
+
+std::size_t RoomPool::getWorkerCount() const {
+	return _workers.size();
+}
+
+std::size_t RoomPool::getGameCount() const {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _tasks.size() + _busy;
+}
+
+uint32_t RoomPool::getTickRate() const {
+	return _tickRate;
+}
+
+std::map<int, std::shared_ptr<metrics::TickProfiler>> RoomPool::getProfilers() const {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _profilers;
+}
+
+bool RoomPool::laterThan(Task const &a, Task const &b) {
+	return a.due > b.due;
+}
+
+bool RoomPool::step(Task &task) {
+	try {
+		if (!task.started) {
+			task.started = true;
+			task.game->start(task.roomId);
+			// Loading a level may take a while: the first tick is due once it is done.
+			task.clock.reset(Clock::now());
+		} else {
+			Clock::time_point now = Clock::now();
+			uint64_t skipped = task.clock.skippedTicks();
+			uint32_t due = task.clock.advance(now);
+			if (task.clock.skippedTicks() != skipped)
+				LOG_WARN(std::format("Game of room {} fell behind, skipped {} ticks", task.roomId, task.clock.skippedTicks() - skipped));
+			if (task.profiler) {
+				task.profiler->lateness().record(metrics::elapsedNs(task.due, now));
+				task.profiler->skippedTicks.add(task.clock.skippedTicks() - skipped);
+			}
+			for (uint32_t i = 0; i < due; ++i) {
+				Clock::time_point start = Clock::now();
+				if (!task.game->tick(task.clock.dt()))
+					return false;
+				if (task.profiler)
+					task.profiler->tick().record(metrics::elapsedNs(start, Clock::now()));
+			}
+		}
+		task.due = task.clock.nextDeadline();
+		return true;
+	} catch (const std::exception &e) {
+		LOG_ERROR(std::format("Game of room {} stopped: {}", task.roomId, e.what()));
+		return false;
+	}
+}
+
+void RoomPool::workerLoop() {
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (!_stopping) {
+		if (_tasks.empty()) {
+			_wake.wait(lock);
+			continue;
+		}
+		// Another task may be added with an earlier due time, or taken by
+		// another worker, while waiting: look again after every wake-up.
+		Clock::time_point due = _tasks.front().due;
+		if (Clock::now() < due) {
+			_wake.wait_until(lock, due);
+			continue;
+		}
+		std::pop_heap(_tasks.begin(), _tasks.end(), laterThan);
+		Task task = std::move(_tasks.back());
+		_tasks.pop_back();
+		++_busy;
+		lock.unlock();
+
+		bool running = step(task);
+		if (!running) {
+			LOG_INFO(std::format("Released game of room {}", task.roomId));
+			task.game.reset();
+		}
+
+		lock.lock();
+		--_busy;
+		if (!running) {
+			auto profiler = _profilers.find(task.roomId);
+			if (profiler != _profilers.end() && profiler->second == task.profiler)
+				_profilers.erase(profiler);
+		}
+		if (running) {
+			_tasks.push_back(std::move(task));
+			std::push_heap(_tasks.begin(), _tasks.end(), laterThan);
+			_wake.notify_one();
+		}
+	}
+}
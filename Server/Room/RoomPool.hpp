@@ -0,0 +1,138 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** RoomPool
+*/
+
+#pragma once
+
+#include "FixedTimestep.hpp"
+#include "TickProfiler.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class IServerGame;
+
+/**
+ * @class RoomPool
+ * @brief Runs the games of every room on a fixed set of worker threads.
+ *
+ * Each running game is a task with its own timing::FixedTimestep. A worker
+ * takes the task due first, waits until its deadline, runs the ticks due by
+ * then (several in a row when the game fell behind, up to
+ * timing::MAX_CATCH_UP_TICKS) and puts the task back at its next absolute
+ * deadline. A task is held by a single worker at a time, so the ticks of a
+ * game never overlap and need no locking of their own. The first time a
+ * task is taken, the worker calls start() instead of waiting for a tick.
+ *
+ * When tick() returns false or throws, the task is dropped and the pool
+ * releases its reference to the game.
+ *
+ * Whole ticks, and how late after their deadline they started, are recorded
+ * into the game's metrics::TickProfiler next to the phases the game times.
+ */
+class RoomPool {
+	public:
+		using Clock = std::chrono::steady_clock; ///< Clock of the due times.
+
+		/**
+		 * @brief Starts the worker threads.
+		 *
+		 * @param workers Number of worker threads; 0 uses one per hardware thread.
+		 * @param tickRate Ticks per second of every game.
+		 */
+		explicit RoomPool(std::size_t workers = 0, uint32_t tickRate = timing::DEFAULT_TICK_RATE);
+
+		/**
+		 * @brief Stops and joins the workers, dropping every game still running.
+		 *
+		 * Ticks in progress are finished first.
+		 */
+		~RoomPool();
+
+		RoomPool(RoomPool const &) = delete;
+		RoomPool &operator=(RoomPool const &) = delete;
+
+		/**
+		 * @brief Schedules a game: start() as soon as a worker is free, then tickRate ticks per second.
+		 *
+		 * @param game The game to run.
+		 * @param roomId Room handed to start().
+		 */
+		void add(std::shared_ptr<IServerGame> game, int roomId);
+
+		/**
+		 * @brief Gets the number of worker threads.
+		 *
+		 * @return Worker count.
+		 */
+		std::size_t getWorkerCount() const;
+
+		/**
+		 * @brief Gets the number of games scheduled or being ticked.
+		 *
+		 * @return Running game count.
+		 */
+		std::size_t getGameCount() const;
+
+		/**
+		 * @brief Gets the tick rate of the games.
+		 *
+		 * @return Ticks per second.
+		 */
+		uint32_t getTickRate() const;
+
+		/**
+		 * @brief Gets the profilers of the games running, by room.
+		 *
+		 * @return Room ID and profiler of every game that has one.
+		 */
+		std::map<int, std::shared_ptr<metrics::TickProfiler>> getProfilers() const;
+
+	private:
+		/**
+		 * @brief A scheduled game.
+		 */
+		struct Task {
+			Clock::time_point due; ///< When the next tick (or start()) should run.
+			std::shared_ptr<IServerGame> game; ///< The game to tick.
+			int roomId; ///< Room handed to start().
+			bool started; ///< Whether start() already ran.
+			timing::FixedTimestep clock; ///< Ticks due and next deadline of the game.
+			std::shared_ptr<metrics::TickProfiler> profiler; ///< Profiler of the game, may be null.
+		};
+
+		/**
+		 * @brief Orders _tasks as a min-heap on the due time.
+		 */
+		static bool laterThan(Task const &a, Task const &b);
+
+		/**
+		 * @brief Body of a worker thread.
+		 */
+		void workerLoop();
+
+		/**
+		 * @brief Runs start() or the due ticks of a task outside the lock, then sets its next due time.
+		 *
+		 * @return false if the game is over or failed.
+		 */
+		static bool step(Task &task);
+
+		uint32_t _tickRate; ///< Ticks per second of every game.
+		mutable std::mutex _mutex; ///< Protects every member below.
+		std::condition_variable _wake; ///< Signals new tasks and shutdown.
+		std::vector<Task> _tasks; ///< Games waiting for their next tick, heap ordered.
+		std::size_t _busy = 0; ///< Games currently being ticked.
+		std::map<int, std::shared_ptr<metrics::TickProfiler>> _profilers; ///< Profilers of the games scheduled or being ticked.
+		bool _stopping = false; ///< Set by the destructor.
+		std::vector<std::thread> _workers; ///< Worker threads.
+};
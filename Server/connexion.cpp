@@ -7,8 +7,10 @@
 
 #include "Include/connexion.hpp"
 #include "Logger.hpp"
+#include <array>
 #include <asio.hpp>
 #include <chrono>
+#include <cstring>
 #include <format>
 #include <thread>
 
@@ -29,32 +31,42 @@ void Connexion::startListening() {
 void Connexion::stopListening() {
 	bool wasListening = listening.exchange(false);
 	if (wasListening) {
-		queueCv.notify_all();
+		{
+			std::lock_guard<std::mutex> lock(wakeMutex);
+			wakeCv.notify_all();
+		}
 		if (receiverThread.joinable())
 			receiverThread.join();
 	}
 }
 
 bool Connexion::waitForPacket(ReceivedPacket &packet, std::chrono::milliseconds timeout) {
-	std::unique_lock<std::mutex> lock(queueMutex);
-	if (!queueCv.wait_for(lock, timeout, [this]() {
-		return !packetQueue.empty() || !listening.load();
-	}))
-		return false;
-	if (packetQueue.empty())
-		return false;
-	packet = std::move(packetQueue.front());
-	packetQueue.pop();
-	return true;
+	if (packetRing.try_pop(packet))
+		return true;
+	std::unique_lock<std::mutex> lock(wakeMutex);
+	bool popped = false;
+	consumerWaiting.store(true, std::memory_order_relaxed);
+	// Pairs with the fence in wakeConsumer(): either the receiver sees us
+	// waiting, or we see what it pushed before looking.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	wakeCv.wait_for(lock, timeout, [&]() {
+		popped = packetRing.try_pop(packet);
+		return popped || !listening.load();
+	});
+	consumerWaiting.store(false, std::memory_order_relaxed);
+	return popped;
 }
 
 bool Connexion::tryPopPacket(ReceivedPacket &packet) {
-	std::lock_guard<std::mutex> lock(queueMutex);
-	if (packetQueue.empty())
-		return false;
-	packet = std::move(packetQueue.front());
-	packetQueue.pop();
-	return true;
+	return packetRing.try_pop(packet);
+}
+
+void Connexion::wakeConsumer() {
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (!consumerWaiting.load(std::memory_order_relaxed))
+		return;
+	std::lock_guard<std::mutex> lock(wakeMutex);
+	wakeCv.notify_one();
 }
 
 void Connexion::broadcastToClients(const std::vector<uint32_t> &clients, const void *data, size_t size) {
@@ -75,6 +87,14 @@ void Connexion::sendTo(const void *msg, size_t size, const asio::ip::udp::endpoi
 	}
 }
 
+void Connexion::sendToClient(uint32_t id, const void *msg, size_t size) {
+	try {
+		socket.broadcastToClients(&id, 1, msg, size);
+	} catch (const std::exception &e) {
+		LOG_ERROR(std::format("Connexion::sendToClient(): {}", e.what()));
+	}
+}
+
 void Connexion::broadcast(const void *msg, size_t size) {
 	try {
 		socket.broadcast(msg, size);
@@ -84,12 +104,12 @@ void Connexion::broadcast(const void *msg, size_t size) {
 }
 
 void Connexion::broadcastToRoom(Room const &room, const void *msg, size_t size) {
-	std::vector<uint32_t> roomClients;
+	const auto &roomClients = room.getClientIds();
 
-	for (auto c: room.getClients())
-		roomClients.push_back(c.first);
+	if (roomClients.empty())
+		return;
 	try {
-		socket.broadcastToClients(roomClients, msg, size);
+		socket.broadcastToClients(roomClients.data(), roomClients.size(), msg, size);
 	} catch (const std::exception &e) {
 		LOG_ERROR(std::format("Connexion::broadcastToRoom(): {}", e.what()));
 	}
@@ -102,6 +122,11 @@ void Connexion::addClient(const asio::ip::udp::endpoint &endpoint, uint32_t id)
 		endpoints[addrStr] = endpoint;
 
 		socket.addClient(endpoint, id);
+
+		std::lock_guard<std::mutex> lock(reliableMutex);
+		if (id >= reliablePeers.size())
+			reliablePeers.resize(static_cast<size_t>(id) + 1);
+		reliablePeers[id] = ReliablePeer{true, endpoint, reliable::Connection(id)};
 	} catch (const std::exception &e) {
 		LOG_ERROR(std::format("Connexion::addClient(): {}", e.what()));
 	}
@@ -127,45 +152,89 @@ void Connexion::disconnectClient(uint32_t id) {
 		}
 		clientNames.erase(id);
 		socket.disconnectClient(id);
+
+		std::lock_guard<std::mutex> lock(reliableMutex);
+		if (id < reliablePeers.size())
+			reliablePeers[id] = ReliablePeer{};
 	} catch (const std::exception &e) {
 		LOG_ERROR(std::format("Connexion::disconnectClient(): {}", e.what()));
 	}
 }
 
-bool Connexion::acceptTcpClient(uint32_t id, uint16_t port) {
+void Connexion::sendReliable(uint32_t id, reliable::Channel channel, const void *data, size_t size) {
 	try {
-		auto client = std::make_shared<TCP_socket>(port);
-		if (!client->acceptClient())
-			return false;
-		tcpClients[id] = client;
-		LOG_INFO(std::format("TCP client {} accepted on port {}", id, port));
-		return true;
+		std::lock_guard<std::mutex> lock(reliableMutex);
+		if (id >= reliablePeers.size() || !reliablePeers[id].connected) {
+			LOG_WARN(std::format("sendReliable(): client {} not found", id));
+			return;
+		}
+		ReliablePeer &peer = reliablePeers[id];
+		if (!peer.connection.send(channel, data, size))
+			LOG_WARN(std::format("sendReliable(): too much unacked data for client {}, message dropped", id));
+		flushReliable(peer, reliable::Connection::Clock::now());
 	} catch (const std::exception &e) {
-		LOG_ERROR(std::format("acceptTcpClient(): {}", e.what()));
-		return false;
+		LOG_ERROR(std::format("sendReliable(): {}", e.what()));
 	}
 }
 
-void Connexion::sendJsonToClient(uint32_t id, const nlohmann::json &j) {
-	try {
-		if (tcpClients.find(id) != tcpClients.end()) {
-			tcpClients[id]->sendJson(j);
-		} else {
-			LOG_WARN(std::format("sendJsonToClient(): client {} not found", id));
-		}
-	} catch (const std::exception &e) {
-		LOG_ERROR(std::format("sendJsonToClient(): ", e.what()));
+void Connexion::broadcastReliable(const std::vector<uint32_t> &clientIds, reliable::Channel channel, const void *data, size_t size) {
+	for (uint32_t id : clientIds)
+		sendReliable(id, channel, data, size);
+}
+
+void Connexion::flushReliable(ReliablePeer &peer, reliable::Connection::Clock::time_point now) {
+	peer.connection.flush(now, [&](const uint8_t *data, size_t size) {
+		socket.sendTo(data, size, peer.endpoint);
+	});
+	if (peer.connection.has_unacked())
+		reliableBacklog.store(true, std::memory_order_relaxed);
+}
+
+void Connexion::flushAllReliable() {
+	std::lock_guard<std::mutex> lock(reliableMutex);
+	auto now = reliable::Connection::Clock::now();
+	bool backlog = false;
+	for (auto &peer : reliablePeers) {
+		if (!peer.connected)
+			continue;
+		peer.connection.flush(now, [&](const uint8_t *data, size_t size) {
+			socket.sendTo(data, size, peer.endpoint);
+		});
+		backlog = backlog || peer.connection.has_unacked();
 	}
+	reliableBacklog.store(backlog, std::memory_order_relaxed);
 }
 
-void Connexion::broadcastJson(const nlohmann::json &j) {
-	try {
-		for (auto &[id, client]: tcpClients) {
-			client->sendJson(j);
-		}
-	} catch (const std::exception &e) {
-		LOG_ERROR(std::format("broadcastJson(): {}", e.what()));
+void Connexion::handleReliable(ReceivedPacket &packet) {
+	if (packet.data.size() < sizeof(ReliableHeader))
+		return;
+	ReliableHeader header;
+	std::memcpy(&header, packet.data.data(), sizeof(header));
+	uint32_t id = ntohl(header.clientId);
+
+	std::lock_guard<std::mutex> lock(reliableMutex);
+	if (id >= reliablePeers.size() || !reliablePeers[id].connected || reliablePeers[id].endpoint != packet.endpoint)
+		return;
+	ReliablePeer &peer = reliablePeers[id];
+	if (!peer.connection.on_packet(reliable::Connection::Clock::now(), packet.data.data(), packet.data.size())) {
+		LOG_WARN(std::format("handleReliable(): malformed datagram from client {}", id));
+		return;
 	}
+
+	reliable::Channel channel;
+	bool pushed = false;
+	while (peer.connection.receive(channel, reliableMessage.data)) {
+		if (channel != reliable::Channel::Events || reliableMessage.data.empty())
+			continue;
+		reliableMessage.endpoint = packet.endpoint;
+		if (packetRing.try_push(reliableMessage))
+			pushed = true;
+		else
+			LOG_WARN("handleReliable(): packet ring full, reliable message dropped");
+	}
+	if (pushed)
+		wakeConsumer();
+	flushReliable(peer, reliable::Connection::Clock::now());
 }
 
 void Connexion::setClientName(uint32_t id, std::string name) {
@@ -179,6 +248,14 @@ std::string Connexion::getClientName(uint32_t id) const {
 	return {};
 }
 
+UDP_socket::Traffic Connexion::getTraffic() const {
+	return socket.getTraffic();
+}
+
+uint64_t Connexion::getDroppedPackets() const {
+	return droppedPackets.load(std::memory_order_relaxed);
+}
+
 size_t Connexion::getClientCount() const {
 	return clients.size();
 }
@@ -192,19 +269,34 @@ const std::unordered_map<std::string, asio::ip::udp::endpoint> &Connexion::getEn
 }
 
 void Connexion::receiverLoop() {
+	std::array<ReceivedPacket, RECEIVE_BATCH> batch;
+
 	while (listening.load()) {
 		try {
-			std::vector<uint8_t> data;
-			asio::ip::udp::endpoint endpoint;
-			if (socket.try_receive(data, endpoint) && !data.empty()) {
-				{
-					std::lock_guard<std::mutex> lock(queueMutex);
-					packetQueue.push(ReceivedPacket{std::move(data), endpoint});
+			bool backlog = reliableBacklog.load(std::memory_order_relaxed);
+			bool readable = socket.wait_readable(backlog ? RELIABLE_FLUSH_INTERVAL : RECEIVE_POLL_TIMEOUT);
+			if (backlog)
+				flushAllReliable();
+			if (!readable)
+				continue;
+			size_t count = socket.receive_batch(batch.data(), batch.size());
+			size_t dropped = 0;
+			for (size_t i = 0; i < count; ++i) {
+				if (batch[i].data.empty())
+					continue;
+				if (batch[i].data[0] == static_cast<uint8_t>(MessageType::Reliable)) {
+					handleReliable(batch[i]);
+					continue;
 				}
-				queueCv.notify_one();
-			} else {
-				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				if (!packetRing.try_push(batch[i]))
+					++dropped;
+			}
+			if (dropped) {
+				droppedPackets.fetch_add(dropped, std::memory_order_relaxed);
+				LOG_WARN(std::format("Connexion::receiverLoop(): packet ring full, dropped {} packets", dropped));
 			}
+			if (count)
+				wakeConsumer();
 		} catch (const std::exception &e) {
 			LOG_ERROR(std::format("Connexion::receiverLoop(): {}", e.what()));
 		}
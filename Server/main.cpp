@@ -7,6 +7,8 @@
 
 #include "Include/server.hpp"
 #include "Logger.hpp"
+#include "FixedTimestep.hpp"
+#include <format>
 
 bool is_number(std::string const &str) {
 	std::string::const_iterator it = str.begin();
@@ -22,18 +24,30 @@ bool is_number(std::string const &str) {
 int main(int argc, char *argv[]) {
 	if (argc < 2) {
 		LOG_ERROR("You must enter a port for the server to listen on.");
-		std::cerr << "Usage: " << argv[0] << " <server_port> " << std::endl;
+		std::cerr << "Usage: " << argv[0] << " <server_port> [tick_rate] [room_count] " << std::endl;
 		return 1;
 	}
 	std::string const port = std::string(argv[1]);
+	std::string const tickRate = argc > 2 ? std::string(argv[2]) : std::to_string(timing::DEFAULT_TICK_RATE);
+	std::string const roomCount = argc > 3 ? std::string(argv[3]) : std::to_string(GameServer::DEFAULT_ROOMS);
 
 	LOG_INFO("Starting server...");
 	if (port == "" || !is_number(port)) {
 		LOG_ERROR("The port number entered is invalid! Port must not be empty and contains only numbers!");
-		std::cerr << "Usage: " << argv[0] << " <server_port> " << std::endl;
+		std::cerr << "Usage: " << argv[0] << " <server_port> [tick_rate] [room_count] " << std::endl;
 		return 1;
 	}
-	GameServer server(static_cast<uint16_t>(std::stoi(port)));
+	if (!is_number(tickRate) || tickRate.size() > 3 || !timing::isSupportedTickRate(std::stoul(tickRate))) {
+		LOG_ERROR("The tick rate entered is invalid! It must be 30, 60 or 120.");
+		std::cerr << "Usage: " << argv[0] << " <server_port> [tick_rate] [room_count] " << std::endl;
+		return 1;
+	}
+	if (!is_number(roomCount) || roomCount.size() > 2 || std::stoi(roomCount) < 1 || std::stoi(roomCount) > GameServer::MAX_ROOMS) {
+		LOG_ERROR(std::format("The room count entered is invalid! It must be between 1 and {}.", GameServer::MAX_ROOMS));
+		std::cerr << "Usage: " << argv[0] << " <server_port> [tick_rate] [room_count] " << std::endl;
+		return 1;
+	}
+	GameServer server(static_cast<uint16_t>(std::stoi(port)), static_cast<uint32_t>(std::stoul(tickRate)), std::stoi(roomCount));
 	server.run();
 	return 0;
 }
@@ -9,19 +9,24 @@
 #include "Include/IServerGame.hpp"
 #include "../Game/Game_logic/Rungame.hpp"
 #include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <thread>
 #include <cstring>
 #include <string>
 #include <optional>
 #include <format>
+#include <nlohmann/json.hpp>
 #include "Logger.hpp"
 #include "WeaponDefinition.hpp"
 
-GameServer::GameServer(uint16_t port) : connexion(ioContext, port), roomManager(4) {
+GameServer::GameServer(uint16_t port, uint32_t tickRate, int roomCount) : connexion(ioContext, port), roomManager(roomCount, tickRate) {
 	roomManager.addRoom(Room(connexion, 4, 4, "Room 1"));
 	roomManager.addRoom(Room(connexion, 4, 4, "Room 2"));
 	roomManager.addRoom(Room(connexion, 6, 4, "Room 3"));
 	roomManager.addRoom(Room(connexion, 2, 2, "Room 4"));
+	for (int i = DEFAULT_ROOMS; i < roomCount; ++i)
+		roomManager.addRoom(Room(connexion, 4, 4, std::format("Room {}", i + 1)));
 }
 
 static void sigintHandler(int s) {
@@ -35,9 +40,15 @@ void GameServer::run() {
 	signal(SIGINT, sigintHandler);
 	LOG_INFO("Server started. Now listening for connections...");
 	connexion.startListening();
+	startTime = std::chrono::steady_clock::now();
+	nextStatsDump = startTime + STATS_INTERVAL;
 
+	Connexion::ReceivedPacket packet;
 	while (serverRunning) {
-		Connexion::ReceivedPacket packet;
+		if (std::chrono::steady_clock::now() >= nextStatsDump) {
+			writeStats();
+			nextStatsDump += STATS_INTERVAL;
+		}
 		if (!connexion.waitForPacket(packet, std::chrono::milliseconds(5)))
 			continue;
 		processIncomingPacket(packet);
@@ -55,11 +66,6 @@ void GameServer::handleClientHello(const std::vector<uint8_t> &data, const asio:
 	uint32_t clientId = nextClientId++;
 	connexion.addClient(clientEndpoint, clientId);
 	connexion.setClientName(clientId, std::string(msg->clientName));
-	uint16_t tcpPort = 5000 + clientId;
-	std::thread([this, clientId, tcpPort]() {
-		if (!connexion.acceptTcpClient(clientId, tcpPort))
-			LOG_ERROR(std::format("TCP accept failed for client {}", clientId));
-	}).detach();
 	ServerAssignIdMessage assignMsg{};
 	assignMsg.type = MessageType::ServerAssignId;
 	assignMsg.clientId = htonl(clientId);
@@ -147,6 +153,7 @@ void GameServer::broadcastGameStart(uint32_t roomId) {
 	GameStartMessage msg{};
 	msg.type = MessageType::GameStart;
 	msg.clientCount = htonl(room->getClients().size());
+	msg.tickRate = htonl(roomManager.getTickRate());
 	connexion.broadcastToRoom(*room.get(), &msg, sizeof(msg));
 }
 
@@ -218,12 +225,10 @@ void GameServer::handle_client_message(const std::vector<uint8_t> &data, const a
 	if (data.size() < sizeof(ClientInputMessage)) return;
 	const ClientInputMessage *msg = reinterpret_cast<const ClientInputMessage *>(data.data());
 	uint32_t id = ntohl(msg->clientId);
-	InputCode code = static_cast<InputCode>(msg->inputCode);
-	bool pressed = msg->isPressed != 0;
 	(void) from;
-	std::cout << "[ServerBootstrap][Input] received event from client " << id
-			<< " code=" << inputCodeToString(code)
-			<< " pressed=" << pressed << std::endl;
+	LOG_DEBUG("[ServerBootstrap][Input] received commands from client " << id
+			<< " up to #" << ntohl(msg->sequence)
+			<< " count=" << static_cast<int>(msg->count));
 }
 
 void GameServer::handleClientConfirmStart(const std::vector<uint8_t> &data, const asio::ip::udp::endpoint &from) {
@@ -251,11 +256,10 @@ void GameServer::handleClientLeaveRoom(const std::vector<uint8_t> &data, const a
 	const ClientLeaveRoomMessage *msg = reinterpret_cast<const ClientLeaveRoomMessage *>(data.data());
 	if (!roomManager.roomExists(msg->roomId)) return;
 
-	auto room = roomManager.getRoom(msg->roomId);
-	room->removeClient(msg->clientId);
+	roomManager.removeClientFromRoom(msg->clientId, msg->roomId);
 }
 
-void GameServer::processIncomingPacket(const Connexion::ReceivedPacket &packet) {
+void GameServer::processIncomingPacket(Connexion::ReceivedPacket &packet) {
 	if (packet.data.size() < sizeof(MessageType))
 		return;
 	MessageType type = *reinterpret_cast<const MessageType *>(packet.data.data());
@@ -287,7 +291,7 @@ void GameServer::processIncomingPacket(const Connexion::ReceivedPacket &packet)
 	}
 }
 
-void GameServer::routePacketToGame(const Connexion::ReceivedPacket &packet, MessageType type) {
+void GameServer::routePacketToGame(Connexion::ReceivedPacket &packet, MessageType type) {
 	uint32_t clientId = 0;
 	bool hasClient = false;
 
@@ -365,7 +369,7 @@ void GameServer::routePacketToGame(const Connexion::ReceivedPacket &packet, Mess
 		LOG_WARN(std::format("routePacketToGame(): game instance missing for room {}", roomId.value()));
 		return;
 	}
-	game->enqueuePacket(packet.data, packet.endpoint);
+	game->enqueuePacket(packet);
 }
 
 void GameServer::sleep_to_maintain_tick(const std::chrono::high_resolution_clock::time_point &start, int tick_ms) {
@@ -374,3 +378,71 @@ void GameServer::sleep_to_maintain_tick(const std::chrono::high_resolution_clock
 	if (elapsed_ms < tick_ms)
 		std::this_thread::sleep_for(std::chrono::milliseconds(tick_ms - elapsed_ms));
 }
+
+namespace {
+	double toMicroseconds(uint64_t nanoseconds) {
+		return static_cast<double>(nanoseconds) / 1000.0;
+	}
+
+	nlohmann::json summaryToJson(metrics::Summary const &summary) {
+		return {
+			{"count", summary.count},
+			{"p50_us", toMicroseconds(summary.p50)},
+			{"p99_us", toMicroseconds(summary.p99)},
+			{"max_us", toMicroseconds(summary.max)},
+			{"mean_us", summary.count ? toMicroseconds(summary.total / summary.count) : 0.0},
+		};
+	}
+}
+
+void GameServer::writeStats() {
+	auto now = std::chrono::steady_clock::now();
+	UDP_socket::Traffic traffic = connexion.getTraffic();
+
+	nlohmann::json stats;
+	stats["uptime_s"] = std::chrono::duration<double>(now - startTime).count();
+	stats["interval_s"] = std::chrono::duration<double>(STATS_INTERVAL).count();
+	stats["tick_rate"] = roomManager.getTickRate();
+	stats["network"] = {
+		{"packets_in", traffic.packetsIn},
+		{"bytes_in", traffic.bytesIn},
+		{"packets_out", traffic.packetsOut},
+		{"bytes_out", traffic.bytesOut},
+		{"dropped_packets", connexion.getDroppedPackets()},
+	};
+	stats["rooms"] = nlohmann::json::array();
+	for (auto const &[roomId, profiler] : roomManager.getProfilers()) {
+		metrics::TickReport report = profiler->collect();
+		nlohmann::json phases = nlohmann::json::object();
+		for (auto const &[name, summary] : report.phases)
+			phases[name] = summaryToJson(summary);
+		stats["rooms"].push_back({
+			{"room", roomId},
+			{"tick", summaryToJson(report.tick)},
+			{"lateness", summaryToJson(report.lateness)},
+			{"skipped_ticks", report.skippedTicks},
+			{"phases", phases},
+			{"packets_in", report.packetsIn},
+			{"bytes_in", report.bytesIn},
+			{"packets_out", report.packetsOut},
+			{"bytes_out", report.bytesOut},
+			{"max_pending_packets", report.pendingPackets},
+			{"dropped_packets", report.droppedPackets},
+			{"max_queued_commands", report.queuedCommands},
+		});
+	}
+
+	std::string tmpPath = std::string(STATS_FILE) + ".tmp";
+	{
+		std::ofstream file(tmpPath, std::ios::trunc);
+		if (!file.is_open()) {
+			LOG_WARN(std::format("Cannot write server stats to {}", tmpPath));
+			return;
+		}
+		file << stats.dump(2) << '\n';
+	}
+	std::error_code ec;
+	std::filesystem::rename(tmpPath, STATS_FILE, ec);
+	if (ec)
+		LOG_WARN(std::format("Cannot write server stats to {}: {}", STATS_FILE, ec.message()));
+}
@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Fixed timestep simulation clock implementation
+*/
+
+#include "FixedTimestep.hpp"
+#include <algorithm>
+
+namespace timing {
+
+    bool isSupportedTickRate(uint32_t tickRate) {
+        return tickRate == 30 || tickRate == 60 || tickRate == 120;
+    }
+
+    FixedTimestep::FixedTimestep(uint32_t tickRate, uint32_t maxCatchUp)
+        : _tickRate(std::max(1u, tickRate)), _maxCatchUp(std::max(1u, maxCatchUp)),
+          _dt(1.0f / static_cast<float>(_tickRate)) {
+        reset(Clock::now());
+    }
+
+    void FixedTimestep::reset(Clock::time_point now) {
+        _start = now;
+        _ticks = 0;
+        _skipped = 0;
+    }
+
+    Clock::time_point FixedTimestep::deadline(uint64_t tick) const {
+        // Whole seconds and remainder apart, so that tick * 1e9 cannot overflow.
+        // Rounded up, so that advance() at the deadline counts the tick as due.
+        using namespace std::chrono;
+        auto whole = seconds(tick / _tickRate);
+        auto rest = nanoseconds(((tick % _tickRate) * 1'000'000'000ull + _tickRate - 1) / _tickRate);
+        return _start + duration_cast<Clock::duration>(whole) + duration_cast<Clock::duration>(rest);
+    }
+
+    uint32_t FixedTimestep::advance(Clock::time_point now) {
+        if (now < _start)
+            return 0;
+        uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - _start).count());
+        // Ticks 0 to due - 1 are due at or before now.
+        uint64_t due = elapsed / 1'000'000'000ull * _tickRate + elapsed % 1'000'000'000ull * _tickRate / 1'000'000'000ull + 1;
+        if (due <= _ticks)
+            return 0;
+        uint64_t behind = due - _ticks;
+        if (behind > _maxCatchUp) {
+            _skipped += behind - _maxCatchUp;
+            behind = _maxCatchUp;
+        }
+        _ticks = due;
+        return static_cast<uint32_t>(behind);
+    }
+
+    Clock::time_point FixedTimestep::nextDeadline() const {
+        return deadline(_ticks);
+    }
+
+} // namespace timing
@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Fixed timestep simulation clock
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace timing {
+
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief Simulation rate used when none is configured, in ticks per second. */
+    constexpr uint32_t DEFAULT_TICK_RATE = 60;
+
+    /** @brief Most ticks run back to back to catch up after a stall. */
+    constexpr uint32_t MAX_CATCH_UP_TICKS = 5;
+
+    /**
+     * @brief Whether a rate is one the server can be configured with (30, 60 or 120 Hz).
+     */
+    bool isSupportedTickRate(uint32_t tickRate);
+
+    /**
+     * @class FixedTimestep
+     * @brief Tells a simulation loop how many fixed ticks are due and when the next one is.
+     *
+     * The time elapsed on steady_clock since reset() is the accumulator: tick n
+     * is due at start + n / tickRate, computed from the start every time, so
+     * rounding never adds up and the loop does not drift whatever the rate.
+     * The caller runs the ticks returned by advance(), then sleeps until
+     * nextDeadline().
+     *
+     * After a stall longer than maxCatchUp ticks, advance() returns maxCatchUp
+     * and the older ticks are skipped for good: the schedule moves forward
+     * instead of running an ever-growing backlog.
+     */
+    class FixedTimestep {
+        public:
+            explicit FixedTimestep(uint32_t tickRate = DEFAULT_TICK_RATE, uint32_t maxCatchUp = MAX_CATCH_UP_TICKS);
+
+            /**
+             * @brief Restarts the schedule: the first tick is due at `now`.
+             */
+            void reset(Clock::time_point now);
+
+            /**
+             * @brief Number of ticks to run at `now`, between 0 and maxCatchUp.
+             *
+             * They are counted as done; call it once per wake-up.
+             */
+            uint32_t advance(Clock::time_point now);
+
+            /** @brief When the next tick is due. */
+            Clock::time_point nextDeadline() const;
+
+            /** @brief Duration of a tick, in seconds: the dt every tick simulates. */
+            float dt() const { return _dt; }
+
+            uint32_t tickRate() const { return _tickRate; }
+
+            /** @brief Ticks run so far. */
+            uint64_t ticks() const { return _ticks; }
+
+            /** @brief Ticks skipped because the loop fell more than maxCatchUp ticks behind. */
+            uint64_t skippedTicks() const { return _skipped; }
+
+        private:
+            Clock::time_point deadline(uint64_t tick) const;
+
+            uint32_t _tickRate;
+            uint32_t _maxCatchUp;
+            float _dt;
+            Clock::time_point _start{};
+            uint64_t _ticks{0};   ///< Ticks counted as done, run or skipped.
+            uint64_t _skipped{0};
+    };
+
+} // namespace timing
@@ -0,0 +1,140 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Interpolation implementation
+*/
+
+#include "Interpolation.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace snapshot {
+
+    namespace {
+        /** Weight of each new transit delay in the clock offset estimate. */
+        constexpr double OFFSET_SMOOTHING = 0.05;
+
+        bool before(const EntityState &a, const EntityState &b) {
+            return a.kind != b.kind ? a.kind < b.kind : a.id < b.id;
+        }
+
+        /**
+         * Blend two sorted entity lists; alpha above 1 extrapolates. Entities
+         * missing from `from` are taken as they are in `to`.
+         */
+        void blend(const std::vector<EntityState> &from, const std::vector<EntityState> &to, double alpha,
+                   std::vector<EntityState> &out) {
+            float t = static_cast<float>(alpha);
+            std::size_t i = 0;
+            for (const auto &target : to) {
+                while (i < from.size() && before(from[i], target))
+                    ++i;
+                EntityState state = target;
+                if (i < from.size() && from[i].kind == target.kind && from[i].id == target.id) {
+                    state.x = from[i].x + (target.x - from[i].x) * t;
+                    state.y = from[i].y + (target.y - from[i].y) * t;
+                    state.z = from[i].z + (target.z - from[i].z) * t;
+                }
+                out.push_back(state);
+            }
+        }
+    }
+
+    InterpolationBuffer::InterpolationBuffer(double delay, double maxExtrapolation)
+        : _delay(delay), _maxExtrapolation(maxExtrapolation) {}
+
+    double InterpolationBuffer::now() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void InterpolationBuffer::setTickRate(uint32_t tickRate) {
+        if (tickRate != 0)
+            _tickSeconds.store(1.0 / tickRate, std::memory_order_relaxed);
+    }
+
+    double InterpolationBuffer::serverTime(uint32_t tick) const {
+        return static_cast<double>(tick) * _tickSeconds.load(std::memory_order_relaxed);
+    }
+
+    bool InterpolationBuffer::push(uint32_t tick, const WorldState &world, double receivedAt) {
+        std::size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _head.load(std::memory_order_acquire) == FRAME_QUEUE_SIZE)
+            return false;
+
+        Frame &slot = _queue[tail % FRAME_QUEUE_SIZE];
+        slot.tick = tick;
+        slot.receivedAt = receivedAt;
+        slot.states.clear();
+        for (const auto &state : world)
+            slot.states.push_back(dequantize(state));
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    void InterpolationBuffer::recycle(Frame &frame) {
+        frame.states.clear();
+        _spare.push_back(std::move(frame.states));
+    }
+
+    void InterpolationBuffer::drain() {
+        std::size_t head = _head.load(std::memory_order_relaxed);
+        std::size_t tail = _tail.load(std::memory_order_acquire);
+        for (; head != tail; ++head) {
+            Frame &slot = _queue[head % FRAME_QUEUE_SIZE];
+            if (!_frames.empty() && static_cast<int32_t>(slot.tick - _frames.back().tick) <= 0) {
+                if (slot.tick == _frames.back().tick)
+                    continue;
+                // Ticks only go back when a new game starts on the server.
+                for (auto &frame : _frames)
+                    recycle(frame);
+                _frames.clear();
+                _hasOffset = false;
+            }
+
+            double transit = slot.receivedAt - serverTime(slot.tick);
+            if (!_hasOffset) {
+                _offset = transit;
+                _hasOffset = true;
+            } else {
+                _offset += (transit - _offset) * OFFSET_SMOOTHING;
+            }
+
+            Frame frame;
+            frame.tick = slot.tick;
+            frame.receivedAt = slot.receivedAt;
+            frame.states.swap(slot.states);
+            if (!_spare.empty()) {
+                slot.states.swap(_spare.back());
+                _spare.pop_back();
+            }
+            _frames.push_back(std::move(frame));
+        }
+        _head.store(head, std::memory_order_release);
+    }
+
+    void InterpolationBuffer::sample(double now, std::vector<EntityState> &out) {
+        drain();
+        out.clear();
+        if (_frames.empty())
+            return;
+
+        double renderTime = now - _offset - _delay;
+        while (_frames.size() >= 3 && serverTime(_frames[1].tick) <= renderTime) {
+            recycle(_frames.front());
+            _frames.pop_front();
+        }
+        if (_frames.size() == 1) {
+            out = _frames.front().states;
+            return;
+        }
+
+        const Frame &from = _frames[0];
+        const Frame &to = _frames[1];
+        double fromTime = serverTime(from.tick);
+        double span = serverTime(to.tick) - fromTime;
+        double elapsed = std::clamp(renderTime - fromTime, 0.0, span + _maxExtrapolation);
+        blend(from.states, to.states, elapsed / span, out);
+    }
+
+} // namespace snapshot
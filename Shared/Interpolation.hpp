@@ -0,0 +1,113 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Interpolation
+*/
+
+#pragma once
+
+#include "FixedTimestep.hpp"
+#include "Snapshot.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace snapshot {
+
+    /** @brief Duration of one server tick at the default tick rate, in seconds. */
+    constexpr double TICK_SECONDS = 1.0 / timing::DEFAULT_TICK_RATE;
+
+    /** @brief How far behind the newest snapshot entities are rendered, in seconds. */
+    constexpr double INTERPOLATION_DELAY = 0.1;
+
+    /** @brief How long entities keep moving once snapshots stop arriving, in seconds. */
+    constexpr double MAX_EXTRAPOLATION = 0.25;
+
+    /** @brief Snapshots that can wait between the network and the render thread. */
+    constexpr std::size_t FRAME_QUEUE_SIZE = 16;
+
+    /**
+     * @class InterpolationBuffer
+     * @brief Smooths snapshot positions for rendering.
+     *
+     * The network thread push()es every complete snapshot; the render thread
+     * calls sample() once per frame. They share a single-producer,
+     * single-consumer ring, so neither takes a lock and the render thread
+     * never waits on GameClient::stateMutex.
+     *
+     * sample() renders the world INTERPOLATION_DELAY behind the newest
+     * snapshot, blending the two snapshots around that time. When no newer
+     * snapshot arrived, entities continue at the speed they had between the
+     * last two snapshots for at most MAX_EXTRAPOLATION, then stop.
+     *
+     * Server time is tick / tick rate, TICK_SECONDS per tick unless the
+     * server announced another rate through setTickRate(). It is mapped to
+     * local time with an exponential moving average of the transit delay
+     * (receive time minus server time): the first snapshot sets it, then each
+     * one moves it OFFSET_SMOOTHING (5%) of the way towards its own delay, so
+     * jitter is averaged over about twenty snapshots while clock drift is
+     * still followed.
+     */
+    class InterpolationBuffer {
+        public:
+            InterpolationBuffer(double delay = INTERPOLATION_DELAY, double maxExtrapolation = MAX_EXTRAPOLATION);
+
+            /**
+             * @brief Local time in seconds, on the clock push() and sample() expect.
+             */
+            static double now();
+
+            /**
+             * @brief Any thread: server ticks per second, announced when a game starts.
+             *
+             * Frames already queued are timed with the new rate too, so call it
+             * before pushing the first snapshot of the game.
+             */
+            void setTickRate(uint32_t tickRate);
+
+            /**
+             * @brief Network thread: queue the state of a complete tick.
+             * @param receivedAt Local time the tick completed.
+             * @return false if the render thread is too far behind; the tick is dropped.
+             */
+            bool push(uint32_t tick, const WorldState &world, double receivedAt);
+
+            /**
+             * @brief Render thread: state of every entity at the render time.
+             * @param now Current local time.
+             * @param out Replaced by the entities of the newest snapshot used,
+             *        sorted by (kind, id), with blended positions.
+             */
+            void sample(double now, std::vector<EntityState> &out);
+
+        private:
+            struct Frame {
+                uint32_t tick{0};
+                double receivedAt{0.0};
+                std::vector<EntityState> states;
+            };
+
+            void drain();
+            void recycle(Frame &frame);
+            double serverTime(uint32_t tick) const;
+
+            double _delay;
+            double _maxExtrapolation;
+            std::atomic<double> _tickSeconds{TICK_SECONDS};
+
+            std::array<Frame, FRAME_QUEUE_SIZE> _queue;
+            alignas(64) std::atomic<std::size_t> _head{0}; ///< Next slot to read, written by the render thread.
+            alignas(64) std::atomic<std::size_t> _tail{0}; ///< Next slot to write, written by the network thread.
+
+            // Render thread only.
+            std::deque<Frame> _frames;
+            std::vector<std::vector<EntityState>> _spare;
+            bool _hasOffset{false};
+            double _offset{0.0}; ///< Local time minus server time of the fastest snapshot.
+    };
+
+} // namespace snapshot
@@ -0,0 +1,478 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** Logger
+*/
+
+#include "Logger.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace logging {
+
+    namespace {
+        constexpr const char *RESET = "\033[0m";
+        constexpr const char *BLACK = "\033[90m";
+        constexpr const char *RED = "\033[31m";
+        constexpr const char *GREEN = "\033[32m";
+        constexpr const char *YELLOW = "\033[33m";
+        constexpr const char *BLUE = "\033[34m";
+
+        constexpr int64_t NO_WINDOW = std::numeric_limits<int64_t>::min();
+        constexpr int64_t RATE_WINDOW_NS = std::chrono::duration_cast<std::chrono::nanoseconds>(RATE_WINDOW).count();
+
+        /** Time the writer thread sleeps between two drains. */
+        constexpr std::chrono::milliseconds WRITER_INTERVAL{2};
+
+        enum class State : uint8_t { NotStarted, Running, Stopped };
+        std::atomic<State> backendState{State::NotStarted};
+        std::atomic<uint64_t> droppedTotal{0};
+
+        const char *levelName(Level level) {
+            switch (level) {
+                case Level::Debug: return "DEBUG";
+                case Level::Info: return "INFO";
+                case Level::Warn: return "WARN";
+                case Level::Error: return "ERROR";
+                default: return "OFF";
+            }
+        }
+
+        std::string lower(const char *value) {
+            std::string result = value ? value : "";
+            for (char &c : result)
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            return result;
+        }
+
+        Level levelFromEnvironment() {
+            std::string value = lower(std::getenv("RTYPE_LOG_LEVEL"));
+            if (value == "info") return Level::Info;
+            if (value == "warn") return Level::Warn;
+            if (value == "error") return Level::Error;
+            if (value == "off") return Level::Off;
+            return Level::Debug;
+        }
+
+        Config configFromEnvironment() {
+            Config config;
+            std::string format = lower(std::getenv("RTYPE_LOG_FORMAT"));
+            if (format == "json")
+                config.format = Format::Json;
+            else if (format == "binary")
+                config.format = Format::Binary;
+            config.level = levelFromEnvironment();
+            if (const char *path = std::getenv("RTYPE_LOG_FILE"))
+                config.path = path;
+            return config;
+        }
+
+        int64_t systemNow() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+        /**
+         * Stream buffer over the text of a record: writes past the end are
+         * dropped, so long messages are truncated without failing the stream.
+         */
+        class SlotBuffer : public std::streambuf {
+            public:
+                void reset(char *data, std::size_t capacity) { setp(data, data + capacity); }
+                std::size_t size() const { return static_cast<std::size_t>(pptr() - pbase()); }
+
+            protected:
+                int_type overflow(int_type ch) override { return traits_type::not_eof(ch); }
+
+                std::streamsize xsputn(const char *data, std::streamsize count) override {
+                    std::streamsize room = std::min<std::streamsize>(count, epptr() - pptr());
+                    std::memcpy(pptr(), data, static_cast<std::size_t>(room));
+                    pbump(static_cast<int>(room));
+                    return count;
+                }
+        };
+
+        /**
+         * Single producer, single consumer ring of records. The logging thread
+         * fills the slot at tail in place, then publishes it; the writer reads
+         * from head.
+         */
+        struct Ring {
+            explicit Ring(uint32_t id) : thread(id) {}
+
+            std::array<Record, RING_CAPACITY> slots;
+            std::atomic<uint64_t> head{0};
+            std::atomic<uint64_t> tail{0};
+            std::atomic<uint64_t> dropped{0};
+            std::atomic<bool> closed{false};  ///< Its thread exited; removed once drained.
+            const uint32_t thread;
+        };
+
+        class Backend {
+            public:
+                Backend() : _config(configFromEnvironment()) {
+                    open();
+                    _running = true;
+                    _writer = std::thread(&Backend::run, this);
+                }
+
+                ~Backend() {
+                    backendState.store(State::Stopped, std::memory_order_release);
+                    _running = false;
+                    if (_writer.joinable())
+                        _writer.join();
+                    std::lock_guard<std::mutex> lock(_drainMutex);
+                    drain();
+                    close();
+                }
+
+                std::shared_ptr<Ring> registerRing() {
+                    std::lock_guard<std::mutex> lock(_ringsMutex);
+                    auto ring = std::make_shared<Ring>(_nextThread++);
+                    _rings.push_back(ring);
+                    return ring;
+                }
+
+                void configure(const Config &config) {
+                    std::lock_guard<std::mutex> lock(_drainMutex);
+                    close();
+                    _config = config;
+                    open();
+                }
+
+                void flush() {
+                    std::lock_guard<std::mutex> lock(_drainMutex);
+                    drain();
+                }
+
+            private:
+                void run() {
+                    while (_running.load(std::memory_order_relaxed)) {
+                        {
+                            std::lock_guard<std::mutex> lock(_drainMutex);
+                            drain();
+                        }
+                        std::this_thread::sleep_for(WRITER_INTERVAL);
+                    }
+                }
+
+                void open() {
+                    if (_config.path.empty())
+                        return;
+                    _file = std::fopen(_config.path.c_str(), _config.format == Format::Binary ? "ab" : "a");
+                    if (!_file)
+                        std::fprintf(stderr, "[WARN] Cannot open log file %s, logging to the console\n", _config.path.c_str());
+                }
+
+                void close() {
+                    if (_file) {
+                        std::fclose(_file);
+                        _file = nullptr;
+                    }
+                }
+
+                /** Writes every published record, oldest first. Called with _drainMutex held. */
+                void drain() {
+                    {
+                        std::lock_guard<std::mutex> lock(_ringsMutex);
+                        _draining.clear();
+                        for (const auto &ring : _rings)
+                            _draining.emplace_back(ring, 0);
+                    }
+                    _batch.clear();
+                    uint64_t dropped = 0;
+                    for (auto &[ring, tail] : _draining) {
+                        // Read before tail: once closed is seen, every message of the thread is published.
+                        bool closed = ring->closed.load(std::memory_order_acquire);
+                        tail = ring->tail.load(std::memory_order_acquire);
+                        for (uint64_t head = ring->head.load(std::memory_order_relaxed); head != tail; ++head)
+                            _batch.push_back(&ring->slots[head % RING_CAPACITY]);
+                        dropped += ring->dropped.exchange(0, std::memory_order_relaxed);
+                        if (closed)
+                            removeRing(ring);
+                    }
+                    std::stable_sort(_batch.begin(), _batch.end(),
+                                     [](const Record *a, const Record *b) { return a->time < b->time; });
+
+                    for (const Record *record : _batch)
+                        write(*record);
+                    if (dropped != 0) {
+                        droppedTotal.fetch_add(dropped, std::memory_order_relaxed);
+                        write(droppedNotice(dropped));
+                    }
+                    // Slots are only handed back once written, since _batch points into them.
+                    for (const auto &[ring, tail] : _draining)
+                        ring->head.store(tail, std::memory_order_release);
+
+                    if (_file)
+                        std::fflush(_file);
+                    std::fflush(stdout);
+                    std::fflush(stderr);
+                }
+
+                static Record droppedNotice(uint64_t dropped) {
+                    Record notice;
+                    notice.time = systemNow();
+                    notice.file = __FILE__;
+                    notice.line = __LINE__;
+                    notice.level = Level::Warn;
+                    int size = std::snprintf(notice.text.data(), notice.text.size(),
+                                             "%llu log messages dropped: a thread logged faster than they could be written",
+                                             static_cast<unsigned long long>(dropped));
+                    notice.size = static_cast<uint16_t>(std::clamp<int>(size, 0, static_cast<int>(notice.text.size()) - 1));
+                    return notice;
+                }
+
+                void removeRing(const std::shared_ptr<Ring> &ring) {
+                    std::lock_guard<std::mutex> lock(_ringsMutex);
+                    _rings.erase(std::remove(_rings.begin(), _rings.end(), ring), _rings.end());
+                }
+
+                void write(const Record &record) {
+                    if (_config.format == Format::Json)
+                        _line = formatJson(record);
+                    else if (_config.format == Format::Binary)
+                        _line = formatBinary(record);
+                    else
+                        _line = formatText(record, _file == nullptr);
+                    FILE *out = _file;
+                    if (!out)
+                        out = _config.format == Format::Text && record.level >= Level::Warn ? stderr : stdout;
+                    std::fwrite(_line.data(), 1, _line.size(), out);
+                }
+
+                Config _config;
+                FILE *_file{nullptr};
+                std::mutex _drainMutex;     ///< Held while draining; the rings have a single consumer.
+                std::mutex _ringsMutex;
+                std::vector<std::shared_ptr<Ring>> _rings;
+                std::vector<std::pair<std::shared_ptr<Ring>, uint64_t>> _draining; ///< Rings of the drain in progress and their tail.
+                std::vector<const Record *> _batch;
+                std::string _line;
+                uint32_t _nextThread{1};
+                std::atomic<bool> _running{false};
+                std::thread _writer;
+        };
+
+        Backend &backend() {
+            static Backend instance;
+            backendState.store(State::Running, std::memory_order_release);
+            return instance;
+        }
+
+        /**
+         * Logging state of a thread. The ring outlives the thread when the
+         * writer still holds it, so the last messages are not lost.
+         */
+        struct ThreadState {
+            ThreadState() : stream(&buffer) {}
+            ~ThreadState() {
+                if (ring)
+                    ring->closed.store(true, std::memory_order_release);
+            }
+
+            std::shared_ptr<Ring> ring;
+            SlotBuffer buffer;
+            std::ostream stream;
+            Record scratch;             ///< Target of messages that find the ring full.
+            Record *current{nullptr};
+            uint64_t tail{0};
+        };
+
+        ThreadState &threadState() {
+            thread_local ThreadState state;
+            return state;
+        }
+
+        void appendJsonString(std::string &out, std::string_view value) {
+            out += '"';
+            for (char c : value) {
+                switch (c) {
+                    case '"': out += "\\\""; break;
+                    case '\\': out += "\\\\"; break;
+                    case '\n': out += "\\n"; break;
+                    case '\r': out += "\\r"; break;
+                    case '\t': out += "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            char escaped[8];
+                            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(static_cast<unsigned char>(c)));
+                            out += escaped;
+                        } else {
+                            out += c;
+                        }
+                }
+            }
+            out += '"';
+        }
+    }
+
+    namespace detail {
+        std::atomic<uint8_t> runtimeLevel{static_cast<uint8_t>(levelFromEnvironment())};
+    }
+
+    bool RateLimit::allow(int64_t now, uint32_t &suppressed) {
+        int64_t start = _windowStart.load(std::memory_order_relaxed);
+        if ((start == NO_WINDOW || now - start >= RATE_WINDOW_NS)
+            && _windowStart.compare_exchange_strong(start, now, std::memory_order_relaxed)) {
+            _count.store(1, std::memory_order_relaxed);
+            suppressed = _suppressed.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+        if (_count.fetch_add(1, std::memory_order_relaxed) < RATE_LIMIT)
+            return true;
+        _suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    bool RateLimit::allow(uint32_t &suppressed) {
+        return allow(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count(), suppressed);
+    }
+
+    void configure(const Config &config) {
+        detail::runtimeLevel.store(static_cast<uint8_t>(config.level), std::memory_order_relaxed);
+        if (backendState.load(std::memory_order_acquire) != State::Stopped)
+            backend().configure(config);
+    }
+
+    std::ostream &begin() {
+        ThreadState &state = threadState();
+        if (!state.ring && backendState.load(std::memory_order_acquire) != State::Stopped)
+            state.ring = backend().registerRing();
+
+        state.current = &state.scratch;
+        if (state.ring && backendState.load(std::memory_order_acquire) != State::Stopped) {
+            uint64_t tail = state.ring->tail.load(std::memory_order_relaxed);
+            if (tail - state.ring->head.load(std::memory_order_acquire) < RING_CAPACITY) {
+                state.current = &state.ring->slots[tail % RING_CAPACITY];
+                state.tail = tail;
+            }
+        }
+        state.buffer.reset(state.current->text.data(), state.current->text.size());
+        state.stream.clear();
+        state.stream.flags(std::ios_base::dec | std::ios_base::skipws);
+        state.stream.precision(6);
+        state.stream.width(0);
+        state.stream.fill(' ');
+        return state.stream;
+    }
+
+    void commit(Level level, const char *file, uint32_t line, bool tagged, uint32_t suppressed) {
+        ThreadState &state = threadState();
+        Record &record = *state.current;
+        record.time = systemNow();
+        record.file = file;
+        record.line = line;
+        record.thread = state.ring ? state.ring->thread : 0;
+        record.suppressed = suppressed;
+        record.level = level;
+        record.tagged = tagged;
+        record.size = static_cast<uint16_t>(state.buffer.size());
+
+        if (&record != &state.scratch) {
+            state.ring->tail.store(state.tail + 1, std::memory_order_release);
+            return;
+        }
+        if (state.ring && backendState.load(std::memory_order_acquire) != State::Stopped) {
+            state.ring->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        // Logged during shutdown, after the writer stopped: write it here.
+        std::string text = formatText(record, false);
+        std::fwrite(text.data(), 1, text.size(), level >= Level::Warn ? stderr : stdout);
+    }
+
+    void flush() {
+        if (backendState.load(std::memory_order_acquire) == State::Running)
+            backend().flush();
+    }
+
+    uint64_t droppedCount() {
+        return droppedTotal.load(std::memory_order_relaxed);
+    }
+
+    std::string formatText(const Record &record, bool color) {
+        std::string_view message(record.text.data(), record.size);
+        std::string line;
+        line.reserve(message.size() + 48);
+        if (!record.tagged) {
+            if (color)
+                line += RESET;
+            line += message;
+            if (color)
+                line += RESET;
+        } else if (!color) {
+            line += '[';
+            line += levelName(record.level);
+            line += "] ";
+            line += message;
+        } else {
+            const char *tint = record.level == Level::Error ? RED
+                : record.level == Level::Warn ? YELLOW
+                : record.level == Level::Info ? GREEN : BLUE;
+            line += BLACK;
+            line += '[';
+            line += tint;
+            line += levelName(record.level);
+            line += BLACK;
+            line += "] ";
+            line += record.level >= Level::Warn ? tint : RESET;
+            line += message;
+            line += RESET;
+        }
+        if (record.suppressed != 0)
+            line += " (" + std::to_string(record.suppressed) + " similar messages suppressed)";
+        line += '\n';
+        return line;
+    }
+
+    std::string formatJson(const Record &record) {
+        std::string line = "{\"time\":" + std::to_string(record.time) + ",\"level\":";
+        std::string level = levelName(record.level);
+        for (char &c : level)
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        appendJsonString(line, level);
+        line += ",\"thread\":" + std::to_string(record.thread) + ",\"file\":";
+        appendJsonString(line, record.file);
+        line += ",\"line\":" + std::to_string(record.line);
+        if (record.suppressed != 0)
+            line += ",\"suppressed\":" + std::to_string(record.suppressed);
+        line += ",\"message\":";
+        appendJsonString(line, std::string_view(record.text.data(), record.size));
+        line += "}\n";
+        return line;
+    }
+
+    std::string formatBinary(const Record &record) {
+        std::size_t fileSize = std::min<std::size_t>(std::strlen(record.file), UINT16_MAX);
+        BinaryHeader header{};
+        header.time = record.time;
+        header.thread = record.thread;
+        header.line = record.line;
+        header.suppressed = record.suppressed;
+        header.level = static_cast<uint8_t>(record.level);
+        header.tagged = record.tagged ? 1 : 0;
+        header.fileSize = static_cast<uint16_t>(fileSize);
+        header.messageSize = record.size;
+
+        std::string out(sizeof(header) + fileSize + record.size, '\0');
+        std::memcpy(out.data(), &header, sizeof(header));
+        std::memcpy(out.data() + sizeof(header), record.file, fileSize);
+        std::memcpy(out.data() + sizeof(header) + fileSize, record.text.data(), record.size);
+        return out;
+    }
+
+} // namespace logging
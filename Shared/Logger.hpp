@@ -7,17 +7,197 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <string>
 
-#define L_RESET   "\033[0m"
-#define L_BLACK   "\033[90m"
-#define L_RED     "\033[31m"
-#define L_GREEN   "\033[32m"
-#define L_YELLOW  "\033[33m"
-#define L_BLUE    "\033[34m"
-
-#define LOG_ERROR(msg)   std::cerr << L_BLACK << "[" << L_RED << "ERROR" << L_BLACK "] " << L_RED << msg << L_RESET << std::endl
-#define LOG_INFO(msg)    std::cout << L_BLACK << "[" << L_GREEN << "INFO" << L_BLACK "] " << L_RESET << msg << std::endl
-#define LOG_DEBUG(msg)   std::cout << L_BLACK << "[" << L_BLUE << "DEBUG" << L_BLACK "] " << L_RESET << msg << std::endl
-#define LOG_WARN(msg)   std::cerr << L_BLACK << "[" << L_YELLOW << "WARN" << L_BLACK "] " << L_YELLOW << msg << L_RESET << std::endl
-#define LOG(msg)         std::cout << L_RESET << msg << L_RESET << std::endl
+/**
+ * @brief Lowest level compiled in: 0 debug, 1 info, 2 warn, 3 error, 4 none.
+ *
+ * Calls below it are discarded at compile time, message formatting included.
+ * Set it with -DRTYPE_LOG_LEVEL=<n> (the CMake cache variable of the same name).
+ */
+#ifndef RTYPE_LOG_LEVEL
+#define RTYPE_LOG_LEVEL 0
+#endif
+
+namespace logging {
+
+    enum class Level : uint8_t {
+        Debug = 0,
+        Info = 1,
+        Warn = 2,
+        Error = 3,
+        Off = 4,
+    };
+
+    enum class Format : uint8_t {
+        Text,    ///< Colored lines, warnings and errors on stderr when no file is set.
+        Json,    ///< One JSON object per line.
+        Binary,  ///< BinaryHeader, then the file name and the message, per record.
+    };
+
+    constexpr Level COMPILED_LEVEL = static_cast<Level>(RTYPE_LOG_LEVEL);
+
+    /** @brief Longest message kept; longer ones are truncated. */
+    constexpr std::size_t MAX_MESSAGE_SIZE = 440;
+
+    /** @brief Records a thread can have waiting for the writer; more are dropped. */
+    constexpr std::size_t RING_CAPACITY = 256;
+
+    /** @brief Messages a single LOG_* call site may emit per RATE_WINDOW. */
+    constexpr uint32_t RATE_LIMIT = 50;
+    constexpr std::chrono::seconds RATE_WINDOW{1};
+
+    /**
+     * @struct Record
+     * @brief One message, as written by the logging thread and read by the writer.
+     */
+    struct Record {
+        int64_t time{0};          ///< System clock, in ns since the epoch.
+        const char *file{""};     ///< __FILE__ of the call site.
+        uint32_t line{0};
+        uint32_t thread{0};       ///< Small number given to each thread on its first message.
+        uint32_t suppressed{0};   ///< Messages of the same call site the rate limit dropped before this one.
+        Level level{Level::Info};
+        bool tagged{true};        ///< false for LOG(): no level tag in text output.
+        uint16_t size{0};
+        std::array<char, MAX_MESSAGE_SIZE> text;
+    };
+
+    /**
+     * @struct BinaryHeader
+     * @brief Header of a record in Format::Binary, in host byte order.
+     *
+     * Followed by fileSize bytes of file name and messageSize bytes of message.
+     */
+    struct BinaryHeader {
+        int64_t time;
+        uint32_t thread;
+        uint32_t line;
+        uint32_t suppressed;
+        uint8_t level;
+        uint8_t tagged;
+        uint16_t fileSize;
+        uint16_t messageSize;
+        uint16_t reserved;
+    };
+
+    /**
+     * @struct Config
+     * @brief Where and how the writer thread outputs records.
+     */
+    struct Config {
+        Format format{Format::Text};
+        Level level{Level::Debug};  ///< Lowest level written, on top of COMPILED_LEVEL.
+        std::string path;           ///< Output file; stdout and stderr when empty.
+    };
+
+    /**
+     * @class RateLimit
+     * @brief Caps how many messages one call site emits per window.
+     *
+     * Each LOG_* expansion owns one, so a message repeated every packet
+     * cannot flood the output; the first message let through after a
+     * window with drops tells how many were dropped. Lock-free and
+     * approximate under contention: a few extra messages may pass when
+     * several threads open a window at once.
+     */
+    class RateLimit {
+        public:
+            /**
+             * @param now Current time in ns, on any monotonic clock.
+             * @param suppressed Set to the messages dropped since the last one allowed, when allowed.
+             * @return Whether the message may be emitted.
+             */
+            bool allow(int64_t now, uint32_t &suppressed);
+
+            /** @brief Same, on the steady clock. */
+            bool allow(uint32_t &suppressed);
+
+        private:
+            std::atomic<int64_t> _windowStart{std::numeric_limits<int64_t>::min()};
+            std::atomic<uint32_t> _count{0};
+            std::atomic<uint32_t> _suppressed{0};
+    };
+
+    namespace detail {
+        extern std::atomic<uint8_t> runtimeLevel;
+    }
+
+    /** @brief Whether messages of a level are written at all. */
+    inline bool enabled(Level level) {
+        return static_cast<uint8_t>(level) >= detail::runtimeLevel.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Replaces the output; records already queued use the new one.
+     *
+     * Without a call, the config comes from the environment:
+     * RTYPE_LOG_FORMAT (text, json, binary), RTYPE_LOG_LEVEL (debug, info,
+     * warn, error, off) and RTYPE_LOG_FILE (path).
+     */
+    void configure(const Config &config);
+
+    /**
+     * @brief Starts a message: returns a stream writing straight into a free
+     *        slot of the calling thread's ring. Must be followed by commit().
+     */
+    std::ostream &begin();
+
+    /**
+     * @brief Queues the message started by begin() for the writer thread.
+     *
+     * Never blocks: when the ring of the thread is full the message is
+     * dropped and counted, and the writer reports the count.
+     */
+    void commit(Level level, const char *file, uint32_t line, bool tagged, uint32_t suppressed);
+
+    /**
+     * @brief Writes every message queued so far and flushes the output.
+     */
+    void flush();
+
+    /** @brief Messages dropped because a ring was full, since the start. */
+    uint64_t droppedCount();
+
+    /** @brief Text line of a record, newline included. */
+    std::string formatText(const Record &record, bool color);
+
+    /** @brief JSON line of a record, newline included. */
+    std::string formatJson(const Record &record);
+
+    /** @brief Binary form of a record, see BinaryHeader. */
+    std::string formatBinary(const Record &record);
+
+} // namespace logging
+
+/**
+ * Every macro takes a stream expression: LOG_INFO("Client " << id << " left").
+ * The message is formatted on the calling thread into its ring and written
+ * by a background thread; levels below RTYPE_LOG_LEVEL compile to nothing.
+ */
+#define RTYPE_LOG_AT(level, tagged, msg)                                                   \
+    do {                                                                                   \
+        if constexpr ((level) >= logging::COMPILED_LEVEL) {                                \
+            if (logging::enabled(level)) {                                                 \
+                static logging::RateLimit rtypeLogLimit_;                                  \
+                uint32_t rtypeLogSuppressed_ = 0;                                          \
+                if (rtypeLogLimit_.allow(rtypeLogSuppressed_)) {                           \
+                    logging::begin() << msg;                                               \
+                    logging::commit(level, __FILE__, __LINE__, tagged, rtypeLogSuppressed_); \
+                }                                                                          \
+            }                                                                              \
+        }                                                                                  \
+    } while (0)
+
+#define LOG_ERROR(msg)   RTYPE_LOG_AT(logging::Level::Error, true, msg)
+#define LOG_WARN(msg)    RTYPE_LOG_AT(logging::Level::Warn, true, msg)
+#define LOG_INFO(msg)    RTYPE_LOG_AT(logging::Level::Info, true, msg)
+#define LOG_DEBUG(msg)   RTYPE_LOG_AT(logging::Level::Debug, true, msg)
+#define LOG(msg)         RTYPE_LOG_AT(logging::Level::Info, false, msg)
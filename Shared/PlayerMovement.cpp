@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** PlayerMovement implementation
+*/
+
+#include "PlayerMovement.hpp"
+#include <cmath>
+
+namespace movement {
+
+    std::size_t commands_per_tick(float tickSeconds)
+    {
+        if (tickSeconds <= 0.f)
+            return 1;
+        // The epsilon keeps a tick of exactly k steps at k, despite float rounding.
+        return static_cast<std::size_t>(std::ceil(tickSeconds / STEP_SECONDS - 1e-4f)) + 1;
+    }
+
+    bool overlaps(float x, float y, float width, float height, const Box &box)
+    {
+        float left = x - width / 2.f;
+        float right = x + width / 2.f;
+        float top = y - height / 2.f;
+        float bottom = y + height / 2.f;
+
+        float boxLeft = box.x - box.width / 2.f;
+        float boxRight = box.x + box.width / 2.f;
+        float boxTop = box.y - box.height / 2.f;
+        float boxBottom = box.y + box.height / 2.f;
+
+        return right > boxLeft && left < boxRight && bottom > boxTop && top < boxBottom;
+    }
+
+    bool is_blocked(float x, float y, const std::vector<Box> &obstacles)
+    {
+        for (const auto &box : obstacles) {
+            if (overlaps(x, y, PLAYER_WIDTH, PLAYER_HEIGHT, box))
+                return true;
+        }
+        return false;
+    }
+
+    void Predictor::seed(float x, float y)
+    {
+        if (_hasPosition)
+            return;
+        _x = x;
+        _y = y;
+        _hasPosition = true;
+    }
+
+    void Predictor::reset()
+    {
+        _hasPosition = false;
+        _lastAcked = 0;
+        _pending.clear();
+    }
+
+    uint32_t Predictor::apply(uint8_t buttons, const std::vector<Box> &obstacles)
+    {
+        uint32_t sequence = _nextSequence++;
+        if (_pending.size() == MAX_PENDING_COMMANDS)
+            _pending.pop_front();
+        _pending.push_back({sequence, buttons});
+        step(_x, _y, buttons, [&](float x, float y) { return is_blocked(x, y, obstacles); });
+        return sequence;
+    }
+
+    void Predictor::reconcile(uint32_t sequence, float x, float y, const std::vector<Box> &obstacles)
+    {
+        if (static_cast<int32_t>(sequence - _lastAcked) < 0)
+            return;
+        _lastAcked = sequence;
+        while (!_pending.empty() && static_cast<int32_t>(_pending.front().sequence - sequence) <= 0)
+            _pending.pop_front();
+        _x = x;
+        _y = y;
+        _hasPosition = true;
+        for (const auto &command : _pending)
+            step(_x, _y, command.buttons, [&](float px, float py) { return is_blocked(px, py, obstacles); });
+    }
+
+    std::size_t Predictor::unacked(uint32_t &newestSequence, uint8_t *buttons, std::size_t max) const
+    {
+        if (_pending.empty())
+            return 0;
+        newestSequence = _pending.back().sequence;
+        std::size_t count = 0;
+        for (auto it = _pending.rbegin(); it != _pending.rend() && count < max; ++it)
+            buttons[count++] = it->buttons;
+        return count;
+    }
+
+} // namespace movement
@@ -0,0 +1,191 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** PlayerMovement
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+/**
+ * @namespace movement
+ * @brief Player movement shared by the server simulation and client prediction.
+ *
+ * The client turns its input into numbered commands, one per STEP_SECONDS
+ * while a direction is held, and sends them in ClientInputMessage. The
+ * server applies each command once, in order, with step(), then acks the
+ * last one it applied together with the resulting position
+ * (PlayerInputAckMessage). The client applies the same commands locally as
+ * soon as they are made, and on each ack restarts from the server position
+ * and replays the commands the server has not applied yet (Predictor).
+ */
+namespace movement {
+
+    /** @brief Player speed, in units per second. */
+    constexpr float PLAYER_SPEED = 200.f;
+
+    /** @brief Size of the box that obstacles block. */
+    constexpr float PLAYER_WIDTH = 30.f;
+    constexpr float PLAYER_HEIGHT = 30.f;
+
+    /** @brief Duration of one command, about one server tick at the default 60 Hz. */
+    constexpr float STEP_SECONDS = 0.016f;
+
+    /** @brief Commands kept by the client until acked; older ones are forgotten. */
+    constexpr std::size_t MAX_PENDING_COMMANDS = 128;
+
+    /**
+     * @enum Button
+     * @brief Bits of the button mask of a command.
+     */
+    enum Button : uint8_t {
+        Up = 1 << 0,
+        Down = 1 << 1,
+        Left = 1 << 2,
+        Right = 1 << 3,
+    };
+
+    /**
+     * @struct Box
+     * @brief Obstacle box, centered on (x, y).
+     */
+    struct Box {
+        float x;
+        float y;
+        float width;
+        float height;
+    };
+
+    /**
+     * @brief Most commands the server applies per player in one tick.
+     *
+     * One tick spans tickSeconds / STEP_SECONDS commands of a client holding a
+     * direction, so a tick rate below 1 / STEP_SECONDS needs several per tick
+     * just to keep up; one more lets a late burst catch up without speeding
+     * the player much.
+     *
+     * @param tickSeconds Duration of a server tick.
+     */
+    std::size_t commands_per_tick(float tickSeconds);
+
+    /**
+     * @brief Whether a box of the given size centered on (x, y) overlaps an obstacle.
+     */
+    bool overlaps(float x, float y, float width, float height, const Box &box);
+
+    /**
+     * @brief Whether the player box centered on (x, y) overlaps any obstacle.
+     */
+    bool is_blocked(float x, float y, const std::vector<Box> &obstacles);
+
+    /**
+     * @brief Apply one command to a position.
+     *
+     * Each axis moves on its own, so the player slides along an obstacle
+     * instead of stopping against it.
+     *
+     * @param blocked Callable (float x, float y) -> bool telling whether the
+     *        player box centered there overlaps an obstacle.
+     */
+    template <typename Blocked>
+    void step(float &x, float &y, uint8_t buttons, Blocked &&blocked)
+    {
+        float inputX = 0.f;
+        float inputY = 0.f;
+        bool left = buttons & Left;
+        bool right = buttons & Right;
+        bool up = buttons & Up;
+        bool down = buttons & Down;
+
+        if (left != right)
+            inputX = left ? -1.f : 1.f;
+        if (up != down)
+            inputY = up ? -1.f : 1.f;
+        if (inputX == 0.f && inputY == 0.f)
+            return;
+
+        float distance = PLAYER_SPEED * STEP_SECONDS;
+        float newX = x + inputX * distance;
+        float newY = y + inputY * distance;
+        if (!blocked(newX, y))
+            x = newX;
+        if (!blocked(x, newY))
+            y = newY;
+    }
+
+    /**
+     * @class Predictor
+     * @brief Client side: position of the local player ahead of the server.
+     */
+    class Predictor {
+        public:
+            /**
+             * @return Whether the predictor has a position, from seed() or an ack.
+             */
+            bool has_position() const noexcept { return _hasPosition; }
+            float x() const noexcept { return _x; }
+            float y() const noexcept { return _y; }
+
+            /**
+             * @brief Start from a known position if none is set yet.
+             */
+            void seed(float x, float y);
+
+            /**
+             * @brief Forget the position and every command, e.g. on death or a new game.
+             */
+            void reset();
+
+            /**
+             * @brief Make a command and apply it to the predicted position.
+             * @param buttons Button mask, see Button.
+             * @return The sequence number of the command.
+             */
+            uint32_t apply(uint8_t buttons, const std::vector<Box> &obstacles);
+
+            /**
+             * @brief Restart from the server state and replay newer commands.
+             *
+             * An ack older than the last one reconciled arrived out of order
+             * and is ignored.
+             *
+             * @param sequence Last command the server applied, 0 for none.
+             * @param x Server position after that command.
+             * @param y Server position after that command.
+             */
+            void reconcile(uint32_t sequence, float x, float y, const std::vector<Box> &obstacles);
+
+            /**
+             * @return Whether some commands were not acked yet.
+             */
+            bool has_unacked() const noexcept { return !_pending.empty(); }
+
+            /**
+             * @brief Newest commands not acked yet, to send.
+             * @param newestSequence Receives the sequence of buttons[0].
+             * @param buttons Receives the button masks, newest first.
+             * @param max Size of buttons.
+             * @return Number of commands written.
+             */
+            std::size_t unacked(uint32_t &newestSequence, uint8_t *buttons, std::size_t max) const;
+
+        private:
+            struct Command {
+                uint32_t sequence;
+                uint8_t buttons;
+            };
+
+            bool _hasPosition{false};
+            float _x{0.f};
+            float _y{0.f};
+            uint32_t _nextSequence{1};
+            uint32_t _lastAcked{0};
+            std::deque<Command> _pending;
+    };
+
+} // namespace movement
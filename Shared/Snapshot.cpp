@@ -0,0 +1,367 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Snapshot implementation
+*/
+
+#include "Snapshot.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace snapshot {
+
+    namespace {
+        constexpr std::size_t HEADER_SIZE = 16;
+        constexpr uint8_t KIND_MASK = 0x07;
+        constexpr uint8_t FIELD_MASK = (1u << FIELD_COUNT) - 1;
+
+        void putU16(uint8_t *out, uint16_t value) {
+            out[0] = static_cast<uint8_t>(value >> 8);
+            out[1] = static_cast<uint8_t>(value);
+        }
+
+        void putU32(uint8_t *out, uint32_t value) {
+            out[0] = static_cast<uint8_t>(value >> 24);
+            out[1] = static_cast<uint8_t>(value >> 16);
+            out[2] = static_cast<uint8_t>(value >> 8);
+            out[3] = static_cast<uint8_t>(value);
+        }
+
+        uint16_t getU16(const uint8_t *in) {
+            return static_cast<uint16_t>((in[0] << 8) | in[1]);
+        }
+
+        uint32_t getU32(const uint8_t *in) {
+            return (static_cast<uint32_t>(in[0]) << 24) | (static_cast<uint32_t>(in[1]) << 16)
+                | (static_cast<uint32_t>(in[2]) << 8) | static_cast<uint32_t>(in[3]);
+        }
+
+        void putVarint(std::vector<uint8_t> &out, uint32_t value) {
+            while (value >= 0x80) {
+                out.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<uint8_t>(value));
+        }
+
+        bool getVarint(const uint8_t *data, std::size_t size, std::size_t &at, uint32_t &value) {
+            value = 0;
+            for (unsigned shift = 0; shift < 35; shift += 7) {
+                if (at >= size)
+                    return false;
+                uint8_t byte = data[at++];
+                value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80))
+                    return true;
+            }
+            return false;
+        }
+
+        uint32_t zigzag(int32_t value) {
+            return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+        }
+
+        int32_t unzigzag(uint32_t value) {
+            return static_cast<int32_t>((value >> 1) ^ (0u - (value & 1)));
+        }
+
+        int32_t quantizeValue(float value) {
+            double scaled = std::round(static_cast<double>(value) * POSITION_SCALE);
+            if (!(scaled > std::numeric_limits<int32_t>::min()))
+                return std::numeric_limits<int32_t>::min();
+            if (scaled > std::numeric_limits<int32_t>::max())
+                return std::numeric_limits<int32_t>::max();
+            return static_cast<int32_t>(scaled);
+        }
+
+        bool stateLess(const QuantizedState &a, const QuantizedState &b) {
+            return a.kind != b.kind ? a.kind < b.kind : a.id < b.id;
+        }
+
+        bool sameKey(const QuantizedState &a, const QuantizedState &b) {
+            return a.kind == b.kind && a.id == b.id;
+        }
+
+        bool isNewer(uint32_t tick, uint32_t than) {
+            return static_cast<int32_t>(tick - than) > 0;
+        }
+    }
+
+    static_assert(sizeof(SnapshotChunkHeader) == HEADER_SIZE, "SnapshotChunkHeader must have no padding");
+
+    QuantizedState quantize(const EntityState &state) {
+        return {state.kind, state.id, {quantizeValue(state.x), quantizeValue(state.y), quantizeValue(state.z),
+                                       quantizeValue(state.vx), quantizeValue(state.vy), quantizeValue(state.vz)}};
+    }
+
+    EntityState dequantize(const QuantizedState &state) {
+        auto value = [&](std::size_t field) { return static_cast<float>(state.fields[field]) / POSITION_SCALE; };
+        return {state.kind, state.id, value(0), value(1), value(2), value(3), value(4), value(5)};
+    }
+
+    void sortWorld(WorldState &world) {
+        std::sort(world.begin(), world.end(), stateLess);
+    }
+
+    const QuantizedState *findEntity(const WorldState &world, EntityKind kind, uint32_t id) {
+        auto it = std::lower_bound(world.begin(), world.end(), QuantizedState{kind, id, {}}, stateLess);
+        if (it == world.end() || it->kind != kind || it->id != id)
+            return nullptr;
+        return &*it;
+    }
+
+    QuantizedState applyDelta(const RecordDelta &record, const QuantizedState *base) {
+        QuantizedState state{record.kind, record.id, {}};
+        for (std::size_t field = 0; field < FIELD_COUNT; ++field) {
+            uint32_t from = base ? static_cast<uint32_t>(base->fields[field]) : 0;
+            state.fields[field] = static_cast<int32_t>(from + static_cast<uint32_t>(record.deltas[field]));
+        }
+        return state;
+    }
+
+    void SnapshotHistory::store(uint32_t tick, const WorldState &world) {
+        auto &entry = _entries[tick % HISTORY_SIZE];
+        entry.valid = true;
+        entry.tick = tick;
+        entry.world = world;
+    }
+
+    const WorldState *SnapshotHistory::find(uint32_t tick) const {
+        const auto &entry = _entries[tick % HISTORY_SIZE];
+        if (!entry.valid || entry.tick != tick)
+            return nullptr;
+        return &entry.world;
+    }
+
+    void SnapshotHistory::clear() {
+        for (auto &entry : _entries) {
+            entry.valid = false;
+            entry.world.clear();
+        }
+    }
+
+    SnapshotWriter::SnapshotWriter(std::size_t maxDatagramSize)
+        : _maxDatagramSize(maxDatagramSize) {}
+
+    void SnapshotWriter::openChunk() {
+        if (_chunkCount == _chunks.size())
+            _chunks.emplace_back();
+        auto &chunk = _chunks[_chunkCount];
+        chunk.assign(HEADER_SIZE, 0);
+        chunk[0] = static_cast<uint8_t>(MessageType::Snapshot);
+        putU16(&chunk[2], static_cast<uint16_t>(_chunkCount));
+        putU32(&chunk[4], _tick);
+        putU32(&chunk[8], _baselineTick);
+        _recordCounts.push_back(0);
+        ++_chunkCount;
+    }
+
+    void SnapshotWriter::commitRecord() {
+        if (_chunkCount == 0 || _chunks[_chunkCount - 1].size() + _record.size() > _maxDatagramSize)
+            openChunk();
+        auto &chunk = _chunks[_chunkCount - 1];
+        chunk.insert(chunk.end(), _record.begin(), _record.end());
+        ++_recordCounts[_chunkCount - 1];
+    }
+
+    void SnapshotWriter::writeRecord(const QuantizedState &state, const QuantizedState *base) {
+        _record.clear();
+        _record.push_back(static_cast<uint8_t>(state.kind));
+        putVarint(_record, state.id);
+        std::size_t maskAt = _record.size();
+        _record.push_back(0);
+        uint8_t mask = 0;
+        for (std::size_t field = 0; field < FIELD_COUNT; ++field) {
+            uint32_t from = base ? static_cast<uint32_t>(base->fields[field]) : 0;
+            int32_t delta = static_cast<int32_t>(static_cast<uint32_t>(state.fields[field]) - from);
+            if (delta == 0)
+                continue;
+            mask |= static_cast<uint8_t>(1u << field);
+            putVarint(_record, zigzag(delta));
+        }
+        _record[maskAt] = mask;
+        commitRecord();
+    }
+
+    void SnapshotWriter::writeRemoved(const QuantizedState &base) {
+        _record.clear();
+        _record.push_back(static_cast<uint8_t>(static_cast<uint8_t>(base.kind) | REMOVED_FLAG));
+        putVarint(_record, base.id);
+        commitRecord();
+    }
+
+    const std::vector<std::vector<uint8_t>> &SnapshotWriter::encode(uint32_t tick, const WorldState &world,
+                                                                    uint32_t baselineTick, const WorldState *baseline) {
+        _tick = tick;
+        _baselineTick = baseline ? baselineTick : 0;
+        _chunkCount = 0;
+        _recordCounts.clear();
+
+        static const WorldState empty;
+        const WorldState &base = baseline ? *baseline : empty;
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < world.size() || j < base.size()) {
+            if (j == base.size() || (i < world.size() && stateLess(world[i], base[j]))) {
+                writeRecord(world[i++], nullptr);
+            } else if (i == world.size() || stateLess(base[j], world[i])) {
+                writeRemoved(base[j++]);
+            } else {
+                if (world[i].fields != base[j].fields)
+                    writeRecord(world[i], &base[j]);
+                ++i;
+                ++j;
+            }
+        }
+        if (_chunkCount == 0)
+            openChunk();
+
+        _chunks.resize(_chunkCount);
+        for (std::size_t c = 0; c < _chunkCount; ++c) {
+            putU16(&_chunks[c][12], static_cast<uint16_t>(_chunkCount));
+            putU16(&_chunks[c][14], _recordCounts[c]);
+        }
+        return _chunks;
+    }
+
+    bool decodeChunk(const uint8_t *data, std::size_t size, SnapshotChunkHeader &header,
+                     std::vector<RecordDelta> &out) {
+        if (size < HEADER_SIZE || data[0] != static_cast<uint8_t>(MessageType::Snapshot))
+            return false;
+        header.type = MessageType::Snapshot;
+        header.reserved = 0;
+        header.chunkIndex = getU16(data + 2);
+        header.tick = getU32(data + 4);
+        header.baselineTick = getU32(data + 8);
+        header.chunkCount = getU16(data + 12);
+        header.recordCount = getU16(data + 14);
+        if (header.chunkIndex >= header.chunkCount)
+            return false;
+
+        std::size_t at = HEADER_SIZE;
+        for (uint16_t i = 0; i < header.recordCount; ++i) {
+            if (at >= size)
+                return false;
+            uint8_t kindByte = data[at++];
+            if ((kindByte & ~(KIND_MASK | REMOVED_FLAG))
+                || (kindByte & KIND_MASK) > static_cast<uint8_t>(EntityKind::EnemyProjectile))
+                return false;
+
+            RecordDelta record{static_cast<EntityKind>(kindByte & KIND_MASK), 0,
+                               (kindByte & REMOVED_FLAG) != 0, 0, {}};
+            if (!getVarint(data, size, at, record.id))
+                return false;
+            if (!record.removed) {
+                if (at >= size || (data[at] & ~FIELD_MASK))
+                    return false;
+                record.mask = data[at++];
+                for (std::size_t field = 0; field < FIELD_COUNT; ++field) {
+                    if (!(record.mask & (1u << field)))
+                        continue;
+                    uint32_t value;
+                    if (!getVarint(data, size, at, value))
+                        return false;
+                    record.deltas[field] = unzigzag(value);
+                }
+            }
+            out.push_back(record);
+        }
+        return at == size;
+    }
+
+    SnapshotReceiver::Result SnapshotReceiver::receive(const uint8_t *data, std::size_t size,
+                                                       std::vector<EntityState> &updated) {
+        SnapshotChunkHeader header{};
+        _records.clear();
+        if (!decodeChunk(data, size, header, _records))
+            return Result::Malformed;
+        if (_completedTick != 0 && !isNewer(header.tick, _completedTick))
+            return Result::Stale;
+        if (_hasPending && header.tick != _pendingTick) {
+            if (!isNewer(header.tick, _pendingTick))
+                return Result::Stale;
+            _hasPending = false;
+        }
+
+        const WorldState *base = nullptr;
+        if (header.baselineTick != 0) {
+            base = _history.find(header.baselineTick);
+            if (!base)
+                return Result::MissingBaseline;
+        }
+
+        if (!_hasPending) {
+            _hasPending = true;
+            _pendingTick = header.tick;
+            _pendingBaselineTick = header.baselineTick;
+            _pendingChunkCount = header.chunkCount;
+            _pendingReceived = 0;
+            _pendingSeen.assign(header.chunkCount, false);
+            _pendingChanges.clear();
+            _pendingRemovals.clear();
+        } else if (header.chunkCount != _pendingChunkCount || header.baselineTick != _pendingBaselineTick) {
+            return Result::Malformed;
+        }
+        if (_pendingSeen[header.chunkIndex])
+            return Result::Stale;
+        _pendingSeen[header.chunkIndex] = true;
+        ++_pendingReceived;
+
+        for (const auto &record : _records) {
+            const QuantizedState *from = base ? findEntity(*base, record.kind, record.id) : nullptr;
+            if (record.removed) {
+                if (from)
+                    _pendingRemovals.push_back(*from);
+                continue;
+            }
+            QuantizedState state = applyDelta(record, from);
+            _pendingChanges.push_back(state);
+            updated.push_back(dequantize(state));
+        }
+
+        if (_pendingReceived < _pendingChunkCount)
+            return Result::Applied;
+        complete();
+        return Result::Completed;
+    }
+
+    void SnapshotReceiver::complete() {
+        static const WorldState empty;
+        const WorldState *baseline = _pendingBaselineTick != 0 ? _history.find(_pendingBaselineTick) : nullptr;
+        const WorldState &base = baseline ? *baseline : empty;
+        sortWorld(_pendingChanges);
+        sortWorld(_pendingRemovals);
+
+        _world.clear();
+        std::size_t removed = 0;
+        auto keepBase = [&](const QuantizedState &state) {
+            while (removed < _pendingRemovals.size() && stateLess(_pendingRemovals[removed], state))
+                ++removed;
+            if (removed == _pendingRemovals.size() || !sameKey(_pendingRemovals[removed], state))
+                _world.push_back(state);
+        };
+        std::size_t i = 0;
+        for (const auto &change : _pendingChanges) {
+            for (; i < base.size() && stateLess(base[i], change); ++i)
+                keepBase(base[i]);
+            if (i < base.size() && sameKey(base[i], change))
+                ++i;
+            _world.push_back(change);
+        }
+        for (; i < base.size(); ++i)
+            keepBase(base[i]);
+
+        _history.store(_pendingTick, _world);
+        _completedTick = _pendingTick;
+        _hasPending = false;
+    }
+
+    void SnapshotReceiver::reset() {
+        _history.clear();
+        _completedTick = 0;
+        _hasPending = false;
+    }
+
+} // namespace snapshot
@@ -0,0 +1,261 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Snapshot
+*/
+
+#pragma once
+
+#include "protocol.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @namespace snapshot
+ * @brief Delta-encoded per-tick world snapshot (MessageType::Snapshot).
+ *
+ * The server keeps the world state of its last ticks. Each client acks the
+ * ticks it fully received, and the server encodes the next snapshot against
+ * the newest acked one (the baseline): only entities that changed, appeared
+ * or disappeared since the baseline are sent. A baseline tick of 0 means no
+ * baseline, every entity is then sent as new.
+ *
+ * Values are quantized to 1/POSITION_SCALE units so that both sides store
+ * the exact same baseline. A chunk is a SnapshotChunkHeader followed by
+ * recordCount records:
+ * - uint8_t kind (EntityKind), with REMOVED_FLAG set if the entity is gone;
+ * - varint id;
+ * - unless removed, uint8_t field mask (bit i = field i, in the order
+ *   x, y, z, vx, vy, vz), then one zigzag varint per set bit holding the
+ *   difference with the baseline value (0 for a new entity).
+ */
+namespace snapshot {
+
+    /** @brief Largest datagram the writer produces, kept under a 1280-byte path MTU. */
+    constexpr std::size_t MAX_DATAGRAM_SIZE = 1200;
+
+    /** @brief Quantization step of positions and velocities is 1 / POSITION_SCALE. */
+    constexpr float POSITION_SCALE = 16.f;
+
+    /** @brief Number of ticks kept on each side to encode and decode deltas. */
+    constexpr std::size_t HISTORY_SIZE = 64;
+
+    /** @brief Number of quantized fields per entity. */
+    constexpr std::size_t FIELD_COUNT = 6;
+
+    /** @brief Set on the kind byte of a record whose entity left the snapshot. */
+    constexpr uint8_t REMOVED_FLAG = 0x80;
+
+    /**
+     * @enum EntityKind
+     * @brief Kind of entity a record describes.
+     */
+    enum class EntityKind : uint8_t {
+        Player,           ///< Player position.
+        Enemy,            ///< Enemy position and 2D velocity.
+        Obstacle,         ///< Obstacle position and 3D velocity.
+        Element,          ///< Random element position and 2D velocity.
+        Projectile,       ///< Player projectile position.
+        EnemyProjectile,  ///< Enemy projectile position.
+    };
+
+    /**
+     * @struct EntityState
+     * @brief State of one entity in world units.
+     */
+    struct EntityState {
+        EntityKind kind;
+        uint32_t id;
+        float x;
+        float y;
+        float z;
+        float vx;
+        float vy;
+        float vz;
+    };
+
+    /**
+     * @struct QuantizedState
+     * @brief State of one entity as stored in a snapshot.
+     */
+    struct QuantizedState {
+        EntityKind kind;
+        uint32_t id;
+        std::array<int32_t, FIELD_COUNT> fields; ///< x, y, z, vx, vy, vz.
+    };
+
+    /**
+     * @brief Entities of one tick, sorted by (kind, id). See sortWorld().
+     */
+    using WorldState = std::vector<QuantizedState>;
+
+    /**
+     * @struct RecordDelta
+     * @brief One decoded record, not yet applied to its baseline.
+     */
+    struct RecordDelta {
+        EntityKind kind;
+        uint32_t id;
+        bool removed;
+        uint8_t mask;                            ///< Fields present in the record.
+        std::array<int32_t, FIELD_COUNT> deltas; ///< Zero for absent fields.
+    };
+
+    QuantizedState quantize(const EntityState &state);
+    EntityState dequantize(const QuantizedState &state);
+
+    /**
+     * @brief Sort a world state by (kind, id), as every function here expects.
+     */
+    void sortWorld(WorldState &world);
+
+    /**
+     * @brief Find an entity in a sorted world state.
+     * @return The entity, or nullptr.
+     */
+    const QuantizedState *findEntity(const WorldState &world, EntityKind kind, uint32_t id);
+
+    /**
+     * @brief Rebuild the full state of a record.
+     * @param base State of the entity in the baseline, or nullptr if new.
+     */
+    QuantizedState applyDelta(const RecordDelta &record, const QuantizedState *base);
+
+    /**
+     * @class SnapshotHistory
+     * @brief Ring of the world states of the last HISTORY_SIZE ticks.
+     */
+    class SnapshotHistory {
+        public:
+            /**
+             * @brief Keep the state of a tick, replacing the one HISTORY_SIZE ticks older.
+             */
+            void store(uint32_t tick, const WorldState &world);
+
+            /**
+             * @return The state stored for a tick, or nullptr if unknown or overwritten.
+             */
+            const WorldState *find(uint32_t tick) const;
+
+            void clear();
+
+        private:
+            struct Entry {
+                bool valid{false};
+                uint32_t tick{0};
+                WorldState world;
+            };
+            std::array<Entry, HISTORY_SIZE> _entries;
+    };
+
+    /**
+     * @class SnapshotWriter
+     * @brief Encodes a world state against a baseline into MTU-sized datagrams.
+     *
+     * Buffers are reused from one call to the next.
+     */
+    class SnapshotWriter {
+        public:
+            /**
+             * @param maxDatagramSize Upper bound of each datagram, header included.
+             */
+            explicit SnapshotWriter(std::size_t maxDatagramSize = MAX_DATAGRAM_SIZE);
+
+            /**
+             * @brief Encode the snapshot of a tick.
+             * @param tick Tick of the snapshot, never 0.
+             * @param world Sorted state of the tick.
+             * @param baselineTick Tick of the baseline, or 0 for none.
+             * @param baseline Sorted state of the baseline, or nullptr for none.
+             * @return The datagrams to send, valid until the next call. Holds
+             *         at least one datagram, so that the receiver can ack the tick.
+             */
+            const std::vector<std::vector<uint8_t>> &encode(uint32_t tick, const WorldState &world,
+                                                            uint32_t baselineTick, const WorldState *baseline);
+
+        private:
+            void openChunk();
+            void writeRecord(const QuantizedState &state, const QuantizedState *base);
+            void writeRemoved(const QuantizedState &base);
+            void commitRecord();
+
+            std::size_t _maxDatagramSize;
+            uint32_t _tick{0};
+            uint32_t _baselineTick{0};
+            std::size_t _chunkCount{0};
+            std::vector<std::vector<uint8_t>> _chunks;
+            std::vector<uint16_t> _recordCounts;
+            std::vector<uint8_t> _record;
+    };
+
+    /**
+     * @brief Decode one snapshot datagram.
+     * @param data Datagram bytes.
+     * @param size Datagram size.
+     * @param header Receives the header, in host byte order.
+     * @param out Receives the records, appended.
+     * @return false if the datagram is malformed; out may then hold a partial list.
+     */
+    bool decodeChunk(const uint8_t *data, std::size_t size, SnapshotChunkHeader &header,
+                     std::vector<RecordDelta> &out);
+
+    /**
+     * @class SnapshotReceiver
+     * @brief Client side: rebuilds snapshots from their chunks and baselines.
+     *
+     * A tick is complete once all its chunks arrived; it is then stored as a
+     * possible baseline and should be acked to the server.
+     */
+    class SnapshotReceiver {
+        public:
+            enum class Result {
+                Applied,          ///< Chunk decoded, its tick is not complete yet.
+                Completed,        ///< Chunk decoded and its tick is now complete.
+                Stale,            ///< Chunk of a tick older than the one in progress.
+                MissingBaseline,  ///< The baseline of the chunk is not stored anymore.
+                Malformed,        ///< The chunk could not be decoded.
+            };
+
+            /**
+             * @brief Decode a chunk.
+             * @param updated Receives the full state of every entity the chunk
+             *        changed or added, appended. Removed entities are not listed.
+             */
+            Result receive(const uint8_t *data, std::size_t size, std::vector<EntityState> &updated);
+
+            /**
+             * @return The newest complete tick, to ack; 0 if none yet.
+             */
+            uint32_t completedTick() const noexcept { return _completedTick; }
+
+            /**
+             * @return The state of the newest complete tick, or nullptr if none yet.
+             */
+            const WorldState *completedWorld() const { return _history.find(_completedTick); }
+
+            /**
+             * @brief Forget every snapshot, e.g. when a new game starts.
+             */
+            void reset();
+
+        private:
+            void complete();
+
+            SnapshotHistory _history;
+            uint32_t _completedTick{0};
+            bool _hasPending{false};
+            uint32_t _pendingTick{0};
+            uint32_t _pendingBaselineTick{0};
+            uint16_t _pendingChunkCount{0};
+            uint16_t _pendingReceived{0};
+            std::vector<bool> _pendingSeen;
+            WorldState _pendingChanges;
+            WorldState _pendingRemovals;
+            WorldState _world;
+            std::vector<RecordDelta> _records;
+    };
+
+} // namespace snapshot
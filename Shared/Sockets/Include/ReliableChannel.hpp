@@ -0,0 +1,234 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** ReliableChannel
+*/
+
+#pragma once
+
+#include "../../protocol.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+/**
+ * @namespace reliable
+ * @brief Reliable ordered messages over the game's UDP socket.
+ *
+ * A Connection holds one side of the link with a peer. Messages given to
+ * send() reach the peer's receive() exactly once and in order, per channel;
+ * channels are independent, so a large registry transfer does not delay
+ * gameplay events. Fragments are resent until acked, at most WINDOW_SIZE of
+ * them in flight per channel, once they wait longer than a timeout tracking
+ * the round-trip time. The wire format is ReliableHeader followed by the
+ * fragment payload.
+ *
+ * The Connection does no I/O nor locking: the owner feeds it the
+ * MessageType::Reliable datagrams received from the peer with on_packet(),
+ * and calls flush() to get the datagrams to send, both right after
+ * send()/on_packet() and regularly to resend what was lost.
+ */
+namespace reliable {
+
+    /**
+     * @enum Channel
+     * @brief Independent ordered streams of a connection.
+     */
+    enum class Channel : uint8_t {
+        Registry = 0, ///< Full registry snapshots (encode_snapshot()), often many fragments.
+        Events = 1,   ///< Gameplay messages that must not be lost (spawn, despawn, deaths).
+    };
+
+    /** @brief Number of channels. */
+    constexpr std::size_t CHANNEL_COUNT = 2;
+
+    /** @brief Size of ReliableHeader on the wire. */
+    constexpr std::size_t HEADER_SIZE = 20;
+
+    /** @brief Largest fragment payload, keeping datagrams under a 1280-byte path MTU. */
+    constexpr std::size_t MAX_FRAGMENT_SIZE = 1200;
+
+    /** @brief Largest datagram flush() produces. */
+    constexpr std::size_t MAX_PACKET_SIZE = HEADER_SIZE + MAX_FRAGMENT_SIZE;
+
+    /** @brief Fragments in flight per channel; the ack bitfield covers all of them. */
+    constexpr std::size_t WINDOW_SIZE = 32;
+
+    /** @brief Fragments queued per channel before send() refuses new messages. */
+    constexpr std::size_t MAX_QUEUED_FRAGMENTS = 8192;
+
+    /** @brief Delay after which an unacked fragment is sent again, until the first round trip is measured. */
+    constexpr std::chrono::milliseconds INITIAL_RESEND_TIMEOUT{250};
+
+    /** @brief Shortest resend delay, whatever the measured round trip. */
+    constexpr std::chrono::milliseconds MIN_RESEND_TIMEOUT{50};
+
+    /** @brief Longest resend delay, reached by backing off on a link that stopped acking. */
+    constexpr std::chrono::milliseconds MAX_RESEND_TIMEOUT{2000};
+
+    /** @brief Least slack above the smoothed round trip, when it barely varies. */
+    constexpr std::chrono::milliseconds MIN_RESEND_MARGIN{20};
+
+    /**
+     * @class Connection
+     * @brief State of the reliable channels with one peer.
+     */
+    class Connection {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            /**
+             * @param clientId ID of the client side, written in every header.
+             */
+            explicit Connection(uint32_t clientId = 0);
+
+            uint32_t client_id() const noexcept { return _clientId; }
+
+            /**
+             * @brief Queue a message; flush() sends it.
+             * @return false if the channel has too many fragments waiting,
+             *         the message is then dropped.
+             */
+            bool send(Channel channel, const void *data, std::size_t size);
+
+            /**
+             * @brief Process a MessageType::Reliable datagram from the peer.
+             *
+             * Handles the acks it carries and stores its fragment. Complete
+             * messages become available to receive() in order; an ack is
+             * owed to the peer and sent by the next flush().
+             *
+             * The newest fragment it acks that was sent only once gives a
+             * round-trip sample (Karn's rule): the resend timeout becomes
+             * the smoothed round trip plus four times its mean deviation,
+             * as in TCP (RFC 6298), clamped to [MIN_RESEND_TIMEOUT,
+             * MAX_RESEND_TIMEOUT].
+             *
+             * @param now Arrival time of the datagram.
+             * @return false if the datagram is malformed.
+             */
+            bool on_packet(Clock::time_point now, const uint8_t *data, std::size_t size);
+
+            /**
+             * @brief Take the next complete message, in arrival order.
+             * @param channel Receives the channel of the message.
+             * @param message Receives the message; its previous buffer is recycled.
+             * @return false if no message is complete.
+             */
+            bool receive(Channel &channel, std::vector<uint8_t> &message);
+
+            /**
+             * @brief Produce the datagrams due now.
+             *
+             * New fragments within the window, fragments unacked for
+             * resend_timeout(), and a bare ack for channels that owe one and
+             * had no fragment to carry it. Resending doubles the timeout
+             * until a fresh round trip is measured.
+             *
+             * @param send Callable (const uint8_t *data, std::size_t size),
+             *        called once per datagram; data is only valid during the call.
+             */
+            template <typename Send>
+            void flush(Clock::time_point now, Send &&send)
+            {
+                std::array<uint8_t, MAX_PACKET_SIZE> packet;
+                bool timedOut = false;
+                for (std::size_t c = 0; c < CHANNEL_COUNT; ++c) {
+                    ChannelState &state = _channels[c];
+                    bool ackSent = false;
+                    std::size_t inFlight = std::min(state.outgoing.size(), WINDOW_SIZE);
+                    for (std::size_t i = 0; i < inFlight; ++i) {
+                        Fragment &fragment = state.outgoing[i];
+                        if (fragment.acked || (fragment.sent && now - fragment.sentAt < _resendTimeout))
+                            continue;
+                        send(packet.data(), write_packet(c, &fragment, packet.data()));
+                        timedOut |= fragment.sent;
+                        fragment.resent = fragment.sent;
+                        fragment.sent = true;
+                        fragment.sentAt = now;
+                        ackSent = true;
+                    }
+                    if (state.ackPending && !ackSent)
+                        send(packet.data(), write_packet(c, nullptr, packet.data()));
+                    state.ackPending = false;
+                }
+                if (timedOut)
+                    _resendTimeout = std::min<Clock::duration>(_resendTimeout * 2, MAX_RESEND_TIMEOUT);
+            }
+
+            /**
+             * @return Whether some fragment waits to be sent or acked, i.e.
+             *         whether flush() must keep being called.
+             */
+            bool has_unacked() const noexcept;
+
+            /**
+             * @return Delay after which an unacked fragment is sent again.
+             */
+            Clock::duration resend_timeout() const noexcept { return _resendTimeout; }
+
+        private:
+            struct Fragment {
+                uint16_t sequence;
+                uint16_t index;
+                uint16_t count;
+                std::vector<uint8_t> payload;
+                Clock::time_point sentAt{};
+                bool sent{false};
+                bool resent{false};  ///< Sent more than once: its ack does not tell which copy arrived.
+                bool acked{false};
+            };
+
+            struct Received {
+                bool present{false};
+                uint16_t sequence{0};
+                uint16_t index{0};
+                uint16_t count{0};
+                std::vector<uint8_t> payload;
+            };
+
+            struct ChannelState {
+                uint16_t nextSequence{0};               ///< Sequence of the next fragment queued.
+                std::deque<Fragment> outgoing;          ///< Unacked fragments, oldest first.
+                uint16_t nextExpected{0};               ///< Next sequence to deliver.
+                std::array<Received, WINDOW_SIZE> window; ///< Fragments received ahead, by sequence % WINDOW_SIZE.
+                std::vector<uint8_t> assembling;        ///< Fragments of the current message delivered so far.
+                bool ackPending{false};                 ///< A fragment arrived since the last ack sent.
+            };
+
+            /**
+             * @brief Write the header, and the fragment if any, into out.
+             * @return Size of the datagram.
+             */
+            std::size_t write_packet(std::size_t channel, const Fragment *fragment, uint8_t *out) const;
+
+            /**
+             * @brief Drop or mark the fragments acked by a datagram.
+             * @return Send time of the newest of them sent only once, or a
+             *         default time point if there is none.
+             */
+            Clock::time_point handle_ack(ChannelState &state, uint16_t ack, uint32_t ackBits);
+
+            /**
+             * @brief Fold a round-trip sample into the resend timeout.
+             */
+            void sample_round_trip(Clock::duration rtt);
+
+            void deliver(Channel channel, ChannelState &state);
+
+            uint32_t _clientId;
+            Clock::duration _resendTimeout{INITIAL_RESEND_TIMEOUT};
+            Clock::duration _smoothedRtt{};
+            Clock::duration _rttDeviation{};
+            bool _rttMeasured{false};
+            std::array<ChannelState, CHANNEL_COUNT> _channels;
+            std::deque<std::pair<Channel, std::vector<uint8_t>>> _delivered;
+    };
+
+} // namespace reliable
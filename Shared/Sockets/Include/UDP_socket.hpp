@@ -8,6 +8,8 @@
 #pragma once
 
 #include <asio.hpp>
+#include <atomic>
+#include <chrono>
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -27,6 +29,18 @@
  */
 class UDP_socket {
     public:
+        /** @brief Largest datagram receive_batch() accepts; longer ones are truncated. */
+        static constexpr std::size_t MAX_DATAGRAM_SIZE = 2048;
+
+        /**
+         * @struct Datagram
+         * @brief One received datagram and its sender.
+         */
+        struct Datagram {
+            std::vector<uint8_t> data;           ///< Payload, sized to the datagram.
+            asio::ip::udp::endpoint endpoint;    ///< Sender's address and port.
+        };
+
         /**
          * @brief Constructs a UDP socket in client mode (no binding).
          * @throws std::runtime_error if socket creation fails.
@@ -60,6 +74,26 @@ class UDP_socket {
          */
         bool try_receive(std::vector<uint8_t>& outData, asio::ip::udp::endpoint& outEndpoint);
 
+        /**
+         * @brief Blocks until a datagram can be read or the timeout expires.
+         * @param timeout Maximum time to wait.
+         * @return true if the socket is readable.
+         */
+        bool wait_readable(std::chrono::milliseconds timeout);
+
+        /**
+         * @brief Receives every pending datagram, up to count, without blocking.
+         *
+         * Uses a single recvmmsg() call on Linux. The payload is written in
+         * place into each Datagram::data, which only allocates when its
+         * capacity is below MAX_DATAGRAM_SIZE.
+         *
+         * @param out Array of at least count datagrams to fill.
+         * @param count Maximum number of datagrams to receive.
+         * @return Number of datagrams received, 0 if none is pending.
+         */
+        std::size_t receive_batch(Datagram* out, std::size_t count);
+
         /**
          * @brief Sends a UDP message to the specified endpoint.
          * @param data Pointer to the data buffer.
@@ -83,6 +117,19 @@ class UDP_socket {
 		*/
         void broadcastToClients(std::vector<uint32_t> const &roomClients, const void* data, size_t size);
 
+        /**
+         * @brief Sends one payload to many clients (server mode only).
+         *
+         * Endpoints come from the table filled by addClient(); unknown IDs are
+         * skipped. On Linux, up to 64 recipients are served per sendmmsg() call.
+         *
+         * @param clientIds Array of client IDs.
+         * @param count Number of IDs in clientIds.
+         * @param data Pointer to the data to send.
+         * @param size Size of the data in bytes.
+         */
+        void broadcastToClients(const uint32_t* clientIds, size_t count, const void* data, size_t size);
+
         /**
          * @brief Registers a client with a unique ID (server mode only).
          * @param endpoint Client's UDP endpoint.
@@ -103,15 +150,43 @@ class UDP_socket {
         size_t getClientCount() const;
 
         /**
-         * @brief Returns a map of client addresses to their IDs (server mode only).
-         * @return const reference to the clients map.
+         * @struct Traffic
+         * @brief Datagrams and bytes that went through the socket since it was created.
+         */
+        struct Traffic {
+            uint64_t packetsIn{0};
+            uint64_t bytesIn{0};
+            uint64_t packetsOut{0};
+            uint64_t bytesOut{0};
+        };
+
+        /**
+         * @brief Returns the traffic counters; safe to call from any thread.
+         * @return Totals since the socket was created.
          */
-        const std::unordered_map<std::string, uint32_t>& getClients() const { return clients; }
+        Traffic getTraffic() const;
 
     private:
+        /**
+         * @struct ClientSlot
+         * @brief Entry of the client table, indexed by client ID.
+         */
+        struct ClientSlot {
+            asio::ip::udp::endpoint endpoint;    ///< Resolved once, in addClient().
+            bool connected{false};               ///< false for IDs never added or disconnected.
+        };
+
         asio::io_context ioContext;                           /**< Internal ASIO I/O context. */
         asio::ip::udp::socket socket;                        /**< UDP socket instance. */
-        std::unordered_map<std::string, uint32_t> clients;  /**< Maps client address strings to client IDs. */
-        mutable std::mutex clientsMutex;                     /**< Mutex for thread-safe client map access. */
+        std::vector<ClientSlot> clientSlots;                 /**< Client endpoints indexed by client ID (IDs are small and sequential). */
+        size_t clientCount{0};                               /**< Number of connected slots. */
+        mutable std::mutex clientsMutex;                     /**< Mutex for thread-safe client table access. */
         bool isServerMode;                                   /**< Flag to track if socket is in server mode. */
+        std::atomic<uint64_t> packetsIn{0};                  /**< Datagrams received. */
+        std::atomic<uint64_t> bytesIn{0};                    /**< Payload bytes received. */
+        std::atomic<uint64_t> packetsOut{0};                 /**< Datagrams handed to the kernel, one per recipient. */
+        std::atomic<uint64_t> bytesOut{0};                   /**< Payload bytes handed to the kernel. */
+
+        void countReceived(std::size_t packets, std::size_t bytes);
+        void countSent(std::size_t packets, std::size_t bytes);
 };
\ No newline at end of file
@@ -0,0 +1,197 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type
+** File description:
+** ReliableChannel
+*/
+
+#include "Include/ReliableChannel.hpp"
+#include <cstring>
+#include <limits>
+
+namespace reliable {
+
+    namespace {
+        void putU16(uint8_t *out, uint16_t value) {
+            out[0] = static_cast<uint8_t>(value >> 8);
+            out[1] = static_cast<uint8_t>(value);
+        }
+
+        void putU32(uint8_t *out, uint32_t value) {
+            out[0] = static_cast<uint8_t>(value >> 24);
+            out[1] = static_cast<uint8_t>(value >> 16);
+            out[2] = static_cast<uint8_t>(value >> 8);
+            out[3] = static_cast<uint8_t>(value);
+        }
+
+        uint16_t getU16(const uint8_t *in) {
+            return static_cast<uint16_t>((in[0] << 8) | in[1]);
+        }
+
+        uint32_t getU32(const uint8_t *in) {
+            return (static_cast<uint32_t>(in[0]) << 24) | (static_cast<uint32_t>(in[1]) << 16)
+                | (static_cast<uint32_t>(in[2]) << 8) | static_cast<uint32_t>(in[3]);
+        }
+
+        /** Signed distance from b to a, valid while they are less than 32768 apart. */
+        int16_t distance(uint16_t a, uint16_t b) {
+            return static_cast<int16_t>(static_cast<uint16_t>(a - b));
+        }
+    }
+
+    static_assert(sizeof(ReliableHeader) == HEADER_SIZE, "ReliableHeader must have no padding");
+    static_assert(WINDOW_SIZE <= 33, "the ack bitfield covers ack + 1 to ack + 33");
+
+    Connection::Connection(uint32_t clientId) : _clientId(clientId) {
+    }
+
+    bool Connection::send(Channel channel, const void *data, std::size_t size) {
+        ChannelState &state = _channels[static_cast<std::size_t>(channel)];
+        std::size_t count = size == 0 ? 1 : (size + MAX_FRAGMENT_SIZE - 1) / MAX_FRAGMENT_SIZE;
+        if (count > std::numeric_limits<uint16_t>::max() || state.outgoing.size() + count > MAX_QUEUED_FRAGMENTS)
+            return false;
+
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        for (std::size_t i = 0; i < count; ++i) {
+            std::size_t offset = i * MAX_FRAGMENT_SIZE;
+            std::size_t length = std::min(MAX_FRAGMENT_SIZE, size - offset);
+            Fragment fragment{state.nextSequence++, static_cast<uint16_t>(i), static_cast<uint16_t>(count), {}};
+            fragment.payload.assign(bytes + offset, bytes + offset + length);
+            state.outgoing.push_back(std::move(fragment));
+        }
+        return true;
+    }
+
+    bool Connection::on_packet(Clock::time_point now, const uint8_t *data, std::size_t size) {
+        if (size < HEADER_SIZE || data[0] != static_cast<uint8_t>(MessageType::Reliable) || data[1] >= CHANNEL_COUNT)
+            return false;
+        Channel channel = static_cast<Channel>(data[1]);
+        ChannelState &state = _channels[data[1]];
+        uint16_t sequence = getU16(data + 2);
+        uint16_t index = getU16(data + 14);
+        uint16_t count = getU16(data + 16);
+        if (count != 0 && index >= count)
+            return false;
+
+        Clock::time_point sentAt = handle_ack(state, getU16(data + 12), getU32(data + 8));
+        if (sentAt != Clock::time_point{} && now >= sentAt)
+            sample_round_trip(now - sentAt);
+        if (count == 0)
+            return true;
+
+        state.ackPending = true;
+        int16_t ahead = distance(sequence, state.nextExpected);
+        if (ahead < 0 || ahead >= static_cast<int16_t>(WINDOW_SIZE))
+            return true;
+        Received &slot = state.window[sequence % WINDOW_SIZE];
+        if (!slot.present) {
+            slot.present = true;
+            slot.sequence = sequence;
+            slot.index = index;
+            slot.count = count;
+            slot.payload.assign(data + HEADER_SIZE, data + size);
+            deliver(channel, state);
+        }
+        return true;
+    }
+
+    bool Connection::receive(Channel &channel, std::vector<uint8_t> &message) {
+        if (_delivered.empty())
+            return false;
+        channel = _delivered.front().first;
+        std::swap(message, _delivered.front().second);
+        _delivered.pop_front();
+        return true;
+    }
+
+    bool Connection::has_unacked() const noexcept {
+        for (const auto &state : _channels) {
+            if (!state.outgoing.empty())
+                return true;
+        }
+        return false;
+    }
+
+    std::size_t Connection::write_packet(std::size_t channel, const Fragment *fragment, uint8_t *out) const {
+        const ChannelState &state = _channels[channel];
+        uint16_t ack = static_cast<uint16_t>(state.nextExpected - 1);
+        uint32_t ackBits = 0;
+        for (std::size_t i = 0; i + 1 < WINDOW_SIZE; ++i) {
+            uint16_t sequence = static_cast<uint16_t>(ack + 2 + i);
+            const Received &slot = state.window[sequence % WINDOW_SIZE];
+            if (slot.present && slot.sequence == sequence)
+                ackBits |= 1u << i;
+        }
+
+        out[0] = static_cast<uint8_t>(MessageType::Reliable);
+        out[1] = static_cast<uint8_t>(channel);
+        putU16(out + 2, fragment ? fragment->sequence : 0);
+        putU32(out + 4, _clientId);
+        putU32(out + 8, ackBits);
+        putU16(out + 12, ack);
+        putU16(out + 14, fragment ? fragment->index : 0);
+        putU16(out + 16, fragment ? fragment->count : 0);
+        putU16(out + 18, 0);
+        if (!fragment)
+            return HEADER_SIZE;
+        if (!fragment->payload.empty())
+            std::memcpy(out + HEADER_SIZE, fragment->payload.data(), fragment->payload.size());
+        return HEADER_SIZE + fragment->payload.size();
+    }
+
+    Connection::Clock::time_point Connection::handle_ack(ChannelState &state, uint16_t ack, uint32_t ackBits) {
+        Clock::time_point newest{};
+        auto acked = [&newest](Fragment &fragment) {
+            if (fragment.sent && !fragment.resent && !fragment.acked)
+                newest = std::max(newest, fragment.sentAt);
+            fragment.acked = true;
+        };
+        // An ack beyond the last fragment queued is garbage.
+        if (distance(ack, static_cast<uint16_t>(state.nextSequence - 1)) > 0)
+            return newest;
+        while (!state.outgoing.empty() && distance(state.outgoing.front().sequence, ack) <= 0) {
+            acked(state.outgoing.front());
+            state.outgoing.pop_front();
+        }
+        for (auto &fragment : state.outgoing) {
+            int16_t bit = distance(fragment.sequence, static_cast<uint16_t>(ack + 2));
+            if (bit >= 32)
+                break;
+            if (bit >= 0 && (ackBits & (1u << bit)))
+                acked(fragment);
+        }
+        return newest;
+    }
+
+    void Connection::sample_round_trip(Clock::duration rtt) {
+        if (!_rttMeasured) {
+            _rttMeasured = true;
+            _smoothedRtt = rtt;
+            _rttDeviation = rtt / 2;
+        } else {
+            Clock::duration error = rtt > _smoothedRtt ? rtt - _smoothedRtt : _smoothedRtt - rtt;
+            _rttDeviation += (error - _rttDeviation) / 4;
+            _smoothedRtt += (rtt - _smoothedRtt) / 8;
+        }
+        Clock::duration margin = std::max<Clock::duration>(_rttDeviation * 4, MIN_RESEND_MARGIN);
+        _resendTimeout = std::clamp<Clock::duration>(_smoothedRtt + margin, MIN_RESEND_TIMEOUT, MAX_RESEND_TIMEOUT);
+    }
+
+    void Connection::deliver(Channel channel, ChannelState &state) {
+        for (;;) {
+            Received &slot = state.window[state.nextExpected % WINDOW_SIZE];
+            if (!slot.present || slot.sequence != state.nextExpected)
+                return;
+            if (slot.index == 0)
+                state.assembling.clear();
+            state.assembling.insert(state.assembling.end(), slot.payload.begin(), slot.payload.end());
+            if (slot.index + 1 == slot.count) {
+                _delivered.emplace_back(channel, std::move(state.assembling));
+                state.assembling = {};
+            }
+            slot.present = false;
+            ++state.nextExpected;
+        }
+    }
+
+} // namespace reliable
@@ -6,10 +6,19 @@
 */
 
 #include "Include/UDP_socket.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
 #include <stdexcept>
 #include <cstring>
 #include <asio.hpp>
 
+#if !defined(_WIN32)
+#include <poll.h>
+#include <sys/socket.h>
+#endif
+
 using asio::ip::udp;
 
 // Client mode constructor (no binding)
@@ -27,7 +36,7 @@ UDP_socket::UDP_socket() : socket(ioContext), isServerMode(false) {
         if (ec) throw std::runtime_error("Failed to set non-blocking mode: " + ec.message());
 
     } catch (const std::exception& e) {
-        std::cerr << "[ERROR] UDP_socket client ctor: " << e.what() << std::endl;
+        LOG_ERROR("UDP_socket client ctor: " << e.what());
         throw;
     }
 }
@@ -48,7 +57,7 @@ UDP_socket::UDP_socket(uint16_t port) : ioContext(), socket(ioContext), isServer
         if (ec) throw std::runtime_error("Failed to set non-blocking mode: " + ec.message());
 
     } catch (const std::exception& e) {
-        std::cerr << "[ERROR] UDP_socket server ctor: " << e.what() << std::endl;
+        LOG_ERROR("UDP_socket server ctor: " << e.what());
         throw;
     }
 }
@@ -66,10 +75,11 @@ std::pair<std::vector<uint8_t>, asio::ip::udp::endpoint> UDP_socket::receive() {
     try {
         size_t len = socket.receive_from(asio::buffer(buf), sender, 0, ec);
         if (ec) throw std::runtime_error("UDP receive failed: " + ec.message());
+        countReceived(1, len);
 
         return { std::vector<uint8_t>(buf.data(), buf.data() + len), sender };
     } catch (const std::exception& e) {
-        std::cerr << "[ERROR] receive(): " << e.what() << std::endl;
+        LOG_ERROR("receive(): " << e.what());
         return {};
     }
 }
@@ -88,114 +98,237 @@ bool UDP_socket::try_receive(std::vector<uint8_t>& outData, asio::ip::udp::endpo
         }
 
         outData.assign(buf.data(), buf.data() + len);
+        countReceived(1, len);
         return true;
     } catch (const std::exception& e) {
-        std::cerr << "[ERROR] try_receive(): " << e.what() << std::endl;
+        LOG_ERROR("try_receive(): " << e.what());
         return false;
     }
 }
 
+namespace {
+    /**
+     * @brief Sends one payload to a list of endpoints, batching the syscalls.
+     *
+     * On Linux, endpoints are queued and sent together by sendmmsg(); the
+     * queued endpoints must stay alive until flush(). Elsewhere, add() sends
+     * right away.
+     */
+    class FanOut {
+        public:
+            FanOut(udp::socket &socket, const void* data, size_t size) : socket(socket), data(data), size(size) {
+#if defined(__linux__)
+                payload.iov_base = const_cast<void*>(data);
+                payload.iov_len = size;
+#endif
+            }
+
+            void add(const udp::endpoint& endpoint) {
+#if defined(__linux__)
+                mmsghdr &header = headers[count++];
+                header = {};
+                header.msg_hdr.msg_name = const_cast<asio::detail::socket_addr_type*>(endpoint.data());
+                header.msg_hdr.msg_namelen = static_cast<socklen_t>(endpoint.size());
+                header.msg_hdr.msg_iov = &payload;
+                header.msg_hdr.msg_iovlen = 1;
+                if (count == headers.size())
+                    flush();
+#else
+                asio::error_code ec;
+                socket.send_to(asio::buffer(data, size), endpoint, 0, ec);
+                if (ec)
+                    LOG_WARN("broadcast(): UDP send failed: " << ec.message());
+#endif
+            }
+
+            void flush() {
+#if defined(__linux__)
+                size_t sent = 0;
+                while (sent < count) {
+                    int got = ::sendmmsg(socket.native_handle(), headers.data() + sent,
+                                         static_cast<unsigned int>(count - sent), 0);
+                    if (got < 0) {
+                        if (errno == EINTR)
+                            continue;
+                        // Skip the recipient that failed, keep serving the others.
+                        LOG_WARN("broadcast(): UDP send failed: " << std::strerror(errno));
+                        got = 1;
+                    }
+                    sent += static_cast<size_t>(got);
+                }
+                count = 0;
+#endif
+            }
+
+        private:
+            udp::socket &socket;
+            const void* data;
+            size_t size;
+#if defined(__linux__)
+            iovec payload{};
+            std::array<mmsghdr, 64> headers;
+            size_t count{0};
+#endif
+    };
+}
+
+bool UDP_socket::wait_readable(std::chrono::milliseconds timeout) {
+#if defined(_WIN32)
+    WSAPOLLFD fd{};
+    fd.fd = socket.native_handle();
+    fd.events = POLLRDNORM;
+    return WSAPoll(&fd, 1, static_cast<INT>(timeout.count())) > 0;
+#else
+    pollfd fd{};
+    fd.fd = socket.native_handle();
+    fd.events = POLLIN;
+    return ::poll(&fd, 1, static_cast<int>(timeout.count())) > 0;
+#endif
+}
+
+#if defined(__linux__)
+std::size_t UDP_socket::receive_batch(Datagram* out, std::size_t count) {
+    constexpr std::size_t MAX_BATCH = 64;
+    std::array<mmsghdr, MAX_BATCH> headers;
+    std::array<iovec, MAX_BATCH> iovecs;
+    std::size_t received = 0;
+
+    while (received < count) {
+        std::size_t batch = std::min(count - received, MAX_BATCH);
+        for (std::size_t i = 0; i < batch; ++i) {
+            Datagram &datagram = out[received + i];
+            datagram.data.resize(MAX_DATAGRAM_SIZE);
+            iovecs[i].iov_base = datagram.data.data();
+            iovecs[i].iov_len = datagram.data.size();
+            headers[i] = {};
+            headers[i].msg_hdr.msg_name = datagram.endpoint.data();
+            headers[i].msg_hdr.msg_namelen = static_cast<socklen_t>(datagram.endpoint.capacity());
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        int got = ::recvmmsg(socket.native_handle(), headers.data(), static_cast<unsigned int>(batch), MSG_DONTWAIT, nullptr);
+        if (got <= 0) {
+            if (got < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                LOG_ERROR("receive_batch(): " << std::strerror(errno));
+            break;
+        }
+        std::size_t bytes = 0;
+        for (int i = 0; i < got; ++i) {
+            Datagram &datagram = out[received + i];
+            datagram.data.resize(headers[i].msg_len);
+            datagram.endpoint.resize(headers[i].msg_hdr.msg_namelen);
+            bytes += headers[i].msg_len;
+        }
+        countReceived(static_cast<std::size_t>(got), bytes);
+        received += static_cast<std::size_t>(got);
+        if (static_cast<std::size_t>(got) < batch)
+            break;
+    }
+    return received;
+}
+#else
+std::size_t UDP_socket::receive_batch(Datagram* out, std::size_t count) {
+    std::size_t received = 0;
+
+    for (; received < count; ++received) {
+        Datagram &datagram = out[received];
+        asio::error_code ec;
+        datagram.data.resize(MAX_DATAGRAM_SIZE);
+        std::size_t len = socket.receive_from(asio::buffer(datagram.data), datagram.endpoint, 0, ec);
+        if (ec) {
+            if (ec != asio::error::would_block && ec != asio::error::try_again)
+                LOG_ERROR("receive_batch(): " << ec.message());
+            break;
+        }
+        datagram.data.resize(len);
+        countReceived(1, len);
+    }
+    return received;
+}
+#endif
+
 void UDP_socket::sendTo(const void* data, size_t size, const asio::ip::udp::endpoint& endpoint) {
     try {
         asio::error_code ec;
         socket.send_to(asio::buffer(data, size), endpoint, 0, ec);
         if (ec) throw std::runtime_error("UDP sendTo failed: " + ec.message());
+        countSent(1, size);
     } catch (const std::exception& e) {
-        std::cerr << "[ERROR] sendTo(): " << e.what() << std::endl;
+        LOG_ERROR("sendTo(): " << e.what());
     }
 }
 
 void UDP_socket::broadcast(const void* data, size_t size) {
     if (!isServerMode) {
-        std::cerr << "[WARN] broadcast() called on client-mode socket, ignoring." << std::endl;
+        LOG_WARN("broadcast() called on client-mode socket, ignoring.");
         return;
     }
 
     std::lock_guard<std::mutex> lock(clientsMutex);
-    asio::error_code ec;
-
-    for (const auto& [addrStr, clientId] : clients) {
-        try {
-            auto pos = addrStr.find(':');
-            if (pos == std::string::npos) continue;
-            
-            std::string ip = addrStr.substr(0, pos);
-            uint16_t port = static_cast<uint16_t>(std::stoi(addrStr.substr(pos + 1)));
-            auto addr = asio::ip::make_address(ip, ec);
-            if (ec) continue;
-
-            udp::endpoint ep(addr, port);
-            socket.send_to(asio::buffer(data, size), ep, 0, ec);
-            if (ec) throw std::runtime_error("UDP broadcast failed to " + addrStr + ": " + ec.message());
-
-        } catch (const std::exception& e) {
-            std::cerr << "[WARN] broadcast(): " << e.what() << std::endl;
-        }
+    FanOut fanOut(socket, data, size);
+    for (const auto& slot : clientSlots) {
+        if (slot.connected)
+            fanOut.add(slot.endpoint);
     }
+    fanOut.flush();
+    countSent(clientCount, size * clientCount);
 }
 
 void UDP_socket::broadcastToClients(std::vector<uint32_t> const &roomClients, const void* data, size_t size) {
+    broadcastToClients(roomClients.data(), roomClients.size(), data, size);
+}
+
+void UDP_socket::broadcastToClients(const uint32_t* clientIds, size_t count, const void* data, size_t size) {
     if (!isServerMode) {
-        std::cerr << "[WARN] broadcastToRoom() called on client-mode socket, ignoring." << std::endl;
+        LOG_WARN("broadcastToRoom() called on client-mode socket, ignoring.");
         return;
     }
 
     std::lock_guard<std::mutex> lock(clientsMutex);
-    asio::error_code ec;
-
-    for (auto &p : roomClients) {
-        for (const auto& [addrStr, clientId] : clients) {
-            if (p != clientId)
-                continue;
-
-            try {
-                auto pos = addrStr.find(':');
-                if (pos == std::string::npos) continue;
-
-                std::string ip = addrStr.substr(0, pos);
-                uint16_t port = static_cast<uint16_t>(std::stoi(addrStr.substr(pos + 1)));
-                auto addr = asio::ip::make_address(ip, ec);
-                if (ec) continue;
-
-                udp::endpoint ep(addr, port);
-                socket.send_to(asio::buffer(data, size), ep, 0, ec);
-                if (ec) throw std::runtime_error("UDP broadcast failed to " + addrStr + ": " + ec.message());
-
-            } catch (const std::exception& e) {
-                std::cerr << "[WARN] broadcast(): " << e.what() << std::endl;
-            }
+    FanOut fanOut(socket, data, size);
+    size_t recipients = 0;
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t id = clientIds[i];
+        if (id < clientSlots.size() && clientSlots[id].connected) {
+            fanOut.add(clientSlots[id].endpoint);
+            ++recipients;
         }
     }
+    fanOut.flush();
+    countSent(recipients, size * recipients);
 }
 
 void UDP_socket::addClient(const asio::ip::udp::endpoint& endpoint, uint32_t clientId) {
     if (!isServerMode) {
-        std::cerr << "[WARN] addClient() called on client-mode socket, ignoring." << std::endl;
+        LOG_WARN("addClient() called on client-mode socket, ignoring.");
         return;
     }
 
-    std::string addrStr = endpoint.address().to_string() + ":" + std::to_string(endpoint.port());
-
     std::lock_guard<std::mutex> lock(clientsMutex);
-    clients[addrStr] = clientId;
+    if (clientId >= clientSlots.size())
+        clientSlots.resize(static_cast<size_t>(clientId) + 1);
+    ClientSlot &slot = clientSlots[clientId];
+    if (!slot.connected)
+        ++clientCount;
+    slot.endpoint = endpoint;
+    slot.connected = true;
 }
 
 void UDP_socket::disconnectClient(uint32_t clientId) {
     if (!isServerMode) {
-        std::cerr << "[WARN] disconnectClient() called on client-mode socket, ignoring." << std::endl;
+        LOG_WARN("disconnectClient() called on client-mode socket, ignoring.");
         return;
     }
 
     std::lock_guard<std::mutex> lock(clientsMutex);
-
-    for (auto it = clients.begin(); it != clients.end();) {
-        if (it->second == clientId) {
-            std::cout << "[INFO] Client disconnected: " << it->first << " (ID " << clientId << ")" << std::endl;
-            it = clients.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    if (clientId >= clientSlots.size() || !clientSlots[clientId].connected)
+        return;
+    ClientSlot &slot = clientSlots[clientId];
+    LOG_INFO("Client disconnected: " << slot.endpoint.address().to_string() << ":"
+              << slot.endpoint.port() << " (ID " << clientId << ")");
+    slot = ClientSlot{};
+    --clientCount;
 }
 
 size_t UDP_socket::getClientCount() const {
@@ -204,5 +337,24 @@ size_t UDP_socket::getClientCount() const {
     }
 
     std::lock_guard<std::mutex> lock(clientsMutex);
-    return clients.size();
-}
\ No newline at end of file
+    return clientCount;
+}
+
+UDP_socket::Traffic UDP_socket::getTraffic() const {
+    Traffic traffic;
+    traffic.packetsIn = packetsIn.load(std::memory_order_relaxed);
+    traffic.bytesIn = bytesIn.load(std::memory_order_relaxed);
+    traffic.packetsOut = packetsOut.load(std::memory_order_relaxed);
+    traffic.bytesOut = bytesOut.load(std::memory_order_relaxed);
+    return traffic;
+}
+
+void UDP_socket::countReceived(std::size_t packets, std::size_t bytes) {
+    packetsIn.fetch_add(packets, std::memory_order_relaxed);
+    bytesIn.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void UDP_socket::countSent(std::size_t packets, std::size_t bytes) {
+    packetsOut.fetch_add(packets, std::memory_order_relaxed);
+    bytesOut.fetch_add(bytes, std::memory_order_relaxed);
+}
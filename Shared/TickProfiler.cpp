@@ -0,0 +1,117 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Per-phase tick profiler implementation
+*/
+
+#include "TickProfiler.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace metrics {
+
+    namespace {
+        void raiseTo(std::atomic<uint64_t> &max, uint64_t value) {
+            uint64_t current = max.load(std::memory_order_relaxed);
+            while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+                ;
+        }
+    }
+
+    uint64_t elapsedNs(Clock::time_point from, Clock::time_point to) {
+        if (to <= from)
+            return 0;
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+    }
+
+    std::size_t Histogram::bucketOf(uint64_t value) {
+        if (value < LINEAR_BUCKETS)
+            return static_cast<std::size_t>(value);
+        unsigned exponent = static_cast<unsigned>(std::bit_width(value)) - 1;
+        std::size_t sub = static_cast<std::size_t>(value >> (exponent - 3)) & (SUB_BUCKETS - 1);
+        return LINEAR_BUCKETS + (exponent - 4) * SUB_BUCKETS + sub;
+    }
+
+    uint64_t Histogram::bucketValue(std::size_t bucket) {
+        if (bucket < LINEAR_BUCKETS)
+            return bucket;
+        unsigned exponent = static_cast<unsigned>((bucket - LINEAR_BUCKETS) / SUB_BUCKETS) + 4;
+        uint64_t sub = (bucket - LINEAR_BUCKETS) % SUB_BUCKETS;
+        uint64_t width = uint64_t{1} << (exponent - 3);
+        return (SUB_BUCKETS + sub) * width + width / 2;
+    }
+
+    void Histogram::record(uint64_t nanoseconds) {
+        _buckets[bucketOf(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+        _total.fetch_add(nanoseconds, std::memory_order_relaxed);
+        raiseTo(_max, nanoseconds);
+    }
+
+    Summary Histogram::collect() {
+        std::array<uint64_t, BUCKET_COUNT> counts;
+        Summary summary;
+        for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+            counts[i] = _buckets[i].exchange(0, std::memory_order_relaxed);
+            summary.count += counts[i];
+        }
+        summary.max = _max.exchange(0, std::memory_order_relaxed);
+        summary.total = _total.exchange(0, std::memory_order_relaxed);
+        if (summary.count == 0)
+            return summary;
+
+        uint64_t p50Rank = (summary.count + 1) / 2;
+        uint64_t p99Rank = (summary.count * 99 + 99) / 100;
+        uint64_t seen = 0;
+        bool p50Found = false;
+        for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+            seen += counts[i];
+            if (!p50Found && seen >= p50Rank) {
+                summary.p50 = bucketValue(i);
+                p50Found = true;
+            }
+            if (seen >= p99Rank) {
+                summary.p99 = bucketValue(i);
+                break;
+            }
+        }
+        // A bucket's middle may exceed the largest value actually recorded.
+        if (summary.max != 0) {
+            summary.p50 = std::min(summary.p50, summary.max);
+            summary.p99 = std::min(summary.p99, summary.max);
+        }
+        return summary;
+    }
+
+    void Gauge::sample(uint64_t value) {
+        raiseTo(_max, value);
+    }
+
+    TickProfiler::TickProfiler(std::vector<std::string> phaseNames)
+        : _names(std::move(phaseNames)), _phases(std::make_unique<Histogram[]>(_names.size())) {}
+
+    TickReport TickProfiler::collect() {
+        TickReport report;
+        report.phases.reserve(_names.size());
+        for (std::size_t i = 0; i < _names.size(); ++i)
+            report.phases.emplace_back(_names[i], _phases[i].collect());
+        report.tick = _tick.collect();
+        report.lateness = _lateness.collect();
+        report.skippedTicks = skippedTicks.collect();
+        report.packetsIn = packetsIn.collect();
+        report.bytesIn = bytesIn.collect();
+        report.packetsOut = packetsOut.collect();
+        report.bytesOut = bytesOut.collect();
+        report.pendingPackets = pendingPackets.collect();
+        report.droppedPackets = droppedPackets.collect();
+        report.queuedCommands = queuedCommands.collect();
+        return report;
+    }
+
+    void PhaseTimer::lap(std::size_t phase) {
+        Clock::time_point now = Clock::now();
+        _profiler.phase(phase).record(elapsedNs(_last, now));
+        _last = now;
+    }
+
+} // namespace metrics
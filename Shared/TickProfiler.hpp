@@ -0,0 +1,173 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Per-phase tick profiler
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace metrics {
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Distribution of the values recorded since the previous collect.
+     */
+    struct Summary {
+        uint64_t count{0};
+        uint64_t p50{0};
+        uint64_t p99{0};
+        uint64_t max{0};
+        uint64_t total{0};
+    };
+
+    /**
+     * @class Histogram
+     * @brief Lock-free log-linear histogram of durations in nanoseconds.
+     *
+     * Values under 16 ns get a bucket each; above, every power of two is cut in
+     * 8 buckets, so percentiles are within 12.5 % of the recorded value.
+     *
+     * record() may run on any thread and never blocks. collect() empties the
+     * histogram as it reads it: each value is counted in exactly one
+     * collected window, whatever runs concurrently. Only one thread should
+     * collect.
+     */
+    class Histogram {
+        public:
+            static constexpr std::size_t LINEAR_BUCKETS = 16;
+            static constexpr std::size_t SUB_BUCKETS = 8;
+            static constexpr std::size_t BUCKET_COUNT = LINEAR_BUCKETS + (64 - 4) * SUB_BUCKETS;
+
+            void record(uint64_t nanoseconds);
+            Summary collect();
+
+            /** @brief Bucket of a value. */
+            static std::size_t bucketOf(uint64_t value);
+
+            /** @brief Middle of the values a bucket holds. */
+            static uint64_t bucketValue(std::size_t bucket);
+
+        private:
+            std::array<std::atomic<uint64_t>, BUCKET_COUNT> _buckets{};
+            std::atomic<uint64_t> _max{0};
+            std::atomic<uint64_t> _total{0};
+    };
+
+    /**
+     * @class Counter
+     * @brief Lock-free count of events since the previous collect.
+     */
+    class Counter {
+        public:
+            void add(uint64_t amount) { _value.fetch_add(amount, std::memory_order_relaxed); }
+            uint64_t collect() { return _value.exchange(0, std::memory_order_relaxed); }
+
+        private:
+            std::atomic<uint64_t> _value{0};
+    };
+
+    /**
+     * @class Gauge
+     * @brief Highest value sampled since the previous collect, such as a queue depth.
+     */
+    class Gauge {
+        public:
+            void sample(uint64_t value);
+            uint64_t collect() { return _max.exchange(0, std::memory_order_relaxed); }
+
+        private:
+            std::atomic<uint64_t> _max{0};
+    };
+
+    /**
+     * @brief Everything a TickProfiler recorded since the previous collect.
+     */
+    struct TickReport {
+        std::vector<std::pair<std::string, Summary>> phases; ///< In the order the phases were declared.
+        Summary tick;           ///< Whole tick.
+        Summary lateness;       ///< How long after its deadline each tick started.
+        uint64_t skippedTicks{0};
+        uint64_t packetsIn{0};
+        uint64_t bytesIn{0};
+        uint64_t packetsOut{0};
+        uint64_t bytesOut{0};
+        uint64_t pendingPackets{0};  ///< Deepest queue of received packets waiting for a tick.
+        uint64_t droppedPackets{0};  ///< Received packets dropped because that queue was full.
+        uint64_t queuedCommands{0};  ///< Most movement commands waiting for a single player.
+    };
+
+    /**
+     * @class TickProfiler
+     * @brief Timings and traffic of one game instance, cheap enough to stay on.
+     *
+     * The game declares its phases once and times them with a PhaseTimer
+     * each tick; the room pool times whole ticks. A stats thread calls
+     * collect() now and then to read and reset every value. Nothing here
+     * takes a lock: recording a phase is a clock read and a few relaxed
+     * atomic adds.
+     */
+    class TickProfiler {
+        public:
+            explicit TickProfiler(std::vector<std::string> phaseNames);
+
+            std::size_t phaseCount() const { return _names.size(); }
+            Histogram &phase(std::size_t index) { return _phases[index]; }
+            Histogram &tick() { return _tick; }
+            Histogram &lateness() { return _lateness; }
+
+            Counter skippedTicks;
+            Counter packetsIn;
+            Counter bytesIn;
+            Counter packetsOut;
+            Counter bytesOut;
+            Gauge pendingPackets;
+            Counter droppedPackets;
+            Gauge queuedCommands;
+
+            /** @brief Reads and resets every value. */
+            TickReport collect();
+
+        private:
+            std::vector<std::string> _names;
+            std::unique_ptr<Histogram[]> _phases;
+            Histogram _tick;
+            Histogram _lateness;
+    };
+
+    /**
+     * @class PhaseTimer
+     * @brief Times consecutive phases of a tick with one clock read per phase.
+     *
+     * @code
+     * metrics::PhaseTimer timer(profiler);
+     * process_pending_messages();
+     * timer.lap(PHASE_MESSAGES);
+     * @endcode
+     */
+    class PhaseTimer {
+        public:
+            explicit PhaseTimer(TickProfiler &profiler) : _profiler(profiler), _last(Clock::now()) {}
+
+            /** @brief Records the time since the previous lap (or construction) into a phase. */
+            void lap(std::size_t phase);
+
+        private:
+            TickProfiler &_profiler;
+            Clock::time_point _last;
+    };
+
+    /** @brief Nanoseconds between two time points, 0 if `to` is earlier. */
+    uint64_t elapsedNs(Clock::time_point from, Clock::time_point to);
+
+} // namespace metrics
@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** TripleBuffer
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class TripleBuffer
+ * @brief Hands the latest version of a value from one writer thread to one
+ *        reader thread, without locks and without the reader ever copying.
+ *
+ * Three T live in the buffer: the writer's back buffer, the reader's front
+ * buffer and a middle one. publish() swaps the back buffer with the middle
+ * one and flags it fresh; read() swaps the middle buffer with the front one
+ * when it is fresh. Both swaps are a single atomic exchange, so neither side
+ * ever waits for the other and the reader always gets a complete version.
+ *
+ * After publishing, the writer's new back buffer is brought up to date by
+ * copy-assigning the version just published, so it can keep editing the
+ * state incrementally. Copy-assigning standard containers reuses their
+ * storage: once the three buffers have grown, publishing does not allocate.
+ */
+template <typename T>
+class TripleBuffer {
+    public:
+        TripleBuffer() = default;
+        TripleBuffer(const TripleBuffer &) = delete;
+        TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+        /**
+         * @brief Writer thread only: the version being edited.
+         *        The reference stays valid until the next publish().
+         */
+        T &back() noexcept { return _buffers[_back]; }
+
+        /**
+         * @brief Writer thread only: make the back buffer the latest version.
+         */
+        void publish()
+        {
+            std::uint8_t published = _back;
+            std::uint8_t previous = _middle.exchange(static_cast<std::uint8_t>(published | FRESH), std::memory_order_acq_rel);
+            _back = previous & INDEX;
+            _buffers[_back] = _buffers[published];
+        }
+
+        /**
+         * @brief Reader thread only: the latest published version.
+         *        The reference stays valid until the next read().
+         */
+        const T &read() noexcept
+        {
+            if (_middle.load(std::memory_order_acquire) & FRESH)
+                _front = _middle.exchange(_front, std::memory_order_acq_rel) & INDEX;
+            return _buffers[_front];
+        }
+
+        /**
+         * @brief Whether a version newer than the last read() is waiting.
+         */
+        bool fresh() const noexcept { return _middle.load(std::memory_order_acquire) & FRESH; }
+
+    private:
+        static constexpr std::uint8_t INDEX = 0x3;
+        static constexpr std::uint8_t FRESH = 0x4;
+
+        T _buffers[3]{};
+        std::uint8_t _back{0};                  ///< Writer only.
+        alignas(64) std::atomic<std::uint8_t> _middle{1};
+        alignas(64) std::uint8_t _front{2};     ///< Reader only.
+};
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -61,6 +62,11 @@ enum class MessageType : uint8_t {
     GlobalScore,              ///< Server updates team global score.
     IndividualScore,          ///< Server updates individual player score.
     ChatMessage,              ///< Chat message relayed through server.
+    Snapshot,                 ///< Server sends one chunk of the per-tick world snapshot.
+    SnapshotAck,              ///< Client acknowledges a complete snapshot.
+    PlayerInputAck,           ///< Server acknowledges the movement commands it applied.
+    Reliable,                 ///< Fragment or acknowledgement of the reliable ordered channel.
+    ClientInputEvent,         ///< Client sends a key press or release (Smash Bros mode).
 };
 
 /**
@@ -201,6 +207,7 @@ struct GameStartMessage {
     MessageType type;      ///< Always MessageType::GameStart.
     uint32_t clientCount;  ///< Number of players in the game.
     uint32_t roomId;       ///< Room ID of the starting game.
+    uint32_t tickRate;     ///< Server ticks per second; snapshot ticks are counted at this rate.
 };
 
 /**
@@ -287,18 +294,55 @@ struct ServerSendRoomsMessage {
     char jsonData[2047]; ///< JSON-formatted room list (null-terminated).
 };
 
+/** @brief Movement commands repeated in each ClientInputMessage, to survive packet loss. */
+constexpr std::size_t INPUT_REDUNDANCY = 4;
+
 /**
  * @struct ClientInputMessage
- * @brief Message sent by client containing player input for the current frame.
+ * @brief Message sent by client with its newest movement commands.
+ *
+ * A command is the button mask (movement::Button) held during one tick. The
+ * client numbers commands from 1 and sends the newest ones it has not seen
+ * acked, newest first: buttons[i] is command sequence - i. The server skips
+ * the ones it already received. See Shared/PlayerMovement.hpp.
  */
 struct ClientInputMessage {
-    MessageType type;    ///< Always MessageType::ClientInput.
+    MessageType type;                  ///< Always MessageType::ClientInput.
+    uint32_t clientId;                 ///< Client ID sending input.
+    uint32_t sequence;                 ///< Sequence number of buttons[0] (network byte order).
+    uint8_t count;                     ///< Number of commands in buttons, 1 to INPUT_REDUNDANCY.
+    uint8_t buttons[INPUT_REDUNDANCY]; ///< Button masks, newest first.
+};
+
+/**
+ * @struct ClientInputEventMessage
+ * @brief Message sent by client when a tracked key is pressed or released.
+ *
+ * Used by the Smash Bros mode, whose server keeps the held keys itself;
+ * R-Type movement uses ClientInputMessage.
+ */
+struct ClientInputEventMessage {
+    MessageType type;    ///< Always MessageType::ClientInputEvent.
     uint32_t clientId;   ///< Client ID sending input.
     uint8_t inputCode;   ///< Input type (see InputCode enum).
     uint8_t isPressed;   ///< 1 if pressed, 0 if released.
     uint16_t padding{0}; ///< Padding for alignment.
 };
 
+/**
+ * @struct PlayerInputAckMessage
+ * @brief Message sent by server to a player with its authoritative position.
+ *
+ * Sent after the server applied new commands of the player, when the
+ * position changed for another reason, and periodically otherwise.
+ */
+struct PlayerInputAckMessage {
+    MessageType type;  ///< Always MessageType::PlayerInputAck.
+    uint32_t clientId; ///< Client ID of the player.
+    uint32_t sequence; ///< Last command applied, 0 for none (network byte order).
+    Position3D pos;    ///< Position after that command.
+};
+
 /**
  * @struct StateUpdateMessage
  * @brief Message sent by server to update a client's 3D position.
@@ -571,4 +615,57 @@ struct EndlessModeMessage {
     MessageType type;   ///< Always MessageType::EndlessMode.
     uint32_t clientId;  ///< Client ID.
     uint8_t isEndless;  ///< 1 if endless mode enabled, 0 otherwise.
-};
\ No newline at end of file
+};
+
+/**
+ * @struct SnapshotChunkHeader
+ * @brief Header of one datagram of the per-tick world snapshot.
+ *
+ * The server encodes each tick against the newest tick the client acked
+ * (see SnapshotAckMessage) and splits the result into datagrams of at most
+ * snapshot::MAX_DATAGRAM_SIZE bytes. Each chunk holds whole records and can
+ * be applied on its own. Records follow the header; see Shared/Snapshot.hpp
+ * for their layout.
+ */
+struct SnapshotChunkHeader {
+    MessageType type;      ///< Always MessageType::Snapshot.
+    uint8_t reserved;      ///< Zero.
+    uint16_t chunkIndex;   ///< Index of this chunk in the tick (network byte order).
+    uint32_t tick;         ///< Server tick the snapshot was taken at (network byte order).
+    uint32_t baselineTick; ///< Tick the records are relative to, 0 for none (network byte order).
+    uint16_t chunkCount;   ///< Number of chunks sent for this tick (network byte order).
+    uint16_t recordCount;  ///< Number of records in this chunk (network byte order).
+};
+
+/**
+ * @struct SnapshotAckMessage
+ * @brief Message sent by client once every chunk of a snapshot arrived.
+ */
+struct SnapshotAckMessage {
+    MessageType type;  ///< Always MessageType::SnapshotAck.
+    uint32_t clientId; ///< Client ID.
+    uint32_t tick;     ///< Tick of the completed snapshot.
+};
+
+/**
+ * @struct ReliableHeader
+ * @brief Header of a datagram of the reliable ordered channel.
+ *
+ * Each channel numbers its datagrams on its own. A message larger than one
+ * datagram is split into fragments with consecutive sequence numbers. Every
+ * datagram also acks, for its channel, the other direction: ack is the last
+ * sequence received in order, and bit i of ackBits is set when ack + 2 + i
+ * was received too. A datagram with fragmentCount 0 only carries acks. The
+ * fragment payload follows the header; see Shared/Sockets/ReliableChannel.hpp.
+ */
+struct ReliableHeader {
+    MessageType type;       ///< Always MessageType::Reliable.
+    uint8_t channel;        ///< reliable::Channel the datagram belongs to.
+    uint16_t sequence;      ///< Sequence number of the fragment (network byte order).
+    uint32_t clientId;      ///< Client ID of the client side of the connection (network byte order).
+    uint32_t ackBits;       ///< Sequences received after ack + 1 (network byte order).
+    uint16_t ack;           ///< Last sequence received in order (network byte order).
+    uint16_t fragmentIndex; ///< Index of the fragment in its message (network byte order).
+    uint16_t fragmentCount; ///< Number of fragments of the message, 0 for acks only (network byte order).
+    uint16_t reserved;      ///< Zero.
+};
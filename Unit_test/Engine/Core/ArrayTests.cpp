@@ -6,7 +6,9 @@
 */
 
 #include <cstdint>
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <vector>
 #include "sparse_array.hpp"
 
 using namespace ecs;
@@ -116,3 +118,132 @@ TEST(SparseArray, iterators_work) {
 
     EXPECT_EQ(sum, 60);
 }
+
+TEST(SparseArray, owners_follow_inserts_and_erases) {
+    sparse_array<int> arr;
+    arr.insert_at(7, 1);
+    arr.emplace_at(2, 2);
+    arr.insert_at(4, 3);
+    arr.erase(7);
+    arr.erase(5);
+
+    std::vector<size_t> owners = arr.owners();
+    std::sort(owners.begin(), owners.end());
+    EXPECT_EQ(owners, (std::vector<size_t>{2, 4}));
+    EXPECT_EQ(arr.prune_owners(), 2);
+}
+
+TEST(SparseArray, prune_drops_slots_left_empty_through_brackets) {
+    sparse_array<int> arr;
+    arr.insert_at(0, 1);
+    arr[3] = 4;
+    static_cast<void>(arr[9].has_value());
+
+    EXPECT_EQ(arr.owners().size(), 3);
+    EXPECT_EQ(arr.prune_owners(), 2);
+
+    std::vector<size_t> owners = arr.owners();
+    std::sort(owners.begin(), owners.end());
+    EXPECT_EQ(owners, (std::vector<size_t>{0, 3}));
+}
+
+TEST(DenseSparseArray, default_empty) {
+    sparse_array<Position, dense_storage> arr;
+
+    EXPECT_EQ(arr.size(), 0);
+    EXPECT_EQ(arr.dense_size(), 0);
+    EXPECT_TRUE(arr.begin() == arr.end());
+}
+
+TEST(DenseSparseArray, operator_brackets_resizes) {
+    sparse_array<Position, dense_storage> arr;
+    arr[5] = Position{4, 2};
+
+    EXPECT_EQ(arr.size(), 6);
+    EXPECT_EQ(arr.dense_size(), 1);
+    EXPECT_TRUE(arr[5].has_value());
+    EXPECT_FALSE(arr[4].has_value());
+    EXPECT_EQ(arr[5]->x, 4);
+    EXPECT_EQ(arr[5].value().y, 2);
+}
+
+TEST(DenseSparseArray, const_out_of_bounds) {
+    const sparse_array<Position, dense_storage> arr;
+
+    EXPECT_FALSE(arr[10]);
+    EXPECT_THROW(arr[10].value(), std::bad_optional_access);
+}
+
+TEST(DenseSparseArray, insert_replaces_in_place) {
+    sparse_array<Position, dense_storage> arr;
+
+    arr.insert_at(3, Position{1, 2});
+    arr.insert_at(3, Position{3, 4});
+    EXPECT_EQ(arr.dense_size(), 1);
+    EXPECT_EQ(arr[3]->x, 3);
+    EXPECT_EQ(arr[3]->y, 4);
+}
+
+TEST(DenseSparseArray, emplace_at) {
+    sparse_array<Position, dense_storage> arr;
+
+    arr.emplace_at(2, 9, 8);
+    EXPECT_TRUE(arr[2].has_value());
+    EXPECT_EQ(arr[2]->x, 9);
+    EXPECT_EQ(arr[2]->y, 8);
+    EXPECT_EQ(arr.size(), 3);
+}
+
+TEST(DenseSparseArray, erase_swaps_last_component) {
+    sparse_array<Position, dense_storage> arr;
+    arr.insert_at(0, Position{0, 0});
+    arr.insert_at(7, Position{7, 7});
+    arr.insert_at(3, Position{3, 3});
+
+    arr.erase(0);
+    EXPECT_FALSE(arr[0].has_value());
+    EXPECT_EQ(arr.dense_size(), 2);
+    EXPECT_EQ(arr[3]->x, 3);
+    EXPECT_EQ(arr[7]->x, 7);
+
+    arr[3].reset();
+    arr.erase(99);
+    EXPECT_FALSE(arr.contains(3));
+    EXPECT_TRUE(arr.contains(7));
+    EXPECT_EQ(arr.dense_size(), 1);
+}
+
+TEST(DenseSparseArray, iteration_only_visits_live_components) {
+    sparse_array<Position, dense_storage> arr;
+    arr.insert_at(1000, Position{10, 0});
+    arr.insert_at(5, Position{20, 0});
+    arr.insert_at(42, Position{30, 0});
+    arr.erase(5);
+
+    int sum = 0;
+    int visited = 0;
+    for (auto &pos : arr) {
+        sum += pos.x;
+        ++visited;
+    }
+    EXPECT_EQ(visited, 2);
+    EXPECT_EQ(sum, 40);
+    ASSERT_EQ(arr.entities().size(), 2);
+    for (std::size_t i = 0; i < arr.entities().size(); ++i)
+        EXPECT_EQ(arr.get_index(*(arr.begin() + i)), arr.entities()[i]);
+}
+
+TEST(DenseSparseArray, get_index_invalid) {
+    sparse_array<Position, dense_storage> arr1;
+    sparse_array<Position, dense_storage> arr2;
+    arr1.insert_at(0, Position{5, 5});
+    arr2.insert_at(0, Position{7, 7});
+
+    EXPECT_EQ(arr1.get_index(*arr2.begin()), static_cast<size_t>(-1));
+}
+
+TEST(DenseSparseArray, flagged_as_dense_pool) {
+    EXPECT_TRUE((is_dense_pool_v<sparse_array<Position, dense_storage>>));
+    EXPECT_TRUE((is_dense_pool_v<const sparse_array<Position, dense_storage>>));
+    EXPECT_FALSE(is_dense_pool_v<sparse_array<Position>>);
+}
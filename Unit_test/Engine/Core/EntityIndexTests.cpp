@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** EntityIndexTests.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include "entity_index.hpp"
+
+using namespace ecs;
+
+TEST(EntityIndex, insert_and_find) {
+    entity_index<uint32_t> index;
+
+    EXPECT_TRUE(index.insert(10, entity_t(3)));
+    EXPECT_TRUE(index.insert(20, entity_t(4)));
+    EXPECT_FALSE(index.insert(10, entity_t(5)));
+
+    ASSERT_NE(index.find(10), nullptr);
+    EXPECT_EQ(*index.find(10), entity_t(3));
+    EXPECT_EQ(*index.find(20), entity_t(4));
+    EXPECT_EQ(index.find(30), nullptr);
+    EXPECT_TRUE(index.contains(20));
+    EXPECT_EQ(index.size(), 2u);
+}
+
+TEST(EntityIndex, erase_moves_the_last_entity_into_the_hole) {
+    entity_index<uint32_t> index;
+    index.insert(1, entity_t(100));
+    index.insert(2, entity_t(200));
+    index.insert(3, entity_t(300));
+
+    auto removed = index.erase(1);
+
+    ASSERT_TRUE(removed.has_value());
+    EXPECT_EQ(*removed, entity_t(100));
+    ASSERT_EQ(index.size(), 2u);
+    EXPECT_EQ(index.entities()[0], entity_t(300));
+    EXPECT_EQ(index.keys()[0], 3u);
+    EXPECT_EQ(*index.find(3), entity_t(300));
+    EXPECT_EQ(*index.find(2), entity_t(200));
+    EXPECT_FALSE(index.contains(1));
+    EXPECT_FALSE(index.erase(1).has_value());
+}
+
+TEST(EntityIndex, erase_last_and_reinsert) {
+    entity_index<uint32_t> index;
+    index.insert(1, entity_t(1));
+    index.insert(2, entity_t(2));
+
+    EXPECT_TRUE(index.erase(2).has_value());
+    EXPECT_TRUE(index.insert(2, entity_t(7, 1)));
+
+    EXPECT_EQ(*index.find(2), entity_t(7, 1));
+    EXPECT_EQ(index.keys().back(), 2u);
+}
+
+TEST(EntityIndex, keys_and_entities_stay_paired) {
+    entity_index<uint32_t> index;
+    for (uint32_t key = 0; key < 64; ++key)
+        index.insert(key, entity_t(key * 2));
+    for (uint32_t key = 0; key < 64; key += 3)
+        index.erase(key);
+
+    ASSERT_EQ(index.keys().size(), index.entities().size());
+    for (std::size_t i = 0; i < index.size(); ++i) {
+        EXPECT_EQ(index.entities()[i].value(), index.keys()[i] * 2);
+        EXPECT_EQ(*index.find(index.keys()[i]), index.entities()[i]);
+    }
+
+    index.clear();
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.find(1), nullptr);
+}
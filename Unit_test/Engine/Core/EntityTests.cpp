@@ -125,3 +125,13 @@ TEST(Entity, comparison_edge_cases) {
     EXPECT_TRUE(e1 != e3);
     EXPECT_FALSE(e1 == e3);
 }
+
+TEST(Entity, generation_comparison) {
+    entity_t e1(7), e2(7, 1), e3(7, 1);
+
+    EXPECT_EQ(e1.generation(), 0u);
+    EXPECT_EQ(e2.generation(), 1u);
+    EXPECT_EQ((std::size_t)e1, (std::size_t)e2);
+    EXPECT_TRUE(e1 != e2);
+    EXPECT_TRUE(e2 == e3);
+}
@@ -8,6 +8,8 @@
 #include <cstdint>
 #include <gtest/gtest.h>
 #include <unordered_set>
+#include <string>
+#include <vector>
 #include "registry.hpp"
 
 TEST(Registry, spawn_kill_entity) {
@@ -208,3 +210,109 @@ TEST(Registry, alive_entities_returns_correct_list) {
     EXPECT_TRUE(ids.find(e3.value()) != ids.end());
     EXPECT_TRUE(ids.find(e2.value()) == ids.end());
 }
+
+struct Label {
+    std::string content;
+};
+
+template <>
+struct ecs::storage_policy<Label> {
+    using type = ecs::dense_storage;
+};
+
+TEST(Registry, dense_component_lifecycle) {
+    ecs::registry reg;
+    reg.register_component<Label>();
+
+    auto e1 = reg.spawn_entity();
+    auto e2 = reg.spawn_entity();
+    reg.add_component<Label>(e1, Label{"first"});
+    reg.emplace_component<Label>(e2, "second");
+
+    auto &labels = reg.get_components<Label>();
+    EXPECT_EQ(labels.dense_size(), 2);
+    EXPECT_EQ(labels[e2.value()]->content, "second");
+
+    reg.kill_entity(e1);
+    EXPECT_FALSE(labels[e1.value()].has_value());
+    EXPECT_EQ(labels.dense_size(), 1);
+    EXPECT_EQ(labels[e2.value()]->content, "second");
+}
+
+TEST(Registry, stale_handle_after_reuse) {
+    ecs::registry reg;
+    ecs::entity_t e1 = reg.spawn_entity();
+    EXPECT_TRUE(reg.is_alive(e1));
+
+    reg.kill_entity(e1);
+    EXPECT_FALSE(reg.is_alive(e1));
+
+    ecs::entity_t e2 = reg.spawn_entity();
+    EXPECT_EQ((std::size_t)e1, (std::size_t)e2);
+    EXPECT_NE(e1, e2);
+    EXPECT_FALSE(reg.is_alive(e1));
+    EXPECT_TRUE(reg.is_alive(e2));
+    EXPECT_EQ(reg.entity_from_index(e2.value()), e2);
+
+    reg.register_component<Position>();
+    reg.add_component<Position>(e2, {1, 2});
+    reg.kill_entity(e1);
+    EXPECT_TRUE(reg.is_alive(e2));
+    EXPECT_TRUE(reg.get_components<Position>()[e2.value()].has_value());
+}
+
+TEST(Registry, double_kill_is_noop) {
+    ecs::registry reg;
+    ecs::entity_t e1 = reg.spawn_entity();
+
+    reg.kill_entity(e1);
+    reg.kill_entity(e1);
+
+    ecs::entity_t e2 = reg.spawn_entity();
+    ecs::entity_t e3 = reg.spawn_entity();
+    EXPECT_NE((std::size_t)e2, (std::size_t)e3);
+    EXPECT_EQ(reg.alive_entities().size(), 2);
+}
+
+TEST(Registry, alive_entities_tracks_spawn_and_kill) {
+    ecs::registry reg;
+    std::vector<ecs::entity_t> spawned;
+    for (int i = 0; i < 10; ++i)
+        spawned.push_back(reg.spawn_entity());
+
+    for (std::size_t i = 0; i < spawned.size(); i += 2)
+        reg.kill_entity(spawned[i]);
+
+    auto const &alive = reg.alive_entities();
+    EXPECT_EQ(alive.size(), 5);
+    for (auto const &e : alive) {
+        EXPECT_TRUE(reg.is_alive(e));
+        EXPECT_EQ(e.value() % 2, 1);
+    }
+    EXPECT_EQ(&alive, &reg.alive_entities());
+}
+
+TEST(Registry, component_ids_are_dense_and_stable) {
+    std::size_t pos_id = ecs::component_id<Position>();
+    std::size_t label_id = ecs::component_id<Label>();
+
+    EXPECT_NE(pos_id, label_id);
+    EXPECT_EQ(ecs::component_id<Position>(), pos_id);
+    EXPECT_EQ(ecs::component_id<const Position>(), pos_id);
+}
+
+TEST(Registry, component_arrays_survive_later_registrations) {
+    ecs::registry reg;
+    EXPECT_FALSE(reg.has_components<Position>());
+    EXPECT_THROW(reg.get_components<Position>(), std::runtime_error);
+
+    auto &positions = reg.register_component<Position>();
+    EXPECT_TRUE(reg.has_components<Position>());
+    EXPECT_EQ(&reg.register_component<Position>(), &positions);
+
+    reg.register_component<Label>();
+    EXPECT_EQ(&reg.get_components<Position>(), &positions);
+
+    ecs::registry const &creg = reg;
+    EXPECT_EQ(&creg.get_components<Position>(), &positions);
+}
@@ -0,0 +1,135 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_scheduler.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "registry.hpp"
+
+using namespace ecs;
+
+namespace {
+    struct Pos {
+        int x;
+    };
+
+    struct Vel {
+        int dx;
+    };
+
+    struct Hp {
+        int value;
+    };
+
+    std::size_t id_of_pos() { return component_id<Pos>(); }
+    std::size_t id_of_vel() { return component_id<Vel>(); }
+    std::size_t id_of_hp() { return component_id<Hp>(); }
+}
+
+TEST(Scheduler, conflicts) {
+    system_access read_pos{{id_of_pos()}, {}, false};
+    system_access write_pos{{}, {id_of_pos()}, false};
+    system_access write_vel{{id_of_pos()}, {id_of_vel()}, false};
+    system_access exclusive{{}, {}, true};
+
+    EXPECT_FALSE(read_pos.conflicts_with(read_pos));
+    EXPECT_TRUE(read_pos.conflicts_with(write_pos));
+    EXPECT_TRUE(write_pos.conflicts_with(read_pos));
+    EXPECT_TRUE(write_pos.conflicts_with(write_pos));
+    EXPECT_FALSE(read_pos.conflicts_with(write_vel));
+    EXPECT_TRUE(exclusive.conflicts_with(read_pos));
+}
+
+TEST(Scheduler, stages_keep_conflicting_systems_ordered) {
+    scheduler sched(0);
+    auto noop = [](registry &) {};
+
+    sched.add(noop, {{id_of_vel()}, {id_of_pos()}, false}); // 0: pos += vel
+    sched.add(noop, {{}, {id_of_hp()}, false});             // 1: independent
+    sched.add(noop, {{id_of_pos()}, {}, false});            // 2: reads pos, after 0
+    sched.add(noop, {{}, {}, true});                        // 3: exclusive barrier
+    sched.add(noop, {{}, {id_of_hp()}, false});             // 4: after the barrier
+
+    auto const &stages = sched.stages();
+    ASSERT_EQ(stages.size(), 4);
+    EXPECT_EQ(stages[0], (std::vector<std::size_t>{0, 1}));
+    EXPECT_EQ(stages[1], (std::vector<std::size_t>{2}));
+    EXPECT_EQ(stages[2], (std::vector<std::size_t>{3}));
+    EXPECT_EQ(stages[3], (std::vector<std::size_t>{4}));
+}
+
+TEST(Scheduler, parallel_run_matches_sequential) {
+    auto build = [](registry &reg, std::size_t workers) {
+        reg.set_system_workers(workers);
+        reg.register_component<Pos>();
+        reg.register_component<Vel>();
+        reg.register_component<Hp>();
+        for (int i = 0; i < 1000; ++i) {
+            auto e = reg.spawn_entity();
+            reg.add_component<Pos>(e, {i});
+            reg.add_component<Vel>(e, {i % 7});
+            reg.add_component<Hp>(e, {100});
+        }
+        reg.add_system(reads<Vel>{}, writes<Pos>{},
+            [](registry &, sparse_array<Vel> const &vel, sparse_array<Pos> &pos) {
+                for (std::size_t i = 0; i < pos.size(); ++i)
+                    if (pos[i] && vel[i])
+                        pos[i]->x += vel[i]->dx;
+            });
+        reg.add_system(reads<>{}, writes<Hp>{},
+            [](registry &, sparse_array<Hp> &hp) {
+                for (auto &h : hp)
+                    if (h)
+                        h->value -= 1;
+            });
+        reg.add_system(reads<Pos>{}, writes<Vel>{},
+            [](registry &, sparse_array<Pos> const &pos, sparse_array<Vel> &vel) {
+                for (std::size_t i = 0; i < vel.size(); ++i)
+                    if (pos[i] && vel[i])
+                        vel[i]->dx = pos[i]->x % 5;
+            });
+        reg.add_system<Hp>([](registry &r, sparse_array<Hp> &hp) {
+            for (std::size_t i = 0; i < hp.size(); ++i)
+                if (hp[i] && i % 100 == 0 && hp[i]->value < 98)
+                    r.kill_entity(r.entity_from_index(i));
+        });
+    };
+
+    registry sequential;
+    registry parallel;
+    build(sequential, 0);
+    build(parallel, 3);
+    for (int frame = 0; frame < 5; ++frame) {
+        sequential.run_systems();
+        parallel.run_systems();
+    }
+
+    auto &seq_pos = sequential.get_components<Pos>();
+    auto &par_pos = parallel.get_components<Pos>();
+    ASSERT_EQ(seq_pos.size(), par_pos.size());
+    for (std::size_t i = 0; i < seq_pos.size(); ++i) {
+        ASSERT_EQ(seq_pos[i].has_value(), par_pos[i].has_value());
+        if (seq_pos[i]) {
+            EXPECT_EQ(seq_pos[i]->x, par_pos[i]->x);
+        }
+    }
+    EXPECT_EQ(sequential.alive_entities().size(), parallel.alive_entities().size());
+}
+
+TEST(Scheduler, exception_is_rethrown) {
+    registry reg;
+    reg.set_system_workers(2);
+    reg.register_component<Pos>();
+    reg.register_component<Vel>();
+    reg.add_system(reads<>{}, writes<Pos>{}, [](registry &, sparse_array<Pos> &) {
+        throw std::runtime_error("boom");
+    });
+    reg.add_system(reads<>{}, writes<Vel>{}, [](registry &, sparse_array<Vel> &) {});
+
+    EXPECT_THROW(reg.run_systems(), std::runtime_error);
+    EXPECT_THROW(reg.run_systems(), std::runtime_error);
+}
@@ -0,0 +1,194 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_view.cpp
+*/
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+#include "registry.hpp"
+
+using namespace ecs;
+
+namespace {
+    struct Position {
+        int x;
+        int y;
+    };
+
+    struct Velocity {
+        int dx;
+        int dy;
+    };
+
+    struct Tag {
+        int value;
+    };
+}
+
+template <>
+struct ecs::storage_policy<Tag> {
+    using type = ecs::dense_storage;
+};
+
+TEST(View, yields_only_entities_with_all_components) {
+    registry reg;
+    reg.register_component<Position>();
+    reg.register_component<Velocity>();
+
+    for (int i = 0; i < 10; ++i) {
+        auto e = reg.spawn_entity();
+        reg.add_component<Position>(e, {i, 0});
+        if (i % 3 == 0)
+            reg.add_component<Velocity>(e, {1, 2});
+    }
+
+    std::vector<int> xs;
+    for (auto [pos, vel] : reg.view<Position, Velocity>())
+        xs.push_back(pos.x);
+
+    EXPECT_EQ(xs, (std::vector<int>{0, 3, 6, 9}));
+}
+
+TEST(View, bindings_are_references) {
+    registry reg;
+    reg.register_component<Position>();
+    reg.register_component<Velocity>();
+
+    auto e = reg.spawn_entity();
+    reg.add_component<Position>(e, {1, 1});
+    reg.add_component<Velocity>(e, {2, 3});
+
+    for (auto [pos, vel] : reg.view<Position, Velocity>()) {
+        pos.x += vel.dx;
+        pos.y += vel.dy;
+    }
+
+    auto &positions = reg.get_components<Position>();
+    EXPECT_EQ(positions[e.value()]->x, 3);
+    EXPECT_EQ(positions[e.value()]->y, 4);
+}
+
+TEST(View, indexed_view_yields_entity_ids) {
+    registry reg;
+    reg.register_component<Position>();
+    reg.register_component<Velocity>();
+
+    for (int i = 0; i < 6; ++i) {
+        auto e = reg.spawn_entity();
+        reg.add_component<Position>(e, {i * 10, 0});
+        if (i >= 4)
+            reg.add_component<Velocity>(e, {0, 0});
+    }
+
+    std::vector<std::size_t> ids;
+    for (auto [idx, pos, vel] : reg.indexed_view<Position, Velocity>()) {
+        EXPECT_EQ(pos.x, static_cast<int>(idx) * 10);
+        ids.push_back(idx);
+    }
+
+    EXPECT_EQ(ids, (std::vector<std::size_t>{4, 5}));
+}
+
+TEST(View, driven_by_smallest_pool) {
+    registry reg;
+    reg.register_component<Position>();
+    reg.register_component<Tag>();
+
+    for (int i = 0; i < 1000; ++i) {
+        auto e = reg.spawn_entity();
+        reg.add_component<Position>(e, {i, i});
+    }
+    reg.add_component<Tag>(entity_t{900}, {1});
+    reg.add_component<Tag>(entity_t{42}, {2});
+
+    auto view = reg.indexed_view<Position, Tag>();
+    EXPECT_EQ(view.size_hint(), 2);
+
+    std::vector<std::size_t> ids;
+    for (auto [idx, pos, tag] : view) {
+        EXPECT_EQ(pos.x, static_cast<int>(idx));
+        ids.push_back(idx);
+    }
+    EXPECT_EQ(ids, (std::vector<std::size_t>{900, 42}));
+}
+
+TEST(View, driven_by_smallest_optional_pool) {
+    registry reg;
+    reg.register_component<Position>();
+    reg.register_component<Velocity>();
+
+    for (int i = 0; i < 1000; ++i) {
+        auto e = reg.spawn_entity();
+        reg.add_component<Position>(e, {i, i});
+    }
+    reg.add_component<Velocity>(entity_t{700}, {1, 1});
+    reg.add_component<Velocity>(entity_t{12}, {1, 1});
+
+    auto view = reg.indexed_view<Position, Velocity>();
+    EXPECT_EQ(view.size_hint(), 2);
+
+    std::vector<std::size_t> ids;
+    for (auto [idx, pos, vel] : view)
+        ids.push_back(idx);
+    EXPECT_EQ(ids, (std::vector<std::size_t>{700, 12}));
+}
+
+TEST(View, sees_components_assigned_through_brackets) {
+    registry reg;
+    reg.register_component<Position>();
+    reg.register_component<Velocity>();
+
+    for (int i = 0; i < 100; ++i) {
+        auto e = reg.spawn_entity();
+        reg.add_component<Position>(e, {i, 0});
+    }
+    auto &velocities = reg.get_components<Velocity>();
+    velocities[40] = Velocity{1, 1};
+    for (std::size_t i = 0; i < 30; ++i)
+        static_cast<void>(velocities[i].has_value());
+
+    auto view = reg.indexed_view<Position, Velocity>();
+    EXPECT_EQ(view.size_hint(), 1);
+
+    std::vector<std::size_t> ids;
+    for (auto [idx, pos, vel] : view)
+        ids.push_back(idx);
+    EXPECT_EQ(ids, (std::vector<std::size_t>{40}));
+}
+
+TEST(View, empty_when_a_pool_is_empty) {
+    registry reg;
+    reg.register_component<Position>();
+    reg.register_component<Velocity>();
+
+    auto e = reg.spawn_entity();
+    reg.add_component<Position>(e, {1, 1});
+
+    auto view = reg.view<Position, Velocity>();
+    EXPECT_TRUE(view.begin() == view.end());
+}
+
+TEST(View, skips_killed_entities) {
+    registry reg;
+    reg.register_component<Position>();
+    reg.register_component<Tag>();
+
+    auto e1 = reg.spawn_entity();
+    auto e2 = reg.spawn_entity();
+    reg.add_component<Position>(e1, {1, 0});
+    reg.add_component<Position>(e2, {2, 0});
+    reg.add_component<Tag>(e1, {1});
+    reg.add_component<Tag>(e2, {2});
+    reg.kill_entity(e1);
+
+    int count = 0;
+    for (auto [pos, tag] : reg.view<Position, Tag>()) {
+        EXPECT_EQ(pos.x, 2);
+        EXPECT_EQ(tag.value, 2);
+        ++count;
+    }
+    EXPECT_EQ(count, 1);
+}
@@ -0,0 +1,111 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_projectile_pool.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "ProjectilePool.hpp"
+
+using physics::aabb;
+using physics::projectile;
+using physics::projectile_pool;
+
+namespace {
+    projectile at(float x, float y, float vx = 0.f, float vy = 0.f)
+    {
+        return {x, y, vx, vy, 7, 1.f, 10.f, 5.f};
+    }
+}
+
+TEST(ProjectilePool, spawn_and_lookup) {
+    projectile_pool pool;
+    auto a = pool.spawn(at(1.f, 2.f));
+    auto b = pool.spawn(at(3.f, 4.f));
+
+    EXPECT_NE(a, projectile_pool::invalid_handle);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(pool.size(), 2);
+    EXPECT_FLOAT_EQ(pool.at(pool.slot_of(b)).x, 3.f);
+    EXPECT_EQ(pool.at(pool.slot_of(a)).owner, 7u);
+    EXPECT_FALSE(pool.contains(projectile_pool::invalid_handle));
+}
+
+TEST(ProjectilePool, despawn_keeps_other_handles_valid) {
+    projectile_pool pool;
+    std::vector<projectile_pool::handle> handles;
+    for (int i = 0; i < 5; ++i)
+        handles.push_back(pool.spawn(at(static_cast<float>(i), 0.f)));
+
+    EXPECT_TRUE(pool.despawn(handles[1]));
+    EXPECT_FALSE(pool.despawn(handles[1]));
+    EXPECT_FALSE(pool.contains(handles[1]));
+    EXPECT_EQ(pool.size(), 4);
+    for (int i : {0, 2, 3, 4}) {
+        ASSERT_TRUE(pool.contains(handles[i]));
+        EXPECT_FLOAT_EQ(pool.at(pool.slot_of(handles[i])).x, static_cast<float>(i));
+        EXPECT_EQ(pool.handle_at(pool.slot_of(handles[i])), handles[i]);
+    }
+}
+
+TEST(ProjectilePool, reused_slot_gets_a_new_handle) {
+    projectile_pool pool;
+    auto old = pool.spawn(at(0.f, 0.f));
+    pool.despawn(old);
+    auto fresh = pool.spawn(at(1.f, 1.f));
+
+    EXPECT_NE(old, fresh);
+    EXPECT_FALSE(pool.contains(old));
+    EXPECT_TRUE(pool.contains(fresh));
+
+    pool.clear();
+    EXPECT_TRUE(pool.empty());
+    EXPECT_FALSE(pool.contains(fresh));
+}
+
+TEST(ProjectilePool, integrate_and_cull) {
+    projectile_pool pool;
+    std::vector<projectile_pool::handle> handles;
+    for (int i = 0; i < 11; ++i)
+        handles.push_back(pool.spawn(at(100.f * static_cast<float>(i), 50.f, 100.f, i % 2 ? -10.f : 10.f)));
+
+    pool.integrate(0.5f);
+    for (int i = 0; i < 11; ++i) {
+        auto p = pool.at(pool.slot_of(handles[i]));
+        EXPECT_FLOAT_EQ(p.x, 100.f * static_cast<float>(i) + 50.f);
+        EXPECT_FLOAT_EQ(p.y, i % 2 ? 45.f : 55.f);
+    }
+
+    std::vector<projectile_pool::handle> removed;
+    auto count = pool.cull(aabb{0.f, 0.f, 700.f, 100.f}, [&](projectile_pool::handle h) { removed.push_back(h); });
+    std::sort(removed.begin(), removed.end());
+    std::vector<projectile_pool::handle> expected(handles.begin() + 7, handles.end());
+    std::sort(expected.begin(), expected.end());
+
+    EXPECT_EQ(count, 4);
+    EXPECT_EQ(removed, expected);
+    EXPECT_EQ(pool.size(), 7);
+    for (int i = 0; i < 7; ++i)
+        EXPECT_TRUE(pool.contains(handles[i]));
+}
+
+TEST(ProjectilePool, simd_path_matches_scalar) {
+#ifdef PHYSICS_PROJECTILE_SSE
+    projectile_pool scalar;
+    projectile_pool simd;
+    for (int i = 0; i < 37; ++i) {
+        auto p = at(static_cast<float>(i) * 3.f, static_cast<float>(i), static_cast<float>(i) - 18.f, 0.25f * static_cast<float>(i));
+        scalar.spawn(p);
+        simd.spawn(p);
+    }
+    scalar.integrate_scalar(0.016f);
+    simd.integrate_sse(0.016f);
+    EXPECT_EQ(scalar.xs(), simd.xs());
+    EXPECT_EQ(scalar.ys(), simd.ys());
+#else
+    GTEST_SKIP() << "built without the SSE2 path";
+#endif
+}
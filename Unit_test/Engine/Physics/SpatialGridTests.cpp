@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_spatial_grid.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "SpatialGrid.hpp"
+
+using physics::aabb;
+using physics::uniform_grid;
+
+TEST(SpatialGrid, matches_brute_force) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coord(-200.f, 2200.f);
+    std::uniform_real_distribution<float> size(5.f, 250.f);
+
+    std::vector<aabb> boxes;
+    uniform_grid grid(0.f, 0.f, 1920.f, 1080.f, 64.f);
+    for (uint32_t i = 0; i < 300; ++i) {
+        boxes.push_back(aabb::from_center(coord(rng), coord(rng) * 0.5f, size(rng), size(rng)));
+        grid.insert(i, boxes.back());
+    }
+    grid.build();
+
+    for (int q = 0; q < 200; ++q) {
+        aabb region = aabb::from_center(coord(rng), coord(rng) * 0.5f, size(rng), size(rng));
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < boxes.size(); ++i)
+            if (boxes[i].overlaps(region))
+                expected.push_back(i);
+
+        std::vector<uint32_t> found;
+        grid.query(region, 1, [&](uint32_t id, aabb const &) { found.push_back(id); });
+        std::sort(found.begin(), found.end());
+        EXPECT_EQ(found, expected);
+    }
+}
+
+TEST(SpatialGrid, filters_by_layer) {
+    uniform_grid grid(0.f, 0.f, 640.f, 640.f, 64.f);
+    grid.insert(1, aabb::from_center(100.f, 100.f, 30.f, 30.f), 1u);
+    grid.insert(2, aabb::from_center(105.f, 100.f, 30.f, 30.f), 2u);
+    grid.build();
+
+    std::vector<uint32_t> found;
+    aabb region = aabb::from_center(100.f, 100.f, 10.f, 10.f);
+    grid.query(region, 2u, [&](uint32_t id, aabb const &) { found.push_back(id); });
+    EXPECT_EQ(found, std::vector<uint32_t>{2});
+
+    found.clear();
+    grid.query(region, 3u, [&](uint32_t id, aabb const &) { found.push_back(id); });
+    EXPECT_EQ(found.size(), 2);
+}
+
+TEST(SpatialGrid, clear_and_rebuild) {
+    uniform_grid grid(0.f, 0.f, 640.f, 640.f, 64.f);
+    grid.insert(1, aabb::from_center(100.f, 100.f, 30.f, 30.f));
+    grid.build();
+    grid.clear();
+    EXPECT_EQ(grid.size(), 0);
+
+    grid.insert(7, aabb::from_center(500.f, 500.f, 30.f, 30.f));
+    grid.build();
+
+    int hits = 0;
+    grid.query(aabb::from_center(100.f, 100.f, 30.f, 30.f), 1, [&](uint32_t, aabb const &) { ++hits; });
+    EXPECT_EQ(hits, 0);
+    grid.query(aabb::from_center(510.f, 500.f, 30.f, 30.f), 1, [&](uint32_t id, aabb const &) { EXPECT_EQ(id, 7u); ++hits; });
+    EXPECT_EQ(hits, 1);
+}
@@ -0,0 +1,260 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** AssetStreamerTests.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <set>
+#include <string>
+#include <thread>
+#include "AssetStreamer.hpp"
+
+using rendering::AssetStreamer;
+using rendering::TextureCache;
+
+namespace {
+    char PIXELS[4];
+
+    /** Decodes instantly, or when released for paths containing "slow"; remembers who decoded what. */
+    struct FakeFiles {
+        std::mutex mutex;
+        std::set<std::thread::id> decoders;
+        std::atomic<int> imagesFreed{0};
+        std::atomic<int> wavesFreed{0};
+        std::atomic<int> fontsFreed{0};
+        std::promise<void> release;
+        std::shared_future<void> released{release.get_future().share()};
+        std::chrono::steady_clock::time_point clock{};
+
+        rendering::AssetBackend backend() {
+            rendering::AssetBackend backend;
+            backend.decodeImage = [this](const std::string &path) {
+                record(path);
+                if (path.find("missing") != std::string::npos)
+                    return Image{};
+                return Image{PIXELS, 32, 16, 1, 7};
+            };
+            backend.decodeWave = [this](const std::string &path) {
+                record(path);
+                Wave wave{};
+                wave.frameCount = 100;
+                wave.data = PIXELS;
+                return wave;
+            };
+            backend.decodeFont = [this](const std::string &path) {
+                record(path);
+                rendering::DecodedFont font{};
+                font.font.baseSize = 32;
+                font.atlas = Image{PIXELS, 128, 128, 1, 7};
+                return font;
+            };
+            backend.uploadSound = [](const Wave &wave) {
+                Sound sound{};
+                sound.frameCount = wave.frameCount;
+                return sound;
+            };
+            backend.uploadFont = [](const rendering::DecodedFont &font) { return font.font; };
+            backend.unloadImage = [this](Image) { ++imagesFreed; };
+            backend.unloadWave = [this](Wave) { ++wavesFreed; };
+            backend.unloadFont = [this](const rendering::DecodedFont &) { ++fontsFreed; };
+            backend.now = [this] { return clock; };
+            return backend;
+        }
+
+        void record(const std::string &path) {
+            if (path.find("slow") != std::string::npos)
+                released.wait();
+            std::lock_guard<std::mutex> lock(mutex);
+            decoders.insert(std::this_thread::get_id());
+        }
+    };
+
+    /** Uploads take one millisecond of the fake clock. */
+    struct FakeGpu {
+        FakeFiles &files;
+        unsigned int nextId{1};
+        std::size_t fileLoads{0};
+        std::size_t imageLoads{0};
+
+        rendering::TextureBackend backend() {
+            return {
+                [this](const std::string &) { ++fileLoads; return Texture2D{nextId++, 16, 16, 1, 7}; },
+                [this](const Image &image) {
+                    ++imageLoads;
+                    files.clock += std::chrono::milliseconds(1);
+                    return Texture2D{nextId++, image.width, image.height, 1, 7};
+                },
+                [](Texture2D) {},
+            };
+        }
+    };
+
+    void waitDecoded(const AssetStreamer &streamer, std::size_t count) {
+        for (int i = 0; i < 2000 && streamer.stats().decoded < count; ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ASSERT_GE(streamer.stats().decoded, count);
+    }
+}
+
+TEST(AssetStreamer, decodes_images_on_a_worker) {
+    FakeFiles files;
+    FakeGpu gpu{files};
+    TextureCache cache(gpu.backend());
+    AssetStreamer streamer(files.backend(), cache);
+
+    streamer.requestImage("/assets/sprites/r-typesheet19.png");
+    waitDecoded(streamer, 1);
+    std::optional<Image> image = streamer.takeImage("/assets/sprites/r-typesheet19.png");
+
+    ASSERT_TRUE(image.has_value());
+    EXPECT_EQ(image->width, 32);
+    EXPECT_EQ(files.decoders.count(std::this_thread::get_id()), 0u);
+    EXPECT_FALSE(streamer.takeImage("/assets/sprites/r-typesheet19.png").has_value());
+    EXPECT_EQ(streamer.stats().pending, 0u);
+}
+
+TEST(AssetStreamer, returns_nothing_for_unknown_or_broken_files) {
+    FakeFiles files;
+    FakeGpu gpu{files};
+    TextureCache cache(gpu.backend());
+    AssetStreamer streamer(files.backend(), cache);
+
+    streamer.requestImage("/assets/missing.png");
+
+    EXPECT_FALSE(streamer.takeImage("/assets/never_requested.png").has_value());
+    EXPECT_FALSE(streamer.takeImage("/assets/missing.png").has_value());
+    EXPECT_FALSE(streamer.takeSound("/assets/missing.png").has_value());
+}
+
+TEST(AssetStreamer, pump_uploads_textures_within_the_budget) {
+    FakeFiles files;
+    FakeGpu gpu{files};
+    TextureCache cache(gpu.backend());
+    AssetStreamer streamer(files.backend(), cache);
+
+    for (int i = 0; i < 5; ++i)
+        streamer.requestTexture("/assets/backgrounds/" + std::to_string(i) + ".png");
+    waitDecoded(streamer, 5);
+
+    EXPECT_EQ(streamer.pump(std::chrono::microseconds(2500)), 3u);
+    EXPECT_EQ(streamer.pump(std::chrono::microseconds(2500)), 2u);
+    EXPECT_EQ(streamer.pump(std::chrono::microseconds(2500)), 0u);
+    EXPECT_EQ(files.imagesFreed, 5);
+
+    // The scene then finds them in VRAM.
+    rendering::TextureHandle handle = cache.acquire("/assets/backgrounds/3.png");
+    EXPECT_EQ(handle->width, 32);
+    EXPECT_EQ(gpu.fileLoads, 0u);
+    EXPECT_EQ(streamer.stats().uploaded, 5u);
+}
+
+TEST(AssetStreamer, pump_uploads_one_texture_even_without_budget) {
+    FakeFiles files;
+    FakeGpu gpu{files};
+    TextureCache cache(gpu.backend());
+    AssetStreamer streamer(files.backend(), cache);
+
+    streamer.requestTexture("/assets/a.png");
+    streamer.requestTexture("/assets/b.png");
+    waitDecoded(streamer, 2);
+
+    EXPECT_EQ(streamer.pump(std::chrono::microseconds(0)), 1u);
+    EXPECT_EQ(streamer.pump(std::chrono::microseconds(0)), 1u);
+}
+
+TEST(AssetStreamer, take_waits_for_a_decode_and_decodes_queued_files_itself) {
+    FakeFiles files;
+    FakeGpu gpu{files};
+    TextureCache cache(gpu.backend());
+    AssetStreamer streamer(files.backend(), cache, 1);
+
+    streamer.requestImage("/assets/slow.png");
+    streamer.requestImage("/assets/queued.png");
+    // The only worker is stuck on slow.png: queued.png is decoded right here.
+    std::optional<Image> queued = streamer.takeImage("/assets/queued.png");
+    ASSERT_TRUE(queued.has_value());
+    EXPECT_EQ(files.decoders.count(std::this_thread::get_id()), 1u);
+
+    auto slow = std::async(std::launch::async, [&] { return streamer.takeImage("/assets/slow.png"); });
+    EXPECT_EQ(slow.wait_for(std::chrono::milliseconds(20)), std::future_status::timeout);
+    files.release.set_value();
+    ASSERT_TRUE(slow.get().has_value());
+}
+
+TEST(AssetStreamer, a_texture_not_uploaded_yet_can_be_taken_as_an_image) {
+    FakeFiles files;
+    FakeGpu gpu{files};
+    TextureCache cache(gpu.backend());
+    AssetStreamer streamer(files.backend(), cache);
+
+    streamer.requestTexture("/assets/sheet.png");
+    waitDecoded(streamer, 1);
+
+    EXPECT_TRUE(streamer.takeImage("/assets/sheet.png").has_value());
+    EXPECT_EQ(streamer.pump(), 0u);
+    EXPECT_FALSE(cache.contains("/assets/sheet.png"));
+}
+
+TEST(AssetStreamer, sounds_and_fonts_are_uploaded_when_taken) {
+    FakeFiles files;
+    FakeGpu gpu{files};
+    TextureCache cache(gpu.backend());
+    AssetStreamer streamer(files.backend(), cache);
+
+    streamer.requestSound("/assets/sounds/shoot.wav");
+    streamer.requestFont("/assets/fonts/PressStart2P.ttf");
+
+    std::optional<Sound> sound = streamer.takeSound("/assets/sounds/shoot.wav");
+    std::optional<Font> font = streamer.takeFont("/assets/fonts/PressStart2P.ttf");
+
+    ASSERT_TRUE(sound.has_value());
+    EXPECT_EQ(sound->frameCount, 100u);
+    EXPECT_EQ(files.wavesFreed, 1);
+    ASSERT_TRUE(font.has_value());
+    EXPECT_EQ(font->baseSize, 32);
+    EXPECT_EQ(files.imagesFreed, 1);
+    EXPECT_FALSE(streamer.takeImage("/assets/sounds/shoot.wav").has_value());
+}
+
+TEST(AssetStreamer, jobs_can_request_assets) {
+    FakeFiles files;
+    FakeGpu gpu{files};
+    TextureCache cache(gpu.backend());
+    AssetStreamer streamer(files.backend(), cache);
+
+    streamer.enqueue([&streamer] {
+        streamer.requestImage("/assets/level/enemy.png");
+        streamer.requestTexture("/assets/level/background.png");
+    });
+    waitDecoded(streamer, 2);
+
+    EXPECT_TRUE(streamer.takeImage("/assets/level/enemy.png").has_value());
+    EXPECT_EQ(streamer.pump(), 1u);
+    EXPECT_TRUE(cache.contains("/assets/level/background.png"));
+}
+
+TEST(AssetStreamer, clear_frees_what_was_not_taken) {
+    FakeFiles files;
+    FakeGpu gpu{files};
+    TextureCache cache(gpu.backend());
+    AssetStreamer streamer(files.backend(), cache);
+
+    streamer.requestImage("/assets/a.png");
+    streamer.requestTexture("/assets/b.png");
+    streamer.requestSound("/assets/c.wav");
+    streamer.requestFont("/assets/d.ttf");
+    waitDecoded(streamer, 4);
+    streamer.clear();
+
+    EXPECT_EQ(files.imagesFreed, 2);
+    EXPECT_EQ(files.wavesFreed, 1);
+    EXPECT_EQ(files.fontsFreed, 1);
+    EXPECT_EQ(streamer.pump(), 0u);
+    EXPECT_FALSE(streamer.takeImage("/assets/a.png").has_value());
+    EXPECT_EQ(streamer.stats().pending, 0u);
+}
@@ -0,0 +1,84 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** AtlasPackerTests.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "AtlasPacker.hpp"
+
+using rendering::AtlasLayout;
+using rendering::AtlasSize;
+using rendering::packAtlas;
+
+namespace {
+    bool overlap(const AtlasSize &a, const rendering::AtlasPlacement &pa,
+                 const AtlasSize &b, const rendering::AtlasPlacement &pb, int padding) {
+        if (pa.page != pb.page)
+            return false;
+        return pa.x - padding < pb.x + b.width + padding && pb.x - padding < pa.x + a.width + padding &&
+               pa.y - padding < pb.y + b.height + padding && pb.y - padding < pa.y + a.height + padding;
+    }
+}
+
+TEST(AtlasPacker, packs_small_sheets_in_one_page_without_overlap) {
+    std::vector<AtlasSize> sizes{{533, 36}, {266, 143}, {166, 17}, {34, 34}, {100, 100}, {166, 86}, {65, 132}};
+    const int padding = 2;
+
+    AtlasLayout layout = packAtlas(sizes, 1024, padding);
+
+    ASSERT_EQ(layout.placements.size(), sizes.size());
+    ASSERT_EQ(layout.pageWidths.size(), 1u);
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        const auto &placement = layout.placements[i];
+        EXPECT_TRUE(placement.packed);
+        EXPECT_GE(placement.x, padding);
+        EXPECT_GE(placement.y, padding);
+        EXPECT_LE(placement.x + sizes[i].width + padding, layout.pageWidths[0]);
+        EXPECT_LE(placement.y + sizes[i].height + padding, layout.pageHeights[0]);
+        for (std::size_t j = i + 1; j < sizes.size(); ++j)
+            EXPECT_FALSE(overlap(sizes[i], placement, sizes[j], layout.placements[j], padding)) << i << " and " << j;
+    }
+}
+
+TEST(AtlasPacker, opens_a_new_page_when_full) {
+    std::vector<AtlasSize> sizes(5, AtlasSize{60, 60});
+
+    AtlasLayout layout = packAtlas(sizes, 128, 2);
+
+    // Two 64x64 slots per shelf, two shelves per page: four per page.
+    ASSERT_EQ(layout.pageWidths.size(), 2u);
+    std::size_t onSecondPage = 0;
+    for (const auto &placement : layout.placements) {
+        EXPECT_TRUE(placement.packed);
+        onSecondPage += placement.page == 1;
+    }
+    EXPECT_EQ(onSecondPage, 1u);
+    EXPECT_EQ(layout.pageWidths[1], 64);
+    EXPECT_EQ(layout.pageHeights[1], 64);
+}
+
+TEST(AtlasPacker, leaves_oversized_and_empty_images_out) {
+    std::vector<AtlasSize> sizes{{1920, 1080}, {0, 10}, {32, 32}};
+
+    AtlasLayout layout = packAtlas(sizes, 1024, 2);
+
+    EXPECT_FALSE(layout.placements[0].packed);
+    EXPECT_FALSE(layout.placements[1].packed);
+    EXPECT_TRUE(layout.placements[2].packed);
+    EXPECT_EQ(layout.pageWidths.size(), 1u);
+}
+
+TEST(AtlasPacker, fills_shelves_before_opening_new_ones) {
+    std::vector<AtlasSize> sizes{{40, 50}, {40, 20}, {40, 20}};
+
+    AtlasLayout layout = packAtlas(sizes, 256, 0);
+
+    // The short images sit on the shelf opened by the tall one.
+    for (const auto &placement : layout.placements)
+        EXPECT_EQ(placement.y, 0);
+    EXPECT_EQ(layout.pageWidths[0], 120);
+    EXPECT_EQ(layout.pageHeights[0], 50);
+}
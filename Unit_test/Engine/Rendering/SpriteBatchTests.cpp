@@ -0,0 +1,139 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SpriteBatchTests.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "SpriteBatch.hpp"
+
+using rendering::AtlasRegion;
+using rendering::Quad;
+using rendering::SpriteBatch;
+
+namespace {
+    /** Records what reaches the GPU, flushing every `capacity` quads like rlgl. */
+    struct FakeGpu {
+        struct Run {
+            unsigned int texture;
+            std::vector<Quad> quads;
+        };
+        std::vector<Run> runs;
+        std::size_t capacity{0};
+
+        SpriteBatch::Submit submit() {
+            return [this](const Texture2D &texture, const Quad *quads, std::size_t count) {
+                runs.push_back({texture.id, std::vector<Quad>(quads, quads + count)});
+                return capacity == 0 ? std::size_t{0} : (count - 1) / capacity;
+            };
+        }
+    };
+
+    const Texture2D SOLID{1, 1, 1, 1, 7};
+    const Texture2D ATLAS{2, 1024, 1024, 1, 7};
+    const Texture2D SHEET{3, 256, 128, 1, 7};
+}
+
+TEST(SpriteBatch, makes_the_same_quad_as_draw_texture_pro) {
+    Quad quad = rendering::makeQuad({256.f, 128.f}, {64.f, 32.f, 32.f, 16.f}, {100.f, 50.f, 64.f, 32.f}, {0.f, 0.f}, 0.f, WHITE);
+
+    EXPECT_FLOAT_EQ(quad.corners[0].x, 100.f);
+    EXPECT_FLOAT_EQ(quad.corners[0].y, 50.f);
+    EXPECT_FLOAT_EQ(quad.corners[2].x, 164.f);
+    EXPECT_FLOAT_EQ(quad.corners[2].y, 82.f);
+    EXPECT_FLOAT_EQ(quad.uvs[0].x, 0.25f);
+    EXPECT_FLOAT_EQ(quad.uvs[0].y, 0.25f);
+    EXPECT_FLOAT_EQ(quad.uvs[2].x, 0.375f);
+    EXPECT_FLOAT_EQ(quad.uvs[2].y, 0.375f);
+}
+
+TEST(SpriteBatch, rotates_around_the_destination_corner) {
+    Quad quad = rendering::makeQuad({100.f, 100.f}, {0.f, 0.f, 10.f, 10.f}, {50.f, 50.f, 20.f, 10.f}, {0.f, 0.f}, 180.f, RED);
+
+    // Turned half a turn: the far corner ends up up and to the left.
+    EXPECT_NEAR(quad.corners[0].x, 50.f, 1e-4);
+    EXPECT_NEAR(quad.corners[0].y, 50.f, 1e-4);
+    EXPECT_NEAR(quad.corners[2].x, 30.f, 1e-4);
+    EXPECT_NEAR(quad.corners[2].y, 40.f, 1e-4);
+    Color red = RED;
+    EXPECT_EQ(quad.tint.r, red.r);
+}
+
+TEST(SpriteBatch, flips_with_a_negative_source_width) {
+    Quad quad = rendering::makeQuad({100.f, 100.f}, {10.f, 0.f, -20.f, 10.f}, {0.f, 0.f, 20.f, 10.f}, {0.f, 0.f}, 0.f, WHITE);
+
+    EXPECT_FLOAT_EQ(quad.uvs[0].x, 0.3f);
+    EXPECT_FLOAT_EQ(quad.uvs[3].x, 0.1f);
+}
+
+TEST(SpriteBatch, offsets_sources_into_the_atlas) {
+    FakeGpu gpu;
+    SpriteBatch batch(gpu.submit(), SOLID);
+
+    batch.draw(0, AtlasRegion{ATLAS, {512.f, 256.f}}, {0.f, 0.f, 32.f, 32.f}, {0.f, 0.f, 32.f, 32.f}, {0.f, 0.f}, 0.f, WHITE);
+    batch.flush();
+
+    ASSERT_EQ(gpu.runs.size(), 1u);
+    EXPECT_FLOAT_EQ(gpu.runs[0].quads[0].uvs[0].x, 0.5f);
+    EXPECT_FLOAT_EQ(gpu.runs[0].quads[0].uvs[0].y, 0.25f);
+}
+
+TEST(SpriteBatch, sorts_by_layer_then_texture) {
+    FakeGpu gpu;
+    SpriteBatch batch(gpu.submit(), SOLID);
+    Rectangle rect{0.f, 0.f, 8.f, 8.f};
+
+    batch.draw(2, SHEET, rect, rect, {0.f, 0.f}, 0.f, WHITE);
+    batch.draw(1, ATLAS, rect, rect, {0.f, 0.f}, 0.f, WHITE);
+    batch.draw(2, ATLAS, rect, rect, {0.f, 0.f}, 0.f, WHITE);
+    batch.draw(2, SHEET, rect, rect, {0.f, 0.f}, 0.f, BLUE);
+    batch.drawRectangle(0, rect, GRAY);
+    batch.flush();
+
+    ASSERT_EQ(gpu.runs.size(), 3u);
+    EXPECT_EQ(gpu.runs[0].texture, SOLID.id);
+    // Layer 1 and the start of layer 2 share the atlas: one run.
+    EXPECT_EQ(gpu.runs[1].texture, ATLAS.id);
+    EXPECT_EQ(gpu.runs[1].quads.size(), 2u);
+    EXPECT_EQ(gpu.runs[2].texture, SHEET.id);
+    ASSERT_EQ(gpu.runs[2].quads.size(), 2u);
+    Color white = WHITE;
+    Color blue = BLUE;
+    EXPECT_EQ(gpu.runs[2].quads[0].tint.r, white.r);
+    EXPECT_EQ(gpu.runs[2].quads[1].tint.r, blue.r);
+
+    EXPECT_EQ(batch.stats().sprites, 5u);
+    EXPECT_EQ(batch.stats().textureBinds, 3u);
+    EXPECT_EQ(batch.stats().drawCalls, 3u);
+    EXPECT_EQ(batch.size(), 0u);
+}
+
+TEST(SpriteBatch, thousands_of_bullets_are_one_bind) {
+    FakeGpu gpu;
+    gpu.capacity = 1024;
+    SpriteBatch batch(gpu.submit(), SOLID);
+
+    for (int i = 0; i < 3000; ++i) {
+        float y = static_cast<float>(i % 1080);
+        batch.draw(6, AtlasRegion{ATLAS, {0.f, 0.f}}, {170.f, 135.f, 50.f, 15.f}, {static_cast<float>(i), y, 50.f, 15.f}, {0.f, 0.f}, 0.f, WHITE);
+    }
+    batch.flush();
+
+    EXPECT_EQ(gpu.runs.size(), 1u);
+    EXPECT_EQ(batch.stats().textureBinds, 1u);
+    EXPECT_EQ(batch.stats().drawCalls, 3u);
+}
+
+TEST(SpriteBatch, skips_sprites_without_texture) {
+    FakeGpu gpu;
+    SpriteBatch batch(gpu.submit(), SOLID);
+    Rectangle rect{0.f, 0.f, 8.f, 8.f};
+
+    batch.draw(0, Texture2D{}, rect, rect, {0.f, 0.f}, 0.f, WHITE);
+    batch.flush();
+
+    EXPECT_TRUE(gpu.runs.empty());
+    EXPECT_EQ(batch.stats().drawCalls, 0u);
+}
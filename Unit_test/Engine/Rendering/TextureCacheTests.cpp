@@ -0,0 +1,187 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** TextureCacheTests.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include "TextureCache.hpp"
+
+using rendering::TextureCache;
+using rendering::TextureHandle;
+
+namespace {
+    /** Stands in for the GPU: hands out ids, remembers which are still uploaded. */
+    struct FakeGpu {
+        unsigned int nextId{1};
+        std::size_t fileLoads{0};
+        std::size_t imageLoads{0};
+        std::map<unsigned int, int> uploaded;
+
+        rendering::TextureBackend backend() {
+            return {
+                [this](const std::string &path) {
+                    ++fileLoads;
+                    if (path.find("missing") != std::string::npos)
+                        return Texture2D{};
+                    return upload(16, 16);
+                },
+                [this](const Image &image) {
+                    ++imageLoads;
+                    return upload(image.width, image.height);
+                },
+                [this](Texture2D texture) { uploaded.erase(texture.id); },
+            };
+        }
+
+        Texture2D upload(int width, int height) {
+            Texture2D texture{nextId++, width, height, 1, 7};
+            uploaded[texture.id] = width * height;
+            return texture;
+        }
+    };
+
+    constexpr std::size_t SPRITE_BYTES = 16 * 16 * 4;
+}
+
+TEST(TextureCache, shares_one_load_between_handles) {
+    FakeGpu gpu;
+    TextureCache cache(gpu.backend());
+
+    TextureHandle a = cache.acquire("/assets/sprites/r-typesheet19.png");
+    TextureHandle b = cache.acquire("/assets/sprites/r-typesheet19.png");
+    TextureHandle c = b;
+
+    EXPECT_EQ(gpu.fileLoads, 1u);
+    EXPECT_EQ(a->id, b->id);
+    EXPECT_EQ(c->id, a->id);
+    EXPECT_EQ(cache.stats().loads, 1u);
+    EXPECT_EQ(cache.stats().hits, 1u);
+    EXPECT_EQ(cache.stats().bytes, SPRITE_BYTES);
+}
+
+TEST(TextureCache, normalizes_paths_to_one_key) {
+    FakeGpu gpu;
+    TextureCache cache(gpu.backend());
+
+    TextureHandle a = cache.acquire("/assets/sprites/r-typesheet1.png");
+    TextureHandle b = cache.acquire("/assets/sprites/../sprites/./r-typesheet1.png");
+    TextureHandle c = cache.acquire("/assets//sprites/r-typesheet1.png");
+
+    EXPECT_EQ(gpu.fileLoads, 1u);
+    EXPECT_EQ(a.path(), "/assets/sprites/r-typesheet1.png");
+    EXPECT_EQ(c.path(), a.path());
+}
+
+TEST(TextureCache, keeps_released_textures_until_over_budget) {
+    FakeGpu gpu;
+    TextureCache cache(gpu.backend(), 2 * SPRITE_BYTES);
+
+    cache.acquire("/a.png");
+    cache.acquire("/b.png");
+    EXPECT_EQ(gpu.uploaded.size(), 2u);
+    EXPECT_EQ(cache.stats().unused, 2u);
+
+    TextureHandle a = cache.acquire("/a.png");
+    EXPECT_EQ(gpu.fileLoads, 2u);
+
+    // A third unused texture pushes out the oldest unused one, b.
+    cache.acquire("/c.png");
+    cache.acquire("/d.png");
+    EXPECT_TRUE(cache.contains("/a.png"));
+    EXPECT_FALSE(cache.contains("/b.png"));
+    EXPECT_TRUE(cache.contains("/c.png"));
+    EXPECT_TRUE(cache.contains("/d.png"));
+    EXPECT_EQ(cache.stats().evictions, 1u);
+    EXPECT_EQ(cache.stats().unusedBytes, 2 * SPRITE_BYTES);
+}
+
+TEST(TextureCache, trim_unloads_only_unused_textures) {
+    FakeGpu gpu;
+    TextureCache cache(gpu.backend());
+
+    TextureHandle kept = cache.acquire("/kept.png");
+    cache.acquire("/dropped.png");
+    cache.trim();
+
+    EXPECT_EQ(gpu.uploaded.size(), 1u);
+    EXPECT_TRUE(gpu.uploaded.count(kept->id));
+    EXPECT_EQ(cache.stats().resident, 1u);
+    EXPECT_EQ(cache.stats().unused, 0u);
+}
+
+TEST(TextureCache, remembers_failed_loads) {
+    FakeGpu gpu;
+    TextureCache cache(gpu.backend());
+
+    TextureHandle a = cache.acquire("/missing.png");
+    TextureHandle b = cache.acquire("/missing.png");
+
+    EXPECT_FALSE(a);
+    EXPECT_EQ(b->id, 0u);
+    EXPECT_EQ(gpu.fileLoads, 1u);
+    EXPECT_EQ(cache.stats().bytes, 0u);
+}
+
+TEST(TextureCache, uploads_a_decoded_image_once) {
+    FakeGpu gpu;
+    TextureCache cache(gpu.backend());
+    Image image{nullptr, 32, 8, 1, 7};
+
+    TextureHandle a = cache.acquire("/skin.png", image);
+    TextureHandle b = cache.acquire("/skin.png", image);
+    TextureHandle c = cache.acquire("/skin.png");
+
+    EXPECT_EQ(gpu.imageLoads, 1u);
+    EXPECT_EQ(gpu.fileLoads, 0u);
+    EXPECT_EQ(c->width, 32);
+    EXPECT_EQ(cache.stats().bytes, 32u * 8u * 4u);
+}
+
+TEST(TextureCache, clear_unloads_everything_and_handles_survive) {
+    FakeGpu gpu;
+    TextureCache cache(gpu.backend());
+
+    TextureHandle held = cache.acquire("/held.png");
+    cache.acquire("/unused.png");
+    cache.clear();
+
+    EXPECT_TRUE(gpu.uploaded.empty());
+    EXPECT_EQ(held->id, 0u);
+    EXPECT_EQ(cache.stats().resident, 0u);
+    EXPECT_EQ(cache.stats().bytes, 0u);
+
+    TextureHandle again = cache.acquire("/held.png");
+    EXPECT_NE(again->id, 0u);
+    EXPECT_NE(held->id, 0u);
+    EXPECT_EQ(cache.stats().resident, 1u);
+
+    held.reset();
+    again.reset();
+    EXPECT_EQ(cache.stats().unused, 1u);
+}
+
+TEST(TextureHandle, empty_handle_reads_as_no_texture) {
+    TextureHandle handle;
+
+    EXPECT_FALSE(handle);
+    EXPECT_EQ(handle->id, 0u);
+    EXPECT_TRUE(handle.path().empty());
+}
+
+TEST(TextureHandle, move_leaves_the_source_empty) {
+    FakeGpu gpu;
+    TextureCache cache(gpu.backend());
+
+    TextureHandle a = cache.acquire("/a.png");
+    TextureHandle b = std::move(a);
+    EXPECT_FALSE(a);
+    EXPECT_TRUE(b);
+    EXPECT_EQ(cache.stats().unused, 0u);
+
+    b = TextureHandle();
+    EXPECT_EQ(cache.stats().unused, 1u);
+}
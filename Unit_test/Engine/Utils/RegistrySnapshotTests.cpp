@@ -0,0 +1,173 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** RegistrySnapshotTests.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include "registry_snapshot.hpp"
+#include "hitbox.hpp"
+#include "enemy.hpp"
+#include "registry.hpp"
+
+using namespace ecs;
+using namespace game::serializer;
+
+namespace {
+    /** A server-like registry: two enemies sharing a sprite, one player with its hitbox. */
+    registry make_level() {
+        registry reg;
+        reg.register_component<component::position>();
+        reg.register_component<component::previous_position>();
+        reg.register_component<component::velocity>();
+        reg.register_component<component::health>();
+        reg.register_component<component::type>();
+        reg.register_component<component::collision_box>();
+        reg.register_component<component::pattern_element>();
+        reg.register_component<component::drawable>();
+        reg.register_component<component::sprite>();
+        reg.register_component<component::client_id>();
+        reg.register_component<component::hitbox_link>();
+
+        game::entities::create_enemy(reg, 100.f, 200.f, 0.f, "sprites/enemy.png", 33.f, 28.f, "", "spiral", 3, 0.4f);
+        game::entities::create_enemy(reg, 300.f, 400.f, 0.f, "sprites/enemy.png", 33.f, 28.f, "", "wave", 1, 0.2f);
+        entity_t player = reg.spawn_entity();
+        reg.emplace_component<component::position>(player, 10.f, 20.f, 0.f);
+        reg.emplace_component<component::type>(player, component::entity_type::PLAYER);
+        reg.emplace_component<component::client_id>(player, 7u);
+        reg.emplace_component<component::drawable>(player, 50.f, 30.f, 10.f, Color{1, 2, 3, 4});
+        game::entities::create_hitbox_for(reg, player);
+        // Untyped and unlinked: not part of what the client rebuilds.
+        entity_t scratch = reg.spawn_entity();
+        reg.emplace_component<component::position>(scratch, 1.f, 1.f, 1.f);
+        return reg;
+    }
+}
+
+TEST(RegistrySnapshot, round_trip_keeps_every_field) {
+    registry reg = make_level();
+    std::vector<uint8_t> bytes = encode_snapshot(reg);
+    auto snapshot = decode_snapshot(bytes.data(), bytes.size());
+    ASSERT_TRUE(snapshot.has_value());
+    ASSERT_EQ(snapshot->entities.size(), 4u);
+
+    const SnapshotEntity &enemy = snapshot->entities[0];
+    EXPECT_EQ(enemy.entity_id, 0u);
+    EXPECT_TRUE(enemy.has(SnapshotComponent::sprite));
+    EXPECT_FALSE(enemy.has(SnapshotComponent::client_id));
+    EXPECT_EQ(enemy.type.value, component::entity_type::ENEMY);
+    EXPECT_FLOAT_EQ(enemy.position.y, 200.f);
+    EXPECT_FLOAT_EQ(enemy.velocity.vx, -40.f);
+    EXPECT_EQ(enemy.health.current, 3);
+    EXPECT_EQ(enemy.sprite.image_path, "sprites/enemy.png");
+    EXPECT_EQ(enemy.pattern_element.pattern_name, "spiral");
+    EXPECT_EQ(snapshot->entities[1].pattern_element.pattern_name, "wave");
+
+    const SnapshotEntity &player = snapshot->entities[2];
+    EXPECT_EQ(player.client_id.id, 7u);
+    EXPECT_EQ(player.drawable.color.b, 3);
+    EXPECT_EQ(player.mask, snapshot_bit(SnapshotComponent::type) | snapshot_bit(SnapshotComponent::position)
+        | snapshot_bit(SnapshotComponent::drawable) | snapshot_bit(SnapshotComponent::client_id));
+
+    const SnapshotEntity &hitbox = snapshot->entities[3];
+    EXPECT_FALSE(hitbox.has(SnapshotComponent::type));
+    EXPECT_EQ(hitbox.hitbox_link.owner.value(), player.entity_id);
+    EXPECT_FLOAT_EQ(hitbox.collision_box.width, 50.f);
+}
+
+TEST(RegistrySnapshot, asset_paths_are_written_once) {
+    registry reg = make_level();
+    std::vector<uint8_t> bytes = encode_snapshot(reg);
+    std::string text(bytes.begin(), bytes.end());
+    std::string path = "sprites/enemy.png";
+    auto first = text.find(path);
+    ASSERT_NE(first, std::string::npos);
+    EXPECT_EQ(text.find(path, first + 1), std::string::npos);
+}
+
+TEST(RegistrySnapshot, restore_rebuilds_entities_and_hitbox_owners) {
+    registry server = make_level();
+    std::vector<uint8_t> bytes = encode_snapshot(server);
+    auto snapshot = decode_snapshot(bytes.data(), bytes.size());
+    ASSERT_TRUE(snapshot.has_value());
+
+    registry client;
+    client.spawn_entity();
+    restore_snapshot(client, *snapshot);
+    ASSERT_EQ(client.alive_entities().size(), 5u);
+
+    auto &types = client.get_components<component::type>();
+    auto &links = client.get_components<component::hitbox_link>();
+    auto &sprites = client.get_components<component::sprite>();
+    ASSERT_TRUE(types[3].has_value());
+    EXPECT_EQ(types[3]->value, component::entity_type::PLAYER);
+    ASSERT_TRUE(sprites[1].has_value());
+    EXPECT_EQ(sprites[1]->image_path, std::string(ASSETS_PATH) + "/sprites/enemy.png");
+    ASSERT_TRUE(links[4].has_value());
+    EXPECT_EQ(links[4]->owner.value(), 3u);
+}
+
+TEST(RegistrySnapshot, restore_maps_the_server_asset_paths_onto_ours) {
+    const std::string serverAssets = "/home/server/r-type/build/assets";
+    registry server;
+    server.register_component<component::sprite>();
+    server.register_component<component::model3D>();
+    server.register_component<component::audio>();
+    server.register_component<component::font>();
+    server.register_component<component::type>();
+    entity_t e = server.spawn_entity();
+    server.emplace_component<component::type>(e, component::entity_type::BACKGROUND);
+    server.emplace_component<component::sprite>(e, serverAssets + "/sprites/r-typesheet1.png");
+    server.emplace_component<component::model3D>(e, serverAssets + "/models/ship.obj");
+    server.emplace_component<component::audio>(e, serverAssets + "/sounds/shoot.wav", 0.5f, true, true);
+    server.emplace_component<component::font>(e, serverAssets + "/fonts/PressStart2P.ttf");
+
+    std::vector<uint8_t> bytes = encode_snapshot(server);
+    auto snapshot = decode_snapshot(bytes.data(), bytes.size());
+    ASSERT_TRUE(snapshot.has_value());
+    registry client;
+    restore_snapshot(client, *snapshot);
+
+    const std::string ours = ASSETS_PATH;
+    ASSERT_TRUE(client.get_components<component::sprite>()[0].has_value());
+    EXPECT_EQ(client.get_components<component::sprite>()[0]->image_path, ours + "/sprites/r-typesheet1.png");
+    EXPECT_EQ(client.get_components<component::model3D>()[0]->model_path, ours + "/models/ship.obj");
+    EXPECT_EQ(client.get_components<component::audio>()[0]->sound_path, ours + "/sounds/shoot.wav");
+    EXPECT_EQ(client.get_components<component::audio>()[0]->volume, 0.5f);
+    EXPECT_EQ(client.get_components<component::font>()[0]->font_path, ours + "/fonts/PressStart2P.ttf");
+    EXPECT_TRUE(std::filesystem::exists(client.get_components<component::audio>()[0]->sound_path));
+
+    // Paths that already exist here are kept as they are.
+    RegistrySnapshot local = *snapshot;
+    local.entities[0].sprite.image_path = ours + "/sprites/r-typesheet1.png";
+    registry again;
+    restore_snapshot(again, local);
+    EXPECT_EQ(again.get_components<component::sprite>()[0]->image_path, ours + "/sprites/r-typesheet1.png");
+}
+
+TEST(RegistrySnapshot, corrupt_buffers_are_rejected) {
+    registry reg = make_level();
+    std::vector<uint8_t> bytes = encode_snapshot(reg);
+
+    for (std::size_t size = 0; size < bytes.size(); ++size)
+        EXPECT_FALSE(decode_snapshot(bytes.data(), size).has_value()) << "truncated to " << size;
+
+    std::vector<uint8_t> otherVersion = bytes;
+    otherVersion[4] = SNAPSHOT_VERSION + 1;
+    EXPECT_FALSE(decode_snapshot(otherVersion.data(), otherVersion.size()).has_value());
+
+    std::vector<uint8_t> unknownComponent = bytes;
+    unknownComponent[16 + 4] = 0x80;
+    EXPECT_FALSE(decode_snapshot(unknownComponent.data(), unknownComponent.size()).has_value());
+}
+
+TEST(RegistrySnapshot, empty_registry_round_trips) {
+    registry reg;
+    std::vector<uint8_t> bytes = encode_snapshot(reg);
+    auto snapshot = decode_snapshot(bytes.data(), bytes.size());
+    ASSERT_TRUE(snapshot.has_value());
+    EXPECT_TRUE(snapshot->entities.empty());
+}
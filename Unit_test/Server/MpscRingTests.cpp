@@ -0,0 +1,122 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_mpsc_ring.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "MpscRing.hpp"
+
+TEST(MpscRing, capacity_rounds_up_to_power_of_two) {
+    MpscRing<int> ring(100);
+    EXPECT_EQ(ring.capacity(), 128u);
+}
+
+TEST(MpscRing, pops_in_push_order) {
+    MpscRing<int> ring(8);
+    for (int i = 0; i < 5; ++i) {
+        int value = i;
+        ASSERT_TRUE(ring.try_push(value));
+    }
+    int out = -1;
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(ring.try_pop(out));
+        EXPECT_EQ(out, i);
+    }
+    EXPECT_FALSE(ring.try_pop(out));
+}
+
+TEST(MpscRing, rejects_push_when_full) {
+    MpscRing<int> ring(4);
+    for (int i = 0; i < 4; ++i) {
+        int value = i;
+        ASSERT_TRUE(ring.try_push(value));
+    }
+    int extra = 42;
+    EXPECT_FALSE(ring.try_push(extra));
+    EXPECT_EQ(extra, 42);
+
+    int out = 0;
+    ASSERT_TRUE(ring.try_pop(out));
+    EXPECT_TRUE(ring.try_push(extra));
+}
+
+TEST(MpscRing, size_counts_queued_values) {
+    MpscRing<int> ring(4);
+    EXPECT_EQ(ring.size(), 0u);
+    for (int i = 0; i < 4; ++i) {
+        int value = i;
+        ASSERT_TRUE(ring.try_push(value));
+    }
+    int extra = 4;
+    EXPECT_FALSE(ring.try_push(extra));
+    EXPECT_EQ(ring.size(), 4u);
+
+    int out = 0;
+    ASSERT_TRUE(ring.try_pop(out));
+    EXPECT_EQ(ring.size(), 3u);
+}
+
+TEST(MpscRing, recycles_buffers_instead_of_copying) {
+    MpscRing<std::vector<uint8_t>> ring(2);
+    std::vector<uint8_t> sent(64, 7);
+    const uint8_t *storage = sent.data();
+    ASSERT_TRUE(ring.try_push(sent));
+    EXPECT_TRUE(sent.empty());
+
+    std::vector<uint8_t> received;
+    received.reserve(128);
+    const uint8_t *spare = received.data();
+    ASSERT_TRUE(ring.try_pop(received));
+    EXPECT_EQ(received.data(), storage);
+    EXPECT_EQ(received.size(), 64u);
+
+    // The consumer's old buffer is what the next producer gets back.
+    std::vector<uint8_t> next(1, 1);
+    ASSERT_TRUE(ring.try_push(next));
+    ASSERT_TRUE(ring.try_pop(received));
+    std::vector<uint8_t> again(1, 2);
+    ASSERT_TRUE(ring.try_push(again));
+    ASSERT_TRUE(ring.try_push(next));
+    EXPECT_TRUE(again.data() == spare || next.data() == spare);
+}
+
+TEST(MpscRing, keeps_per_producer_order_under_contention) {
+    constexpr uint32_t PRODUCERS = 4;
+    constexpr uint32_t PER_PRODUCER = 20000;
+    MpscRing<uint32_t> ring(64);
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&ring, p] {
+            for (uint32_t i = 0; i < PER_PRODUCER; ++i) {
+                uint32_t value = (p << 24) | i;
+                while (!ring.try_push(value))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<uint32_t> next(PRODUCERS, 0);
+    uint32_t received = 0;
+    while (received < PRODUCERS * PER_PRODUCER) {
+        uint32_t value = 0;
+        if (!ring.try_pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        uint32_t producer = value >> 24;
+        ASSERT_LT(producer, PRODUCERS);
+        ASSERT_EQ(value & 0xFFFFFF, next[producer]);
+        ++next[producer];
+        ++received;
+    }
+    for (auto &thread : producers)
+        thread.join();
+    uint32_t value = 0;
+    EXPECT_FALSE(ring.try_pop(value));
+}
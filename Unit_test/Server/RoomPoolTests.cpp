@@ -0,0 +1,248 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_room_pool.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RoomPool.hpp"
+#include "IServerGame.hpp"
+
+using namespace std::chrono_literals;
+
+namespace {
+    /**
+     * @brief Order in which the pool called the fake games.
+     */
+    class EventLog {
+        public:
+            void add(std::string event) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _events.push_back(std::move(event));
+            }
+
+            std::vector<std::string> events() const {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _events;
+            }
+
+        private:
+            mutable std::mutex _mutex;
+            std::vector<std::string> _events;
+    };
+
+    /**
+     * @brief IServerGame counting the calls it gets, failing when told to.
+     */
+    class FakeGame : public IServerGame {
+        public:
+            explicit FakeGame(std::string name = "game", EventLog *log = nullptr)
+                : _name(std::move(name)), _log(log),
+                  _profiler(std::make_shared<metrics::TickProfiler>(std::vector<std::string>{"tick"})) {}
+
+            void start(int roomId) override {
+                room = roomId;
+                starts.fetch_add(1);
+                if (_log)
+                    _log->add(_name + ".start");
+            }
+
+            bool tick(float dt) override {
+                uint32_t n = ticks.fetch_add(1) + 1;
+                lastDt.store(dt);
+                if (_log)
+                    _log->add(_name + ".tick");
+                if (onTick)
+                    onTick(n);
+                if (throwAtTick == n)
+                    throw std::runtime_error("tick failed");
+                inTick.store(false);
+                return n != stopAtTick;
+            }
+
+            void stop() override {}
+            void enqueuePacket(UDP_socket::Datagram &) override {}
+            void setInitialClients(const std::map<uint32_t, bool> &) override {}
+            std::shared_ptr<metrics::TickProfiler> getProfiler() const override { return _profiler; }
+
+            std::atomic<int> room{-1};
+            std::atomic<uint32_t> starts{0};
+            std::atomic<uint32_t> ticks{0};
+            std::atomic<float> lastDt{0.f};
+            std::atomic<bool> inTick{false};
+            uint32_t stopAtTick{0};                 ///< Tick returning false, 0 for never.
+            uint32_t throwAtTick{0};                ///< Tick throwing, 0 for never.
+            std::function<void(uint32_t)> onTick;   ///< Called by every tick with its number.
+
+        private:
+            std::string _name;
+            EventLog *_log;
+            std::shared_ptr<metrics::TickProfiler> _profiler;
+    };
+
+    /**
+     * @brief Poll a condition until it holds or a generous timeout expires.
+     */
+    bool eventually(const std::function<bool()> &condition, std::chrono::milliseconds timeout = 3s) {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!condition()) {
+            if (std::chrono::steady_clock::now() >= deadline)
+                return false;
+            std::this_thread::sleep_for(1ms);
+        }
+        return true;
+    }
+}
+
+TEST(RoomPool, starts_once_then_ticks_at_the_tick_rate) {
+    RoomPool pool(1, 100);
+    auto game = std::make_shared<FakeGame>();
+    auto begin = std::chrono::steady_clock::now();
+    pool.add(game, 7);
+
+    ASSERT_TRUE(eventually([&] { return game->ticks.load() >= 20; }));
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+
+    EXPECT_EQ(game->starts.load(), 1u);
+    EXPECT_EQ(game->room.load(), 7);
+    EXPECT_FLOAT_EQ(game->lastDt.load(), 1.f / 100);
+    EXPECT_EQ(pool.getGameCount(), 1u);
+    // The first tick is due right after start(), then one every 10 ms: never ahead of the clock.
+    EXPECT_LE(game->ticks.load(), std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() / 10 + 2);
+}
+
+TEST(RoomPool, runs_the_earliest_deadline_first) {
+    EventLog log;
+    RoomPool pool(1, 10);
+    auto a = std::make_shared<FakeGame>("a", &log);
+    auto b = std::make_shared<FakeGame>("b", &log);
+    auto c = std::make_shared<FakeGame>("c", &log);
+
+    // a ticks every 100 ms; b and c join in between and must not wait for a's next tick.
+    pool.add(a, 1);
+    std::this_thread::sleep_for(25ms);
+    pool.add(b, 2);
+    std::this_thread::sleep_for(25ms);
+    pool.add(c, 3);
+    ASSERT_TRUE(eventually([&] { return c->ticks.load() >= 2; }));
+
+    std::vector<std::string> events = log.events();
+    events.resize(9);
+    EXPECT_EQ(events, (std::vector<std::string>{
+        "a.start", "a.tick", "b.start", "b.tick", "c.start", "c.tick", "a.tick", "b.tick", "c.tick"}));
+}
+
+TEST(RoomPool, catches_up_back_to_back_after_a_slow_tick) {
+    auto pool = std::make_unique<RoomPool>(1, 100);
+    auto game = std::make_shared<FakeGame>();
+    std::vector<std::chrono::steady_clock::time_point> times;
+    game->onTick = [&](uint32_t n) {
+        times.push_back(std::chrono::steady_clock::now());
+        if (n == 3)
+            std::this_thread::sleep_for(35ms);
+    };
+    pool->add(game, 1);
+    ASSERT_TRUE(eventually([&] { return game->ticks.load() >= 10; }));
+    pool.reset();
+
+    // Ticks 4 to 6 were due during the stall of tick 3 and run right after it.
+    ASSERT_GE(times.size(), 6u);
+    EXPECT_GE(times[3] - times[2], 35ms);
+    EXPECT_LT(times[4] - times[3], 5ms);
+    EXPECT_LT(times[5] - times[4], 5ms);
+    EXPECT_FLOAT_EQ(game->lastDt.load(), 1.f / 100);
+    EXPECT_EQ(game->getProfiler()->collect().skippedTicks, 0u);
+}
+
+TEST(RoomPool, skips_ticks_after_a_stall_longer_than_the_catch_up) {
+    RoomPool pool(1, 100);
+    auto game = std::make_shared<FakeGame>();
+    std::atomic<uint32_t> stalledAt{0};
+    game->onTick = [&](uint32_t n) {
+        if (n == 2) {
+            std::this_thread::sleep_for(10ms * (timing::MAX_CATCH_UP_TICKS + 10));
+            stalledAt.store(n);
+        }
+    };
+    pool.add(game, 1);
+    ASSERT_TRUE(eventually([&] { return game->ticks.load() >= 2 + timing::MAX_CATCH_UP_TICKS + 3; }));
+
+    EXPECT_EQ(stalledAt.load(), 2u);
+    EXPECT_GT(game->getProfiler()->collect().skippedTicks, 0u);
+}
+
+TEST(RoomPool, releases_a_game_whose_tick_returns_false) {
+    RoomPool pool(1, 100);
+    auto game = std::make_shared<FakeGame>();
+    game->stopAtTick = 20;
+    pool.add(game, 4);
+    EXPECT_EQ(pool.getProfilers().count(4), 1u);
+
+    ASSERT_TRUE(eventually([&] { return pool.getGameCount() == 0; }));
+    EXPECT_EQ(game.use_count(), 1);
+    EXPECT_TRUE(pool.getProfilers().empty());
+    std::this_thread::sleep_for(30ms);
+    EXPECT_EQ(game->ticks.load(), 20u);
+}
+
+TEST(RoomPool, releases_a_game_whose_tick_throws_and_keeps_the_others) {
+    RoomPool pool(1, 100);
+    auto failing = std::make_shared<FakeGame>();
+    auto healthy = std::make_shared<FakeGame>();
+    failing->throwAtTick = 2;
+    pool.add(failing, 1);
+    pool.add(healthy, 2);
+
+    ASSERT_TRUE(eventually([&] { return pool.getGameCount() == 1; }));
+    uint32_t failedTicks = failing->ticks.load();
+    uint32_t before = healthy->ticks.load();
+    ASSERT_TRUE(eventually([&] { return healthy->ticks.load() >= before + 5; }));
+
+    EXPECT_EQ(failedTicks, 2u);
+    EXPECT_EQ(failing->ticks.load(), 2u);
+    EXPECT_EQ(failing.use_count(), 1);
+    auto profilers = pool.getProfilers();
+    EXPECT_EQ(profilers.count(1), 0u);
+    EXPECT_EQ(profilers.count(2), 1u);
+}
+
+TEST(RoomPool, shutdown_finishes_running_ticks_and_drops_pending_games) {
+    std::vector<std::shared_ptr<FakeGame>> games;
+    std::vector<std::weak_ptr<FakeGame>> watched;
+    for (int i = 0; i < 6; ++i) {
+        games.push_back(std::make_shared<FakeGame>());
+        watched.push_back(games.back());
+    }
+    auto slow = games.front();
+    slow->onTick = [&](uint32_t) {
+        slow->inTick.store(true);
+        std::this_thread::sleep_for(30ms);
+    };
+
+    {
+        RoomPool pool(2, 100);
+        for (std::size_t i = 0; i < games.size(); ++i)
+            pool.add(games[i], static_cast<int>(i));
+        games.clear();
+        ASSERT_TRUE(eventually([&] { return slow->inTick.load(); }));
+    }
+    // The tick in progress completed before the destructor returned.
+    EXPECT_FALSE(slow->inTick.load());
+
+    uint32_t ticks = slow->ticks.load();
+    std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(slow->ticks.load(), ticks);
+    slow.reset();
+    for (auto const &game : watched)
+        EXPECT_TRUE(game.expired());
+}
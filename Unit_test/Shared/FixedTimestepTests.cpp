@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_fixed_timestep.cpp
+*/
+
+#include <gtest/gtest.h>
+#include "FixedTimestep.hpp"
+
+using timing::Clock;
+using timing::FixedTimestep;
+using namespace std::chrono_literals;
+
+namespace {
+    const Clock::time_point START{10s};
+}
+
+TEST(FixedTimestep, only_30_60_and_120_hz_are_supported) {
+    EXPECT_TRUE(timing::isSupportedTickRate(30));
+    EXPECT_TRUE(timing::isSupportedTickRate(60));
+    EXPECT_TRUE(timing::isSupportedTickRate(120));
+    EXPECT_FALSE(timing::isSupportedTickRate(0));
+    EXPECT_FALSE(timing::isSupportedTickRate(61));
+}
+
+TEST(FixedTimestep, dt_is_the_tick_period) {
+    EXPECT_FLOAT_EQ(FixedTimestep(30).dt(), 1.f / 30);
+    EXPECT_FLOAT_EQ(FixedTimestep(60).dt(), 1.f / 60);
+    EXPECT_FLOAT_EQ(FixedTimestep(120).dt(), 1.f / 120);
+}
+
+TEST(FixedTimestep, first_tick_is_due_at_reset) {
+    FixedTimestep clock(60);
+    clock.reset(START);
+    EXPECT_EQ(clock.nextDeadline(), START);
+    EXPECT_EQ(clock.advance(START), 1u);
+    EXPECT_EQ(clock.advance(START), 0u);
+    EXPECT_GT(clock.nextDeadline(), START);
+}
+
+TEST(FixedTimestep, ticks_become_due_at_their_deadline) {
+    FixedTimestep clock(60);
+    clock.reset(START);
+    clock.advance(START);
+    for (int i = 0; i < 200; ++i) {
+        Clock::time_point deadline = clock.nextDeadline();
+        EXPECT_EQ(clock.advance(deadline - 1ns), 0u);
+        EXPECT_EQ(clock.advance(deadline), 1u);
+    }
+}
+
+TEST(FixedTimestep, deadlines_do_not_drift) {
+    // 1 / 60 s is not a whole number of nanoseconds: adding a rounded period
+    // each tick would drift, deadlines computed from the start do not.
+    FixedTimestep clock(60);
+    clock.reset(START);
+    while (clock.ticks() < 60 * 60)
+        clock.advance(clock.nextDeadline());
+    EXPECT_EQ(clock.nextDeadline(), START + 60s);
+}
+
+TEST(FixedTimestep, late_wake_up_runs_the_missed_ticks) {
+    FixedTimestep clock(60, 5);
+    clock.reset(START);
+    clock.advance(START);
+    // 50 ms late: ticks at 16.7, 33.3 and 50 ms are due.
+    EXPECT_EQ(clock.advance(START + 50ms), 3u);
+    EXPECT_EQ(clock.skippedTicks(), 0u);
+    EXPECT_EQ(clock.ticks(), 4u);
+}
+
+TEST(FixedTimestep, catch_up_is_bounded) {
+    FixedTimestep clock(60, 5);
+    clock.reset(START);
+    clock.advance(START);
+    EXPECT_EQ(clock.advance(START + 1s), 5u);
+    EXPECT_EQ(clock.skippedTicks(), 55u);
+    // The schedule moved on: the next tick is one period after the stall, not 55 ticks back.
+    EXPECT_GT(clock.nextDeadline(), START + 1s);
+    EXPECT_LE(clock.nextDeadline(), START + 1s + 17ms);
+}
@@ -0,0 +1,128 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_interpolation.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "Interpolation.hpp"
+
+using snapshot::EntityKind;
+using snapshot::EntityState;
+using snapshot::InterpolationBuffer;
+using snapshot::TICK_SECONDS;
+
+namespace {
+    constexpr double TRANSIT = 0.05;
+    constexpr double DELAY = 0.1;
+
+    snapshot::WorldState enemyAt(float x, uint32_t id = 1)
+    {
+        return {snapshot::quantize({EntityKind::Enemy, id, x, 100.f, 0.f, 0.f, 0.f, 0.f})};
+    }
+
+    void push(InterpolationBuffer &buffer, uint32_t tick, float x)
+    {
+        ASSERT_TRUE(buffer.push(tick, enemyAt(x), tick * TICK_SECONDS + TRANSIT));
+    }
+
+    /** Local time at which the buffer renders the given server time. */
+    double renderingAt(double serverTime)
+    {
+        return serverTime + TRANSIT + DELAY;
+    }
+}
+
+TEST(Interpolation, empty_buffer_samples_nothing) {
+    InterpolationBuffer buffer(DELAY, 0.25);
+    std::vector<EntityState> out{{EntityKind::Player, 1, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f}};
+    buffer.sample(1.0, out);
+    EXPECT_TRUE(out.empty());
+}
+
+TEST(Interpolation, server_time_follows_the_announced_tick_rate) {
+    constexpr double TICK_30HZ = 1.0 / 30;
+    InterpolationBuffer buffer(DELAY, 0.25);
+    buffer.setTickRate(30);
+    ASSERT_TRUE(buffer.push(10, enemyAt(100.f), 10 * TICK_30HZ + TRANSIT));
+    ASSERT_TRUE(buffer.push(11, enemyAt(110.f), 11 * TICK_30HZ + TRANSIT));
+
+    std::vector<EntityState> out;
+    buffer.sample(renderingAt(10.5 * TICK_30HZ), out);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_NEAR(out[0].x, 105.f, 0.01f);
+}
+
+TEST(Interpolation, blends_between_bracketing_snapshots) {
+    InterpolationBuffer buffer(DELAY, 0.25);
+    push(buffer, 10, 100.f);
+    push(buffer, 11, 110.f);
+    push(buffer, 12, 130.f);
+
+    std::vector<EntityState> out;
+    buffer.sample(renderingAt(10.5 * TICK_SECONDS), out);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_NEAR(out[0].x, 105.f, 0.01f);
+    EXPECT_FLOAT_EQ(out[0].y, 100.f);
+
+    buffer.sample(renderingAt(11.5 * TICK_SECONDS), out);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_NEAR(out[0].x, 120.f, 0.01f);
+}
+
+TEST(Interpolation, extrapolates_for_a_bounded_time) {
+    InterpolationBuffer buffer(DELAY, 2 * TICK_SECONDS);
+    push(buffer, 10, 100.f);
+    push(buffer, 11, 110.f);
+
+    std::vector<EntityState> out;
+    buffer.sample(renderingAt(12 * TICK_SECONDS), out);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_NEAR(out[0].x, 120.f, 0.01f);
+
+    buffer.sample(renderingAt(20 * TICK_SECONDS), out);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_NEAR(out[0].x, 130.f, 0.01f);
+}
+
+TEST(Interpolation, new_entities_appear_at_their_position) {
+    InterpolationBuffer buffer(DELAY, 0.25);
+    push(buffer, 10, 100.f);
+    snapshot::WorldState both = enemyAt(110.f);
+    both.push_back(enemyAt(500.f, 2)[0]);
+    ASSERT_TRUE(buffer.push(11, both, 11 * TICK_SECONDS + TRANSIT));
+
+    std::vector<EntityState> out;
+    buffer.sample(renderingAt(10.5 * TICK_SECONDS), out);
+    ASSERT_EQ(out.size(), 2u);
+    EXPECT_NEAR(out[0].x, 105.f, 0.01f);
+    EXPECT_EQ(out[1].id, 2u);
+    EXPECT_FLOAT_EQ(out[1].x, 500.f);
+}
+
+TEST(Interpolation, queue_full_drops_new_snapshots) {
+    InterpolationBuffer buffer(DELAY, 0.25);
+    for (uint32_t tick = 1; tick <= snapshot::FRAME_QUEUE_SIZE; ++tick)
+        push(buffer, tick, static_cast<float>(tick));
+    EXPECT_FALSE(buffer.push(100, enemyAt(0.f), 1.0));
+
+    std::vector<EntityState> out;
+    buffer.sample(renderingAt(1 * TICK_SECONDS), out);
+    EXPECT_TRUE(buffer.push(100, enemyAt(0.f), 100 * TICK_SECONDS + TRANSIT));
+}
+
+TEST(Interpolation, restarts_when_ticks_go_back) {
+    InterpolationBuffer buffer(DELAY, 0.25);
+    push(buffer, 500, 100.f);
+    push(buffer, 501, 110.f);
+    std::vector<EntityState> out;
+    buffer.sample(renderingAt(500 * TICK_SECONDS), out);
+
+    // A new game restarts server ticks at 1, on a new clock offset.
+    ASSERT_TRUE(buffer.push(1, enemyAt(7.f), 10.0));
+    buffer.sample(10.0 + DELAY, out);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_FLOAT_EQ(out[0].x, 7.f);
+}
@@ -0,0 +1,168 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_logger.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Logger.hpp"
+
+namespace {
+    constexpr int64_t SECOND = 1'000'000'000;
+
+    logging::Record makeRecord(logging::Level level, const std::string &text) {
+        logging::Record record;
+        record.time = 42;
+        record.file = "Shared/Logger.cpp";
+        record.line = 7;
+        record.thread = 3;
+        record.level = level;
+        record.size = static_cast<uint16_t>(text.size());
+        std::memcpy(record.text.data(), text.data(), text.size());
+        return record;
+    }
+
+    std::vector<std::string> readLines(const std::string &path) {
+        std::ifstream file(path);
+        std::vector<std::string> lines;
+        for (std::string line; std::getline(file, line);)
+            lines.push_back(line);
+        return lines;
+    }
+
+    /** Sends the output to a fresh file for the test, and back to the console after. */
+    class LogFile {
+        public:
+            explicit LogFile(const std::string &name, logging::Format format = logging::Format::Text)
+                : _path(testing::TempDir() + name) {
+                std::remove(_path.c_str());
+                logging::configure({format, logging::Level::Debug, _path});
+            }
+            ~LogFile() {
+                logging::flush();
+                logging::configure({});
+                std::remove(_path.c_str());
+            }
+            const std::string &path() const { return _path; }
+
+        private:
+            std::string _path;
+    };
+}
+
+TEST(Logger, rate_limit_lets_a_burst_through_then_drops) {
+    logging::RateLimit limit;
+    uint32_t suppressed = 0;
+    uint32_t allowed = 0;
+    for (uint32_t i = 0; i < logging::RATE_LIMIT * 3; ++i)
+        allowed += limit.allow(SECOND + i, suppressed) ? 1 : 0;
+    EXPECT_EQ(allowed, logging::RATE_LIMIT);
+    EXPECT_EQ(suppressed, 0u);
+}
+
+TEST(Logger, rate_limit_reports_drops_in_the_next_window) {
+    logging::RateLimit limit;
+    uint32_t suppressed = 0;
+    for (uint32_t i = 0; i < logging::RATE_LIMIT + 10; ++i)
+        limit.allow(SECOND, suppressed);
+
+    EXPECT_FALSE(limit.allow(SECOND + SECOND / 2, suppressed));
+    ASSERT_TRUE(limit.allow(2 * SECOND, suppressed));
+    EXPECT_EQ(suppressed, 11u);
+    ASSERT_TRUE(limit.allow(2 * SECOND + 1, suppressed));
+}
+
+TEST(Logger, text_keeps_the_level_tag) {
+    auto record = makeRecord(logging::Level::Warn, "Room 3 is full");
+    EXPECT_EQ(logging::formatText(record, false), "[WARN] Room 3 is full\n");
+
+    record.tagged = false;
+    EXPECT_EQ(logging::formatText(record, false), "Room 3 is full\n");
+
+    record.tagged = true;
+    record.suppressed = 12;
+    EXPECT_EQ(logging::formatText(record, false), "[WARN] Room 3 is full (12 similar messages suppressed)\n");
+}
+
+TEST(Logger, json_escapes_the_message) {
+    auto record = makeRecord(logging::Level::Error, "bad \"name\"\n\x1b[0m\\");
+    EXPECT_EQ(logging::formatJson(record),
+              "{\"time\":42,\"level\":\"error\",\"thread\":3,\"file\":\"Shared/Logger.cpp\",\"line\":7,"
+              "\"message\":\"bad \\\"name\\\"\\n\\u001b[0m\\\\\"}\n");
+}
+
+TEST(Logger, binary_record_round_trips) {
+    auto record = makeRecord(logging::Level::Info, "hello");
+    std::string out = logging::formatBinary(record);
+
+    logging::BinaryHeader header;
+    ASSERT_EQ(out.size(), sizeof(header) + std::strlen(record.file) + 5);
+    std::memcpy(&header, out.data(), sizeof(header));
+    EXPECT_EQ(header.time, 42);
+    EXPECT_EQ(header.line, 7u);
+    EXPECT_EQ(header.level, static_cast<uint8_t>(logging::Level::Info));
+    EXPECT_EQ(out.substr(sizeof(header), header.fileSize), "Shared/Logger.cpp");
+    EXPECT_EQ(out.substr(sizeof(header) + header.fileSize), "hello");
+}
+
+TEST(Logger, macros_write_through_the_writer_thread) {
+    LogFile log("logger_macros.log");
+    LOG_INFO("player " << 7 << " joined");
+    LOG("plain " << 1.5);
+    logging::flush();
+
+    auto lines = readLines(log.path());
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], "[INFO] player 7 joined");
+    EXPECT_EQ(lines[1], "plain 1.5");
+}
+
+TEST(Logger, long_messages_are_truncated) {
+    LogFile log("logger_truncated.log");
+    LOG_INFO(std::string(logging::MAX_MESSAGE_SIZE * 2, 'x'));
+    logging::flush();
+
+    auto lines = readLines(log.path());
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], "[INFO] " + std::string(logging::MAX_MESSAGE_SIZE, 'x'));
+}
+
+TEST(Logger, every_message_is_written_or_counted_as_dropped) {
+    LogFile log("logger_threads.log", logging::Format::Json);
+    constexpr int THREADS = 4;
+    constexpr int MESSAGES = static_cast<int>(logging::RING_CAPACITY) * 4;
+    uint64_t droppedBefore = logging::droppedCount();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([t] {
+            // Straight to the ring, past the rate limit of a call site.
+            for (int i = 0; i < MESSAGES; ++i) {
+                logging::begin() << t << ':' << i;
+                logging::commit(logging::Level::Debug, __FILE__, __LINE__, true, 0);
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    logging::flush();
+
+    auto lines = readLines(log.path());
+    std::size_t messages = 0;
+    std::set<std::string> seen;
+    for (const auto &line : lines) {
+        if (line.find("\"level\":\"debug\"") == std::string::npos)
+            continue;
+        ++messages;
+        seen.insert(line.substr(line.find("\"message\":")));
+    }
+    EXPECT_EQ(seen.size(), messages);
+    EXPECT_EQ(messages + (logging::droppedCount() - droppedBefore), static_cast<std::size_t>(THREADS * MESSAGES));
+}
@@ -0,0 +1,114 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_player_movement.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "PlayerMovement.hpp"
+
+using movement::Box;
+using movement::Predictor;
+
+namespace {
+    constexpr float STEP = movement::PLAYER_SPEED * movement::STEP_SECONDS;
+    const std::vector<Box> NO_OBSTACLES;
+}
+
+TEST(PlayerMovement, step_moves_each_held_axis) {
+    float x = 100.f;
+    float y = 100.f;
+    movement::step(x, y, movement::Right | movement::Up, [](float, float) { return false; });
+    EXPECT_FLOAT_EQ(x, 100.f + STEP);
+    EXPECT_FLOAT_EQ(y, 100.f - STEP);
+
+    movement::step(x, y, movement::Left | movement::Right, [](float, float) { return false; });
+    EXPECT_FLOAT_EQ(x, 100.f + STEP);
+}
+
+TEST(PlayerMovement, blocked_axis_slides_along_obstacle) {
+    std::vector<Box> wall{{100.f + 15.f + 10.f + STEP / 2.f, 100.f, 20.f, 200.f}};
+    float x = 100.f;
+    float y = 100.f;
+    movement::step(x, y, movement::Right | movement::Down,
+        [&](float px, float py) { return movement::is_blocked(px, py, wall); });
+    EXPECT_FLOAT_EQ(x, 100.f);
+    EXPECT_FLOAT_EQ(y, 100.f + STEP);
+}
+
+TEST(PlayerMovement, reconcile_replays_unacked_commands) {
+    Predictor predictor;
+    predictor.seed(0.f, 0.f);
+    uint32_t first = predictor.apply(movement::Right, NO_OBSTACLES);
+    predictor.apply(movement::Right, NO_OBSTACLES);
+    predictor.apply(movement::Down, NO_OBSTACLES);
+
+    // The server applied the first command from a slightly different position.
+    predictor.reconcile(first, 10.f, 0.f, NO_OBSTACLES);
+    EXPECT_FLOAT_EQ(predictor.x(), 10.f + STEP);
+    EXPECT_FLOAT_EQ(predictor.y(), STEP);
+
+    uint8_t buttons[4];
+    uint32_t newest = 0;
+    ASSERT_EQ(predictor.unacked(newest, buttons, 4), 2u);
+    EXPECT_EQ(newest, first + 2);
+    EXPECT_EQ(buttons[0], movement::Down);
+    EXPECT_EQ(buttons[1], movement::Right);
+}
+
+TEST(PlayerMovement, older_ack_is_ignored) {
+    Predictor predictor;
+    predictor.seed(0.f, 0.f);
+    uint32_t first = predictor.apply(movement::Right, NO_OBSTACLES);
+    uint32_t second = predictor.apply(movement::Right, NO_OBSTACLES);
+
+    predictor.reconcile(second, 2 * STEP, 0.f, NO_OBSTACLES);
+    predictor.reconcile(first, STEP, 0.f, NO_OBSTACLES);
+    EXPECT_FLOAT_EQ(predictor.x(), 2 * STEP);
+    EXPECT_FALSE(predictor.has_unacked());
+}
+
+TEST(PlayerMovement, seed_does_not_override_prediction) {
+    Predictor predictor;
+    EXPECT_FALSE(predictor.has_position());
+    predictor.seed(5.f, 5.f);
+    predictor.apply(movement::Left, NO_OBSTACLES);
+    predictor.seed(5.f, 5.f);
+    EXPECT_FLOAT_EQ(predictor.x(), 5.f - STEP);
+
+    predictor.reset();
+    EXPECT_FALSE(predictor.has_position());
+    EXPECT_FALSE(predictor.has_unacked());
+}
+
+TEST(PlayerMovement, commands_per_tick_follows_the_tick_rate) {
+    EXPECT_EQ(movement::commands_per_tick(1.f / 120.f), 2u);
+    EXPECT_EQ(movement::commands_per_tick(1.f / 60.f), 3u);
+    EXPECT_EQ(movement::commands_per_tick(1.f / 30.f), 4u);
+    EXPECT_EQ(movement::commands_per_tick(movement::STEP_SECONDS), 2u);
+}
+
+TEST(PlayerMovement, server_at_30hz_keeps_up_with_a_held_direction) {
+    const float tick = 1.f / 30.f;
+    const std::size_t perTick = movement::commands_per_tick(tick);
+    float produced = 0.f;
+    std::size_t queued = 0;
+    std::size_t largest = 0;
+
+    // Ten seconds of a client sending one command per STEP_SECONDS.
+    for (int t = 0; t < 300; ++t) {
+        produced += tick / movement::STEP_SECONDS;
+        while (produced >= 1.f) {
+            produced -= 1.f;
+            ++queued;
+        }
+        largest = std::max(largest, queued);
+        queued -= std::min(queued, perTick);
+    }
+    EXPECT_LE(largest, perTick);
+    EXPECT_EQ(queued, 0u);
+}
@@ -0,0 +1,222 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_reliable_channel.cpp
+*/
+
+#include <chrono>
+#include <deque>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "ReliableChannel.hpp"
+
+using reliable::Channel;
+using reliable::Connection;
+
+namespace {
+    using Packets = std::vector<std::vector<uint8_t>>;
+
+    Packets flushed(Connection &from, Connection::Clock::time_point now)
+    {
+        Packets packets;
+        from.flush(now, [&](const uint8_t *data, std::size_t size) { packets.emplace_back(data, data + size); });
+        return packets;
+    }
+
+    void deliver(Connection &to, const Packets &packets, Connection::Clock::time_point now)
+    {
+        for (const auto &packet : packets)
+            ASSERT_TRUE(to.on_packet(now, packet.data(), packet.size()));
+    }
+
+    std::vector<std::string> received(Connection &connection, Channel expected)
+    {
+        std::vector<std::string> messages;
+        Channel channel;
+        std::vector<uint8_t> message;
+        while (connection.receive(channel, message)) {
+            EXPECT_EQ(channel, expected);
+            messages.emplace_back(message.begin(), message.end());
+        }
+        return messages;
+    }
+
+    void send(Connection &connection, Channel channel, const std::string &message)
+    {
+        ASSERT_TRUE(connection.send(channel, message.data(), message.size()));
+    }
+}
+
+TEST(ReliableChannel, message_is_delivered_and_acked) {
+    Connection server(7);
+    Connection client(7);
+    auto now = Connection::Clock::now();
+
+    send(server, Channel::Events, "spawn");
+    deliver(client, flushed(server, now), now);
+    EXPECT_EQ(received(client, Channel::Events), std::vector<std::string>{"spawn"});
+    EXPECT_TRUE(server.has_unacked());
+
+    Packets acks = flushed(client, now);
+    ASSERT_EQ(acks.size(), 1u);
+    deliver(server, acks, now);
+    EXPECT_FALSE(server.has_unacked());
+    EXPECT_TRUE(flushed(server, now + reliable::MAX_RESEND_TIMEOUT).empty());
+}
+
+TEST(ReliableChannel, large_message_is_fragmented_within_window) {
+    Connection server(1);
+    Connection client(1);
+    auto now = Connection::Clock::now();
+    std::string registry(reliable::MAX_FRAGMENT_SIZE * 40 + 17, 'r');
+    for (std::size_t i = 0; i < registry.size(); ++i)
+        registry[i] = static_cast<char>('a' + i % 26);
+
+    send(server, Channel::Registry, registry);
+    Packets first = flushed(server, now);
+    EXPECT_EQ(first.size(), reliable::WINDOW_SIZE);
+    for (const auto &packet : first)
+        EXPECT_LE(packet.size(), reliable::MAX_PACKET_SIZE);
+    deliver(client, first, now);
+    EXPECT_TRUE(received(client, Channel::Registry).empty());
+
+    deliver(server, flushed(client, now), now);
+    Packets rest = flushed(server, now);
+    EXPECT_EQ(rest.size(), 41u - reliable::WINDOW_SIZE);
+    deliver(client, rest, now);
+    EXPECT_EQ(received(client, Channel::Registry), std::vector<std::string>{registry});
+}
+
+TEST(ReliableChannel, lost_fragments_are_resent_and_order_kept) {
+    Connection server(1);
+    Connection client(1);
+    auto now = Connection::Clock::now();
+
+    send(server, Channel::Events, "first");
+    send(server, Channel::Events, "second");
+    send(server, Channel::Events, "third");
+    Packets packets = flushed(server, now);
+    ASSERT_EQ(packets.size(), 3u);
+
+    // "first" is lost: the others wait for it and are acked through the bitfield.
+    deliver(client, {packets[2], packets[1]}, now);
+    EXPECT_TRUE(received(client, Channel::Events).empty());
+    deliver(server, flushed(client, now), now);
+    EXPECT_TRUE(flushed(server, now).empty());
+
+    Packets resent = flushed(server, now + server.resend_timeout());
+    ASSERT_EQ(resent.size(), 1u);
+    deliver(client, resent, now);
+    EXPECT_EQ(received(client, Channel::Events), (std::vector<std::string>{"first", "second", "third"}));
+}
+
+TEST(ReliableChannel, no_spurious_resend_on_a_100ms_round_trip) {
+    using namespace std::chrono_literals;
+    struct InFlight {
+        Connection::Clock::time_point arrival;
+        Connection *to;
+        std::vector<uint8_t> packet;
+    };
+    constexpr auto ONE_WAY = 50ms;
+    constexpr std::size_t LEVEL_FRAGMENTS = 100;
+    Connection server(1);
+    Connection client(1);
+    auto start = Connection::Clock::now();
+    std::deque<InFlight> wire;
+    std::size_t fragmentsSent = 0;
+    std::string level(reliable::MAX_FRAGMENT_SIZE * LEVEL_FRAGMENTS, 'l');
+
+    // Four level loads, one per second. The server flushes every 10 ms, the
+    // client acks on its 20 ms frame, so round trips land in [100, 130) ms.
+    for (int ms = 0; ms <= 5000; ms += 5) {
+        auto now = start + std::chrono::milliseconds(ms);
+        if (ms % 1000 == 0 && ms < 4000)
+            send(server, Channel::Registry, level);
+        while (!wire.empty() && wire.front().arrival <= now) {
+            deliver(*wire.front().to, {wire.front().packet}, now);
+            wire.pop_front();
+        }
+        if (ms % 10 == 0) {
+            server.flush(now, [&](const uint8_t *data, std::size_t size) {
+                fragmentsSent += size > reliable::HEADER_SIZE;
+                wire.push_back({now + ONE_WAY, &client, {data, data + size}});
+            });
+        }
+        if (ms % 20 == 0) {
+            client.flush(now, [&](const uint8_t *data, std::size_t size) {
+                wire.push_back({now + ONE_WAY, &server, {data, data + size}});
+            });
+        }
+    }
+
+    EXPECT_FALSE(server.has_unacked());
+    EXPECT_EQ(received(client, Channel::Registry).size(), 4u);
+    EXPECT_EQ(fragmentsSent, 4 * LEVEL_FRAGMENTS);
+    EXPECT_GT(server.resend_timeout(), 100ms);
+}
+
+TEST(ReliableChannel, resend_timeout_backs_off_when_acks_stop) {
+    Connection server(1);
+    auto now = Connection::Clock::now();
+
+    send(server, Channel::Events, "lost");
+    ASSERT_EQ(flushed(server, now).size(), 1u);
+    EXPECT_EQ(server.resend_timeout(), reliable::INITIAL_RESEND_TIMEOUT);
+
+    now += reliable::INITIAL_RESEND_TIMEOUT;
+    ASSERT_EQ(flushed(server, now).size(), 1u);
+    EXPECT_EQ(server.resend_timeout(), 2 * reliable::INITIAL_RESEND_TIMEOUT);
+    EXPECT_TRUE(flushed(server, now + reliable::INITIAL_RESEND_TIMEOUT).empty());
+
+    for (int i = 0; i < 8; ++i) {
+        now += server.resend_timeout();
+        flushed(server, now);
+    }
+    EXPECT_EQ(server.resend_timeout(), reliable::MAX_RESEND_TIMEOUT);
+}
+
+TEST(ReliableChannel, duplicate_is_delivered_once_and_acked_again) {
+    Connection server(1);
+    Connection client(1);
+    auto now = Connection::Clock::now();
+
+    send(server, Channel::Events, "death");
+    Packets packets = flushed(server, now);
+    deliver(client, packets, now);
+    flushed(client, now);
+    deliver(client, packets, now);
+    EXPECT_EQ(received(client, Channel::Events), std::vector<std::string>{"death"});
+
+    // The first ack was lost; the duplicate makes the client ack again.
+    deliver(server, flushed(client, now), now);
+    EXPECT_FALSE(server.has_unacked());
+}
+
+TEST(ReliableChannel, channels_do_not_block_each_other) {
+    Connection server(1);
+    Connection client(1);
+    auto now = Connection::Clock::now();
+
+    send(server, Channel::Registry, "{}");
+    Packets registry = flushed(server, now);
+    send(server, Channel::Events, "despawn");
+    deliver(client, flushed(server, now), now);
+    EXPECT_EQ(received(client, Channel::Events), std::vector<std::string>{"despawn"});
+
+    deliver(client, registry, now);
+    EXPECT_EQ(received(client, Channel::Registry), std::vector<std::string>{"{}"});
+}
+
+TEST(ReliableChannel, malformed_datagram_is_rejected) {
+    Connection client(1);
+    std::vector<uint8_t> tooShort(reliable::HEADER_SIZE - 1, 0);
+    tooShort[0] = static_cast<uint8_t>(MessageType::Reliable);
+    EXPECT_FALSE(client.on_packet(Connection::Clock::now(), tooShort.data(), tooShort.size()));
+
+    std::vector<uint8_t> badChannel(reliable::HEADER_SIZE, 0);
+    badChannel[0] = static_cast<uint8_t>(MessageType::Reliable);
+    badChannel[1] = static_cast<uint8_t>(reliable::CHANNEL_COUNT);
+    EXPECT_FALSE(client.on_packet(Connection::Clock::now(), badChannel.data(), badChannel.size()));
+}
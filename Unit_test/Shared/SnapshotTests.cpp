@@ -0,0 +1,203 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_snapshot.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "Snapshot.hpp"
+
+using snapshot::EntityKind;
+using snapshot::EntityState;
+using snapshot::RecordDelta;
+using snapshot::SnapshotReceiver;
+using snapshot::SnapshotWriter;
+using snapshot::WorldState;
+
+namespace {
+    WorldState world(const std::vector<EntityState> &states)
+    {
+        WorldState out;
+        for (const auto &state : states)
+            out.push_back(snapshot::quantize(state));
+        snapshot::sortWorld(out);
+        return out;
+    }
+
+    EntityState enemy(uint32_t id, float x, float y, float vx = -50.f)
+    {
+        return {EntityKind::Enemy, id, x, y, 0.f, vx, 0.f, 0.f};
+    }
+
+    std::size_t totalSize(const std::vector<std::vector<uint8_t>> &chunks)
+    {
+        std::size_t size = 0;
+        for (const auto &chunk : chunks)
+            size += chunk.size();
+        return size;
+    }
+}
+
+TEST(Snapshot, quantize_round_trip) {
+    EntityState state{EntityKind::Obstacle, 3, 100.03f, -20.5f, 1.f, -1.5f, 0.25f, 0.0625f};
+    EntityState back = snapshot::dequantize(snapshot::quantize(state));
+    EXPECT_EQ(back.kind, EntityKind::Obstacle);
+    EXPECT_EQ(back.id, 3u);
+    EXPECT_NEAR(back.x, 100.03f, 0.5f / snapshot::POSITION_SCALE);
+    EXPECT_FLOAT_EQ(back.y, -20.5f);
+    EXPECT_FLOAT_EQ(back.vx, -1.5f);
+    EXPECT_FLOAT_EQ(back.vz, 0.0625f);
+}
+
+TEST(Snapshot, full_snapshot_round_trip) {
+    WorldState current = world({
+        {EntityKind::Player, 1, 10.f, 20.f, 0.f, 0.f, 0.f, 0.f},
+        enemy(7, 1.5f, -2.5f),
+        {EntityKind::EnemyProjectile, 0x00100003, 8.f, 9.f, 0.f, 0.f, 0.f, 0.f},
+    });
+    SnapshotWriter writer;
+    const auto &chunks = writer.encode(42, current, 0, nullptr);
+    ASSERT_EQ(chunks.size(), 1u);
+
+    SnapshotChunkHeader header{};
+    std::vector<RecordDelta> records;
+    ASSERT_TRUE(snapshot::decodeChunk(chunks[0].data(), chunks[0].size(), header, records));
+    EXPECT_EQ(header.tick, 42u);
+    EXPECT_EQ(header.baselineTick, 0u);
+    EXPECT_EQ(header.chunkCount, 1u);
+    ASSERT_EQ(records.size(), 3u);
+
+    std::vector<EntityState> updated;
+    SnapshotReceiver receiver;
+    EXPECT_EQ(receiver.receive(chunks[0].data(), chunks[0].size(), updated), SnapshotReceiver::Result::Completed);
+    EXPECT_EQ(receiver.completedTick(), 42u);
+    ASSERT_EQ(updated.size(), 3u);
+    EXPECT_EQ(updated[0].kind, EntityKind::Player);
+    EXPECT_FLOAT_EQ(updated[0].y, 20.f);
+    EXPECT_EQ(updated[1].id, 7u);
+    EXPECT_FLOAT_EQ(updated[1].vx, -50.f);
+    EXPECT_EQ(updated[2].id, 0x00100003u);
+}
+
+TEST(Snapshot, delta_sends_only_changes) {
+    std::vector<EntityState> states;
+    for (uint32_t i = 0; i < 50; ++i)
+        states.push_back(enemy(i, 1000.f + i * 10.f, 300.f));
+    WorldState baseline = world(states);
+    states[3].x -= 1.f;
+    states[9].y += 2.f;
+    WorldState current = world(states);
+
+    SnapshotWriter writer;
+    std::size_t fullSize = totalSize(writer.encode(2, current, 0, nullptr));
+    const auto &chunks = writer.encode(2, current, 1, &baseline);
+    ASSERT_EQ(chunks.size(), 1u);
+    EXPECT_LT(chunks[0].size() * 10, fullSize);
+
+    SnapshotChunkHeader header{};
+    std::vector<RecordDelta> records;
+    ASSERT_TRUE(snapshot::decodeChunk(chunks[0].data(), chunks[0].size(), header, records));
+    EXPECT_EQ(header.baselineTick, 1u);
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].id, 3u);
+    EXPECT_EQ(records[0].mask, 0x01);
+    EXPECT_EQ(records[0].deltas[0], -static_cast<int32_t>(snapshot::POSITION_SCALE));
+    EXPECT_EQ(records[1].id, 9u);
+    EXPECT_EQ(records[1].mask, 0x02);
+}
+
+TEST(Snapshot, receiver_applies_deltas_and_removals) {
+    SnapshotWriter writer;
+    SnapshotReceiver receiver;
+    std::vector<EntityState> updated;
+
+    WorldState first = world({enemy(1, 100.f, 100.f), enemy(2, 200.f, 200.f), enemy(3, 300.f, 300.f)});
+    for (const auto &chunk : writer.encode(1, first, 0, nullptr))
+        receiver.receive(chunk.data(), chunk.size(), updated);
+    ASSERT_EQ(receiver.completedTick(), 1u);
+
+    WorldState second = world({enemy(1, 99.f, 100.f), enemy(3, 300.f, 300.f), enemy(4, 400.f, 400.f)});
+    updated.clear();
+    for (const auto &chunk : writer.encode(2, second, 1, &first))
+        receiver.receive(chunk.data(), chunk.size(), updated);
+    ASSERT_EQ(receiver.completedTick(), 2u);
+    ASSERT_EQ(updated.size(), 2u);
+    EXPECT_EQ(updated[0].id, 1u);
+    EXPECT_FLOAT_EQ(updated[0].x, 99.f);
+    EXPECT_FLOAT_EQ(updated[0].vx, -50.f);
+    EXPECT_EQ(updated[1].id, 4u);
+
+    // Tick 2 is now a baseline: a delta against it holds only enemy 3's move.
+    WorldState third = world({enemy(1, 99.f, 100.f), enemy(3, 310.f, 300.f), enemy(4, 400.f, 400.f)});
+    const auto &chunks = writer.encode(3, third, 2, &second);
+    updated.clear();
+    ASSERT_EQ(receiver.receive(chunks[0].data(), chunks[0].size(), updated), SnapshotReceiver::Result::Completed);
+    ASSERT_EQ(updated.size(), 1u);
+    EXPECT_EQ(updated[0].id, 3u);
+    EXPECT_FLOAT_EQ(updated[0].x, 310.f);
+}
+
+TEST(Snapshot, splits_into_bounded_chunks) {
+    std::vector<EntityState> states;
+    for (uint32_t i = 0; i < 500; ++i)
+        states.push_back(enemy(i, static_cast<float>(i), 50.f));
+    WorldState current = world(states);
+
+    SnapshotWriter writer;
+    const auto &chunks = writer.encode(7, current, 0, nullptr);
+    ASSERT_GT(chunks.size(), 1u);
+
+    SnapshotReceiver receiver;
+    std::vector<EntityState> updated;
+    for (std::size_t i = chunks.size(); i-- > 0;) {
+        EXPECT_LE(chunks[i].size(), snapshot::MAX_DATAGRAM_SIZE);
+        auto result = receiver.receive(chunks[i].data(), chunks[i].size(), updated);
+        EXPECT_EQ(result, i == 0 ? SnapshotReceiver::Result::Completed : SnapshotReceiver::Result::Applied);
+    }
+    EXPECT_EQ(updated.size(), 500u);
+    EXPECT_EQ(receiver.completedTick(), 7u);
+}
+
+TEST(Snapshot, receiver_rejects_stale_and_unknown_baselines) {
+    SnapshotWriter writer;
+    SnapshotReceiver receiver;
+    std::vector<EntityState> updated;
+    WorldState state = world({enemy(1, 10.f, 10.f)});
+
+    std::vector<uint8_t> older = writer.encode(4, state, 0, nullptr)[0];
+    std::vector<uint8_t> newer = writer.encode(5, state, 0, nullptr)[0];
+    EXPECT_EQ(receiver.receive(newer.data(), newer.size(), updated), SnapshotReceiver::Result::Completed);
+    EXPECT_EQ(receiver.receive(older.data(), older.size(), updated), SnapshotReceiver::Result::Stale);
+    EXPECT_EQ(receiver.receive(newer.data(), newer.size(), updated), SnapshotReceiver::Result::Stale);
+
+    WorldState unknownBaseline = world({enemy(1, 0.f, 0.f)});
+    const auto &chunks = writer.encode(6, state, 3, &unknownBaseline);
+    EXPECT_EQ(receiver.receive(chunks[0].data(), chunks[0].size(), updated),
+              SnapshotReceiver::Result::MissingBaseline);
+    EXPECT_EQ(receiver.completedTick(), 5u);
+}
+
+TEST(Snapshot, rejects_malformed_chunks) {
+    SnapshotWriter writer;
+    WorldState current = world({{EntityKind::Element, 5, 1.f, 2.f, 3.f, 4.f, 5.f, 0.f}});
+    std::vector<uint8_t> chunk = writer.encode(3, current, 0, nullptr)[0];
+
+    SnapshotChunkHeader header{};
+    std::vector<RecordDelta> records;
+    EXPECT_FALSE(snapshot::decodeChunk(chunk.data(), 4, header, records));
+    EXPECT_FALSE(snapshot::decodeChunk(chunk.data(), chunk.size() - 1, header, records));
+
+    std::vector<uint8_t> badType = chunk;
+    badType[0] = static_cast<uint8_t>(MessageType::StateUpdate);
+    EXPECT_FALSE(snapshot::decodeChunk(badType.data(), badType.size(), header, records));
+
+    std::vector<uint8_t> badKind = chunk;
+    badKind[16] = 0x07;
+    EXPECT_FALSE(snapshot::decodeChunk(badKind.data(), badKind.size(), header, records));
+
+    std::vector<uint8_t> badIndex = chunk;
+    badIndex[3] = 1;
+    EXPECT_FALSE(snapshot::decodeChunk(badIndex.data(), badIndex.size(), header, records));
+}
@@ -0,0 +1,97 @@
+/*
+** EPITECH PROJECT, 2025
+** G-CPP-500-PAR-5-1-rtype-1
+** File description:
+** test_tick_profiler.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "TickProfiler.hpp"
+
+using metrics::Histogram;
+using metrics::TickProfiler;
+
+TEST(TickProfiler, buckets_keep_small_values_exact) {
+    for (uint64_t v = 0; v < Histogram::LINEAR_BUCKETS; ++v)
+        EXPECT_EQ(Histogram::bucketValue(Histogram::bucketOf(v)), v);
+}
+
+TEST(TickProfiler, buckets_are_within_an_eighth_of_the_value) {
+    for (uint64_t v : {16ull, 100ull, 1'000ull, 16'666'667ull, 1'000'000'000ull, ~0ull}) {
+        std::size_t bucket = Histogram::bucketOf(v);
+        ASSERT_LT(bucket, Histogram::BUCKET_COUNT);
+        double value = static_cast<double>(Histogram::bucketValue(bucket));
+        EXPECT_NEAR(value, static_cast<double>(v), static_cast<double>(v) / 8);
+    }
+}
+
+TEST(TickProfiler, percentiles_of_a_window) {
+    Histogram histogram;
+    for (uint64_t i = 1; i <= 100; ++i)
+        histogram.record(i * 1000);
+
+    metrics::Summary summary = histogram.collect();
+    EXPECT_EQ(summary.count, 100u);
+    EXPECT_EQ(summary.max, 100'000u);
+    EXPECT_EQ(summary.total, 5'050'000u);
+    EXPECT_NEAR(static_cast<double>(summary.p50), 50'000.0, 50'000.0 / 8);
+    EXPECT_NEAR(static_cast<double>(summary.p99), 99'000.0, 99'000.0 / 8);
+    EXPECT_LE(summary.p99, summary.max);
+}
+
+TEST(TickProfiler, collect_starts_a_new_window) {
+    Histogram histogram;
+    histogram.record(5'000'000);
+    histogram.collect();
+    histogram.record(1'000);
+
+    metrics::Summary summary = histogram.collect();
+    EXPECT_EQ(summary.count, 1u);
+    EXPECT_EQ(summary.max, 1'000u);
+    EXPECT_EQ(histogram.collect().count, 0u);
+}
+
+TEST(TickProfiler, no_value_is_lost_while_collecting) {
+    Histogram histogram;
+    constexpr uint64_t RECORDS = 200'000;
+    std::thread writer([&] {
+        for (uint64_t i = 0; i < RECORDS; ++i)
+            histogram.record(i % 5000);
+    });
+    uint64_t counted = 0;
+    for (int i = 0; i < 100; ++i)
+        counted += histogram.collect().count;
+    writer.join();
+    counted += histogram.collect().count;
+    EXPECT_EQ(counted, RECORDS);
+}
+
+TEST(TickProfiler, phases_counters_and_gauges_are_reported_and_reset) {
+    TickProfiler profiler({"messages", "update"});
+    {
+        metrics::PhaseTimer timer(profiler);
+        timer.lap(0);
+        timer.lap(1);
+    }
+    profiler.packetsIn.add(3);
+    profiler.bytesIn.add(120);
+    profiler.pendingPackets.sample(4);
+    profiler.pendingPackets.sample(2);
+
+    metrics::TickReport report = profiler.collect();
+    ASSERT_EQ(report.phases.size(), 2u);
+    EXPECT_EQ(report.phases[0].first, "messages");
+    EXPECT_EQ(report.phases[0].second.count, 1u);
+    EXPECT_EQ(report.phases[1].first, "update");
+    EXPECT_EQ(report.phases[1].second.count, 1u);
+    EXPECT_EQ(report.packetsIn, 3u);
+    EXPECT_EQ(report.bytesIn, 120u);
+    EXPECT_EQ(report.pendingPackets, 4u);
+
+    report = profiler.collect();
+    EXPECT_EQ(report.phases[0].second.count, 0u);
+    EXPECT_EQ(report.packetsIn, 0u);
+    EXPECT_EQ(report.pendingPackets, 0u);
+}
@@ -0,0 +1,102 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** TripleBufferTests.cpp
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "TripleBuffer.hpp"
+
+TEST(TripleBuffer, reader_sees_nothing_before_a_publish) {
+    TripleBuffer<int> buffer;
+
+    buffer.back() = 42;
+    EXPECT_FALSE(buffer.fresh());
+    EXPECT_EQ(buffer.read(), 0);
+}
+
+TEST(TripleBuffer, reader_gets_the_latest_publish) {
+    TripleBuffer<int> buffer;
+
+    buffer.back() = 1;
+    buffer.publish();
+    buffer.back() = 2;
+    buffer.publish();
+    EXPECT_TRUE(buffer.fresh());
+    EXPECT_EQ(buffer.read(), 2);
+    EXPECT_FALSE(buffer.fresh());
+    EXPECT_EQ(buffer.read(), 2);
+}
+
+TEST(TripleBuffer, writer_keeps_editing_from_the_published_state) {
+    TripleBuffer<std::unordered_map<int, int>> buffer;
+
+    buffer.back()[1] = 10;
+    buffer.publish();
+    EXPECT_EQ(buffer.back().at(1), 10);
+
+    buffer.back()[2] = 20;
+    buffer.back().erase(1);
+    buffer.publish();
+
+    const auto &state = buffer.read();
+    EXPECT_EQ(state.size(), 1u);
+    EXPECT_EQ(state.at(2), 20);
+}
+
+TEST(TripleBuffer, read_reference_survives_publishes) {
+    TripleBuffer<int> buffer;
+
+    buffer.back() = 1;
+    buffer.publish();
+    const int &frame = buffer.read();
+    for (int i = 2; i < 10; ++i) {
+        buffer.back() = i;
+        buffer.publish();
+    }
+    EXPECT_EQ(frame, 1);
+    EXPECT_EQ(buffer.read(), 9);
+}
+
+TEST(TripleBuffer, reader_never_sees_a_half_written_version) {
+    struct Pair {
+        std::vector<int> values;
+        int sum{0};
+    };
+    TripleBuffer<Pair> buffer;
+    constexpr int VERSIONS = 5000;
+    std::atomic<bool> done{false};
+
+    std::thread writer([&]() {
+        for (int version = 1; version <= VERSIONS; ++version) {
+            Pair &pair = buffer.back();
+            pair.values.push_back(version);
+            pair.sum += version;
+            buffer.publish();
+        }
+        done = true;
+    });
+
+    int lastSize = 0;
+    bool consistent = true;
+    bool monotonic = true;
+    while (!done.load() || buffer.fresh()) {
+        const Pair &pair = buffer.read();
+        int sum = 0;
+        for (int value : pair.values)
+            sum += value;
+        consistent = consistent && sum == pair.sum;
+        monotonic = monotonic && static_cast<int>(pair.values.size()) >= lastSize;
+        lastSize = static_cast<int>(pair.values.size());
+    }
+    writer.join();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_TRUE(monotonic);
+    EXPECT_EQ(buffer.read().values.size(), static_cast<std::size_t>(VERSIONS));
+}